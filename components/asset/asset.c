@@ -0,0 +1,150 @@
+// https://docs.espressif.com/projects/esp-idf/en/stable/esp32/api-reference/storage/partition.html
+
+#include <inttypes.h>
+#include <string.h>
+
+#include "esp_log.h"
+#include "esp_partition.h"
+#include "esp_rom_crc.h"
+
+#include "sound.h"
+#include "asset.h"
+
+#define MAGIC "SNDA"
+#define HEADER_SZ 16
+
+static const char *TAG = "asset";
+
+static const uint8_t *image; // mapped image
+static uint32_t count;
+static esp_partition_mmap_handle_t map_handle;
+
+// Read a little-endian value from the image.
+static uint32_t rd_le(const uint8_t *p, uint32_t n)
+{
+	uint32_t v = 0;
+	while (n--) v = (v << 8) | p[n];
+	return v;
+}
+
+// Map the asset image and check its header and index.
+// label: partition label, or NULL for ASSET_PARTITION.
+// Return zero if successful, or non-zero otherwise.
+int32_t asset_init(const char *label)
+{
+	uint8_t hdr[HEADER_SZ];
+	const void *ptr;
+
+	if (image != NULL) asset_deinit();
+	if (label == NULL) label = ASSET_PARTITION;
+	const esp_partition_t *part = esp_partition_find_first(
+		ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label);
+	if (part == NULL) {
+		ESP_LOGE(TAG, "No partition %s", label);
+		return -1;
+	}
+	// Check the header before mapping only the image, not the partition
+	if (esp_partition_read(part, 0, hdr, sizeof(hdr)) != ESP_OK ||
+		memcmp(hdr, MAGIC, 4) || rd_le(hdr+4, 2) != ASSET_VERSION) {
+		ESP_LOGE(TAG, "No asset image in %s", label);
+		return -1;
+	}
+	uint32_t n = rd_le(hdr+6, 2);
+	uint32_t size = rd_le(hdr+8, 4);
+	uint32_t index_sz = n * ASSET_ENTRY_SZ;
+	if (size > part->size || size < HEADER_SZ + index_sz) {
+		ESP_LOGE(TAG, "Bad image size %"PRIu32, size);
+		return -1;
+	}
+	if (esp_partition_mmap(part, 0, size, ESP_PARTITION_MMAP_DATA,
+		&ptr, &map_handle) != ESP_OK) {
+		ESP_LOGE(TAG, "Map failed");
+		return -1;
+	}
+	const uint8_t *p = ptr;
+	if (esp_rom_crc32_le(0, p + HEADER_SZ, index_sz) != rd_le(hdr+12, 4)) {
+		ESP_LOGE(TAG, "Bad index CRC");
+		esp_partition_munmap(map_handle);
+		return -1;
+	}
+	for (uint32_t i = 0; i < n; i++) {
+		const uint8_t *e = p + HEADER_SZ + i*ASSET_ENTRY_SZ;
+		uint32_t off = rd_le(e+24, 4), len = rd_le(e+28, 4);
+		uint32_t samples = rd_le(e+32, 4), fmt = e[38];
+		// ADPCM is in whole blocks, the decoder must not read past them
+		bool short_adpcm = fmt == ASSET_ADPCM &&
+			samples > len/SOUND_ADPCM_BLOCK*SOUND_ADPCM_BLOCK_SAMPLES;
+		if (e[ASSET_NAME_MAX] != '\0' || off > size || len > size - off ||
+			fmt >= ASSET_FMT_LAST || short_adpcm) {
+			ESP_LOGE(TAG, "Bad index entry %"PRIu32, i);
+			esp_partition_munmap(map_handle);
+			return -1;
+		}
+	}
+	image = p;
+	count = n;
+	ESP_LOGI(TAG, "%"PRIu32" clips, %"PRIu32" bytes", n, size);
+	return 0;
+}
+
+// Unmap the asset image. Stop any clips playing from it first.
+// Return zero if successful, or non-zero otherwise.
+int32_t asset_deinit(void)
+{
+	if (image == NULL) return -1;
+	esp_partition_munmap(map_handle);
+	image = NULL;
+	count = 0;
+	return 0;
+}
+
+// Return the number of clips in the image.
+uint32_t asset_count(void)
+{
+	return count;
+}
+
+// Get a clip by index.
+// idx: 0 to asset_count()-1.
+// asset: filled with the clip.
+// Return zero if successful, or non-zero otherwise.
+int32_t asset_get(uint32_t idx, asset_t *asset)
+{
+	if (image == NULL || idx >= count) return -1;
+	const uint8_t *e = image + HEADER_SZ + idx*ASSET_ENTRY_SZ;
+	asset->name = (const char *)e;
+	asset->data = image + rd_le(e+24, 4);
+	asset->size = rd_le(e+28, 4);
+	asset->samples = rd_le(e+32, 4);
+	asset->rate = rd_le(e+36, 2);
+	asset->fmt = e[38];
+	return 0;
+}
+
+// Get a clip by name, e.g. "powerUp48k".
+// name: name of the clip, the file name it was packed from less the
+// extension.
+// asset: filled with the clip.
+// Return zero if found, or non-zero otherwise.
+int32_t asset_find(const char *name, asset_t *asset)
+{
+	for (uint32_t i = 0; i < count; i++) {
+		const char *e = (const char *)(image + HEADER_SZ + i*ASSET_ENTRY_SZ);
+		if (!strncmp(e, name, ASSET_NAME_MAX+1)) return asset_get(i, asset);
+	}
+	return -1;
+}
+
+// Play a clip on a voice, in its own format and at its own rate
+// (see sound_play()).
+// asset: clip from asset_get() or asset_find().
+// vol: voice volume, 0-100% as an integer value.
+// prio: priority, higher wins when stealing voices.
+// loop: if true, play cyclically until stopped.
+// Return the voice number, or -1 if no voice was available.
+int32_t asset_play(const asset_t *asset, uint32_t vol, uint32_t prio, bool loop)
+{
+	if (asset->fmt == ASSET_ADPCM)
+		return sound_play_adpcm(asset->data, asset->samples, asset->rate, vol, prio, loop);
+	return sound_play(asset->data, asset->size, asset->rate, vol, prio, loop);
+}
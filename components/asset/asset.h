@@ -0,0 +1,80 @@
+#ifndef ASSET_H_
+#define ASSET_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// This component plays audio clips from an image in a flash data
+// partition, built by asset_pack.py and flashed on its own, so the clips
+// are not linked into (and reflashed with) every app. The partition is
+// memory mapped, and clips are handed to the sound component as pointers
+// into the mapping without a copy.
+//
+// Image format (multi-byte fields little-endian):
+//   magic   4 bytes  "SNDA"
+//   version 2 bytes  ASSET_VERSION
+//   count   2 bytes  number of clips
+//   size    4 bytes  image size in bytes
+//   crc     4 bytes  CRC-32 of the index
+//   index            count entries of ASSET_ENTRY_SZ bytes:
+//     name    24 bytes  NUL padded
+//     offset  4 bytes   from the image start, 4-byte aligned
+//     size    4 bytes   in bytes
+//     samples 4 bytes
+//     rate    2 bytes   Hz
+//     fmt     1 byte    asset_fmt_t
+//     pad     1 byte
+//   data             clips
+
+#define ASSET_PARTITION "storage" // label in partitions.csv
+#define ASSET_VERSION 1
+#define ASSET_NAME_MAX 23
+#define ASSET_ENTRY_SZ 40
+
+typedef enum {ASSET_PCM8, ASSET_ADPCM, ASSET_FMT_LAST} asset_fmt_t;
+
+// A clip in the mapped image
+typedef struct {
+	const char *name;
+	const uint8_t *data; // in flash, valid until asset_deinit()
+	uint32_t size; // in bytes
+	uint32_t samples;
+	uint32_t rate; // Hz
+	asset_fmt_t fmt;
+} asset_t;
+
+// Map the asset image and check its header and index.
+// label: partition label, or NULL for ASSET_PARTITION.
+// Return zero if successful, or non-zero otherwise.
+int32_t asset_init(const char *label);
+
+// Unmap the asset image. Stop any clips playing from it first.
+// Return zero if successful, or non-zero otherwise.
+int32_t asset_deinit(void);
+
+// Return the number of clips in the image.
+uint32_t asset_count(void);
+
+// Get a clip by index.
+// idx: 0 to asset_count()-1.
+// asset: filled with the clip.
+// Return zero if successful, or non-zero otherwise.
+int32_t asset_get(uint32_t idx, asset_t *asset);
+
+// Get a clip by name, e.g. "powerUp48k".
+// name: name of the clip, the file name it was packed from less the
+// extension.
+// asset: filled with the clip.
+// Return zero if found, or non-zero otherwise.
+int32_t asset_find(const char *name, asset_t *asset);
+
+// Play a clip on a voice, in its own format and at its own rate
+// (see sound_play()).
+// asset: clip from asset_get() or asset_find().
+// vol: voice volume, 0-100% as an integer value.
+// prio: priority, higher wins when stealing voices.
+// loop: if true, play cyclically until stopped.
+// Return the voice number, or -1 if no voice was available.
+int32_t asset_play(const asset_t *asset, uint32_t vol, uint32_t prio, bool loop);
+
+#endif /* ASSET_H_ */
@@ -0,0 +1,110 @@
+#!/usr/bin/python3
+
+"""
+Pack audio clips into an image for the flash data partition read by the
+asset component, so the clips are flashed once instead of being linked
+into every app build. Takes the asset arrays in components/audio (*.c,
+with the sample rate and format from the matching *.h) or WAV files
+(stored as 8-bit mono PCM).
+
+Image layout, little-endian:
+    header  "SNDA", version (u16), count (u16), image size (u32),
+            CRC-32 of the index (u32)
+    index   count entries of name (24 bytes, NUL padded), offset (u32,
+            from the image start), size in bytes (u32), samples (u32),
+            rate in Hz (u16), format (u8, 0 = 8-bit PCM, 1 = IMA-ADPCM), pad
+    data    clips, each on a 4-byte boundary
+
+Write the image to the partition with:
+    parttool.py -p PORT write_partition --partition-name storage --input assets.bin
+
+Examples:
+    ./asset_pack.py ../audio/*.c -o assets.bin
+    ./asset_pack.py ../audio/powerUp48kIma.c music.wav -o assets.bin
+"""
+
+import argparse
+import pathlib
+import re
+import struct
+import sys
+import wave
+import zlib
+
+MAGIC = b"SNDA"
+VERSION = 1
+HEADER = struct.Struct("<4sHHII")
+ENTRY = struct.Struct("<24sIIIHBx")
+NAME_MAX = 23
+FMT_PCM8, FMT_ADPCM = 0, 1
+PARTITION_SIZE = 0xF0000  # storage in lcd_test/partitions.csv
+
+
+def read_asset(path):
+    """Return (data, samples, rate, fmt) from an asset array and its header."""
+    text = path.read_text()
+    body = text[text.index("{") + 1 : text.rindex("}")]
+    data = bytes(int(v, 0) for v in re.findall(r"0x[0-9a-fA-F]+|\d+", body))
+    defs = {}
+    hdr = path.with_suffix(".h")
+    if hdr.is_file():
+        for m in re.finditer(r"#define\s+\w+?_(BITS_PER_SAMPLE|SAMPLE_RATE|SAMPLES)\s+(\d+)", hdr.read_text()):
+            defs[m.group(1)] = int(m.group(2))
+    fmt = FMT_ADPCM if defs.get("BITS_PER_SAMPLE") == 4 else FMT_PCM8
+    samples = defs.get("SAMPLES", len(data))
+    return data, samples, defs.get("SAMPLE_RATE", 48000), fmt
+
+
+def read_wav(path):
+    """Return (data, samples, rate, fmt) from a PCM WAV file as 8-bit mono."""
+    with wave.open(str(path), "rb") as w:
+        ch, width, rate = w.getnchannels(), w.getsampwidth(), w.getframerate()
+        raw = w.readframes(w.getnframes())
+    if width == 1:
+        vals = list(raw)
+    elif width == 2:
+        vals = [(v >> 8) + 0x80 for v in struct.unpack("<%dh" % (len(raw) // 2), raw)]
+    else:
+        sys.exit("%s: only 8 or 16-bit PCM" % path)
+    data = bytes(sum(vals[i : i + ch]) // ch for i in range(0, len(vals), ch))
+    return data, len(data), rate, FMT_PCM8
+
+
+def pack(clips):
+    """Return the image for a list of (name, data, samples, rate, fmt)."""
+    base = HEADER.size + ENTRY.size * len(clips)
+    index, blobs = bytearray(), bytearray()
+    for name, data, samples, rate, fmt in clips:
+        blobs += bytes(-(base + len(blobs)) % 4)
+        index += ENTRY.pack(name.encode(), base + len(blobs), len(data), samples, rate, fmt)
+        blobs += data
+    size = HEADER.size + len(index) + len(blobs)
+    return HEADER.pack(MAGIC, VERSION, len(clips), size, zlib.crc32(index)) + index + blobs
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("sources", nargs="+", help="asset .c files or WAV files")
+    parser.add_argument("-o", "--output", default="assets.bin", help="image file")
+    parser.add_argument("-s", "--size", type=lambda v: int(v, 0), default=PARTITION_SIZE, help="partition size")
+    args = parser.parse_args()
+
+    clips, names = [], set()
+    for src in map(pathlib.Path, args.sources):
+        name = src.stem
+        if len(name) > NAME_MAX or name in names:
+            sys.exit("%s: name too long or repeated" % src)
+        names.add(name)
+        data, samples, rate, fmt = read_wav(src) if src.suffix.lower() == ".wav" else read_asset(src)
+        clips.append((name, data, samples, rate, fmt))
+        print("%-24s %7d bytes %7d samples %5d Hz %s" % (name, len(data), samples, rate, "adpcm" if fmt else "pcm8"))
+
+    image = pack(clips)
+    if len(image) > args.size:
+        sys.exit("%d bytes does not fit the %d byte partition" % (len(image), args.size))
+    pathlib.Path(args.output).write_bytes(image)
+    print("%s: %d clips, %d bytes (%d%% of the partition)" % (args.output, len(clips), len(image), 100 * len(image) // args.size))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,10 @@
+// Host build: the ROM CRC, see sim_partition.c.
+#ifndef ESP_ROM_CRC_H_
+#define ESP_ROM_CRC_H_
+
+#include <stdint.h>
+
+// CRC-32 as zlib.crc32(), continued from crc.
+uint32_t esp_rom_crc32_le(uint32_t crc, const uint8_t *buf, uint32_t len);
+
+#endif /* ESP_ROM_CRC_H_ */
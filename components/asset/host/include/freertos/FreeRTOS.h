@@ -0,0 +1,9 @@
+// Host build: the subset of FreeRTOS used by sound.h.
+#ifndef FREERTOS_H_
+#define FREERTOS_H_
+
+#include <stdint.h>
+
+typedef uint32_t TickType_t;
+
+#endif /* FREERTOS_H_ */
@@ -0,0 +1,9 @@
+// Host build: only the task handle type.
+#ifndef TASK_H_
+#define TASK_H_
+
+#include "freertos/FreeRTOS.h"
+
+typedef void *TaskHandle_t;
+
+#endif /* TASK_H_ */
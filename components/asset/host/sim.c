@@ -0,0 +1,179 @@
+// Host test for the asset component. Runs asset.c against a partition
+// held in memory (sim_partition.c), loaded with an image packed by
+// asset_pack.py, and checks that clips are found and played as packed
+// and that damaged images are refused.
+//
+// Usage:
+//   asset_sim test image.bin
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "asset.h"
+#include "sound.h"
+#include "esp_rom_crc.h"
+#include "sim.h"
+#include "powerUp48k.h"
+#include "powerUp48kIma.h"
+
+#define HEADER_SZ 16
+#define PART_SZ 0xF0000 // storage in lcd_test/partitions.csv
+
+// The last clip handed to the sound component
+static struct {
+	const void *audio;
+	uint32_t size; // bytes for PCM, samples for ADPCM
+	uint32_t rate;
+	bool adpcm;
+} played;
+
+static uint8_t *image;
+static size_t image_sz;
+static uint32_t failed;
+
+static void check(bool ok, const char *name, const char *fmt, double val)
+{
+	printf("%-28s %s  ", name, ok ? "pass" : "FAIL");
+	printf(fmt, val);
+	printf("\n");
+	if (!ok) failed++;
+}
+
+int32_t sound_play(const void *audio, uint32_t size, uint32_t rate_hz, uint32_t vol, uint32_t prio, bool loop)
+{
+	played.audio = audio;
+	played.size = size;
+	played.rate = rate_hz;
+	played.adpcm = false;
+	return 0;
+}
+
+int32_t sound_play_adpcm(const void *audio, uint32_t samples, uint32_t rate_hz, uint32_t vol, uint32_t prio, bool loop)
+{
+	played.audio = audio;
+	played.size = samples;
+	played.rate = rate_hz;
+	played.adpcm = true;
+	return 0;
+}
+
+static void wr_le(uint8_t *p, uint32_t v, uint32_t n)
+{
+	while (n--) {*p++ = v; v >>= 8;}
+}
+
+// Write the CRC of the index into the header
+static void crc_fix(uint8_t *img)
+{
+	uint32_t n = img[6] | img[7] << 8;
+	wr_le(img+12, esp_rom_crc32_le(0, img + HEADER_SZ, n*ASSET_ENTRY_SZ), 4);
+}
+
+// Clips are found by name and played from the mapping as packed.
+static void test_packed(void)
+{
+	asset_t a;
+
+	sim_partition(ASSET_PARTITION, image, image_sz, PART_SZ);
+	int32_t ret = asset_init(NULL);
+	check(ret == 0 && asset_count() == 2, "init packed image", "%.0f clips", asset_count());
+	check(sim_map_size == image_sz, "maps the image only", "%.0f bytes", sim_map_size);
+
+	bool ok = asset_find("powerUp48k", &a) == 0 && a.fmt == ASSET_PCM8 &&
+		a.size == POWERUP48K_SAMPLES && !memcmp(a.data, powerUp48k, a.size);
+	asset_play(&a, MAX_VOL, SOUND_PRIO_DEFAULT, false);
+	ok = ok && !played.adpcm && played.audio == a.data && played.size == a.size &&
+		played.rate == POWERUP48K_SAMPLE_RATE;
+	check(ok, "find and play pcm", "%.0f bytes", a.size);
+
+	ok = asset_find("powerUp48kIma", &a) == 0 && a.fmt == ASSET_ADPCM &&
+		a.samples == POWERUP48KIMA_SAMPLES && !memcmp(a.data, powerUp48kIma, a.size);
+	asset_play(&a, MAX_VOL, SOUND_PRIO_DEFAULT, false);
+	ok = ok && played.adpcm && played.audio == a.data && played.size == POWERUP48KIMA_SAMPLES &&
+		played.rate == POWERUP48KIMA_SAMPLE_RATE;
+	check(ok, "find and play adpcm", "%.0f samples", a.samples);
+
+	check(asset_find("powerUp", &a) != 0 && asset_get(2, &a) != 0, "unknown clip", "%.0f", 0);
+	asset_deinit();
+	check(sim_maps == 0 && asset_count() == 0, "deinit unmaps", "%.0f maps", sim_maps);
+}
+
+// Initialize from a copy of the packed image with one field changed.
+// field: byte offset into the image, of an entry from HEADER_SZ.
+// crc: rewrite the index CRC after the change.
+// Return the result of asset_init().
+static int32_t init_changed(uint32_t field, uint32_t val, uint32_t n, bool crc)
+{
+	uint8_t *img = malloc(image_sz);
+	memcpy(img, image, image_sz);
+	wr_le(img + field, val, n);
+	if (crc) crc_fix(img);
+	sim_partition(ASSET_PARTITION, img, image_sz, PART_SZ);
+	free(img);
+	int32_t ret = asset_init(NULL);
+	if (ret == 0) asset_deinit();
+	return ret;
+}
+
+// A damaged header or index entry is refused, with nothing left mapped.
+static void test_refused(void)
+{
+	static const struct {
+		const char *name;
+		uint32_t field, val, n;
+		bool crc;
+	} cases[] = {
+		{"refuse magic", 0, 'X', 1, false},
+		{"refuse version", 4, ASSET_VERSION+1, 2, false},
+		{"refuse size past partition", 8, PART_SZ+1, 4, false},
+		{"refuse index crc", HEADER_SZ, 'q', 1, false},
+		{"refuse unterminated name", HEADER_SZ + ASSET_NAME_MAX, 'x', 1, true},
+		{"refuse offset past image", HEADER_SZ + 24, 0x100000, 4, true},
+		{"refuse size past image", HEADER_SZ + 28, 0x100000, 4, true},
+		{"refuse format", HEADER_SZ + 38, ASSET_FMT_LAST, 1, true},
+		// 30720 bytes hold 120 blocks of 505 samples
+		{"refuse adpcm past blocks", HEADER_SZ + ASSET_ENTRY_SZ + 32,
+			30720/SOUND_ADPCM_BLOCK*SOUND_ADPCM_BLOCK_SAMPLES + 1, 4, true},
+	};
+
+	for (uint32_t i = 0; i < sizeof(cases)/sizeof(cases[0]); i++) {
+		int32_t ret = init_changed(cases[i].field, cases[i].val, cases[i].n, cases[i].crc);
+		check(ret != 0 && sim_maps == 0 && asset_count() == 0, cases[i].name, "%.0f maps", sim_maps);
+	}
+	int32_t ret = init_changed(HEADER_SZ + ASSET_ENTRY_SZ + 32,
+		30720/SOUND_ADPCM_BLOCK*SOUND_ADPCM_BLOCK_SAMPLES, 4, true);
+	check(ret == 0 && sim_maps == 0, "accept adpcm filling blocks", "%.0f", ret);
+
+	sim_partition(ASSET_PARTITION, image, image_sz, PART_SZ);
+	check(asset_init("music") != 0 && sim_maps == 0, "refuse missing partition", "%.0f", 0);
+}
+
+static int cmd_test(void)
+{
+	test_packed();
+	test_refused();
+	printf("%s\n", failed ? "FAILED" : "PASSED");
+	return failed != 0;
+}
+
+int main(int argc, char *argv[])
+{
+	const char *cmd = argc > 1 ? argv[1] : "";
+	FILE *f = argc > 2 ? fopen(argv[2], "rb") : NULL;
+
+	if (strcmp(cmd, "test") || f == NULL) {
+		fprintf(stderr, "usage: %s test image.bin\n", argv[0]);
+		return 2;
+	}
+	fseek(f, 0, SEEK_END);
+	image_sz = ftell(f);
+	rewind(f);
+	image = malloc(image_sz);
+	if (image == NULL || fread(image, 1, image_sz, f) != image_sz) {
+		perror(argv[2]);
+		return 1;
+	}
+	fclose(f);
+	return cmd_test();
+}
@@ -0,0 +1,22 @@
+#ifndef SIM_H_
+#define SIM_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Host mock of a flash data partition: one partition held in memory,
+// erased (0xFF) past the data written to it. Mappings are counted so a
+// test can check that each one is released.
+
+extern int sim_verbose; // show info logs
+extern int32_t sim_maps; // mappings not yet released
+extern size_t sim_map_size; // size of the last mapping
+
+// Set the partition. Replaces any previous one.
+// label: partition label.
+// data: contents written from the start of the partition.
+// size: bytes of data.
+// part_size: size of the partition.
+void sim_partition(const char *label, const void *data, size_t size, size_t part_size);
+
+#endif /* SIM_H_ */
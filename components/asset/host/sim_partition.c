@@ -0,0 +1,73 @@
+// Partition and ROM CRC functions for the asset host test, see sim.h.
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "esp_partition.h"
+#include "esp_rom_crc.h"
+#include "sim.h"
+
+int sim_verbose;
+int32_t sim_maps;
+size_t sim_map_size;
+
+static esp_partition_t part;
+static uint8_t *flash;
+
+void sim_partition(const char *label, const void *data, size_t size, size_t part_size)
+{
+	free(flash);
+	flash = malloc(part_size);
+	if (flash == NULL) {perror("flash"); exit(1);}
+	memset(flash, 0xFF, part_size);
+	memcpy(flash, data, size < part_size ? size : part_size);
+	memset(&part, 0, sizeof(part));
+	part.type = ESP_PARTITION_TYPE_DATA;
+	part.subtype = 0x82;
+	part.size = part_size;
+	snprintf(part.label, sizeof(part.label), "%s", label);
+}
+
+const esp_partition_t *esp_partition_find_first(esp_partition_type_t type,
+	esp_partition_subtype_t subtype, const char *label)
+{
+	if (flash == NULL || type != part.type) return NULL;
+	if (subtype != ESP_PARTITION_SUBTYPE_ANY && subtype != part.subtype) return NULL;
+	if (label != NULL && strcmp(label, part.label)) return NULL;
+	return &part;
+}
+
+esp_err_t esp_partition_read(const esp_partition_t *p, size_t offset, void *dst, size_t size)
+{
+	if (offset > p->size || size > p->size - offset) return ESP_ERR_INVALID_ARG;
+	memcpy(dst, flash + offset, size);
+	return ESP_OK;
+}
+
+esp_err_t esp_partition_mmap(const esp_partition_t *p, size_t offset, size_t size,
+	esp_partition_mmap_memory_t memory, const void **ptr, esp_partition_mmap_handle_t *handle)
+{
+	if (offset > p->size || size > p->size - offset) return ESP_ERR_INVALID_ARG;
+	*ptr = flash + offset;
+	*handle = 1;
+	sim_maps++;
+	sim_map_size = size;
+	return ESP_OK;
+}
+
+void esp_partition_munmap(esp_partition_mmap_handle_t handle)
+{
+	sim_maps--;
+}
+
+uint32_t esp_rom_crc32_le(uint32_t crc, const uint8_t *buf, uint32_t len)
+{
+	crc = ~crc;
+	while (len--) {
+		crc ^= *buf++;
+		for (int k = 0; k < 8; k++) crc = (crc >> 1) ^ (0xEDB88320U & -(crc & 1));
+	}
+	return ~crc;
+}
@@ -5,4 +5,4 @@
 #define BCFIRE48K_SAMPLE_RATE 48000
 #define BCFIRE48K_SAMPLES 53638
 
-const uint8_t bcFire48k[];
+extern const uint8_t bcFire48k[];
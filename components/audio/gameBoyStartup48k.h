@@ -5,4 +5,4 @@
 #define GAMEBOYSTARTUP48K_SAMPLE_RATE 48000
 #define GAMEBOYSTARTUP48K_SAMPLES 105488
 
-const uint8_t gameBoyStartup48k[];
+extern const uint8_t gameBoyStartup48k[];
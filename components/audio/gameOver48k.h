@@ -5,4 +5,4 @@
 #define GAMEOVER48K_SAMPLE_RATE 48000
 #define GAMEOVER48K_SAMPLES 156595
 
-const uint8_t gameOver48k[];
+extern const uint8_t gameOver48k[];
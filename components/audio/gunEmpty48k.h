@@ -5,4 +5,4 @@
 #define GUNEMPTY48K_SAMPLE_RATE 48000
 #define GUNEMPTY48K_SAMPLES 15456
 
-const uint8_t gunEmpty48k[];
+extern const uint8_t gunEmpty48k[];
@@ -0,0 +1,140 @@
+#!/usr/bin/python3
+
+"""
+Convert audio to the 4-bit IMA-ADPCM asset format played by
+sound_play_adpcm(). The input is a WAV file (8 or 16-bit PCM, mono or
+stereo) or one of the 8-bit asset arrays in this directory (*.c).
+Writes <name>.c and <name>.h in the same style as the PCM assets.
+
+The data is a sequence of 256-byte blocks, the same layout as mono IMA
+blocks in a WAV file: a 4-byte header (16-bit predictor, step index,
+zero) followed by 252 bytes of samples, low nibble first. The header
+holds the first sample, so a block decodes 505 samples. The last block
+is padded.
+
+Examples:
+    ./ima_adpcm.py powerUp48k.c
+    ./ima_adpcm.py music.wav -n music48kIma
+"""
+
+import argparse
+import pathlib
+import re
+import struct
+import sys
+import wave
+
+BLOCK = 256
+BLOCK_SAMPLES = 1 + (BLOCK - 4) * 2
+
+INDEX_TABLE = [-1, -1, -1, -1, 2, 4, 6, 8]
+STEP_TABLE = [
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+    253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+    1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+    3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+    11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+    32767,
+]
+
+
+def clamp(v, lo, hi):
+    return lo if v < lo else hi if v > hi else v
+
+
+def step_decode(pred, index, code):
+    """Apply one 4-bit code, the same arithmetic as the decoder in sound.c."""
+    step = STEP_TABLE[index]
+    diff = step >> 3
+    if code & 4:
+        diff += step
+    if code & 2:
+        diff += step >> 1
+    if code & 1:
+        diff += step >> 2
+    pred = clamp(pred - diff if code & 8 else pred + diff, -32768, 32767)
+    index = clamp(index + INDEX_TABLE[code & 7], 0, len(STEP_TABLE) - 1)
+    return pred, index
+
+
+def encode(samples):
+    """Encode 16-bit samples into IMA-ADPCM blocks."""
+    out = bytearray()
+    index = 0
+    for b in range(0, len(samples), BLOCK_SAMPLES):
+        blk = samples[b : b + BLOCK_SAMPLES]
+        blk += [blk[-1]] * (BLOCK_SAMPLES - len(blk))
+        pred = blk[0]
+        out += struct.pack("<hBB", pred, index, 0)
+        codes = []
+        for s in blk[1:]:
+            # Pick the code that lands closest, so rounding never drifts
+            best = None
+            for code in range(16):
+                p, i = step_decode(pred, index, code)
+                if best is None or abs(s - p) < best[0]:
+                    best = (abs(s - p), code, p, i)
+            _, code, pred, index = best
+            codes.append(code)
+        for i in range(0, len(codes), 2):
+            out.append(codes[i] | codes[i + 1] << 4)
+    return bytes(out)
+
+
+def read_wav(path):
+    """Return (rate, 16-bit mono samples) from a PCM WAV file."""
+    with wave.open(str(path), "rb") as w:
+        ch, width, rate = w.getnchannels(), w.getsampwidth(), w.getframerate()
+        raw = w.readframes(w.getnframes())
+    if width == 1:
+        vals = [(v - 0x80) << 8 for v in raw]
+    elif width == 2:
+        vals = list(struct.unpack("<%dh" % (len(raw) // 2), raw))
+    else:
+        sys.exit("%s: only 8 or 16-bit PCM" % path)
+    return rate, [sum(vals[i : i + ch]) // ch for i in range(0, len(vals), ch)]
+
+
+def read_asset(path):
+    """Return (rate, 16-bit mono samples) from an 8-bit asset array."""
+    text = path.read_text()
+    body = text[text.index("{") + 1 : text.rindex("}")]
+    vals = [int(v, 0) for v in re.findall(r"0x[0-9a-fA-F]+|\d+", body)]
+    m = re.search(r"(\d+)k", path.stem)
+    rate = int(m.group(1)) * 1000 if m else 48000
+    return rate, [(v - 0x80) << 8 for v in vals]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("source", help="WAV file or 8-bit asset .c file")
+    parser.add_argument("-n", "--name", help="array name, default <source>Ima")
+    parser.add_argument("-o", "--outdir", default=".", help="output directory")
+    args = parser.parse_args()
+
+    src = pathlib.Path(args.source)
+    rate, samples = read_wav(src) if src.suffix.lower() == ".wav" else read_asset(src)
+    if not samples:
+        sys.exit("%s: no samples" % src)
+    name = args.name or src.stem + "Ima"
+    data = encode(samples)
+
+    out = pathlib.Path(args.outdir)
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("\t" + ", ".join("0x%02x" % b for b in data[i : i + 16]))
+    with open(out / (name + ".c"), "w") as f:
+        f.write("\n#include <stdint.h>\n\nconst uint8_t %s[] = {\n%s\n};\n" % (name, ",\n".join(lines)))
+    macro = name.upper()
+    with open(out / (name + ".h"), "w") as f:
+        f.write("\n#include <stdint.h>\n\n")
+        f.write("#define %s_BITS_PER_SAMPLE 4\n" % macro)
+        f.write("#define %s_SAMPLE_RATE %d\n" % (macro, rate))
+        f.write("#define %s_SAMPLES %d\n" % (macro, len(samples)))
+        f.write("\nextern const uint8_t %s[];\n" % name)
+    print("%s: %d samples, %d bytes (%d as 8-bit PCM)" % (name, len(samples), len(data), len(samples)))
+
+
+if __name__ == "__main__":
+    main()
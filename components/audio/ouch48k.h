@@ -5,4 +5,4 @@
 #define OUCH48K_SAMPLE_RATE 48000
 #define OUCH48K_SAMPLES 23467
 
-const uint8_t ouch48k[];
+extern const uint8_t ouch48k[];
@@ -5,4 +5,4 @@
 #define PACMANDEATH48K_SAMPLE_RATE 48000
 #define PACMANDEATH48K_SAMPLES 82712
 
-const uint8_t pacmanDeath48k[];
+extern const uint8_t pacmanDeath48k[];
@@ -5,4 +5,4 @@
 #define POWERUP48K_SAMPLE_RATE 48000
 #define POWERUP48K_SAMPLES 60480
 
-const uint8_t powerUp48k[];
+extern const uint8_t powerUp48k[];
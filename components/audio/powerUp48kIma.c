@@ -0,0 +1,1925 @@
+
+#include <stdint.h>
+
+const uint8_t powerUp48kIma[] = {
+	0x00, 0xff, 0x00, 0x00, 0xa7, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0x8f, 0x70, 0x08, 0x80,
+	0x80, 0x08, 0x80, 0x78, 0x01, 0x08, 0x08, 0x08, 0x08, 0x27, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+	0x67, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xf8, 0x8f, 0xf8, 0x80, 0x8b, 0xd0, 0x08,
+	0x8c, 0x80, 0x8c, 0x80, 0x00, 0x08, 0x88, 0x00, 0x88, 0x70, 0x03, 0x08, 0x17, 0x08, 0x08, 0x08,
+	0x08, 0x08, 0x80, 0xf8, 0x0d, 0x08, 0x08, 0x08, 0x78, 0x02, 0x06, 0x58, 0x38, 0x04, 0x83, 0x04,
+	0x03, 0x04, 0x03, 0x80, 0x08, 0x80, 0x9f, 0xd0, 0x8b, 0x0c, 0xbc, 0xc0, 0xb0, 0xc8, 0xc0, 0x08,
+	0x80, 0x08, 0x80, 0x87, 0x30, 0x00, 0x04, 0x08, 0x08, 0x08, 0x08, 0xf8, 0xe9, 0xc0, 0xb0, 0xc0,
+	0x0b, 0x0c, 0xc8, 0x80, 0x80, 0x50, 0x08, 0x84, 0x34, 0x48, 0x83, 0x34, 0x48, 0x38, 0x40, 0x08,
+	0x80, 0x08, 0x8e, 0xc0, 0x80, 0x0c, 0xc8, 0x80, 0x08, 0x80, 0x08, 0x70, 0x40, 0x48, 0x48, 0x38,
+	0x30, 0x80, 0x05, 0x88, 0x00, 0x88, 0x00, 0x8f, 0xc8, 0x08, 0x0d, 0xb8, 0x08, 0xd8, 0x08, 0x08,
+	0x08, 0x08, 0xf8, 0x88, 0x80, 0x0e, 0xc8, 0xc0, 0xb8, 0x8b, 0xcc, 0x0b, 0x0c, 0xcb, 0x80, 0x0c,
+	0x08, 0x08, 0x85, 0x40, 0x48, 0x48, 0x38, 0x30, 0x40, 0x80, 0x04, 0x08, 0x85, 0x80, 0x80, 0x60,
+	0x08, 0x34, 0x40, 0x33, 0x44, 0x32, 0x73, 0x12, 0x24, 0x21, 0x22, 0x03, 0x83, 0x80, 0x0d, 0xbc,
+	0xcb, 0xfa, 0xc9, 0xb9, 0xab, 0xd9, 0x99, 0xaa, 0xaa, 0x0b, 0xb8, 0x08, 0x08, 0x08, 0x08, 0x08,
+	0xaf, 0x8d, 0xdb, 0xbb, 0xac, 0x9f, 0x9a, 0xac, 0xa9, 0xa8, 0x80, 0x30, 0x40, 0x27, 0x43, 0x24,
+	0x00, 0xf5, 0x2e, 0x00, 0x25, 0x23, 0x24, 0x24, 0x22, 0x13, 0x14, 0x28, 0x28, 0xa8, 0xb0, 0xb8,
+	0xbc, 0xc8, 0xcb, 0xc0, 0xb0, 0x80, 0x80, 0x68, 0x48, 0x08, 0x83, 0x40, 0x80, 0x8c, 0x8b, 0xfd,
+	0xb9, 0xca, 0xcb, 0xdb, 0xba, 0xda, 0xaa, 0xa9, 0xc9, 0x99, 0x80, 0x2a, 0x80, 0x33, 0x34, 0x73,
+	0x12, 0x24, 0x23, 0x52, 0x21, 0x22, 0x02, 0x42, 0x38, 0x30, 0x40, 0x08, 0x04, 0x84, 0x34, 0x48,
+	0x48, 0x02, 0x83, 0x34, 0x00, 0x84, 0x00, 0x88, 0xf0, 0x80, 0x8b, 0x8c, 0xbc, 0xc8, 0xc0, 0x0b,
+	0x0c, 0x8b, 0xd0, 0x80, 0x8b, 0xc8, 0xc8, 0xc8, 0x0b, 0xcc, 0x8a, 0xbb, 0xcc, 0x8a, 0xbb, 0x08,
+	0x8d, 0x40, 0x48, 0x48, 0x32, 0x43, 0x16, 0x22, 0x24, 0x22, 0x82, 0x03, 0x08, 0x08, 0x0e, 0xac,
+	0xbb, 0xbc, 0xbb, 0xcc, 0x8a, 0x0b, 0x48, 0x40, 0x43, 0x33, 0x27, 0x23, 0x24, 0x14, 0x22, 0x08,
+	0xa2, 0xc8, 0xbb, 0xcb, 0xbf, 0xab, 0xbc, 0x9c, 0xab, 0x0a, 0x8a, 0x48, 0x38, 0x17, 0x14, 0x33,
+	0x53, 0x32, 0x32, 0x22, 0x20, 0x80, 0xcb, 0xac, 0xae, 0xcb, 0xac, 0xbb, 0xca, 0xba, 0x0a, 0x0b,
+	0x48, 0x38, 0x73, 0x32, 0x52, 0x13, 0x14, 0x21, 0x22, 0x08, 0xb8, 0xcb, 0xdc, 0xca, 0xcb, 0x9b,
+	0xbc, 0x9b, 0xaa, 0x0b, 0x8b, 0x04, 0x33, 0x74, 0x41, 0x32, 0x43, 0x33, 0x14, 0x24, 0x21, 0x21,
+	0x32, 0x08, 0x08, 0x08, 0x8d, 0x8b, 0xcc, 0xc0, 0x8a, 0x0b, 0x8c, 0xc0, 0x08, 0x08, 0x08, 0x08,
+	0x08, 0x80, 0x08, 0x80, 0x08, 0xff, 0xdb, 0xbb, 0xfb, 0xda, 0xb9, 0xcb, 0xbb, 0xdb, 0xb9, 0xcb,
+	0x99, 0xaa, 0x0a, 0x80, 0x48, 0x33, 0x47, 0x32, 0x45, 0x31, 0x34, 0x42, 0x13, 0x14, 0x22, 0x13,
+	0x21, 0x01, 0x08, 0xb8, 0xc0, 0xbb, 0xb8, 0x0d, 0x0c, 0x08, 0x08, 0x04, 0x84, 0x34, 0x83, 0x04,
+	0x00, 0x16, 0x25, 0x00, 0x80, 0xc8, 0xbc, 0xaf, 0xcc, 0xcb, 0xdb, 0xbb, 0xdb, 0xca, 0xaa, 0xaa,
+	0xa9, 0x9b, 0xa0, 0x82, 0x32, 0x25, 0x26, 0x52, 0x31, 0x14, 0x14, 0x12, 0x03, 0x13, 0x12, 0x80,
+	0x83, 0x80, 0x80, 0x80, 0x80, 0x37, 0x48, 0x73, 0x31, 0x14, 0x43, 0x33, 0x34, 0x23, 0x22, 0x82,
+	0x80, 0xc0, 0xfb, 0xac, 0xcb, 0xbc, 0xbc, 0xeb, 0xaa, 0xaa, 0xab, 0xba, 0x9b, 0x9a, 0x8a, 0x08,
+	0x43, 0x48, 0x32, 0x17, 0x12, 0x22, 0x38, 0x83, 0x80, 0x80, 0xe0, 0xb8, 0xc8, 0x0c, 0xb8, 0x08,
+	0x08, 0x36, 0x34, 0x73, 0x43, 0x33, 0x54, 0x32, 0x32, 0x25, 0x02, 0x13, 0x12, 0x80, 0xb0, 0xbb,
+	0xfb, 0xbc, 0xac, 0xcb, 0xba, 0xcb, 0xa9, 0x8b, 0x0a, 0x88, 0x40, 0x42, 0x32, 0x43, 0x33, 0x34,
+	0x88, 0x00, 0xbd, 0xec, 0xcb, 0xdb, 0xca, 0xab, 0xac, 0xab, 0xb9, 0x9a, 0x08, 0x38, 0x16, 0x54,
+	0x32, 0x34, 0x43, 0x33, 0x24, 0x22, 0x13, 0x21, 0x08, 0xa8, 0xbb, 0xbc, 0xfb, 0x9a, 0xaa, 0x80,
+	0x80, 0x34, 0x73, 0x32, 0x34, 0x26, 0x22, 0x13, 0x12, 0x80, 0xb0, 0xfb, 0xbb, 0xce, 0xca, 0xca,
+	0xba, 0xac, 0xaa, 0xab, 0x9a, 0x09, 0x28, 0x21, 0x53, 0x44, 0x23, 0x53, 0x32, 0x31, 0x01, 0x01,
+	0xa8, 0xb8, 0xcb, 0x9f, 0x9a, 0xaa, 0xa8, 0x83, 0x34, 0x46, 0x33, 0x36, 0x53, 0x23, 0x43, 0x33,
+	0x22, 0x11, 0x01, 0xaa, 0xea, 0xdb, 0xda, 0xba, 0xbc, 0xcb, 0xba, 0xba, 0x9a, 0xa9, 0x89, 0x82,
+	0x33, 0x17, 0x23, 0x34, 0x22, 0x22, 0x83, 0x08, 0xd0, 0xbb, 0xaf, 0xcb, 0xba, 0xac, 0xa9, 0xaa,
+	0x08, 0x83, 0x27, 0x44, 0x32, 0x45, 0x32, 0x33, 0x24, 0x23, 0x23, 0x21, 0x80, 0xba, 0xfb, 0xac,
+	0xeb, 0xb9, 0x9c, 0x9c, 0xab, 0xb8, 0x09, 0x0a, 0x82, 0x25, 0x41, 0x63, 0x22, 0x52, 0x21, 0x12,
+	0x00, 0x0e, 0x2f, 0x00, 0x01, 0x81, 0xa0, 0xba, 0xfb, 0xbb, 0xbc, 0xcb, 0xbb, 0xc9, 0x9a, 0x8a,
+	0x0a, 0x83, 0x24, 0x54, 0x42, 0x21, 0x14, 0x82, 0x02, 0x08, 0xcb, 0xbb, 0xfb, 0xbc, 0x9c, 0xbb,
+	0xd9, 0x99, 0x80, 0x38, 0x22, 0x46, 0x52, 0x32, 0x44, 0x32, 0x23, 0x24, 0x22, 0x21, 0x28, 0x8a,
+	0xaa, 0xaf, 0xba, 0xcc, 0xab, 0x9b, 0x9c, 0x9a, 0xaa, 0x08, 0x08, 0x03, 0x04, 0x58, 0x08, 0x0c,
+	0xcb, 0xfb, 0xb9, 0xbc, 0xad, 0xab, 0xbb, 0x9c, 0x9a, 0x08, 0x32, 0x72, 0x33, 0x36, 0x63, 0x22,
+	0x33, 0x33, 0x23, 0x33, 0x20, 0x08, 0xbb, 0xfb, 0xba, 0xcc, 0xba, 0xab, 0x8c, 0x89, 0x80, 0x33,
+	0x73, 0x24, 0x33, 0x34, 0x43, 0x21, 0x01, 0xa8, 0xab, 0xbf, 0xeb, 0xbb, 0xae, 0xaa, 0xbb, 0xbb,
+	0x9a, 0x9a, 0x28, 0x20, 0x36, 0x62, 0x32, 0x52, 0x22, 0x21, 0x82, 0x82, 0xaa, 0xbb, 0x9f, 0xcb,
+	0xbb, 0xbc, 0xc9, 0x89, 0x80, 0x23, 0x72, 0x32, 0x26, 0x43, 0x33, 0x43, 0x23, 0x32, 0x11, 0x82,
+	0x80, 0xba, 0xfb, 0xba, 0x9d, 0xbb, 0xa9, 0xba, 0x8a, 0x80, 0x40, 0x40, 0x43, 0x42, 0x38, 0x30,
+	0x0c, 0xc8, 0xfb, 0xac, 0xbb, 0xae, 0xcb, 0xab, 0xac, 0xbb, 0xa9, 0x9a, 0x8a, 0x80, 0x03, 0x43,
+	0x17, 0x14, 0x13, 0x14, 0x41, 0x21, 0x21, 0x22, 0x23, 0x40, 0x33, 0x73, 0x22, 0x35, 0x41, 0x33,
+	0x44, 0x23, 0x33, 0x14, 0x14, 0x11, 0x82, 0x80, 0xba, 0xcb, 0x9e, 0xbc, 0xeb, 0xaa, 0xca, 0xba,
+	0xba, 0xac, 0xba, 0xc9, 0x9a, 0xaa, 0xba, 0xbb, 0xbc, 0xbb, 0xbc, 0xbc, 0xcb, 0x0b, 0x0c, 0x08,
+	0x08, 0x85, 0x34, 0x17, 0x23, 0x34, 0x34, 0x43, 0x33, 0x14, 0x23, 0x14, 0x22, 0x28, 0x80, 0x00,
+	0xc8, 0x08, 0x0d, 0x08, 0x08, 0x08, 0x88, 0x07, 0x43, 0x24, 0x03, 0x43, 0x43, 0x33, 0x48, 0x80,
+	0x00, 0x14, 0x24, 0x00, 0x80, 0xd8, 0xc0, 0xac, 0xbb, 0xec, 0xc9, 0xc9, 0xb9, 0xc9, 0xb9, 0xca,
+	0xa9, 0x9c, 0xaa, 0xaa, 0xba, 0x0c, 0xbb, 0xc8, 0xc0, 0x80, 0x8b, 0x80, 0x80, 0x08, 0x78, 0x81,
+	0x35, 0x40, 0x43, 0x63, 0x22, 0x44, 0x31, 0x34, 0x43, 0x33, 0x34, 0x33, 0x25, 0x43, 0x22, 0x13,
+	0x22, 0x80, 0x83, 0x8b, 0xcc, 0xca, 0xad, 0xbc, 0xbc, 0xc9, 0x9b, 0x9c, 0xab, 0xaa, 0xb0, 0xb0,
+	0x08, 0x0d, 0xc8, 0x80, 0xcb, 0xcb, 0xbb, 0xcf, 0xb9, 0xbb, 0xda, 0x9b, 0xaa, 0xb9, 0x80, 0x30,
+	0x34, 0x64, 0x43, 0x25, 0x32, 0x53, 0x32, 0x32, 0x31, 0x22, 0x22, 0x80, 0x80, 0xc8, 0xc0, 0x0c,
+	0x0b, 0x8c, 0x00, 0x88, 0x50, 0x40, 0x48, 0x83, 0x34, 0x83, 0x34, 0x00, 0x84, 0xc0, 0xc8, 0xcb,
+	0xbb, 0xfb, 0xac, 0xbb, 0x9d, 0xbb, 0xa9, 0xba, 0xba, 0x08, 0x80, 0x35, 0x40, 0x33, 0x44, 0x02,
+	0x83, 0xb4, 0x80, 0xcc, 0xbb, 0xcb, 0xac, 0xbb, 0x0c, 0x08, 0x48, 0x34, 0x73, 0x24, 0x53, 0x32,
+	0x32, 0x23, 0x24, 0x01, 0x08, 0xb8, 0xc0, 0xbb, 0xc0, 0xac, 0xb8, 0xc0, 0x08, 0x08, 0xd8, 0x08,
+	0x0d, 0xcb, 0xfb, 0xb9, 0x9c, 0xac, 0xbb, 0xaa, 0xaa, 0x0b, 0x48, 0x48, 0x25, 0x14, 0x34, 0x43,
+	0x31, 0x14, 0x12, 0x22, 0x38, 0x48, 0x38, 0x30, 0x34, 0x34, 0x43, 0x72, 0x21, 0x01, 0x82, 0x8a,
+	0xbb, 0xcf, 0xad, 0xcb, 0xdb, 0xaa, 0xbb, 0xaa, 0xbb, 0x89, 0x80, 0x20, 0x33, 0x27, 0x23, 0x15,
+	0x21, 0x38, 0x08, 0xb8, 0xc8, 0xc0, 0x80, 0x8b, 0x04, 0x84, 0x64, 0x21, 0x14, 0x34, 0x21, 0x24,
+	0x01, 0x22, 0x08, 0x08, 0x84, 0x80, 0x50, 0x48, 0x83, 0x34, 0x48, 0x83, 0x80, 0xc8, 0xbc, 0xec,
+	0xba, 0xbc, 0xbc, 0xab, 0xaa, 0x0a, 0x08, 0x43, 0x73, 0x32, 0x22, 0x23, 0x80, 0xc0, 0xbf, 0xeb,
+	0x00, 0xfa, 0x32, 0x00, 0xbb, 0xae, 0xab, 0xab, 0xaa, 0x09, 0x08, 0x14, 0x44, 0x43, 0x43, 0x23,
+	0x24, 0x22, 0x11, 0x10, 0x00, 0x88, 0x00, 0x03, 0x44, 0x42, 0x45, 0x33, 0x44, 0x23, 0x33, 0x22,
+	0x22, 0x80, 0x80, 0xbc, 0xac, 0xac, 0x8b, 0xcb, 0xcb, 0xbb, 0xbc, 0xfb, 0xcb, 0xdb, 0xcb, 0xcb,
+	0xbb, 0xad, 0x9b, 0xaa, 0x0b, 0x89, 0x22, 0x24, 0x54, 0x22, 0x33, 0x41, 0x28, 0x08, 0xa8, 0xba,
+	0xac, 0xbb, 0x48, 0x70, 0x61, 0x43, 0x53, 0x32, 0x25, 0x32, 0x22, 0x21, 0x80, 0x99, 0xeb, 0xbb,
+	0xcc, 0xbb, 0xcb, 0xa9, 0x99, 0x08, 0x21, 0x22, 0x35, 0x14, 0x23, 0x22, 0x08, 0x08, 0xbc, 0x9f,
+	0xab, 0xbc, 0xaa, 0xac, 0xb9, 0xb0, 0x8a, 0x8b, 0xcc, 0x0b, 0xbc, 0xbb, 0xcc, 0xba, 0xb8, 0x58,
+	0x48, 0x32, 0x17, 0x43, 0x13, 0x14, 0x14, 0x28, 0x08, 0x08, 0x08, 0x0c, 0x08, 0x03, 0x37, 0x44,
+	0x53, 0x43, 0x43, 0x31, 0x32, 0x11, 0x98, 0xaa, 0xdd, 0xcb, 0xdb, 0xba, 0xbb, 0x9c, 0xaa, 0x99,
+	0x98, 0x08, 0x82, 0x80, 0xc0, 0xb0, 0xec, 0xc9, 0xa9, 0xab, 0x8a, 0x3a, 0x33, 0x74, 0x25, 0x43,
+	0x33, 0x52, 0x11, 0x11, 0x08, 0x0a, 0x9c, 0xaa, 0xaa, 0x0b, 0x03, 0x47, 0x33, 0x36, 0x43, 0x43,
+	0x11, 0x11, 0x98, 0xcb, 0xbd, 0xdb, 0xac, 0xab, 0xba, 0x98, 0x89, 0x12, 0x42, 0x42, 0x23, 0x22,
+	0xa8, 0xf8, 0xbb, 0xcc, 0xbc, 0xca, 0xaa, 0x99, 0x80, 0x10, 0x35, 0x41, 0x33, 0x22, 0x22, 0x08,
+	0x8b, 0xbc, 0xc8, 0x80, 0x34, 0x67, 0x42, 0x34, 0x34, 0x33, 0x25, 0x12, 0x01, 0x90, 0xaa, 0xae,
+	0xac, 0xbc, 0xaa, 0xbb, 0xa8, 0x08, 0x11, 0x42, 0x23, 0x22, 0x82, 0xbb, 0xbf, 0xce, 0xac, 0xbb,
+	0xbc, 0xaa, 0xaa, 0x88, 0x10, 0x21, 0x52, 0x32, 0x22, 0x20, 0x80, 0x8b, 0x80, 0x08, 0x67, 0x63,
+	0x00, 0xf2, 0x32, 0x00, 0x44, 0x34, 0x34, 0x43, 0x23, 0x23, 0x12, 0x80, 0xa9, 0xdc, 0xca, 0xbb,
+	0xcb, 0xba, 0xa9, 0x09, 0x88, 0x20, 0x21, 0x80, 0xb0, 0xec, 0xeb, 0xdb, 0xba, 0xac, 0xab, 0x9b,
+	0x99, 0x28, 0x53, 0x32, 0x45, 0x22, 0x32, 0x22, 0x28, 0x8a, 0xaa, 0xcb, 0xba, 0x08, 0x08, 0x47,
+	0x43, 0x24, 0x33, 0x14, 0x12, 0x80, 0xb0, 0xfa, 0xc9, 0xb9, 0x89, 0x80, 0x53, 0x54, 0x33, 0x35,
+	0x43, 0x23, 0x12, 0x11, 0x99, 0xea, 0xea, 0xaa, 0xcb, 0xaa, 0xab, 0x9b, 0x9b, 0x0a, 0xaa, 0xb0,
+	0xbb, 0xaf, 0xcb, 0xeb, 0xaa, 0x9c, 0x8a, 0x0a, 0x21, 0x34, 0x36, 0x43, 0x44, 0x22, 0x32, 0x02,
+	0x83, 0x80, 0xa0, 0xa8, 0x8a, 0x8b, 0x40, 0x34, 0x17, 0x43, 0x33, 0x34, 0x23, 0x28, 0xb0, 0xc0,
+	0xad, 0x9c, 0xbc, 0xa9, 0xaa, 0x0a, 0x08, 0x08, 0x58, 0x80, 0xd0, 0xc0, 0xba, 0x9f, 0xcb, 0x9b,
+	0xbc, 0xc9, 0xa9, 0xa0, 0x8a, 0x8a, 0xbb, 0xbc, 0xbc, 0x9f, 0xcb, 0xa9, 0xa9, 0x08, 0x78, 0x32,
+	0x46, 0x33, 0x35, 0x43, 0x33, 0x43, 0x22, 0x21, 0x00, 0x08, 0xa9, 0xa9, 0xda, 0xa9, 0x0a, 0x0b,
+	0xb8, 0x80, 0x8c, 0xdb, 0x9e, 0xbc, 0xeb, 0xaa, 0xac, 0xaa, 0x99, 0x9a, 0xa8, 0x80, 0xb0, 0xc8,
+	0xcb, 0xbe, 0xcc, 0xcb, 0xcb, 0xaa, 0x9a, 0x0a, 0x42, 0x63, 0x43, 0x34, 0x34, 0x33, 0x24, 0x13,
+	0x12, 0x01, 0x81, 0x10, 0x20, 0x33, 0x46, 0x53, 0x33, 0x24, 0x32, 0x21, 0x8a, 0xcc, 0xdc, 0xac,
+	0xbc, 0xcb, 0xba, 0xba, 0xa9, 0x99, 0x08, 0x08, 0x08, 0x80, 0xc0, 0xba, 0xfb, 0x9a, 0x9d, 0x80,
+	0x20, 0x31, 0x65, 0x32, 0x43, 0x42, 0x20, 0x01, 0x98, 0x9a, 0xda, 0xba, 0xaa, 0x08, 0x78, 0x33,
+	0x36, 0x35, 0x43, 0x23, 0x14, 0x03, 0x11, 0x89, 0xaa, 0xcc, 0xcb, 0xca, 0xb9, 0xaa, 0xba, 0x9a,
+	0x00, 0x03, 0x2a, 0x00, 0xaa, 0xbb, 0xfb, 0xba, 0xcc, 0xba, 0xad, 0x9b, 0x9b, 0x9a, 0x8a, 0x30,
+	0x48, 0x72, 0x41, 0x31, 0x41, 0x31, 0x42, 0x21, 0x42, 0x22, 0x61, 0x11, 0x43, 0x31, 0x42, 0x23,
+	0x34, 0x22, 0x22, 0x38, 0xc0, 0xb0, 0xec, 0xba, 0xbc, 0xdc, 0xaa, 0xa9, 0xab, 0x89, 0x00, 0x88,
+	0x24, 0x30, 0x84, 0x03, 0x08, 0xbd, 0xec, 0xcb, 0xbb, 0xbc, 0xcb, 0x9b, 0x0a, 0x08, 0x38, 0x24,
+	0x33, 0x34, 0x48, 0x83, 0x80, 0x50, 0x08, 0x34, 0x73, 0x25, 0x44, 0x52, 0x32, 0x24, 0x23, 0x22,
+	0x82, 0x80, 0xcb, 0xdb, 0xcb, 0xdb, 0xaa, 0xaa, 0x9a, 0x99, 0x08, 0x28, 0x80, 0x00, 0xbc, 0xcb,
+	0xde, 0xca, 0xba, 0xba, 0xbb, 0x0a, 0x28, 0x63, 0x43, 0x53, 0x33, 0x52, 0x21, 0x81, 0x91, 0x98,
+	0xba, 0xba, 0xc0, 0x08, 0x48, 0x24, 0x73, 0x31, 0x42, 0x12, 0x80, 0xb0, 0xbb, 0xec, 0xc9, 0xa9,
+	0x80, 0x20, 0x33, 0x47, 0x34, 0x43, 0x23, 0x23, 0x03, 0x08, 0xba, 0xed, 0xab, 0xcc, 0xaa, 0xab,
+	0xab, 0xa9, 0x89, 0x0a, 0xb8, 0xc0, 0xbb, 0xcb, 0xbf, 0xcb, 0xbb, 0xca, 0xa0, 0x20, 0x22, 0x47,
+	0x42, 0x33, 0x34, 0x33, 0x32, 0x12, 0x02, 0x0b, 0xb8, 0x0c, 0x08, 0x08, 0x35, 0x27, 0x43, 0x24,
+	0x43, 0x31, 0x28, 0xa8, 0xb0, 0x9e, 0xbc, 0xc9, 0x9b, 0xaa, 0xaa, 0x08, 0x08, 0x84, 0x80, 0x80,
+	0xe0, 0xcb, 0xfb, 0x9b, 0xbc, 0xc9, 0xb9, 0xaa, 0xa0, 0x0b, 0x0c, 0xbb, 0xbc, 0xcb, 0x9e, 0xbc,
+	0xa9, 0xaa, 0x80, 0x70, 0x33, 0x46, 0x43, 0x34, 0x34, 0x32, 0x43, 0x22, 0x21, 0x81, 0x80, 0x99,
+	0xaa, 0xda, 0xa9, 0x0a, 0x8a, 0xc0, 0x80, 0x0b, 0xcc, 0xad, 0xbc, 0xcc, 0xab, 0xad, 0xaa, 0x99,
+	0x9a, 0x8a, 0x80, 0xc0, 0xb0, 0xcb, 0xbe, 0xdc, 0xbb, 0xac, 0xab, 0x9b, 0x0a, 0x22, 0x55, 0x53,
+	0x00, 0xe7, 0x34, 0x00, 0x53, 0x33, 0x33, 0x33, 0x14, 0x11, 0x81, 0x10, 0x08, 0x22, 0x63, 0x43,
+	0x53, 0x43, 0x22, 0x12, 0x82, 0xa9, 0xbf, 0xeb, 0xcb, 0xbb, 0xac, 0xbb, 0x9b, 0xaa, 0x89, 0x00,
+	0x08, 0x88, 0x80, 0xbb, 0xbc, 0xec, 0xa9, 0xaa, 0x20, 0x60, 0x42, 0x25, 0x24, 0x23, 0x33, 0x01,
+	0x08, 0xba, 0xbe, 0xca, 0xab, 0xa0, 0x22, 0x73, 0x36, 0x53, 0x33, 0x24, 0x43, 0x21, 0x01, 0x91,
+	0xa0, 0xca, 0xba, 0xac, 0xab, 0xcb, 0xba, 0xaa, 0xbd, 0xca, 0xad, 0xac, 0xcb, 0xbc, 0xba, 0xba,
+	0xba, 0x9a, 0x08, 0x02, 0x16, 0x42, 0x23, 0x14, 0x14, 0x23, 0x14, 0x14, 0x24, 0x43, 0x24, 0x34,
+	0x42, 0x31, 0x22, 0x12, 0x80, 0xb0, 0xba, 0xbf, 0xc9, 0xbb, 0x9c, 0xab, 0xaa, 0xba, 0xb0, 0xc8,
+	0x8b, 0xbc, 0xc0, 0x8b, 0x0c, 0x08, 0x88, 0x86, 0x24, 0x33, 0x40, 0x03, 0x08, 0xd8, 0xc8, 0x9f,
+	0xc9, 0xa9, 0xa9, 0xa8, 0x83, 0x43, 0x33, 0x27, 0x23, 0x02, 0x02, 0x08, 0xc8, 0xc8, 0xc0, 0x80,
+	0x34, 0x73, 0x52, 0x32, 0x25, 0x22, 0x13, 0x08, 0xa8, 0xda, 0xae, 0xcb, 0xbb, 0xac, 0xbb, 0x99,
+	0x89, 0x80, 0x20, 0x30, 0x40, 0x08, 0x8c, 0xcb, 0xcb, 0x0b, 0x8c, 0x00, 0x53, 0x73, 0x53, 0x42,
+	0x23, 0x24, 0x02, 0x12, 0x01, 0x8a, 0xea, 0x99, 0x9c, 0x9a, 0xaa, 0x08, 0x48, 0x02, 0x33, 0x04,
+	0x03, 0xd0, 0xcb, 0xfb, 0xbb, 0xbc, 0xcb, 0x99, 0x0a, 0x08, 0x32, 0x37, 0x43, 0x33, 0x42, 0x21,
+	0x08, 0xa8, 0xfb, 0xc9, 0xaa, 0x9b, 0x8a, 0x3a, 0x38, 0x27, 0x53, 0x22, 0x13, 0x02, 0xb2, 0xca,
+	0xfa, 0xba, 0xac, 0xcb, 0xaa, 0x09, 0x08, 0x22, 0x17, 0x33, 0x42, 0x41, 0x11, 0x02, 0x82, 0x08,
+	0x30, 0x40, 0x53, 0x32, 0x37, 0x41, 0x13, 0x84, 0x82, 0xa0, 0xbd, 0xbe, 0xeb, 0xca, 0xba, 0xab,
+	0x00, 0xec, 0x33, 0x00, 0xab, 0x8a, 0x08, 0x11, 0x22, 0x45, 0x31, 0x21, 0x21, 0x83, 0x80, 0x48,
+	0x30, 0x44, 0x62, 0x25, 0x34, 0x25, 0x32, 0x22, 0x11, 0x80, 0xca, 0xeb, 0xbb, 0xac, 0xab, 0x9b,
+	0x0a, 0x28, 0x23, 0x36, 0x14, 0x14, 0x08, 0xa8, 0xcc, 0xbb, 0xcc, 0xab, 0xa9, 0x89, 0x20, 0x32,
+	0x17, 0x14, 0x11, 0x80, 0xda, 0xcb, 0xdb, 0xcb, 0xab, 0xba, 0x98, 0x12, 0x52, 0x45, 0x24, 0x43,
+	0x22, 0x14, 0x13, 0x11, 0x11, 0x08, 0x82, 0x80, 0x20, 0x30, 0x04, 0x43, 0x84, 0x83, 0x8b, 0xfc,
+	0xcc, 0xdb, 0xbc, 0xdb, 0xbb, 0xbb, 0xcb, 0xaa, 0x99, 0x18, 0x31, 0x26, 0x25, 0x33, 0x24, 0x32,
+	0x22, 0x11, 0x01, 0xa8, 0x80, 0x30, 0x48, 0x36, 0x34, 0x63, 0x22, 0x12, 0x01, 0x9a, 0xfa, 0xbb,
+	0xae, 0xac, 0xa9, 0x8a, 0x08, 0x11, 0x43, 0x53, 0x22, 0x13, 0x01, 0xaa, 0xdd, 0xcb, 0xdb, 0xaa,
+	0xbb, 0xa9, 0x98, 0x21, 0x42, 0x34, 0x43, 0x33, 0x14, 0x21, 0x22, 0x38, 0x08, 0x03, 0x34, 0x25,
+	0x73, 0x21, 0x23, 0x22, 0x30, 0x08, 0x8c, 0xcb, 0xcb, 0xfb, 0xb9, 0xca, 0xc9, 0xa9, 0xab, 0xba,
+	0xb0, 0x80, 0x40, 0x34, 0x33, 0x34, 0x27, 0x21, 0x20, 0x0b, 0xcb, 0xeb, 0xca, 0xcb, 0xb9, 0x0a,
+	0x3b, 0x38, 0x43, 0x73, 0x11, 0x14, 0x10, 0x00, 0x88, 0x80, 0x00, 0x58, 0x43, 0x63, 0x42, 0x43,
+	0x31, 0x82, 0x83, 0xab, 0xdc, 0xca, 0xcb, 0xbb, 0xca, 0xa9, 0xa0, 0x08, 0x08, 0x0c, 0x08, 0x8c,
+	0x8b, 0xd0, 0x08, 0x40, 0x48, 0x24, 0x26, 0x21, 0x22, 0x80, 0xc0, 0xc0, 0xba, 0xcb, 0x0b, 0x08,
+	0x58, 0x43, 0x73, 0x11, 0x22, 0x08, 0xa8, 0xac, 0x9f, 0x9b, 0x9a, 0x0b, 0x20, 0x54, 0x34, 0x63,
+	0x22, 0x11, 0x81, 0xa0, 0xda, 0xcb, 0xbb, 0xbc, 0xa9, 0xb9, 0x30, 0x38, 0x34, 0x48, 0x08, 0x08,
+	0x00, 0xfd, 0x23, 0x00, 0xcc, 0xbb, 0xdb, 0x80, 0x80, 0x74, 0x33, 0x34, 0x43, 0x13, 0x84, 0x82,
+	0xaa, 0xaa, 0xce, 0x9a, 0xac, 0x9a, 0x9a, 0x8a, 0xab, 0xb8, 0x8c, 0xcb, 0x0c, 0x08, 0x48, 0x54,
+	0x34, 0x35, 0x44, 0x23, 0x23, 0x13, 0x11, 0xa0, 0xaa, 0xeb, 0xc9, 0xa9, 0xa9, 0xb0, 0xb0, 0xcb,
+	0xfb, 0xdb, 0xcb, 0xbb, 0xae, 0x99, 0x9a, 0x10, 0x31, 0x63, 0x24, 0x24, 0x23, 0x12, 0x02, 0x08,
+	0x0a, 0xaa, 0x08, 0x48, 0x78, 0x41, 0x31, 0x41, 0x28, 0xa8, 0xaa, 0xeb, 0xcb, 0xb9, 0xaa, 0x0a,
+	0x38, 0x30, 0x04, 0x48, 0x8b, 0xdb, 0xfb, 0xbb, 0xca, 0xc9, 0x09, 0x88, 0x20, 0x83, 0x24, 0x33,
+	0x84, 0x24, 0x30, 0x43, 0x24, 0x73, 0x33, 0x42, 0x23, 0x01, 0x08, 0xbb, 0xec, 0xcb, 0xbb, 0x9c,
+	0xab, 0xa0, 0x08, 0x38, 0x80, 0x85, 0xc0, 0x80, 0x80, 0x80, 0x60, 0x43, 0x36, 0x34, 0x23, 0x14,
+	0x82, 0x80, 0xfa, 0xd9, 0xaa, 0xbb, 0xbb, 0x9c, 0xa9, 0xb0, 0x00, 0xb8, 0xc8, 0x80, 0x0c, 0x08,
+	0x58, 0x73, 0x44, 0x43, 0x34, 0x33, 0x14, 0x13, 0x11, 0xa0, 0xa9, 0xac, 0xbc, 0xca, 0xa9, 0xaa,
+	0xaa, 0x9f, 0xbb, 0xae, 0xcb, 0xbb, 0xcb, 0x98, 0x2a, 0x21, 0x26, 0x44, 0x42, 0x32, 0x21, 0x12,
+	0x01, 0x08, 0xa8, 0x00, 0x88, 0x34, 0x48, 0x08, 0x80, 0xfc, 0xea, 0xba, 0xbc, 0xab, 0xbb, 0xa0,
+	0x22, 0x35, 0x44, 0x43, 0x22, 0x13, 0x01, 0x80, 0x8a, 0x0b, 0x08, 0x08, 0x45, 0x83, 0x34, 0xb8,
+	0xc8, 0xcf, 0xac, 0xbc, 0xbb, 0x8c, 0x9b, 0x80, 0x12, 0x15, 0x43, 0x33, 0x14, 0x14, 0x11, 0x20,
+	0x01, 0x23, 0x24, 0x73, 0x21, 0x01, 0x82, 0xb0, 0xcb, 0xfb, 0xbb, 0xcc, 0xab, 0xba, 0xa9, 0xaa,
+	0x8b, 0xc0, 0x80, 0x40, 0x08, 0x84, 0x34, 0x73, 0x32, 0x44, 0x22, 0x33, 0x22, 0x23, 0x80, 0x0c,
+	0x00, 0x0a, 0x26, 0x00, 0xcb, 0x9e, 0xaa, 0xaa, 0xab, 0xac, 0x8b, 0xcb, 0xcb, 0xc0, 0x8a, 0x80,
+	0x80, 0x35, 0x34, 0x17, 0x23, 0x22, 0x22, 0x03, 0x48, 0x80, 0x80, 0x50, 0x80, 0x85, 0x03, 0xd0,
+	0xc0, 0xad, 0xbc, 0xbc, 0xcb, 0x99, 0x0a, 0x22, 0x32, 0x37, 0x21, 0x82, 0x80, 0xeb, 0xca, 0xab,
+	0xb9, 0x80, 0x73, 0x33, 0x36, 0x22, 0x33, 0x10, 0xaa, 0xda, 0xbc, 0xc9, 0xa0, 0x82, 0x15, 0x43,
+	0x41, 0x81, 0xa0, 0xbc, 0xbe, 0xcb, 0xab, 0x9b, 0x10, 0x22, 0x64, 0x22, 0x32, 0x11, 0x80, 0xaa,
+	0x8a, 0xcb, 0x03, 0x73, 0x34, 0x24, 0x33, 0x02, 0xd8, 0xcb, 0xbe, 0xcb, 0xac, 0x9a, 0x89, 0x08,
+	0x12, 0x24, 0x23, 0x23, 0x22, 0x30, 0x48, 0x33, 0x73, 0x35, 0x15, 0x43, 0x12, 0x11, 0xa0, 0xc9,
+	0xdb, 0xdb, 0xab, 0xcb, 0xc9, 0xa8, 0x98, 0x99, 0x89, 0x9a, 0x08, 0x08, 0x73, 0x32, 0x37, 0x42,
+	0x33, 0x43, 0x22, 0x20, 0x98, 0xaa, 0xda, 0xcb, 0xb9, 0xaa, 0xaa, 0xab, 0xac, 0xae, 0xc9, 0xba,
+	0xaa, 0x80, 0x30, 0x37, 0x54, 0x33, 0x35, 0x21, 0x32, 0x88, 0xa0, 0xd9, 0xb9, 0x9c, 0x9c, 0x99,
+	0xca, 0xa9, 0xca, 0xca, 0xab, 0xbc, 0x9a, 0x08, 0x32, 0x57, 0x32, 0x25, 0x33, 0x42, 0x21, 0x18,
+	0x80, 0xa9, 0xa8, 0x8a, 0xcb, 0xb0, 0xbc, 0xfb, 0xac, 0xcb, 0xda, 0xaa, 0x99, 0x09, 0x28, 0x52,
+	0x41, 0x33, 0x34, 0x23, 0x21, 0x83, 0x03, 0x08, 0x58, 0x08, 0xc8, 0x80, 0x8c, 0xbc, 0xac, 0xac,
+	0x8b, 0x80, 0x80, 0x86, 0x24, 0x33, 0x84, 0x84, 0x80, 0x80, 0x8c, 0x0c, 0xc8, 0x80, 0x0c, 0xc8,
+	0xc0, 0xbb, 0xcb, 0xac, 0x8b, 0x8b, 0x80, 0x60, 0x73, 0x32, 0x52, 0x31, 0x22, 0x22, 0x38, 0x80,
+	0xd0, 0xb0, 0x0c, 0xdc, 0xca, 0xc9, 0xbb, 0xca, 0xa9, 0xaa, 0x83, 0x73, 0x33, 0x54, 0x33, 0x52,
+	0x00, 0x0b, 0x33, 0x00, 0x12, 0x11, 0x10, 0x08, 0x98, 0xb8, 0xb0, 0xbc, 0xfb, 0xcc, 0xcb, 0xac,
+	0xbc, 0xac, 0xab, 0x99, 0x08, 0x11, 0x63, 0x33, 0x34, 0x63, 0x22, 0x32, 0x33, 0x34, 0x43, 0x43,
+	0x11, 0x11, 0xb9, 0xec, 0xbb, 0xae, 0xcb, 0xaa, 0xaa, 0x98, 0x80, 0x11, 0x13, 0x21, 0x22, 0x08,
+	0x02, 0x43, 0x57, 0x33, 0x35, 0x53, 0x22, 0x11, 0x99, 0xca, 0xbc, 0xae, 0xba, 0xbb, 0xa9, 0x99,
+	0x09, 0x08, 0x08, 0x0b, 0x48, 0x68, 0x52, 0x34, 0x26, 0x34, 0x32, 0x13, 0x02, 0xa0, 0xbb, 0xdd,
+	0xab, 0xbb, 0xbb, 0xa9, 0x9a, 0xaa, 0xab, 0xbe, 0x9c, 0x9c, 0x09, 0x21, 0x64, 0x53, 0x33, 0x34,
+	0x32, 0x22, 0x28, 0x0a, 0xaa, 0xac, 0xa9, 0xab, 0xbb, 0xec, 0xcb, 0xdb, 0xcb, 0xcb, 0x9a, 0x8a,
+	0x10, 0x43, 0x35, 0x43, 0x24, 0x22, 0x21, 0x10, 0x98, 0xa8, 0xb0, 0xb0, 0xc8, 0x8b, 0xbc, 0xcb,
+	0xac, 0xbb, 0xc8, 0x03, 0x84, 0x27, 0x51, 0x11, 0x21, 0x38, 0x38, 0x38, 0x40, 0x48, 0x48, 0x08,
+	0xc8, 0xfa, 0xdb, 0xac, 0xdb, 0xca, 0xa9, 0x99, 0x80, 0x10, 0x31, 0x34, 0x41, 0x33, 0x14, 0x43,
+	0x53, 0x42, 0x22, 0x33, 0x21, 0x01, 0xa8, 0xfa, 0xba, 0xac, 0xba, 0x0a, 0x0a, 0x02, 0x83, 0x04,
+	0xc8, 0xc0, 0x9e, 0xca, 0x9a, 0x0a, 0x0b, 0x48, 0x08, 0x08, 0x08, 0xbd, 0xbc, 0xcb, 0xeb, 0x98,
+	0x0b, 0x20, 0x30, 0x27, 0x25, 0x43, 0x34, 0x24, 0x43, 0x23, 0x04, 0x83, 0x91, 0xb8, 0xbc, 0xdc,
+	0xab, 0xbc, 0xaa, 0x9b, 0xa9, 0xaa, 0xaa, 0xb8, 0xc8, 0x80, 0x40, 0x70, 0x42, 0x43, 0x33, 0x34,
+	0x23, 0x01, 0x80, 0xbb, 0xbc, 0xfb, 0x9a, 0xca, 0xaa, 0xaa, 0xad, 0xaa, 0x9d, 0x98, 0x28, 0x33,
+	0x47, 0x34, 0x24, 0x24, 0x13, 0x11, 0x80, 0xa9, 0xca, 0xbc, 0xc9, 0x9b, 0x9c, 0xc9, 0xa9, 0xdb,
+	0x00, 0xf5, 0x2f, 0x00, 0x9b, 0x8b, 0x89, 0x32, 0x73, 0x25, 0x43, 0x33, 0x52, 0x11, 0x02, 0x11,
+	0x08, 0x82, 0xb0, 0xb8, 0xcb, 0xbf, 0xbd, 0xbc, 0xad, 0xba, 0xaa, 0x89, 0x10, 0x22, 0x44, 0x13,
+	0x14, 0x21, 0x82, 0x83, 0x03, 0x43, 0x30, 0x04, 0x08, 0xbd, 0xfb, 0xba, 0xda, 0x09, 0x28, 0x22,
+	0x36, 0x43, 0x33, 0x53, 0x11, 0x23, 0x22, 0x15, 0x14, 0x23, 0x82, 0xb0, 0xbe, 0xce, 0xbc, 0xbc,
+	0xac, 0xaa, 0xaa, 0x98, 0x09, 0x81, 0x12, 0x22, 0x32, 0x36, 0x54, 0x43, 0x43, 0x33, 0x43, 0x11,
+	0x81, 0x99, 0xc9, 0xbb, 0x9c, 0xab, 0x0a, 0xab, 0xb8, 0xcb, 0x8b, 0xbc, 0x08, 0x44, 0x36, 0x54,
+	0x32, 0x24, 0x02, 0x82, 0x98, 0xac, 0xcb, 0xad, 0xcb, 0xaa, 0xac, 0xab, 0xad, 0xaa, 0x9b, 0x9a,
+	0x28, 0x53, 0x34, 0x63, 0x32, 0x31, 0x11, 0x22, 0x08, 0x02, 0x33, 0x34, 0x34, 0x43, 0x02, 0x80,
+	0xcc, 0xc0, 0xb0, 0x48, 0x60, 0x42, 0x41, 0x13, 0x22, 0x82, 0x0b, 0xfb, 0xba, 0xda, 0x9b, 0xbc,
+	0xad, 0xac, 0xcb, 0xbb, 0xac, 0xaa, 0x08, 0x48, 0x61, 0x31, 0x34, 0x41, 0x21, 0x11, 0x11, 0x10,
+	0x80, 0x00, 0x88, 0x8b, 0xbc, 0xdd, 0xaa, 0xac, 0x89, 0x80, 0x33, 0x47, 0x52, 0x32, 0x23, 0x33,
+	0x42, 0x21, 0x22, 0x32, 0x02, 0x08, 0xcc, 0xde, 0xbc, 0xad, 0xbc, 0xbb, 0xac, 0x9a, 0x89, 0x81,
+	0x31, 0x43, 0x33, 0x26, 0x23, 0x15, 0x22, 0x23, 0x23, 0x01, 0x08, 0xbb, 0xfb, 0xcb, 0xbb, 0xbc,
+	0xa9, 0x0a, 0x38, 0x48, 0x25, 0x42, 0x14, 0x43, 0x33, 0x34, 0x41, 0x11, 0x02, 0xa8, 0xbb, 0xbf,
+	0xbd, 0xbd, 0xbb, 0xad, 0xab, 0xaa, 0x9b, 0x80, 0x22, 0x44, 0x64, 0x32, 0x34, 0x33, 0x34, 0x22,
+	0x22, 0x00, 0xa9, 0xc9, 0xeb, 0xbb, 0xae, 0xba, 0xcb, 0xaa, 0xab, 0x99, 0x08, 0x48, 0x43, 0x53,
+	0x00, 0xf9, 0x31, 0x00, 0x63, 0x22, 0x32, 0x23, 0x12, 0x82, 0x98, 0xda, 0xac, 0xbd, 0xad, 0xcb,
+	0xbb, 0xbb, 0xbb, 0xaa, 0x29, 0x48, 0x54, 0x34, 0x34, 0x44, 0x32, 0x33, 0x32, 0x12, 0x81, 0x98,
+	0xbc, 0xfb, 0xbb, 0xdb, 0xbb, 0xbc, 0xab, 0xab, 0x9b, 0x89, 0x20, 0x52, 0x63, 0x33, 0x35, 0x33,
+	0x34, 0x23, 0x22, 0x12, 0x80, 0xaa, 0x9e, 0xad, 0xcb, 0xbb, 0xac, 0xba, 0x99, 0x0a, 0x08, 0x32,
+	0x43, 0x16, 0x34, 0x41, 0x21, 0x21, 0x02, 0x08, 0xc8, 0xca, 0xad, 0xbc, 0xca, 0xab, 0x9c, 0x0a,
+	0x08, 0x32, 0x43, 0x36, 0x42, 0x23, 0x14, 0x14, 0x12, 0x20, 0x08, 0xb8, 0x0c, 0x9f, 0xba, 0xda,
+	0xb9, 0xaa, 0x0a, 0x80, 0x30, 0x40, 0x73, 0x22, 0x15, 0x23, 0x22, 0x38, 0x08, 0x0c, 0x9f, 0xba,
+	0xcc, 0xba, 0x9c, 0x9b, 0x89, 0x08, 0x20, 0x24, 0x26, 0x43, 0x43, 0x33, 0x34, 0x23, 0x22, 0x82,
+	0xb0, 0xbc, 0xbf, 0xeb, 0xba, 0xda, 0xa9, 0x9a, 0x0b, 0x0a, 0x28, 0x20, 0x26, 0x73, 0x21, 0x24,
+	0x42, 0x21, 0x12, 0x01, 0xa0, 0xca, 0xbc, 0xbd, 0xbc, 0x9c, 0xab, 0x99, 0x9a, 0x28, 0x32, 0x45,
+	0x53, 0x43, 0x33, 0x16, 0x12, 0x22, 0x81, 0x80, 0xc9, 0xbb, 0xcc, 0xbc, 0xeb, 0xaa, 0xba, 0xab,
+	0xba, 0x89, 0x22, 0x52, 0x35, 0x34, 0x25, 0x33, 0x33, 0x24, 0x12, 0x83, 0x80, 0xca, 0xbc, 0xbd,
+	0xcd, 0xba, 0xac, 0xab, 0xaa, 0x98, 0x18, 0x32, 0x44, 0x34, 0x35, 0x53, 0x32, 0x32, 0x22, 0x20,
+	0x88, 0xa9, 0xac, 0xae, 0xac, 0xbb, 0xda, 0xaa, 0x9a, 0xa9, 0xa0, 0x02, 0x62, 0x32, 0x54, 0x32,
+	0x32, 0x43, 0x21, 0x21, 0x80, 0xb0, 0xfb, 0xcc, 0xca, 0xac, 0xbb, 0xba, 0x9a, 0x0a, 0x28, 0x62,
+	0x41, 0x32, 0x45, 0x22, 0x25, 0x22, 0x22, 0x02, 0x08, 0xca, 0xc9, 0xbc, 0xba, 0xcb, 0xbb, 0x9c,
+	0x00, 0xf7, 0x2d, 0x00, 0xc9, 0xa9, 0x89, 0x02, 0x72, 0x22, 0x43, 0x33, 0x21, 0x22, 0x03, 0x33,
+	0x34, 0x40, 0x08, 0xc8, 0xaf, 0xcb, 0xac, 0xc9, 0x99, 0x08, 0x08, 0x08, 0x80, 0x84, 0x30, 0x34,
+	0x64, 0x21, 0x14, 0x20, 0x08, 0x0b, 0xcb, 0xc0, 0xb0, 0x08, 0xc8, 0x08, 0xcc, 0xc0, 0xb0, 0xb8,
+	0x08, 0x08, 0x8e, 0x80, 0x0c, 0x08, 0x08, 0x36, 0x48, 0x17, 0x32, 0x22, 0x25, 0x41, 0x82, 0x22,
+	0x08, 0xbb, 0xbc, 0xfb, 0x9c, 0x9b, 0x9c, 0xa9, 0x9c, 0xaa, 0x0a, 0xab, 0x88, 0x04, 0x73, 0x22,
+	0x15, 0x12, 0x14, 0x22, 0x22, 0x33, 0x33, 0x80, 0xe0, 0xfb, 0xbb, 0xbc, 0xa9, 0xa9, 0x08, 0x38,
+	0x40, 0x48, 0x30, 0x43, 0x73, 0x24, 0x43, 0x11, 0x01, 0xaa, 0xbd, 0xbc, 0xab, 0x9c, 0xca, 0xa9,
+	0x9c, 0x9c, 0x9a, 0x2a, 0x32, 0x56, 0x14, 0x23, 0x13, 0x11, 0x80, 0x02, 0x23, 0x24, 0x33, 0x80,
+	0xcc, 0xcf, 0xcb, 0xba, 0xb9, 0x90, 0x01, 0x08, 0x08, 0x08, 0x08, 0x58, 0x27, 0x26, 0x23, 0x31,
+	0x80, 0xd9, 0xc9, 0xba, 0x9a, 0x0a, 0x0b, 0x08, 0xc8, 0x0b, 0xcc, 0x83, 0x54, 0x62, 0x22, 0x33,
+	0x21, 0x80, 0xb0, 0xb8, 0x80, 0x80, 0xb6, 0xc0, 0xfb, 0xbb, 0xbc, 0xc9, 0xa0, 0x80, 0x02, 0x08,
+	0x08, 0xd0, 0x80, 0x84, 0x17, 0x24, 0x33, 0x22, 0x08, 0x0b, 0xcb, 0xc0, 0x80, 0x80, 0x80, 0x0d,
+	0xbc, 0xc0, 0x80, 0x34, 0x33, 0x27, 0x22, 0x20, 0x8a, 0xc0, 0x08, 0x08, 0xd8, 0x08, 0x0d, 0xdc,
+	0x9a, 0xab, 0x8a, 0x0b, 0x08, 0x8d, 0xcb, 0xac, 0x0b, 0x8c, 0x24, 0x33, 0x27, 0x51, 0x11, 0x21,
+	0x22, 0x52, 0x42, 0x23, 0x14, 0x80, 0xaa, 0xfa, 0xba, 0xca, 0x99, 0x0a, 0xba, 0xad, 0xd9, 0x9b,
+	0x0a, 0x08, 0x62, 0x43, 0x13, 0x04, 0x81, 0x20, 0x08, 0x33, 0x27, 0x23, 0x80, 0xfa, 0xda, 0xbb,
+	0x00, 0xf9, 0x30, 0x00, 0xac, 0x88, 0x10, 0x28, 0x82, 0x80, 0x30, 0x78, 0x54, 0x53, 0x33, 0x33,
+	0x01, 0x99, 0xad, 0xac, 0x9a, 0x8a, 0xa9, 0xd9, 0xdb, 0xdb, 0xab, 0x99, 0x10, 0x53, 0x34, 0x33,
+	0x13, 0x11, 0x80, 0x20, 0x33, 0x26, 0x84, 0x80, 0xec, 0xbb, 0xbc, 0x9b, 0x89, 0x21, 0x34, 0x22,
+	0x22, 0x08, 0x30, 0x70, 0x45, 0x42, 0x23, 0x02, 0x98, 0xbe, 0xdb, 0xac, 0x9b, 0x9a, 0x99, 0x98,
+	0xa0, 0xaa, 0x0a, 0x08, 0x37, 0x36, 0x35, 0x33, 0x23, 0x81, 0x99, 0x9c, 0xa9, 0x08, 0x32, 0x33,
+	0xc8, 0xfb, 0xad, 0xac, 0x09, 0x31, 0x63, 0x23, 0x12, 0xa0, 0xe9, 0xba, 0xaa, 0x09, 0x28, 0x80,
+	0xbb, 0xdf, 0xac, 0xbb, 0x88, 0x41, 0x34, 0x34, 0x22, 0x13, 0x80, 0x22, 0x62, 0x25, 0x23, 0x13,
+	0xa0, 0xdc, 0xac, 0xcb, 0xa9, 0x89, 0x80, 0x80, 0xa0, 0x8a, 0x0b, 0x48, 0x37, 0x63, 0x22, 0x81,
+	0xa0, 0xcb, 0xcb, 0x9b, 0xa8, 0x80, 0xb0, 0x9f, 0xcc, 0x9a, 0x8a, 0x41, 0x53, 0x25, 0x22, 0x12,
+	0x11, 0x18, 0x42, 0x45, 0x31, 0x32, 0x98, 0xfb, 0xcb, 0xbb, 0xaa, 0x98, 0x08, 0x98, 0xcc, 0xbd,
+	0xac, 0x9a, 0x10, 0x34, 0x45, 0x22, 0x10, 0x08, 0x99, 0x18, 0x34, 0x55, 0x22, 0x12, 0xa8, 0xbb,
+	0xad, 0x9a, 0x08, 0x23, 0x22, 0xb0, 0xbf, 0xaf, 0xbb, 0x9a, 0x80, 0x53, 0x42, 0x12, 0x00, 0x98,
+	0xa9, 0x08, 0x32, 0x57, 0x22, 0x81, 0xb8, 0xfb, 0xbb, 0x9b, 0x8a, 0x21, 0x42, 0x22, 0x08, 0xbb,
+	0x9f, 0x08, 0x34, 0x46, 0x33, 0x23, 0x00, 0xda, 0xaa, 0xbb, 0x19, 0x20, 0x02, 0xb8, 0xff, 0xca,
+	0xba, 0x89, 0x20, 0x52, 0x22, 0x12, 0x01, 0x89, 0x20, 0x35, 0x37, 0x23, 0x03, 0xb0, 0xbd, 0xbe,
+	0xa9, 0x09, 0x18, 0x10, 0xa9, 0xdc, 0xba, 0x8a, 0x10, 0x37, 0x33, 0x32, 0x01, 0xaa, 0x0a, 0x08,
+	0x00, 0x02, 0x26, 0x00, 0x37, 0x25, 0x11, 0xc0, 0xba, 0x9e, 0x9a, 0x08, 0x21, 0x08, 0xcb, 0xec,
+	0xba, 0x99, 0x08, 0x63, 0x32, 0x12, 0x12, 0x80, 0x08, 0x63, 0x43, 0x34, 0x11, 0x98, 0xdc, 0xac,
+	0xaa, 0x0b, 0x19, 0x08, 0xb0, 0xba, 0x9f, 0x98, 0x21, 0x37, 0x33, 0x05, 0x11, 0x90, 0x0a, 0x08,
+	0x38, 0x38, 0x80, 0xf0, 0xae, 0xad, 0xaa, 0x9b, 0x10, 0x10, 0x32, 0x08, 0x88, 0x40, 0x64, 0x43,
+	0x25, 0x23, 0x21, 0xa8, 0xd9, 0xb9, 0xaa, 0x0a, 0x08, 0x8b, 0xbc, 0xec, 0xab, 0xaa, 0x20, 0x27,
+	0x43, 0x32, 0x80, 0xd0, 0xb9, 0xaa, 0x00, 0x62, 0x12, 0x80, 0xea, 0xbb, 0xbc, 0x80, 0x44, 0x34,
+	0x14, 0x00, 0xd9, 0xaa, 0x9a, 0x28, 0x53, 0x24, 0x02, 0xb8, 0xbc, 0x9b, 0x2a, 0x35, 0x36, 0x12,
+	0xb8, 0xfb, 0xac, 0x9b, 0x88, 0x38, 0x11, 0x80, 0xbc, 0xbc, 0x8b, 0x52, 0x64, 0x33, 0x24, 0x01,
+	0x80, 0x80, 0x10, 0x21, 0x14, 0x00, 0xbd, 0xdd, 0xbb, 0xbb, 0x9a, 0x99, 0xa9, 0xaa, 0xba, 0x0b,
+	0x24, 0x37, 0x45, 0x22, 0x32, 0x12, 0x42, 0x11, 0x14, 0x01, 0xa0, 0xdb, 0xae, 0xaa, 0x9b, 0x08,
+	0x08, 0x80, 0xbb, 0x0c, 0x8b, 0x34, 0x64, 0x23, 0x22, 0xab, 0xfb, 0xbb, 0xaa, 0x20, 0x33, 0x83,
+	0x04, 0xc8, 0x0b, 0x8c, 0x34, 0x46, 0x13, 0x84, 0x80, 0xd9, 0xb9, 0xaa, 0x80, 0x30, 0x48, 0x38,
+	0xc0, 0x08, 0x0c, 0x03, 0x37, 0x24, 0x14, 0x80, 0xda, 0xeb, 0xba, 0xaa, 0x99, 0x08, 0x82, 0x8a,
+	0xbb, 0x8c, 0x4b, 0x73, 0x45, 0x32, 0x14, 0x11, 0x09, 0x9a, 0x08, 0x22, 0x33, 0x08, 0xfc, 0xbd,
+	0xbc, 0xab, 0x89, 0x12, 0x14, 0x23, 0x08, 0x8a, 0x08, 0x64, 0x43, 0x33, 0x84, 0xc0, 0xbb, 0xae,
+	0xaa, 0x89, 0x80, 0x80, 0x0a, 0xcb, 0xb0, 0x43, 0x56, 0x42, 0x23, 0x14, 0x10, 0x01, 0x28, 0xa8,
+	0x00, 0x0d, 0x29, 0x00, 0x9d, 0xdc, 0xbb, 0xac, 0xaa, 0x89, 0x10, 0x20, 0x08, 0x08, 0x43, 0x24,
+	0x36, 0x34, 0x21, 0xa0, 0xdb, 0xaa, 0x0a, 0x23, 0x24, 0x80, 0xcb, 0xfb, 0x9a, 0x2a, 0x52, 0x54,
+	0x02, 0x01, 0xa9, 0x89, 0x0a, 0x38, 0x48, 0x08, 0xbc, 0xce, 0xbb, 0x9a, 0x28, 0x33, 0x48, 0xb8,
+	0xcb, 0xcb, 0x08, 0x24, 0x24, 0x03, 0x03, 0x58, 0x30, 0x34, 0x27, 0x21, 0x80, 0xba, 0xb8, 0x8c,
+	0x84, 0x24, 0x80, 0xcb, 0xfb, 0xca, 0x99, 0x98, 0x88, 0x80, 0xbb, 0xfc, 0x89, 0x20, 0x44, 0x44,
+	0x23, 0x22, 0x98, 0xa8, 0xaa, 0x8a, 0x80, 0x80, 0xd8, 0xec, 0xeb, 0xaa, 0x9a, 0x28, 0x43, 0x24,
+	0x43, 0x11, 0x28, 0x28, 0x53, 0x26, 0x22, 0x01, 0xcb, 0xce, 0xca, 0xaa, 0x98, 0x81, 0x11, 0x80,
+	0xa9, 0xa0, 0x38, 0x56, 0x25, 0x22, 0x82, 0x90, 0xcb, 0x09, 0x08, 0x22, 0x82, 0xca, 0xcd, 0xbb,
+	0x9a, 0x58, 0x41, 0x41, 0x18, 0x80, 0x00, 0x22, 0x33, 0x84, 0xc0, 0xde, 0xca, 0xaa, 0x80, 0x10,
+	0x12, 0x00, 0xbb, 0xc0, 0x33, 0x57, 0x42, 0x12, 0x81, 0xb9, 0xaa, 0x0a, 0x32, 0x30, 0xbc, 0xfb,
+	0xbf, 0xab, 0x09, 0x11, 0x44, 0x22, 0x13, 0x12, 0x42, 0x34, 0x43, 0x11, 0xc0, 0xcb, 0xcd, 0xba,
+	0xaa, 0x9a, 0x9a, 0xca, 0xa9, 0x80, 0x60, 0x33, 0x36, 0x43, 0x12, 0x12, 0x11, 0x42, 0x41, 0x01,
+	0x98, 0xbf, 0xac, 0x9d, 0x99, 0x00, 0x10, 0x10, 0xa9, 0xaa, 0xba, 0x30, 0x47, 0x32, 0x12, 0xaa,
+	0xda, 0xbc, 0x80, 0x34, 0x26, 0x13, 0x01, 0xa9, 0xbc, 0xaa, 0x22, 0x36, 0x23, 0xa2, 0xdb, 0xdc,
+	0xaa, 0xa8, 0x10, 0x02, 0x08, 0xeb, 0xab, 0xaa, 0x50, 0x44, 0x34, 0x14, 0x12, 0x08, 0x08, 0x08,
+	0x08, 0x80, 0xcb, 0xbe, 0xae, 0xcb, 0xaa, 0x99, 0x89, 0x89, 0x02, 0x63, 0x63, 0x33, 0x35, 0x22,
+	0x00, 0x0d, 0x31, 0x00, 0x12, 0x01, 0xa1, 0xa0, 0xea, 0xbd, 0xbc, 0xbc, 0xaa, 0x9a, 0x08, 0x08,
+	0x08, 0x02, 0x33, 0x37, 0x54, 0x23, 0x32, 0x13, 0x12, 0x83, 0x83, 0x08, 0xbc, 0xcf, 0xba, 0xad,
+	0x9b, 0x9b, 0x9a, 0xa8, 0xbb, 0x40, 0x42, 0x45, 0x25, 0x02, 0x12, 0x28, 0x08, 0x32, 0x02, 0xb3,
+	0xf8, 0xae, 0xdb, 0x8a, 0x99, 0x08, 0x01, 0x82, 0x83, 0x03, 0x27, 0x34, 0x14, 0x12, 0x80, 0xaa,
+	0x9f, 0x89, 0xa9, 0xa8, 0xb0, 0x9f, 0x9a, 0x08, 0x38, 0x83, 0x84, 0x80, 0x0c, 0x48, 0x24, 0x36,
+	0x16, 0x12, 0x98, 0xa9, 0xaa, 0x0a, 0x88, 0x00, 0xed, 0xe9, 0xba, 0x9b, 0x80, 0x42, 0x25, 0x32,
+	0x01, 0x08, 0x08, 0x23, 0x37, 0x23, 0x22, 0xdb, 0xbe, 0xcb, 0xab, 0x89, 0x10, 0x80, 0x80, 0xba,
+	0x80, 0x34, 0x77, 0x32, 0x22, 0x01, 0x98, 0xa9, 0x0a, 0x38, 0x08, 0xc8, 0xfb, 0xac, 0xcb, 0x99,
+	0x89, 0x0a, 0xba, 0xbb, 0x80, 0x35, 0x73, 0x25, 0x23, 0x33, 0x14, 0x24, 0x12, 0x01, 0xaa, 0xeb,
+	0xcb, 0xbb, 0x9c, 0xc9, 0x9b, 0xbc, 0xa9, 0x08, 0x32, 0x33, 0x43, 0x24, 0x30, 0x43, 0x37, 0x23,
+	0x22, 0x08, 0xb8, 0x0c, 0x48, 0x83, 0x84, 0x80, 0xfc, 0xb9, 0xaa, 0xaa, 0xba, 0xdc, 0xbc, 0xab,
+	0x0c, 0x08, 0x22, 0x63, 0x41, 0x33, 0x34, 0x25, 0x24, 0x10, 0x10, 0x89, 0x80, 0x80, 0x80, 0xcb,
+	0xbf, 0xcb, 0xbb, 0x0c, 0x9a, 0xa8, 0xba, 0xeb, 0xaa, 0x00, 0x62, 0x43, 0x13, 0x14, 0x14, 0x11,
+	0x22, 0x22, 0x32, 0x03, 0xd0, 0xc0, 0xad, 0x9c, 0xbc, 0xc9, 0xa9, 0xa9, 0xb0, 0xb0, 0xc0, 0x48,
+	0x38, 0x17, 0x43, 0x01, 0x91, 0x08, 0x08, 0x83, 0x44, 0x02, 0xac, 0xbb, 0xbc, 0x80, 0x04, 0x03,
+	0x08, 0xbe, 0x80, 0x44, 0x65, 0x23, 0x32, 0x08, 0x80, 0x08, 0x20, 0x80, 0xbc, 0xff, 0xcb, 0xaa,
+	0x00, 0xf6, 0x34, 0x00, 0x98, 0x18, 0x80, 0x99, 0xaa, 0x20, 0x46, 0x34, 0x33, 0x81, 0xa9, 0x89,
+	0x80, 0x33, 0x34, 0xb8, 0xbc, 0xaf, 0xa9, 0x28, 0x33, 0x08, 0xbc, 0xec, 0xa9, 0x0a, 0x0b, 0x08,
+	0xb8, 0x88, 0x66, 0x61, 0x32, 0x24, 0x22, 0x33, 0x43, 0x13, 0x84, 0xa0, 0xbc, 0xbe, 0xbb, 0xba,
+	0xba, 0xca, 0xca, 0xcb, 0xa0, 0x12, 0x53, 0x23, 0x01, 0x08, 0xb8, 0xc0, 0x08, 0xc8, 0xbc, 0xae,
+	0xaa, 0x80, 0x73, 0x21, 0x21, 0x22, 0x63, 0x41, 0x41, 0x81, 0xa9, 0xd9, 0xbb, 0x9c, 0x08, 0x0a,
+	0xa8, 0x8b, 0x4b, 0x78, 0x44, 0x33, 0x32, 0x80, 0xa0, 0x88, 0x00, 0x03, 0xd8, 0xcb, 0xbe, 0x0a,
+	0x22, 0x65, 0x22, 0x11, 0x08, 0x9a, 0xa8, 0x08, 0xfb, 0xcc, 0xfb, 0xba, 0xb9, 0x09, 0x88, 0x21,
+	0x11, 0x12, 0x35, 0x35, 0x34, 0x24, 0x11, 0x99, 0xa9, 0xa9, 0xba, 0x8a, 0xbb, 0xbc, 0xbc, 0x30,
+	0x74, 0x13, 0x14, 0x82, 0x80, 0x80, 0x08, 0x0c, 0xfb, 0x9a, 0xac, 0x80, 0x20, 0x63, 0x21, 0x14,
+	0x42, 0x41, 0x13, 0x84, 0x00, 0xad, 0xcb, 0xba, 0x9c, 0xa0, 0xa9, 0xaa, 0xab, 0x38, 0x25, 0x46,
+	0x12, 0xa2, 0xd0, 0xb9, 0x9c, 0xab, 0xca, 0xbc, 0xcb, 0xa9, 0x00, 0x42, 0x27, 0x42, 0x33, 0x43,
+	0x23, 0x33, 0x03, 0xa8, 0xfa, 0xca, 0xaa, 0xba, 0xbb, 0xca, 0xab, 0x89, 0x50, 0x44, 0x24, 0x33,
+	0x81, 0x01, 0x80, 0x02, 0x83, 0x80, 0xfc, 0xba, 0x8a, 0x20, 0x46, 0x12, 0x12, 0xa0, 0xba, 0xbb,
+	0xc0, 0x9f, 0xcd, 0xda, 0xca, 0xa9, 0x89, 0x18, 0x21, 0x33, 0x25, 0x24, 0x53, 0x23, 0x22, 0x11,
+	0xa0, 0xcb, 0xac, 0xcb, 0xba, 0x9c, 0x09, 0x08, 0x52, 0x43, 0x34, 0x24, 0x21, 0x12, 0x12, 0x02,
+	0xbb, 0xfb, 0xad, 0xab, 0xab, 0x89, 0x80, 0x80, 0x00, 0x48, 0x40, 0x73, 0x82, 0xa2, 0xa8, 0xae,
+	0x00, 0xfe, 0x2c, 0x00, 0x9a, 0x08, 0x38, 0x80, 0x58, 0x48, 0x68, 0x32, 0x24, 0x03, 0xa8, 0xce,
+	0xcb, 0xcb, 0xba, 0xba, 0xbb, 0xca, 0x89, 0x22, 0x35, 0x47, 0x33, 0x34, 0x42, 0x13, 0x12, 0x00,
+	0xa0, 0xb9, 0xbc, 0xbd, 0xbc, 0xeb, 0xaa, 0x9a, 0x89, 0x28, 0x11, 0x12, 0x32, 0x38, 0x30, 0x74,
+	0x21, 0x21, 0x02, 0xb8, 0x80, 0x34, 0x34, 0x73, 0x10, 0x89, 0xba, 0xbb, 0x8b, 0xfc, 0xba, 0xcd,
+	0xaa, 0x9b, 0x0a, 0x22, 0x62, 0x31, 0x42, 0x43, 0x33, 0x34, 0x21, 0xa8, 0xea, 0xb9, 0xbc, 0xcb,
+	0xb9, 0xaa, 0xaa, 0x38, 0x37, 0x25, 0x34, 0x22, 0x21, 0x01, 0x01, 0x08, 0xb8, 0xfb, 0xaf, 0xac,
+	0x9b, 0x99, 0x00, 0x11, 0x10, 0x80, 0x80, 0x24, 0x73, 0x33, 0x12, 0x23, 0x08, 0x08, 0x08, 0x35,
+	0x24, 0x24, 0x26, 0x28, 0x08, 0xa8, 0xbf, 0xeb, 0xbb, 0xcb, 0xcb, 0xbb, 0xab, 0xab, 0x80, 0x35,
+	0x55, 0x43, 0x33, 0x32, 0x23, 0x32, 0x11, 0xa0, 0xda, 0xeb, 0xba, 0xcb, 0x89, 0xa9, 0xa9, 0xa0,
+	0x08, 0x48, 0x32, 0x43, 0x83, 0xcb, 0x9f, 0x9c, 0x99, 0x21, 0x22, 0x33, 0x33, 0x25, 0x46, 0x34,
+	0x34, 0x33, 0x81, 0xc9, 0xdb, 0xcb, 0xbb, 0xcb, 0xbb, 0xba, 0x0a, 0x08, 0x35, 0x34, 0x25, 0x32,
+	0x21, 0x01, 0xa8, 0xeb, 0xbd, 0xbc, 0xba, 0x9a, 0x28, 0x21, 0x26, 0x25, 0x43, 0x53, 0x22, 0x23,
+	0x01, 0x99, 0xcb, 0xbb, 0xfb, 0xba, 0xcb, 0xab, 0xbb, 0x89, 0x22, 0x44, 0x13, 0x12, 0x80, 0x80,
+	0x80, 0x04, 0x43, 0x80, 0x0c, 0x08, 0x74, 0x26, 0x25, 0x14, 0x12, 0x01, 0xa9, 0xcb, 0xcc, 0xbc,
+	0xbc, 0xbb, 0xbb, 0xab, 0x09, 0x38, 0x63, 0x44, 0x53, 0x42, 0x22, 0x12, 0x80, 0x98, 0x8a, 0xab,
+	0xab, 0xcb, 0xac, 0xcb, 0x9a, 0x88, 0x15, 0x34, 0x32, 0x12, 0xa0, 0xe8, 0xb9, 0xca, 0xab, 0x9c,
+	0x00, 0xf6, 0x2c, 0x00, 0x0a, 0x38, 0x72, 0x32, 0x26, 0x42, 0x22, 0x12, 0xa2, 0xc0, 0xdb, 0xad,
+	0xbb, 0xab, 0x9a, 0x0a, 0x21, 0x52, 0x43, 0x53, 0x12, 0x13, 0x01, 0xa8, 0xda, 0xbc, 0xeb, 0xab,
+	0xba, 0x89, 0x20, 0x44, 0x44, 0x33, 0x34, 0x32, 0x31, 0x21, 0x01, 0xab, 0xfb, 0xbe, 0xba, 0xac,
+	0xa9, 0x08, 0x11, 0x42, 0x43, 0x41, 0x31, 0x81, 0x02, 0xba, 0xfb, 0xbb, 0xbc, 0xab, 0xa9, 0x38,
+	0x33, 0x37, 0x26, 0x33, 0x32, 0x82, 0xa0, 0xfb, 0xcb, 0xac, 0xcb, 0xaa, 0x99, 0x89, 0x12, 0x24,
+	0x73, 0x41, 0x32, 0x33, 0x24, 0x82, 0x80, 0xcb, 0xbb, 0x9c, 0xa9, 0x80, 0x80, 0x80, 0x30, 0x00,
+	0x85, 0x44, 0x02, 0x08, 0xfc, 0xdb, 0xeb, 0x9a, 0xa9, 0x09, 0x11, 0x33, 0x36, 0x23, 0x25, 0x12,
+	0x13, 0x81, 0x80, 0xaa, 0xbe, 0xbd, 0xbc, 0xbb, 0x09, 0x41, 0x33, 0x34, 0x21, 0x01, 0xa8, 0xb8,
+	0xc0, 0xac, 0xae, 0xcb, 0x9a, 0x0a, 0x68, 0x51, 0x52, 0x23, 0x34, 0x42, 0x11, 0x00, 0x99, 0xbb,
+	0xbe, 0xac, 0xca, 0xa9, 0xba, 0x9a, 0x9a, 0x28, 0x32, 0x16, 0x14, 0x80, 0xa0, 0xba, 0xfb, 0xa0,
+	0x80, 0x20, 0x63, 0x25, 0x44, 0x32, 0x22, 0x22, 0x11, 0x80, 0xb0, 0xed, 0xdb, 0xbb, 0xac, 0x99,
+	0x09, 0x11, 0x33, 0x53, 0x32, 0x12, 0x22, 0x02, 0x08, 0x0c, 0x9f, 0x9c, 0x9b, 0x0a, 0x22, 0x33,
+	0x17, 0x43, 0x31, 0x42, 0x80, 0xbc, 0xbe, 0xbd, 0xbb, 0xbb, 0xba, 0xc9, 0x99, 0x28, 0x42, 0x36,
+	0x25, 0x33, 0x34, 0x21, 0x11, 0x98, 0xa9, 0xaa, 0x80, 0x73, 0x31, 0x34, 0x41, 0x21, 0x21, 0x20,
+	0x08, 0xcb, 0xbe, 0xce, 0xac, 0xbc, 0xaa, 0x0a, 0x20, 0x34, 0x42, 0x21, 0x11, 0x31, 0x12, 0x80,
+	0xba, 0xdf, 0xba, 0xbc, 0xab, 0xb9, 0x08, 0x51, 0x53, 0x43, 0x22, 0x11, 0x98, 0xa0, 0x9d, 0xc9,
+	0x00, 0xf7, 0x2e, 0x00, 0xbb, 0xbc, 0xa9, 0x0a, 0x32, 0x56, 0x63, 0x43, 0x23, 0x32, 0x11, 0x01,
+	0x88, 0xa0, 0xa9, 0xcd, 0x99, 0x89, 0x02, 0x82, 0x80, 0xc0, 0x8b, 0xbc, 0xec, 0xeb, 0xcc, 0xbb,
+	0xbb, 0xab, 0x08, 0x31, 0x44, 0x45, 0x32, 0x32, 0x23, 0x32, 0x81, 0x80, 0xcc, 0xcc, 0xdb, 0xaa,
+	0xab, 0x9a, 0x80, 0x21, 0x34, 0x34, 0x43, 0x01, 0x08, 0x28, 0x30, 0x73, 0x82, 0x82, 0x83, 0x33,
+	0x47, 0x32, 0x25, 0x11, 0x82, 0xd9, 0xda, 0xdb, 0xbb, 0xbb, 0xbb, 0x99, 0x10, 0x22, 0x55, 0x42,
+	0x23, 0x24, 0x22, 0x11, 0xa0, 0xbc, 0xcf, 0xbb, 0xac, 0x9a, 0x08, 0x11, 0x21, 0x12, 0x52, 0x31,
+	0x22, 0x24, 0x28, 0x80, 0x80, 0xc0, 0xb8, 0x08, 0x75, 0x53, 0x43, 0x22, 0x02, 0xb8, 0xf9, 0xbb,
+	0xbc, 0xac, 0xbb, 0xba, 0x99, 0x80, 0x42, 0x46, 0x25, 0x24, 0x23, 0x12, 0x08, 0xa9, 0xca, 0xcc,
+	0xbb, 0xbc, 0xba, 0x8a, 0x88, 0x32, 0x42, 0x63, 0x22, 0x12, 0x21, 0x08, 0xba, 0xba, 0xcb, 0xbb,
+	0x0c, 0x43, 0x47, 0x43, 0x23, 0x11, 0x89, 0xd9, 0xda, 0xbb, 0xae, 0xab, 0x9a, 0x89, 0x10, 0x41,
+	0x45, 0x54, 0x32, 0x23, 0x12, 0x90, 0xba, 0xbc, 0xcc, 0xab, 0xbc, 0x9b, 0x9a, 0x99, 0x10, 0x42,
+	0x63, 0x33, 0x24, 0x81, 0xa0, 0x9b, 0xda, 0xa0, 0x80, 0x32, 0x62, 0x43, 0x33, 0x82, 0x80, 0xb0,
+	0xcb, 0xbb, 0xbf, 0xbe, 0xac, 0xaa, 0x89, 0x32, 0x73, 0x34, 0x34, 0x23, 0x03, 0x91, 0xb9, 0xbb,
+	0xaf, 0xa9, 0xac, 0xcb, 0xab, 0x9b, 0x80, 0x40, 0x43, 0x35, 0x23, 0x12, 0x98, 0xac, 0xa9, 0x08,
+	0x72, 0x22, 0x23, 0x21, 0x80, 0x80, 0xc0, 0xb8, 0xbc, 0xbc, 0xbf, 0xbd, 0xbc, 0x9b, 0x19, 0x41,
+	0x44, 0x33, 0x34, 0x14, 0x12, 0x08, 0xa9, 0xa9, 0xaa, 0xbb, 0xbb, 0xaf, 0xaa, 0x08, 0x02, 0x34,
+	0x00, 0x00, 0x26, 0x00, 0x43, 0x48, 0x02, 0x0c, 0xbe, 0xca, 0xa9, 0x28, 0x53, 0x42, 0x43, 0x11,
+	0x02, 0xa8, 0xeb, 0xc9, 0xa9, 0xab, 0xbd, 0xeb, 0xaa, 0x09, 0x31, 0x54, 0x24, 0x24, 0x23, 0x11,
+	0x98, 0xaa, 0xbc, 0x99, 0xaa, 0xab, 0xbb, 0xbc, 0x30, 0x34, 0x27, 0x14, 0x23, 0x08, 0xd8, 0xdc,
+	0xbb, 0xac, 0x88, 0x01, 0x13, 0x44, 0x52, 0x32, 0x43, 0x21, 0x81, 0x80, 0xa0, 0xfa, 0xad, 0xac,
+	0x9b, 0x08, 0x21, 0x43, 0x32, 0x24, 0x12, 0x91, 0xba, 0xcd, 0xbc, 0xb9, 0xcb, 0xbc, 0xac, 0x09,
+	0x31, 0x46, 0x24, 0x42, 0x22, 0x11, 0x88, 0xcb, 0xca, 0x8a, 0x99, 0x9a, 0xa9, 0xba, 0x80, 0x54,
+	0x44, 0x24, 0x33, 0x11, 0x08, 0xbc, 0xce, 0x9b, 0x8a, 0x10, 0x13, 0x34, 0x41, 0x13, 0x14, 0x12,
+	0x80, 0xb0, 0xbb, 0xfb, 0xbf, 0xac, 0xab, 0x9a, 0x10, 0x53, 0x42, 0x33, 0x52, 0x10, 0x90, 0x98,
+	0x9a, 0xaa, 0xba, 0x9e, 0xbc, 0xc9, 0xa9, 0x80, 0x02, 0x45, 0x33, 0x34, 0x01, 0xa8, 0xba, 0xca,
+	0x30, 0x33, 0x34, 0x34, 0x43, 0x83, 0x80, 0x58, 0x30, 0x34, 0x34, 0xb3, 0xfc, 0xbb, 0xbc, 0xab,
+	0x0a, 0x80, 0x33, 0x48, 0x17, 0x80, 0xa0, 0x38, 0x48, 0x08, 0xb8, 0xfc, 0xdb, 0xcb, 0xaa, 0xba,
+	0x89, 0x12, 0x55, 0x30, 0x12, 0x13, 0x22, 0x44, 0x13, 0x82, 0xb0, 0xb0, 0xcb, 0xfb, 0x99, 0x88,
+	0x20, 0x36, 0x21, 0xa8, 0xb0, 0x8a, 0x08, 0x8c, 0x40, 0x30, 0x35, 0x17, 0x01, 0x82, 0x53, 0x44,
+	0x13, 0x98, 0xea, 0xcb, 0xbc, 0xdb, 0xba, 0xaa, 0x98, 0x81, 0x82, 0x80, 0x38, 0x45, 0x35, 0x23,
+	0x13, 0x12, 0x02, 0xab, 0xfb, 0xbb, 0x08, 0x38, 0x38, 0xb8, 0xbc, 0xbc, 0x80, 0x80, 0x80, 0x76,
+	0x33, 0x34, 0x41, 0x11, 0x40, 0x61, 0x23, 0x23, 0x01, 0x01, 0xaa, 0xbe, 0xdd, 0xba, 0xac, 0x9a,
+	0x00, 0xf9, 0x32, 0x00, 0xaa, 0x8c, 0x9a, 0x08, 0x28, 0x51, 0x33, 0x26, 0x43, 0x02, 0x80, 0xaa,
+	0xa9, 0x9d, 0xc9, 0x89, 0xa9, 0xba, 0x80, 0x0b, 0xc8, 0x48, 0x37, 0x23, 0x14, 0x22, 0x22, 0x83,
+	0x73, 0x32, 0x24, 0x73, 0x12, 0x01, 0xa9, 0xa9, 0xbc, 0xbc, 0xbb, 0xda, 0xbb, 0x9a, 0x08, 0xb8,
+	0x43, 0x73, 0x34, 0x32, 0x12, 0x02, 0xab, 0xfb, 0xc9, 0xba, 0xcb, 0xc9, 0xb9, 0xcb, 0xb9, 0x0a,
+	0x8a, 0x33, 0x73, 0x23, 0x34, 0x34, 0x43, 0x31, 0x34, 0x43, 0x13, 0x22, 0x08, 0xbb, 0x9f, 0xab,
+	0x9c, 0xaa, 0x80, 0xb0, 0xb8, 0xbc, 0x0c, 0x08, 0x34, 0x43, 0x54, 0x42, 0x23, 0x21, 0x80, 0x8a,
+	0x80, 0xd0, 0xfb, 0xaf, 0xbc, 0xba, 0xbc, 0xbb, 0xaa, 0x29, 0x31, 0x34, 0x13, 0x44, 0x24, 0x24,
+	0x22, 0x11, 0x82, 0x82, 0x83, 0xbb, 0xaf, 0x89, 0x20, 0x20, 0x00, 0xc8, 0xc8, 0xcb, 0xeb, 0xca,
+	0xa9, 0x22, 0x35, 0x54, 0x22, 0x32, 0x42, 0x52, 0x21, 0x08, 0x9a, 0xd9, 0xda, 0xdb, 0xbb, 0xab,
+	0x9a, 0x10, 0x80, 0x02, 0x28, 0x43, 0x02, 0x83, 0x80, 0x50, 0x34, 0x08, 0xc8, 0x0c, 0x3b, 0x40,
+	0x24, 0x84, 0x80, 0xc0, 0x08, 0xc8, 0xb8, 0x58, 0x73, 0x32, 0x24, 0x28, 0x80, 0x23, 0x17, 0x12,
+	0x22, 0x32, 0x33, 0x84, 0xc0, 0x8e, 0x89, 0x20, 0x80, 0xcb, 0xb0, 0xc8, 0x80, 0x40, 0x30, 0x57,
+	0x53, 0x02, 0x91, 0xa0, 0xab, 0x9d, 0xab, 0x9c, 0xa8, 0x80, 0xb0, 0xb8, 0x08, 0x08, 0x76, 0x21,
+	0x21, 0x82, 0xb3, 0xcb, 0xbe, 0xaa, 0x0a, 0x80, 0x8b, 0xd0, 0xb0, 0xbc, 0xcb, 0x0b, 0x0c, 0x03,
+	0x03, 0xe0, 0xbb, 0x0c, 0xcb, 0xc0, 0x80, 0x43, 0x73, 0x01, 0x01, 0x8a, 0xba, 0xac, 0xbe, 0xca,
+	0xcb, 0xad, 0x9a, 0x9a, 0x08, 0x28, 0x35, 0x34, 0x25, 0x22, 0x81, 0xa0, 0xa8, 0x80, 0x0b, 0x8c,
+	0x00, 0xf3, 0x25, 0x00, 0x80, 0x08, 0x80, 0xf8, 0xcb, 0xc0, 0xb0, 0xcb, 0xeb, 0x9c, 0x98, 0x28,
+	0x23, 0x26, 0x43, 0x43, 0x13, 0x00, 0xa8, 0x08, 0x33, 0x44, 0x32, 0x43, 0x48, 0x38, 0x80, 0x0c,
+	0xbc, 0xcb, 0xb0, 0xec, 0x9a, 0xaa, 0x62, 0x53, 0x43, 0x43, 0x22, 0x32, 0x81, 0xa0, 0xaa, 0x80,
+	0x33, 0x27, 0x14, 0x21, 0x14, 0x14, 0x80, 0xa0, 0xab, 0xbb, 0xcf, 0xbc, 0xcb, 0x89, 0x18, 0x43,
+	0x33, 0x26, 0x22, 0x83, 0x80, 0x9c, 0x9a, 0xba, 0x8a, 0x80, 0x80, 0xe0, 0xc0, 0xb0, 0xcb, 0xbb,
+	0xcb, 0x9f, 0x9c, 0x99, 0xaa, 0x80, 0x30, 0x37, 0x41, 0x11, 0x02, 0xa8, 0xb8, 0x9f, 0xc9, 0x98,
+	0x82, 0x22, 0x00, 0x83, 0x80, 0x80, 0xf0, 0xbb, 0xaf, 0x89, 0xaa, 0xab, 0xc8, 0x80, 0x34, 0x48,
+	0x08, 0xb8, 0xd8, 0xf0, 0xca, 0x9b, 0x9c, 0xa0, 0x80, 0x02, 0x48, 0x02, 0x33, 0x80, 0x00, 0xf8,
+	0xc0, 0xba, 0xfb, 0xac, 0xeb, 0xa9, 0x9a, 0xa9, 0x80, 0x80, 0x83, 0x33, 0x34, 0x33, 0x25, 0x33,
+	0x27, 0x01, 0x82, 0x03, 0x48, 0x02, 0x24, 0x40, 0x38, 0x8b, 0xdf, 0xab, 0xac, 0xab, 0xa9, 0x38,
+	0x62, 0x63, 0x32, 0x43, 0x22, 0x33, 0x43, 0x11, 0x80, 0x80, 0x80, 0x0b, 0x58, 0x38, 0x40, 0x43,
+	0x08, 0x08, 0xbd, 0x8e, 0x89, 0x32, 0x36, 0x36, 0x63, 0x32, 0x22, 0x11, 0x01, 0x0a, 0xca, 0xc9,
+	0xbb, 0xd9, 0x09, 0x0a, 0x28, 0x30, 0x42, 0x32, 0x80, 0x80, 0xd8, 0x80, 0x80, 0x47, 0x27, 0x42,
+	0x13, 0x12, 0x21, 0x9a, 0xbf, 0xca, 0xac, 0xba, 0xab, 0x8c, 0x99, 0x18, 0x82, 0x22, 0x32, 0x33,
+	0x40, 0x0c, 0xbb, 0x0c, 0x08, 0x58, 0x08, 0x43, 0x03, 0xc8, 0xcf, 0xbc, 0xbc, 0xad, 0xaa, 0xab,
+	0x99, 0xa0, 0x82, 0x02, 0x32, 0x43, 0x33, 0x80, 0x8c, 0xbc, 0xac, 0x9f, 0x0a, 0x8a, 0xb0, 0xb0,
+	0x00, 0xea, 0x25, 0x00, 0xec, 0xcb, 0xdb, 0xcb, 0xab, 0xb9, 0x80, 0x20, 0x22, 0x45, 0x25, 0x22,
+	0x22, 0x23, 0x21, 0x80, 0x8a, 0xbc, 0xc0, 0x80, 0x84, 0x24, 0x03, 0x03, 0xd8, 0x9f, 0xcb, 0x9b,
+	0x0a, 0x08, 0x62, 0x43, 0x25, 0x43, 0x23, 0x32, 0x33, 0x21, 0x20, 0xb0, 0xb8, 0x08, 0x08, 0x86,
+	0x27, 0x41, 0x12, 0x02, 0xa8, 0xcb, 0xba, 0xb8, 0x58, 0x73, 0x53, 0x33, 0x24, 0x24, 0x02, 0x82,
+	0x08, 0xaa, 0xba, 0xfa, 0xa9, 0xa0, 0x38, 0x32, 0x17, 0x32, 0x22, 0x20, 0xc0, 0xb0, 0x8b, 0x80,
+	0x75, 0x51, 0x32, 0x52, 0x21, 0x18, 0x99, 0xbc, 0xeb, 0xbb, 0xac, 0xbb, 0x9a, 0x0a, 0x08, 0x52,
+	0x22, 0x22, 0x02, 0x08, 0xbc, 0xaf, 0xab, 0x08, 0x08, 0x83, 0x44, 0x32, 0xc0, 0xfb, 0xbd, 0xcb,
+	0xac, 0xac, 0x9b, 0x9a, 0x99, 0x01, 0x21, 0x15, 0x23, 0x22, 0xa8, 0xf8, 0xb9, 0xae, 0xaa, 0xa9,
+	0x89, 0x80, 0x80, 0xb0, 0xbc, 0xce, 0xbd, 0xab, 0x9b, 0x9a, 0x08, 0x32, 0x36, 0x34, 0x25, 0x32,
+	0x13, 0x84, 0x80, 0xd9, 0x9b, 0x9c, 0x89, 0x08, 0x32, 0x33, 0x43, 0x80, 0xbc, 0xfb, 0xaa, 0xba,
+	0x30, 0x73, 0x52, 0x43, 0x42, 0x23, 0x33, 0x41, 0x81, 0x82, 0x0a, 0xab, 0x0b, 0x08, 0x34, 0x57,
+	0x42, 0x32, 0x11, 0x91, 0xa8, 0xb0, 0xbb, 0xc8, 0x84, 0x33, 0x27, 0x21, 0x22, 0x33, 0x43, 0x08,
+	0x08, 0x08, 0x68, 0x80, 0x80, 0x35, 0x47, 0x32, 0x14, 0x11, 0x22, 0x82, 0xba, 0xcb, 0x0b, 0x08,
+	0x08, 0x88, 0x00, 0x78, 0x8b, 0x8c, 0xcc, 0x80, 0x80, 0x8c, 0x80, 0x80, 0x06, 0x08, 0x04, 0x34,
+	0x48, 0xc0, 0xbb, 0xfb, 0xda, 0xba, 0x9d, 0xaa, 0x00, 0x88, 0x80, 0x00, 0x88, 0x8b, 0xbd, 0xaf,
+	0x89, 0xaa, 0xab, 0x9f, 0x9a, 0x8a, 0xb0, 0x80, 0x8b, 0xd0, 0xfb, 0x9e, 0xcb, 0x9b, 0x99, 0x89,
+	0x00, 0xe4, 0x2d, 0x00, 0x21, 0x34, 0x42, 0x21, 0x38, 0x88, 0x00, 0xbc, 0xc0, 0xbb, 0xac, 0x0c,
+	0x8b, 0x84, 0x84, 0x30, 0x0c, 0x9f, 0xad, 0xac, 0xaa, 0x08, 0x41, 0x73, 0x22, 0x33, 0x32, 0x11,
+	0x08, 0x8a, 0xaa, 0xcb, 0x8a, 0x0b, 0x08, 0x08, 0x36, 0x24, 0x84, 0xb0, 0xec, 0xcb, 0xbb, 0x9c,
+	0x28, 0x46, 0x63, 0x32, 0x33, 0x31, 0x81, 0x99, 0xbb, 0xbc, 0x9b, 0xaa, 0x0b, 0x48, 0x02, 0x33,
+	0x40, 0x80, 0x0c, 0xaf, 0x9d, 0x9b, 0x28, 0x72, 0x54, 0x33, 0x35, 0x33, 0x12, 0x81, 0x98, 0xda,
+	0xb9, 0x9a, 0x8b, 0x80, 0x22, 0x23, 0x30, 0xc8, 0xc0, 0xeb, 0xca, 0xab, 0x80, 0x20, 0x46, 0x44,
+	0x34, 0x34, 0x22, 0x00, 0xba, 0xdc, 0xcb, 0xbc, 0xaa, 0x8b, 0x89, 0x08, 0x89, 0xa0, 0xca, 0xcc,
+	0xac, 0xbb, 0x99, 0x89, 0x02, 0x35, 0x46, 0x32, 0x43, 0x11, 0x81, 0xba, 0xce, 0xcb, 0xab, 0x9a,
+	0x88, 0x31, 0x53, 0x43, 0x22, 0x81, 0x99, 0xa8, 0x80, 0x80, 0x30, 0x55, 0x34, 0x43, 0x13, 0x82,
+	0x02, 0xeb, 0xdd, 0xcb, 0xbc, 0xba, 0x9a, 0x0a, 0x38, 0x34, 0x24, 0x81, 0x80, 0xa9, 0xca, 0xbc,
+	0xa9, 0x80, 0x32, 0x33, 0x80, 0x40, 0x04, 0xc8, 0xbf, 0xcb, 0xbb, 0xdb, 0xba, 0x08, 0x36, 0x36,
+	0x34, 0x33, 0x43, 0x12, 0x00, 0x99, 0x09, 0x28, 0x01, 0x32, 0x33, 0x43, 0x03, 0xc8, 0xaf, 0xa9,
+	0xac, 0xbc, 0xaa, 0x0a, 0x38, 0x37, 0x25, 0x44, 0x22, 0x12, 0x98, 0xb9, 0xbc, 0xad, 0xba, 0xa9,
+	0xa0, 0x80, 0x80, 0x8b, 0xbc, 0xaf, 0xc9, 0x0a, 0x0a, 0x08, 0x63, 0x34, 0x25, 0x34, 0x42, 0x22,
+	0x20, 0x88, 0xa9, 0xaa, 0xab, 0x8f, 0x29, 0x21, 0x23, 0x33, 0x84, 0xc0, 0xf0, 0xa9, 0xab, 0x08,
+	0x38, 0x43, 0x36, 0x34, 0x21, 0x22, 0x08, 0xb8, 0xcb, 0x9f, 0xba, 0xaa, 0xab, 0x48, 0x38, 0x43,
+	0x00, 0x0e, 0x27, 0x00, 0x33, 0x80, 0xcc, 0x9e, 0x8a, 0x0a, 0x23, 0x37, 0x43, 0x21, 0x08, 0xa8,
+	0xbb, 0xae, 0xaa, 0x00, 0x02, 0x48, 0x30, 0x04, 0x03, 0x08, 0xbe, 0xbb, 0xcf, 0xad, 0xaa, 0xa9,
+	0x20, 0x51, 0x33, 0x14, 0x91, 0xc8, 0xcc, 0xcb, 0x9a, 0x99, 0x28, 0x28, 0x23, 0x80, 0xc0, 0xcb,
+	0x9e, 0xbc, 0xcb, 0xb9, 0xaa, 0x0a, 0x38, 0x43, 0x16, 0x22, 0x82, 0x8a, 0xfb, 0xba, 0xaa, 0x02,
+	0x16, 0x34, 0x23, 0x14, 0xa0, 0xfa, 0xbc, 0xcb, 0xbb, 0xac, 0x9a, 0x10, 0x21, 0x73, 0x21, 0x32,
+	0x11, 0x80, 0xa0, 0x0b, 0xbb, 0x08, 0x08, 0x68, 0x03, 0x34, 0x84, 0x03, 0xc8, 0xac, 0x9f, 0xac,
+	0x9a, 0x0a, 0x52, 0x63, 0x33, 0x34, 0x14, 0x22, 0x13, 0x11, 0x14, 0x23, 0x14, 0x20, 0x22, 0x38,
+	0xc0, 0x30, 0x08, 0xbd, 0xbb, 0xaf, 0xac, 0xa0, 0x22, 0x57, 0x43, 0x33, 0x33, 0x33, 0x81, 0xc0,
+	0xa9, 0xa9, 0xaa, 0xbb, 0x0b, 0x08, 0x85, 0x80, 0x85, 0x84, 0xc0, 0xcd, 0x9b, 0x9c, 0xa9, 0x58,
+	0x35, 0x34, 0x33, 0x23, 0x23, 0xc8, 0xcb, 0x9b, 0x9a, 0xdb, 0xc9, 0xa0, 0xa0, 0xda, 0xc9, 0xa9,
+	0xa0, 0xcc, 0xa9, 0x89, 0x02, 0x72, 0x51, 0x23, 0x23, 0x81, 0xa9, 0xcd, 0xcc, 0xac, 0xaa, 0x8a,
+	0x9a, 0x89, 0x89, 0xa0, 0xae, 0xcb, 0xb9, 0xa9, 0x9c, 0x08, 0x52, 0x23, 0x22, 0x15, 0x12, 0xb3,
+	0xfa, 0xaa, 0xc9, 0xbb, 0xae, 0x9a, 0x99, 0xab, 0xa9, 0xab, 0xb8, 0xfb, 0xaa, 0x8a, 0x83, 0x43,
+	0x36, 0x37, 0x13, 0x03, 0x00, 0xa8, 0xf9, 0x9a, 0x8a, 0x09, 0x0a, 0x8a, 0x80, 0x8b, 0xbc, 0x80,
+	0x44, 0x16, 0x42, 0x43, 0x33, 0x34, 0x63, 0x32, 0x24, 0x12, 0x12, 0x82, 0xa0, 0x08, 0x08, 0x24,
+	0x84, 0x03, 0x08, 0xd8, 0xcb, 0x80, 0x34, 0x37, 0x55, 0x32, 0x43, 0x31, 0x21, 0x11, 0x01, 0x01,
+	0x00, 0x26, 0x2a, 0x00, 0x02, 0x88, 0x00, 0x8c, 0x80, 0xd0, 0xcb, 0x0b, 0xbc, 0x9f, 0xa9, 0x22,
+	0x35, 0x44, 0x44, 0x24, 0x12, 0x80, 0x08, 0xa0, 0xcb, 0x99, 0x0a, 0x08, 0x8b, 0x0b, 0xc8, 0xbc,
+	0xce, 0x9b, 0x9c, 0xc9, 0xa9, 0x10, 0x53, 0x21, 0x14, 0x34, 0x21, 0xa8, 0xea, 0xb9, 0xbe, 0xeb,
+	0xaa, 0xa9, 0xab, 0xac, 0x9b, 0xba, 0xad, 0xbc, 0x9a, 0x9b, 0xa9, 0x08, 0x32, 0x33, 0x03, 0x04,
+	0x8c, 0xcb, 0xbf, 0xcb, 0xad, 0xcb, 0xbb, 0xad, 0xaa, 0x9a, 0x0b, 0x2a, 0x80, 0x80, 0xc0, 0x80,
+	0x03, 0x34, 0x64, 0x35, 0x43, 0x21, 0x01, 0xa1, 0xa9, 0xdb, 0x9a, 0xba, 0xad, 0xca, 0x9a, 0x8a,
+	0x0b, 0x43, 0x16, 0x34, 0x63, 0x22, 0x21, 0x43, 0x32, 0x24, 0x32, 0x23, 0x02, 0xeb, 0xa9, 0xaa,
+	0xba, 0xca, 0x30, 0x83, 0xbc, 0x80, 0x35, 0x33, 0x74, 0x45, 0x33, 0x24, 0x32, 0x24, 0x12, 0x10,
+	0x38, 0x02, 0x08, 0x3b, 0x48, 0xb3, 0x08, 0x58, 0x17, 0x80, 0x80, 0x32, 0x33, 0x47, 0x44, 0x35,
+	0x24, 0x32, 0x33, 0x01, 0x08, 0xa9, 0xc9, 0x99, 0x8a, 0x00, 0x02, 0x08, 0x03, 0xd8, 0xec, 0x89,
+	0xaa, 0xaa, 0x38, 0x47, 0x22, 0x43, 0x34, 0x11, 0x9a, 0xac, 0xfb, 0xcb, 0xcb, 0xb9, 0xa9, 0xbb,
+	0xaa, 0x99, 0xfa, 0xba, 0xb9, 0xb9, 0xae, 0x99, 0x21, 0x21, 0x28, 0x62, 0x01, 0xbc, 0xad, 0xda,
+	0xba, 0xad, 0x9a, 0xa9, 0xda, 0xa9, 0x99, 0xbb, 0x9b, 0x8a, 0x20, 0x8a, 0x80, 0x40, 0x80, 0x80,
+	0x3e, 0x80, 0xd0, 0x9f, 0xab, 0xbc, 0x9c, 0xac, 0xa9, 0xa9, 0xda, 0xba, 0xcc, 0x99, 0xa9, 0x20,
+	0x52, 0x26, 0x33, 0x21, 0x20, 0x08, 0xab, 0xbb, 0x8c, 0x84, 0x80, 0x80, 0x35, 0x33, 0x80, 0x50,
+	0x34, 0x83, 0x80, 0x47, 0x53, 0x32, 0x45, 0x53, 0x22, 0x21, 0x22, 0x11, 0x08, 0x08, 0x28, 0x16,
+	0x00, 0xfe, 0x2d, 0x00, 0x23, 0x54, 0x22, 0x22, 0x12, 0x25, 0x12, 0x21, 0x32, 0x25, 0x14, 0x34,
+	0x63, 0x22, 0x04, 0x32, 0x81, 0xa0, 0x9c, 0xca, 0xab, 0xaa, 0x30, 0x72, 0x41, 0x31, 0x43, 0x08,
+	0x0a, 0xab, 0xfa, 0xaa, 0x09, 0x28, 0x08, 0x83, 0x34, 0xb8, 0xcf, 0xad, 0xca, 0xab, 0xbb, 0x08,
+	0x28, 0x20, 0x32, 0x17, 0xa0, 0xb9, 0x9d, 0xbc, 0xcb, 0x0b, 0x82, 0x82, 0x00, 0x83, 0xf0, 0xcd,
+	0xac, 0xaa, 0xab, 0x8b, 0x40, 0x21, 0x08, 0x38, 0x08, 0xec, 0xab, 0x80, 0x80, 0x9e, 0x88, 0xa0,
+	0xfb, 0xad, 0x8a, 0xcb, 0xca, 0x98, 0x08, 0x98, 0x0a, 0x82, 0xb0, 0x9f, 0x9a, 0xaa, 0xbd, 0xaa,
+	0x52, 0x82, 0x20, 0x22, 0x80, 0xff, 0xaa, 0x99, 0xaa, 0x8b, 0x62, 0x23, 0x12, 0x41, 0x22, 0xb8,
+	0xda, 0x10, 0x14, 0x21, 0x54, 0x35, 0x21, 0x01, 0x11, 0xa2, 0xd9, 0x29, 0x11, 0x22, 0x53, 0x46,
+	0x32, 0x12, 0x32, 0x11, 0x80, 0x0a, 0x16, 0x43, 0x31, 0x54, 0x23, 0x81, 0x99, 0x0a, 0xba, 0xba,
+	0x48, 0x56, 0x32, 0x21, 0x24, 0x82, 0xc9, 0x0c, 0x08, 0x0a, 0x2a, 0x65, 0x23, 0x01, 0x18, 0x02,
+	0xdd, 0xbb, 0x89, 0x09, 0xaa, 0x70, 0x24, 0x12, 0x10, 0x33, 0x98, 0xdd, 0x98, 0x91, 0x9a, 0x2a,
+	0x37, 0x12, 0x09, 0x28, 0xc8, 0xcf, 0x9b, 0xa8, 0xb9, 0x09, 0x33, 0x15, 0x90, 0x11, 0xa0, 0xdd,
+	0xac, 0x99, 0xa9, 0xbb, 0x88, 0xb3, 0xfa, 0xaa, 0xc0, 0xdb, 0xcb, 0xaa, 0xba, 0xad, 0x0a, 0x08,
+	0xa0, 0x28, 0x30, 0xb8, 0xbc, 0x9f, 0xa9, 0x9c, 0xaa, 0x80, 0xb3, 0x08, 0x8c, 0xc0, 0xcb, 0x0b,
+	0x08, 0x08, 0x08, 0x46, 0x33, 0x03, 0x44, 0x33, 0x53, 0x32, 0x43, 0x33, 0x84, 0x30, 0x04, 0x03,
+	0x08, 0x45, 0x38, 0x80, 0x50, 0x43, 0x38, 0x64, 0x23, 0x22, 0x02, 0x42, 0x08, 0xb8, 0x03, 0x35,
+	0x00, 0xfe, 0x25, 0x00, 0x30, 0x35, 0x83, 0x00, 0x88, 0x80, 0x0f, 0x3c, 0x43, 0x02, 0x34, 0x73,
+	0x23, 0x80, 0x02, 0x83, 0xc0, 0x0c, 0x48, 0x08, 0x08, 0x34, 0x43, 0x80, 0x40, 0x40, 0xcb, 0xb8,
+	0x40, 0x48, 0x08, 0x73, 0x15, 0x81, 0x10, 0x20, 0xab, 0xbb, 0x08, 0x04, 0xcc, 0x30, 0x83, 0xec,
+	0xaa, 0x0a, 0xab, 0xac, 0x38, 0x04, 0xc8, 0x80, 0x84, 0xbb, 0xaf, 0x08, 0xa8, 0xcb, 0x83, 0x84,
+	0xc0, 0xba, 0x08, 0xcf, 0xbb, 0xaa, 0xac, 0x9c, 0x08, 0x22, 0x08, 0x3b, 0x80, 0xbd, 0xaf, 0x89,
+	0x80, 0x80, 0x73, 0x24, 0x82, 0x82, 0x80, 0xfa, 0xba, 0x9c, 0x09, 0xaa, 0x2a, 0x33, 0x43, 0x3b,
+	0x48, 0xc0, 0xbb, 0x80, 0x35, 0x83, 0x74, 0x25, 0x10, 0x80, 0x10, 0xa9, 0xab, 0x8b, 0xc0, 0xc0,
+	0x0b, 0x08, 0xd8, 0xcb, 0x30, 0x0c, 0x8b, 0x34, 0x27, 0x28, 0x52, 0x23, 0x08, 0x8a, 0x80, 0xcb,
+	0xcb, 0x33, 0x08, 0x04, 0x08, 0xd8, 0xec, 0xab, 0x0a, 0x08, 0x60, 0x54, 0x22, 0x12, 0x31, 0x80,
+	0xaa, 0xba, 0x08, 0x8c, 0x40, 0x43, 0x33, 0x03, 0x44, 0x08, 0xbc, 0x0f, 0x9a, 0xa8, 0x23, 0x36,
+	0x34, 0x23, 0x84, 0xa2, 0xcc, 0x9b, 0xaa, 0xb9, 0x30, 0x33, 0x80, 0x05, 0xc3, 0xcb, 0xca, 0xb0,
+	0x8b, 0x3c, 0x34, 0x33, 0x85, 0x33, 0xc0, 0xfb, 0x9c, 0xb9, 0xbc, 0x19, 0x52, 0x98, 0x0a, 0x22,
+	0xab, 0xdf, 0x20, 0x11, 0x0a, 0x78, 0x33, 0x98, 0x09, 0x11, 0xf0, 0xaa, 0x19, 0xa0, 0xcb, 0x2a,
+	0x34, 0xa0, 0x0a, 0x62, 0xc0, 0xbb, 0x28, 0x22, 0x8a, 0x73, 0x27, 0x90, 0x80, 0x80, 0xb9, 0xae,
+	0x88, 0xa0, 0x89, 0x29, 0x22, 0xb0, 0xbc, 0x30, 0xd0, 0xb0, 0x48, 0x43, 0x08, 0x43, 0x24, 0x03,
+	0x8c, 0xc0, 0xb0, 0xbc, 0x0b, 0x8c, 0x80, 0x80, 0x80, 0x87, 0x80, 0x80, 0x50, 0x34, 0x33, 0x44,
+	0x00, 0x00, 0x28, 0x00, 0x23, 0x84, 0x80, 0x80, 0xd0, 0xb8, 0x8c, 0x84, 0xc0, 0x30, 0x84, 0xb3,
+	0xc8, 0x03, 0x80, 0x08, 0x67, 0x23, 0x22, 0x15, 0x82, 0xb0, 0xad, 0xa0, 0x8a, 0x0b, 0x08, 0x04,
+	0xc8, 0xc8, 0x80, 0xbc, 0x08, 0x80, 0x08, 0x87, 0x24, 0x03, 0x03, 0x04, 0xc3, 0xc0, 0xb8, 0xcc,
+	0xba, 0xb8, 0x08, 0x0d, 0x88, 0xd0, 0xcb, 0x0b, 0xbc, 0xc0, 0x80, 0x34, 0x43, 0x38, 0x80, 0x80,
+	0xfd, 0x0a, 0x0a, 0x0b, 0x08, 0x03, 0xb4, 0x08, 0xbd, 0xbc, 0xcb, 0x0b, 0x0c, 0x08, 0x84, 0x84,
+	0x00, 0x88, 0xd0, 0xc8, 0x80, 0x80, 0x80, 0x36, 0x40, 0x43, 0x38, 0x80, 0x80, 0x0d, 0xcc, 0xb0,
+	0xc0, 0x83, 0x34, 0x48, 0x48, 0x08, 0xc8, 0xca, 0x80, 0x30, 0x40, 0x47, 0x32, 0x12, 0x02, 0x82,
+	0xb0, 0x0c, 0x3c, 0x38, 0x40, 0x30, 0x34, 0xc0, 0xb8, 0x08, 0xd8, 0xc8, 0x30, 0x44, 0x38, 0x43,
+	0x16, 0x82, 0x83, 0x83, 0x08, 0xd0, 0x80, 0x08, 0x80, 0x08, 0x87, 0x80, 0xbc, 0xc0, 0xcb, 0xbb,
+	0x08, 0x04, 0x58, 0x48, 0x02, 0xb8, 0xc8, 0x0c, 0xac, 0xb8, 0x80, 0x04, 0x08, 0x08, 0x8e, 0xcb,
+	0xcb, 0x0b, 0xbc, 0x80, 0x80, 0xe0, 0x80, 0x8b, 0xd0, 0x8b, 0x0c, 0x8c, 0x0b, 0x8c, 0x80, 0x80,
+	0x00, 0x88, 0x00, 0x08, 0xaf, 0xe8, 0xc8, 0x80, 0x80, 0x05, 0x08, 0x84, 0xc0, 0x0c, 0xac, 0xb8,
+	0x80, 0x40, 0x40, 0x80, 0x85, 0x03, 0x08, 0x80, 0x08, 0x07, 0x48, 0x30, 0x40, 0x80, 0x04, 0x08,
+	0x08, 0x78, 0x80, 0xd0, 0x80, 0x80, 0x04, 0x08, 0x04, 0x84, 0x84, 0x30, 0x80, 0xe0, 0x30, 0x48,
+	0x30, 0x44, 0x32, 0x80, 0x80, 0x08, 0x80, 0x08, 0x80, 0x77, 0x38, 0x08, 0x83, 0x80, 0x8c, 0x80,
+	0x80, 0x80, 0x70, 0x50, 0x08, 0x03, 0x44, 0x08, 0x08, 0x04, 0x08, 0xd8, 0x08, 0x04, 0x08, 0x08,
+	0x00, 0x0e, 0x20, 0x00, 0x80, 0xbf, 0x8c, 0xbb, 0xbc, 0x0c, 0x88, 0x00, 0x58, 0x80, 0xb5, 0xb8,
+	0xbc, 0xc8, 0xc0, 0x80, 0x30, 0x00, 0xe8, 0x08, 0xbc, 0xbc, 0xbb, 0xbc, 0xc8, 0x80, 0x08, 0x08,
+	0x80, 0x8f, 0xc0, 0xb8, 0xc8, 0x08, 0x08, 0x60, 0x08, 0x08, 0x08, 0x08, 0x8f, 0x8b, 0xd0, 0x08,
+	0x08, 0x08, 0x86, 0x80, 0x80, 0x80, 0xce, 0x0b, 0x0c, 0x48, 0x48, 0x32, 0x03, 0x84, 0x80, 0x80,
+	0x80, 0x00, 0x47, 0x33, 0x53, 0x32, 0x80, 0x80, 0x0d, 0xc8, 0x80, 0x80, 0x85, 0x40, 0x48, 0x33,
+	0x40, 0x08, 0x84, 0x84, 0x80, 0x04, 0x43, 0x03, 0x34, 0x84, 0x80, 0x0c, 0xbc, 0xbb, 0x8c, 0x3b,
+	0x00, 0x45, 0x38, 0x84, 0x80, 0x00, 0x88, 0x00, 0x78, 0x40, 0x87, 0x82, 0x02, 0x08, 0xbb, 0xaf,
+	0xa0, 0xba, 0x8a, 0x00, 0x03, 0x80, 0x08, 0x80, 0xf8, 0x09, 0x08, 0x08, 0x08, 0x08, 0xaf, 0x8e,
+	0xcb, 0xcb, 0xbb, 0xaf, 0x89, 0x0a, 0xab, 0x88, 0x80, 0x00, 0x0f, 0x08, 0x08, 0x0d, 0x83, 0x04,
+	0x03, 0x04, 0x08, 0xd8, 0xc8, 0xbb, 0xc8, 0x08, 0x58, 0x30, 0x34, 0x34, 0x33, 0x40, 0x80, 0x80,
+	0x60, 0x08, 0x34, 0x84, 0x24, 0x80, 0x80, 0xd0, 0xcb, 0xb8, 0xcb, 0x08, 0x08, 0x08, 0x36, 0x80,
+	0x85, 0x80, 0x80, 0x80, 0x80, 0xf0, 0x88, 0x80, 0x8d, 0x80, 0x0d, 0x08, 0x08, 0x08, 0x08, 0x08,
+	0x08, 0x27, 0x78, 0x30, 0x48, 0x30, 0x34, 0x34, 0x48, 0x83, 0x80, 0x80, 0xe0, 0x8b, 0x0c, 0x0c,
+	0x88, 0x80, 0x00, 0x78, 0x08, 0x0c, 0x8b, 0x0c, 0xbc, 0xc0, 0x80, 0xb8, 0x58, 0x08, 0x08, 0xe0,
+	0xc0, 0xba, 0xcb, 0xbb, 0x0c, 0x8b, 0x80, 0x50, 0x48, 0x84, 0x03, 0x88, 0x80, 0x0d, 0x48, 0x80,
+	0x35, 0x33, 0x44, 0x05, 0x21, 0x83, 0x30, 0x08, 0x08, 0x05, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+	0x00, 0x06, 0x18, 0x00, 0x37, 0x78, 0x80, 0x0c, 0xc8, 0xc0, 0xbb, 0x80, 0x8c, 0x04, 0x48, 0x30,
+	0x0c, 0x0c, 0xdc, 0xca, 0xa9, 0x0a, 0x08, 0x48, 0x38, 0x30, 0x80, 0x80, 0x80, 0x80, 0x9f, 0x50,
+	0x03, 0x08, 0x85, 0x84, 0x84, 0x30, 0x03, 0x04, 0x08, 0x08, 0xbe, 0xc8, 0x80, 0x08, 0x50, 0x24,
+	0x00, 0x03, 0xd8, 0xac, 0xac, 0xbb, 0xc8, 0x3b, 0x00, 0x88, 0x00, 0x88, 0xdf, 0xb0, 0x08, 0x8c,
+	0x80, 0x80, 0xe0, 0x08, 0xc8, 0xc0, 0x48, 0x38, 0x40, 0x30, 0x04, 0x8c, 0x0b, 0xbc, 0x08, 0x58,
+	0x73, 0x32, 0x25, 0x23, 0x08, 0x08, 0xbb, 0xcb, 0x80, 0x84, 0x40, 0x42, 0x02, 0xcb, 0xb8, 0xc0,
+	0xcb, 0x30, 0x48, 0x80, 0x34, 0x80, 0x8c, 0x00, 0x88, 0x87, 0x03, 0x08, 0xd8, 0xcb, 0xbe, 0xaa,
+	0xb9, 0xb0, 0x83, 0x44, 0x38, 0x80, 0x08, 0x0d, 0x08, 0x08, 0x85, 0x44, 0x32, 0x03, 0x84, 0xc0,
+	0xb8, 0xc8, 0x0c, 0x08, 0x08, 0x8d, 0x80, 0x0c, 0xc8, 0x48, 0x30, 0x34, 0x27, 0x23, 0x80, 0xb0,
+	0xf8, 0xa9, 0x08, 0x08, 0x33, 0x34, 0x08, 0xc8, 0xec, 0xc9, 0xa9, 0x89, 0x20, 0x72, 0x22, 0x21,
+	0x28, 0xb0, 0x0b, 0x0c, 0x83, 0x80, 0x35, 0x80, 0xcc, 0xb0, 0xbc, 0xbb, 0x88, 0x05, 0x43, 0x03,
+	0x80, 0xd8, 0xc0, 0xb8, 0x48, 0x34, 0x33, 0x37, 0x01, 0xab, 0xbb, 0xec, 0xab, 0x0a, 0x08, 0x30,
+	0x48, 0xc0, 0xc0, 0x8a, 0xcb, 0x80, 0x40, 0x48, 0x48, 0x02, 0xb8, 0x8c, 0x8b, 0xcc, 0x80, 0x34,
+	0x08, 0x08, 0xd8, 0xcf, 0xaa, 0xa9, 0x89, 0x53, 0x42, 0x21, 0x01, 0xa8, 0xae, 0x89, 0x0a, 0x63,
+	0x43, 0x13, 0x12, 0x80, 0xba, 0x9f, 0x08, 0x28, 0x23, 0x73, 0x80, 0xa0, 0xba, 0xba, 0x48, 0x33,
+	0x64, 0x23, 0x84, 0x80, 0xa0, 0xb8, 0x30, 0x44, 0x25, 0x51, 0x21, 0x08, 0xba, 0x8a, 0x9f, 0x08,
+	0x00, 0x09, 0x2b, 0x00, 0x80, 0x02, 0x38, 0x8b, 0xcc, 0xb0, 0xc8, 0x30, 0x34, 0x84, 0x24, 0x03,
+	0xc8, 0x8b, 0xc0, 0x08, 0x44, 0x83, 0xb4, 0xb8, 0xfc, 0xad, 0x9a, 0x99, 0x80, 0x20, 0x82, 0xb0,
+	0xbc, 0xfb, 0x9a, 0x08, 0x32, 0x33, 0x27, 0x88, 0xac, 0xa9, 0xab, 0x8b, 0x04, 0x83, 0x0c, 0xec,
+	0xcb, 0xad, 0x98, 0x08, 0x28, 0x31, 0x82, 0xb0, 0xc8, 0x8b, 0x3c, 0x34, 0x37, 0x41, 0x13, 0x80,
+	0x0a, 0x0b, 0x0c, 0x08, 0x48, 0x84, 0x30, 0xc8, 0xc0, 0xbb, 0x80, 0x85, 0x73, 0x24, 0x32, 0x21,
+	0x02, 0x08, 0x03, 0x34, 0x43, 0x17, 0x24, 0x82, 0x08, 0xda, 0xc9, 0x9b, 0x08, 0x28, 0x63, 0x21,
+	0x80, 0xb0, 0xbb, 0xbc, 0x30, 0x74, 0x61, 0x21, 0x11, 0x89, 0xa9, 0x9c, 0x9a, 0x82, 0x33, 0x33,
+	0x80, 0xfd, 0xbb, 0xbc, 0x9b, 0x28, 0x62, 0x31, 0x22, 0xa8, 0xfa, 0xb9, 0xa9, 0x80, 0x62, 0x13,
+	0x04, 0xa1, 0xdc, 0xca, 0xaa, 0x9a, 0x28, 0x51, 0x18, 0xa0, 0xd9, 0xdb, 0xaa, 0x98, 0x21, 0x42,
+	0x14, 0x91, 0xaa, 0xdd, 0xbb, 0x99, 0x21, 0x22, 0x35, 0xa2, 0xba, 0xcd, 0xbc, 0x8a, 0x10, 0x24,
+	0x35, 0x12, 0xa0, 0xa9, 0xdb, 0xaa, 0x20, 0x63, 0x41, 0x41, 0xa1, 0xa0, 0xa9, 0x0b, 0x3b, 0x64,
+	0x23, 0x14, 0x84, 0x00, 0xaa, 0x0b, 0x08, 0x78, 0x34, 0x14, 0x13, 0x80, 0x9d, 0xab, 0x9a, 0x88,
+	0x27, 0x43, 0x11, 0x01, 0xb0, 0xbd, 0x0a, 0x80, 0x78, 0x32, 0x12, 0x00, 0xb8, 0xbe, 0x9a, 0x08,
+	0x02, 0x26, 0x14, 0xa0, 0xd8, 0xc9, 0x9b, 0x08, 0x22, 0x36, 0x41, 0x01, 0xa8, 0xac, 0x9c, 0x0a,
+	0x28, 0x63, 0x23, 0x22, 0x08, 0xbb, 0xbc, 0x0b, 0x08, 0x44, 0x17, 0x12, 0x80, 0xba, 0xca, 0x8a,
+	0x30, 0x70, 0x43, 0x82, 0xa0, 0xbb, 0xbf, 0xa9, 0x20, 0x32, 0x72, 0x03, 0xa8, 0xaa, 0xbe, 0x9b,
+	0x00, 0x05, 0x2b, 0x00, 0x80, 0x32, 0x33, 0x08, 0xbf, 0xcc, 0x9b, 0xaa, 0x02, 0x02, 0x03, 0xf8,
+	0xcb, 0x9c, 0xab, 0x28, 0x53, 0x22, 0x82, 0xab, 0xbf, 0xc9, 0xa9, 0x20, 0x24, 0x28, 0x80, 0xbb,
+	0xdf, 0x89, 0x80, 0x20, 0x51, 0x01, 0x0a, 0xab, 0xfa, 0x19, 0x32, 0x52, 0x33, 0x84, 0xa9, 0x9c,
+	0xca, 0x8b, 0x52, 0x11, 0x42, 0x12, 0xca, 0xbc, 0xa9, 0x9a, 0x52, 0x34, 0x21, 0x12, 0xe0, 0xb9,
+	0x0a, 0x82, 0x63, 0x35, 0x11, 0xa2, 0xa9, 0xcd, 0x9b, 0x10, 0x42, 0x43, 0x33, 0x80, 0xda, 0xab,
+	0x9c, 0x28, 0x64, 0x23, 0x23, 0x03, 0xaa, 0xac, 0x80, 0x20, 0x56, 0x14, 0x02, 0x81, 0xbb, 0xae,
+	0x09, 0x28, 0x43, 0x26, 0x12, 0x89, 0xa9, 0x9e, 0x8a, 0x31, 0x31, 0x36, 0x13, 0x99, 0xcb, 0xbb,
+	0x9e, 0x11, 0x33, 0x41, 0x01, 0xbc, 0xaf, 0x9a, 0x9a, 0x20, 0x53, 0x11, 0x91, 0xda, 0xcc, 0x9b,
+	0x0a, 0x38, 0x42, 0x22, 0x98, 0xfa, 0xdb, 0x9a, 0x8a, 0x11, 0x33, 0x83, 0xd0, 0xdb, 0xcb, 0x9a,
+	0x18, 0x62, 0x21, 0x02, 0xa8, 0xcc, 0xcb, 0x99, 0x21, 0x62, 0x22, 0x02, 0xb0, 0xac, 0xad, 0x80,
+	0x31, 0x63, 0x23, 0x01, 0x9a, 0x9c, 0xab, 0x20, 0x55, 0x33, 0x32, 0xa2, 0xca, 0x9c, 0xab, 0x22,
+	0x55, 0x33, 0x14, 0x08, 0xab, 0x9d, 0x0b, 0x28, 0x34, 0x26, 0x10, 0x90, 0xba, 0xcc, 0x09, 0x21,
+	0x34, 0x14, 0x01, 0xaa, 0xdd, 0x9a, 0x19, 0x32, 0x34, 0x16, 0x81, 0xb9, 0xeb, 0x9a, 0x18, 0x31,
+	0x44, 0x13, 0x08, 0xca, 0xcb, 0x9b, 0x28, 0x52, 0x43, 0x21, 0xa8, 0xcc, 0xad, 0x98, 0x11, 0x41,
+	0x33, 0x82, 0xda, 0xeb, 0xab, 0x9a, 0x28, 0x43, 0x32, 0xa2, 0xea, 0xbb, 0xae, 0x0a, 0x11, 0x41,
+	0x31, 0x00, 0x9d, 0x9d, 0xaa, 0x00, 0x43, 0x43, 0x13, 0x00, 0xbd, 0xab, 0x0c, 0x21, 0x64, 0x32,
+	0x00, 0x02, 0x30, 0x00, 0x81, 0x99, 0xca, 0x89, 0x20, 0x15, 0x26, 0x11, 0x88, 0x99, 0x9d, 0x80,
+	0x22, 0x52, 0x21, 0x08, 0xdb, 0xca, 0xab, 0x80, 0x50, 0x22, 0x82, 0xb0, 0xcb, 0xae, 0xab, 0x20,
+	0x38, 0x43, 0x08, 0xc0, 0xac, 0xbb, 0x08, 0x58, 0x43, 0x83, 0x80, 0xcc, 0xbb, 0x8b, 0x50, 0x33,
+	0x27, 0x22, 0xb0, 0xca, 0xfa, 0xa0, 0x20, 0x21, 0x23, 0x80, 0xf0, 0xca, 0x9c, 0x09, 0x88, 0x23,
+	0x02, 0xcb, 0xbe, 0xbc, 0xab, 0x80, 0x62, 0x21, 0x01, 0xba, 0xcd, 0xbb, 0x0a, 0x22, 0x36, 0x23,
+	0x01, 0xb0, 0xae, 0x89, 0x62, 0x32, 0x45, 0x11, 0x81, 0x99, 0x80, 0x40, 0x44, 0x44, 0x13, 0x02,
+	0x98, 0xa9, 0x89, 0x52, 0x24, 0x25, 0x82, 0x80, 0x9b, 0x9d, 0x09, 0x21, 0x24, 0x22, 0xab, 0xfb,
+	0xdb, 0xa9, 0x08, 0x01, 0x22, 0xb8, 0xfa, 0xdb, 0xba, 0x9a, 0x08, 0x28, 0x02, 0xb8, 0xcb, 0x9f,
+	0x9c, 0x09, 0x01, 0x22, 0x02, 0x08, 0xbc, 0xbc, 0x0b, 0x58, 0x38, 0x27, 0x28, 0xb0, 0xb0, 0x9f,
+	0x98, 0x28, 0x23, 0x03, 0x03, 0xd8, 0xcb, 0x9e, 0xaa, 0x80, 0x83, 0x30, 0xbc, 0xfb, 0xda, 0xaa,
+	0x09, 0x28, 0x20, 0x80, 0xcb, 0x9f, 0x9c, 0x09, 0x21, 0x22, 0x16, 0x80, 0x0a, 0xab, 0x08, 0x64,
+	0x23, 0x34, 0x82, 0x80, 0x80, 0x30, 0x74, 0x53, 0x22, 0x03, 0x01, 0x8a, 0x20, 0x33, 0x67, 0x21,
+	0x12, 0x80, 0xa0, 0x80, 0x20, 0x73, 0x13, 0x02, 0xa8, 0xeb, 0xa9, 0x0a, 0x38, 0x16, 0x80, 0xa0,
+	0xbe, 0xcb, 0xa9, 0x29, 0x28, 0x03, 0x08, 0xaf, 0x9d, 0x9b, 0x08, 0x82, 0x33, 0x03, 0xbc, 0xbc,
+	0x9f, 0x98, 0x82, 0x62, 0x21, 0x08, 0x0b, 0x9e, 0xa9, 0x0a, 0x38, 0x33, 0x03, 0x08, 0xf0, 0xad,
+	0x9c, 0x08, 0x08, 0x32, 0x03, 0xc8, 0xcf, 0xba, 0x9a, 0x0a, 0x22, 0x06, 0x01, 0xda, 0xeb, 0xaa,
+	0x00, 0xea, 0x30, 0x00, 0x80, 0x21, 0x43, 0x10, 0xb9, 0xbd, 0xbc, 0x80, 0x52, 0x33, 0x16, 0x00,
+	0xb9, 0x9a, 0x0a, 0x35, 0x64, 0x22, 0x12, 0x08, 0xab, 0xa9, 0x22, 0x56, 0x23, 0x12, 0x01, 0xca,
+	0xa9, 0x80, 0x53, 0x42, 0x23, 0xa8, 0xea, 0xb9, 0x8a, 0x20, 0x33, 0x33, 0xc0, 0xbc, 0xbf, 0xa9,
+	0x89, 0x02, 0x83, 0x80, 0xcc, 0xfb, 0x89, 0x89, 0x32, 0x38, 0x80, 0xbc, 0xbc, 0xc0, 0x30, 0x34,
+	0x33, 0x04, 0x03, 0x0d, 0x8b, 0x84, 0x64, 0x21, 0x22, 0x38, 0xc0, 0x80, 0x30, 0x04, 0x73, 0x20,
+	0x80, 0xba, 0x0c, 0x0b, 0x88, 0x00, 0x85, 0x80, 0xcc, 0xcb, 0xbb, 0xbc, 0x00, 0x88, 0x05, 0x0c,
+	0xac, 0xbb, 0xbc, 0x80, 0x80, 0x05, 0x08, 0xbd, 0xbb, 0xcc, 0x80, 0x80, 0x44, 0x32, 0x80, 0xc8,
+	0xcb, 0x08, 0x08, 0x44, 0x17, 0x82, 0x80, 0xb0, 0x0b, 0x48, 0x43, 0x73, 0x11, 0x00, 0xab, 0xad,
+	0xa0, 0x82, 0x43, 0x32, 0x80, 0xfc, 0xb9, 0xaa, 0x80, 0x33, 0x83, 0x04, 0xec, 0xc9, 0x9b, 0x8a,
+	0x32, 0x32, 0x03, 0xbc, 0xec, 0xc9, 0x08, 0x12, 0x15, 0x23, 0x08, 0xea, 0xa9, 0x89, 0x20, 0x36,
+	0x21, 0x22, 0xab, 0xb8, 0x3c, 0x70, 0x43, 0x33, 0x82, 0x80, 0xad, 0x89, 0x2a, 0x73, 0x13, 0x14,
+	0x80, 0x9a, 0xab, 0x08, 0x43, 0x37, 0x01, 0x08, 0x9d, 0xbc, 0x89, 0x38, 0x22, 0x33, 0xb4, 0xf0,
+	0xca, 0x99, 0x28, 0x22, 0x16, 0xa2, 0xd0, 0x9b, 0xbc, 0x89, 0x22, 0x62, 0x01, 0xa1, 0xda, 0xa9,
+	0x89, 0x32, 0x73, 0x11, 0xa0, 0xda, 0xcb, 0x9b, 0x28, 0x22, 0x16, 0x82, 0xa0, 0xab, 0xbb, 0x08,
+	0x58, 0x43, 0x08, 0xbc, 0xce, 0xb9, 0x0a, 0x31, 0x32, 0x03, 0xb4, 0xc8, 0xcb, 0x8a, 0x48, 0x30,
+	0x00, 0xd8, 0xf8, 0xaa, 0x80, 0x38, 0x30, 0x25, 0x30, 0x08, 0x8c, 0x80, 0x05, 0x03, 0x58, 0x08,
+	0x00, 0xfa, 0x24, 0x00, 0x80, 0x08, 0x80, 0x37, 0x34, 0x03, 0x53, 0x83, 0x34, 0x83, 0x04, 0x08,
+	0x08, 0x08, 0xf8, 0x03, 0x58, 0x08, 0x03, 0x58, 0x80, 0x04, 0x03, 0x08, 0x08, 0xf8, 0xcb, 0xc0,
+	0x8a, 0x80, 0x80, 0x80, 0x80, 0xf0, 0x88, 0x80, 0x80, 0x8e, 0x80, 0x0d, 0xbc, 0x0b, 0xbc, 0x88,
+	0x80, 0x00, 0x88, 0x00, 0x78, 0x01, 0xe8, 0x08, 0x08, 0x08, 0x80, 0x80, 0x9f, 0x0d, 0x0c, 0x88,
+	0x40, 0x40, 0x03, 0x03, 0xe0, 0x0b, 0xbc, 0x80, 0x80, 0x80, 0xf0, 0xbb, 0xbc, 0x0b, 0x08, 0x35,
+	0x84, 0x03, 0xbc, 0xbc, 0xbb, 0x08, 0x58, 0x34, 0x08, 0xc8, 0xc8, 0x0b, 0x48, 0x64, 0x41, 0x21,
+	0x08, 0xba, 0x8a, 0x40, 0x42, 0x45, 0x21, 0x88, 0xaa, 0xb0, 0x43, 0x63, 0x26, 0x12, 0x08, 0x9a,
+	0x0a, 0x3b, 0x78, 0x13, 0x04, 0x08, 0x9d, 0x9b, 0x0a, 0x22, 0x63, 0x21, 0xa8, 0xda, 0xbc, 0xa9,
+	0x80, 0x23, 0x33, 0xc0, 0xdc, 0xca, 0xa9, 0x80, 0x53, 0x12, 0x80, 0xba, 0xfb, 0x9a, 0x08, 0x38,
+	0x33, 0x48, 0x8b, 0xbc, 0x8b, 0x8c, 0x40, 0x84, 0x30, 0xd0, 0xb0, 0x08, 0x0d, 0x88, 0xc0, 0x08,
+	0x08, 0xe8, 0x80, 0x80, 0x0d, 0xbc, 0xc0, 0x80, 0x80, 0x58, 0x80, 0xbc, 0xfb, 0xcb, 0x09, 0x88,
+	0x23, 0x33, 0x80, 0xbc, 0xfc, 0x98, 0x10, 0x35, 0x41, 0x01, 0xa8, 0xac, 0x0a, 0x50, 0x62, 0x33,
+	0x22, 0x88, 0xa9, 0xab, 0x48, 0x62, 0x25, 0x13, 0x08, 0xaa, 0xaa, 0x8a, 0x43, 0x36, 0x14, 0x80,
+	0xaa, 0x9d, 0x9a, 0x28, 0x33, 0x33, 0xc0, 0xec, 0xc9, 0x9b, 0x08, 0x31, 0x38, 0xb3, 0xf8, 0xab,
+	0xaa, 0x08, 0x48, 0x03, 0x08, 0xd8, 0xbc, 0x0b, 0x3c, 0x53, 0x62, 0x10, 0x80, 0x0a, 0x8b, 0x40,
+	0x33, 0x44, 0x32, 0x03, 0xc8, 0x08, 0x58, 0x43, 0x33, 0x84, 0x80, 0xd0, 0xbb, 0x8b, 0x80, 0x60,
+	0x00, 0x09, 0x26, 0x00, 0x03, 0x8c, 0xcb, 0x9f, 0x0a, 0x0a, 0x08, 0x38, 0xc0, 0xb8, 0xbc, 0xbc,
+	0x8b, 0x80, 0x50, 0x80, 0xd0, 0xcb, 0xbb, 0x8b, 0x08, 0x60, 0x33, 0x85, 0x80, 0xcb, 0x0c, 0x08,
+	0x48, 0x54, 0x12, 0x00, 0x88, 0xbb, 0x08, 0x35, 0x24, 0x17, 0x82, 0xa0, 0xba, 0x8e, 0x29, 0x28,
+	0x33, 0x83, 0xd0, 0x9e, 0x9c, 0x0a, 0x28, 0x23, 0x30, 0xc0, 0x9f, 0xac, 0x9a, 0x10, 0x32, 0x32,
+	0xc0, 0xbb, 0xaf, 0x8b, 0x20, 0x72, 0x31, 0x01, 0xa8, 0x9d, 0xaa, 0x80, 0x63, 0x23, 0x22, 0xa2,
+	0x8b, 0xac, 0x83, 0x47, 0x43, 0x12, 0x00, 0xd8, 0x99, 0xa8, 0x32, 0x45, 0x13, 0x82, 0xa0, 0xbb,
+	0x8b, 0x40, 0x64, 0x23, 0x08, 0xd8, 0xca, 0xab, 0x80, 0x23, 0x33, 0x34, 0x8b, 0xaf, 0xac, 0x89,
+	0x32, 0x62, 0x12, 0x0a, 0x9d, 0xbc, 0xab, 0x20, 0x22, 0x26, 0x28, 0xaa, 0x9e, 0x9a, 0x28, 0x23,
+	0x26, 0x01, 0xba, 0xcd, 0xbb, 0x0a, 0x22, 0x63, 0x21, 0x08, 0xba, 0xbb, 0x8b, 0x08, 0x45, 0x83,
+	0xc0, 0xfb, 0x9c, 0x9b, 0x28, 0x22, 0x33, 0x48, 0x0b, 0xbc, 0xbb, 0x88, 0x35, 0x40, 0xb8, 0xc8,
+	0xaf, 0x89, 0x80, 0x33, 0x33, 0x04, 0x08, 0x08, 0x08, 0x80, 0x07, 0x04, 0x08, 0xd8, 0x80, 0x0c,
+	0x03, 0x34, 0x25, 0x03, 0x03, 0x04, 0x03, 0x35, 0x40, 0x08, 0x08, 0x8d, 0x8b, 0x80, 0x80, 0x87,
+	0x24, 0x30, 0x80, 0x58, 0x80, 0x40, 0x80, 0x8c, 0x0c, 0xbc, 0xc0, 0x80, 0x4b, 0x08, 0x08, 0x85,
+	0x80, 0x80, 0x80, 0x80, 0x8f, 0x0c, 0x8c, 0x0b, 0xbc, 0x08, 0x0d, 0x08, 0x08, 0x58, 0x40, 0x08,
+	0x08, 0x08, 0x8e, 0x8b, 0x80, 0x80, 0xf0, 0xb8, 0x08, 0x8d, 0x80, 0x35, 0x33, 0x40, 0x80, 0xd0,
+	0x8b, 0x0c, 0x08, 0x08, 0x08, 0x8f, 0xbb, 0x8c, 0x80, 0x35, 0x33, 0x44, 0xb8, 0xc0, 0xbb, 0x8b,
+	0x00, 0xfa, 0x23, 0x00, 0x04, 0x84, 0x80, 0xcc, 0x0b, 0x3c, 0x70, 0x32, 0x42, 0x80, 0xaa, 0xba,
+	0x8b, 0x40, 0x53, 0x32, 0xb3, 0xf8, 0xab, 0x80, 0x70, 0x33, 0x34, 0x01, 0xaa, 0xad, 0xa9, 0x22,
+	0x63, 0x21, 0xa2, 0xab, 0xbe, 0xaa, 0x22, 0x36, 0x23, 0x82, 0xba, 0xcf, 0x98, 0x2a, 0x21, 0x14,
+	0x80, 0xda, 0xcb, 0x9b, 0x28, 0x35, 0x13, 0x02, 0xea, 0xbb, 0x9c, 0x08, 0x42, 0x42, 0x08, 0xda,
+	0xbb, 0xa9, 0x38, 0x62, 0x43, 0x01, 0xaa, 0xcc, 0x99, 0x28, 0x52, 0x41, 0x80, 0xca, 0xab, 0x0c,
+	0x28, 0x35, 0x23, 0x01, 0xd8, 0xca, 0xa9, 0x20, 0x62, 0x11, 0x80, 0xda, 0xab, 0x0c, 0x28, 0x35,
+	0x43, 0x28, 0xaa, 0xda, 0x89, 0x20, 0x52, 0x22, 0x08, 0xeb, 0xab, 0x0a, 0x68, 0x31, 0x34, 0x01,
+	0xaa, 0xea, 0x89, 0x20, 0x22, 0x23, 0x00, 0xfc, 0xc9, 0x80, 0x30, 0x72, 0x21, 0x81, 0x99, 0xca,
+	0xa9, 0x80, 0x32, 0x48, 0xb8, 0xfb, 0x9c, 0x99, 0x21, 0x35, 0x41, 0x01, 0xa8, 0xac, 0x0c, 0x2a,
+	0x28, 0x33, 0xb8, 0xf8, 0xab, 0xaa, 0x42, 0x62, 0x14, 0x81, 0xc0, 0xba, 0xac, 0x89, 0x32, 0x38,
+	0x03, 0xc8, 0xbc, 0x00, 0x53, 0x36, 0x34, 0x01, 0xaa, 0xbd, 0x9c, 0x9a, 0x82, 0x02, 0x83, 0xcb,
+	0xcb, 0x0b, 0x78, 0x42, 0x24, 0x82, 0x9a, 0xbd, 0xc9, 0x80, 0x12, 0x62, 0x18, 0x99, 0xaa, 0x0b,
+	0x78, 0x41, 0x22, 0x08, 0xda, 0xad, 0xaa, 0x80, 0x32, 0x42, 0x82, 0x00, 0xbb, 0x80, 0x74, 0x53,
+	0x12, 0x91, 0xba, 0xdc, 0x9a, 0x89, 0x32, 0x22, 0x08, 0xbb, 0xbc, 0x0b, 0x34, 0x47, 0x12, 0xa0,
+	0xd9, 0xbb, 0x9a, 0x58, 0x41, 0x13, 0xa2, 0xaa, 0xba, 0x0c, 0x73, 0x11, 0x02, 0xab, 0xbf, 0xac,
+	0x89, 0x30, 0x42, 0x23, 0x08, 0xab, 0x8b, 0x40, 0x37, 0x43, 0x11, 0xc9, 0xcb, 0xbb, 0x08, 0x22,
+	0x00, 0x00, 0x28, 0x00, 0x23, 0xc0, 0xeb, 0xca, 0x80, 0x22, 0x35, 0x22, 0xa8, 0xeb, 0xab, 0x80,
+	0x62, 0x33, 0x22, 0xb2, 0xba, 0xcb, 0x48, 0x32, 0x43, 0x80, 0xec, 0xcb, 0x9b, 0x0a, 0x22, 0x16,
+	0x08, 0xb0, 0x0a, 0x3b, 0x34, 0x46, 0x11, 0x02, 0xba, 0xad, 0x0a, 0x20, 0x30, 0x03, 0xbd, 0xae,
+	0x9c, 0x0a, 0x22, 0x32, 0x03, 0xd0, 0xfb, 0x89, 0x80, 0x53, 0x21, 0x21, 0xaa, 0xbb, 0xc8, 0x03,
+	0x27, 0x22, 0x08, 0xfb, 0xb9, 0xaa, 0x0a, 0x02, 0x48, 0x0b, 0xbc, 0xcb, 0x80, 0x27, 0x23, 0x15,
+	0x80, 0x80, 0x8a, 0x30, 0x48, 0x84, 0x80, 0xfb, 0xda, 0x99, 0x80, 0x22, 0x38, 0x08, 0xc8, 0xc0,
+	0x30, 0x48, 0x17, 0x82, 0x80, 0x8a, 0x8a, 0x08, 0x44, 0x33, 0x53, 0x08, 0x0c, 0x0b, 0x08, 0x88,
+	0x00, 0x8f, 0xbb, 0xbc, 0x8c, 0x80, 0x44, 0x32, 0x43, 0x33, 0x48, 0x30, 0x80, 0x05, 0x08, 0xd8,
+	0xbb, 0xad, 0xbb, 0xc8, 0x80, 0x80, 0x80, 0x80, 0x8f, 0x80, 0x35, 0x83, 0x04, 0x08, 0xbd, 0xbb,
+	0x8c, 0x84, 0x24, 0x80, 0x80, 0xcc, 0xbb, 0x80, 0x35, 0x83, 0x80, 0xbf, 0xcd, 0xba, 0x08, 0x12,
+	0x53, 0x82, 0xa2, 0x80, 0x30, 0x34, 0x27, 0x21, 0xb0, 0xea, 0xcb, 0xa9, 0x89, 0x02, 0x38, 0x8b,
+	0xc0, 0x48, 0x30, 0x27, 0x22, 0x02, 0x08, 0x0c, 0x08, 0x58, 0x48, 0x38, 0xc0, 0xb8, 0x80, 0x80,
+	0x36, 0x48, 0x08, 0xc8, 0xbb, 0x8c, 0x80, 0x40, 0x80, 0x80, 0x00, 0x88, 0x57, 0x23, 0x54, 0x22,
+	0x08, 0x08, 0xc8, 0x0b, 0xac, 0xc8, 0xfa, 0x89, 0x9a, 0x08, 0x02, 0x83, 0x04, 0x08, 0x58, 0x80,
+	0x04, 0x03, 0x08, 0xe8, 0xcb, 0x0b, 0x0c, 0x03, 0x53, 0x08, 0xac, 0xac, 0xbb, 0xc8, 0x03, 0x84,
+	0x80, 0xcc, 0xbb, 0x8b, 0x80, 0x36, 0x17, 0x01, 0xa8, 0xb0, 0x80, 0x04, 0x33, 0x34, 0xc0, 0xfb,
+	0x00, 0xfc, 0x2d, 0x00, 0xa9, 0x0a, 0x38, 0x83, 0x84, 0x0b, 0x0d, 0x08, 0x73, 0x52, 0x11, 0x08,
+	0xaa, 0xba, 0x3a, 0x48, 0x43, 0x30, 0xbc, 0xcb, 0xb0, 0x03, 0x37, 0x24, 0x08, 0xa8, 0xae, 0xa9,
+	0x38, 0x32, 0x03, 0x84, 0xcb, 0x8b, 0x0c, 0x43, 0x43, 0x33, 0x84, 0xcb, 0xca, 0xb0, 0x08, 0x84,
+	0x84, 0xc0, 0x8a, 0x0c, 0x08, 0x34, 0x34, 0x83, 0x80, 0xbd, 0xb8, 0xd8, 0x80, 0x80, 0xd8, 0xac,
+	0xac, 0x08, 0x48, 0x73, 0x12, 0x80, 0x0a, 0x8b, 0x8b, 0x50, 0x48, 0xb8, 0xcb, 0xfb, 0x9a, 0x28,
+	0x68, 0x21, 0x08, 0xa8, 0xab, 0x0c, 0x08, 0x43, 0x03, 0xc8, 0xc0, 0x0c, 0x08, 0x27, 0x23, 0x02,
+	0x08, 0xac, 0xb8, 0x30, 0x00, 0x85, 0xdb, 0xbb, 0x8f, 0x19, 0x50, 0x21, 0x82, 0x80, 0x80, 0x40,
+	0x33, 0x55, 0x82, 0x80, 0xba, 0xcb, 0x0b, 0x03, 0x58, 0xc0, 0x0b, 0xbc, 0x80, 0x40, 0x84, 0x03,
+	0x80, 0xbd, 0x08, 0x08, 0x45, 0x83, 0x84, 0x80, 0x80, 0x50, 0x40, 0x08, 0x08, 0xfd, 0xa9, 0xa9,
+	0x8a, 0x00, 0x0c, 0x08, 0x0c, 0x48, 0x38, 0x34, 0x03, 0x03, 0x80, 0x8e, 0x00, 0x08, 0x88, 0x00,
+	0xcf, 0x8b, 0x8b, 0x8c, 0x80, 0xd0, 0xc8, 0xc0, 0x80, 0x84, 0x03, 0x84, 0x80, 0x80, 0x00, 0x06,
+	0x84, 0x84, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x9f, 0xbe, 0xc0, 0x0b, 0x08, 0x58, 0x30, 0x40,
+	0x40, 0x33, 0x44, 0x38, 0x03, 0x08, 0x8d, 0xc0, 0xb8, 0x08, 0x08, 0xe8, 0x08, 0x08, 0x08, 0x87,
+	0x80, 0x04, 0xc8, 0x80, 0x80, 0x05, 0x03, 0x58, 0x80, 0x80, 0x80, 0x08, 0x80, 0x08, 0xf0, 0x8a,
+	0x8e, 0x0c, 0x08, 0x08, 0x08, 0x0f, 0xc8, 0x80, 0x80, 0x50, 0x48, 0x48, 0x08, 0x83, 0x0c, 0x08,
+	0xc8, 0x08, 0x8d, 0xcb, 0xcb, 0xb8, 0x80, 0x50, 0x48, 0x48, 0x08, 0xb8, 0x08, 0x08, 0x08, 0x08,
+	0x00, 0xfd, 0x1c, 0x00, 0xf0, 0xd9, 0x08, 0x08, 0x35, 0x40, 0x08, 0xc8, 0x0c, 0x0c, 0x08, 0x03,
+	0x04, 0xc8, 0xd0, 0x80, 0x30, 0x04, 0x43, 0x80, 0x80, 0x0d, 0x3c, 0x30, 0x04, 0x03, 0xd8, 0xc0,
+	0x0b, 0x08, 0x44, 0x38, 0x80, 0xd0, 0x80, 0x80, 0x35, 0x34, 0x83, 0xd0, 0xeb, 0x0a, 0x08, 0x02,
+	0x83, 0x80, 0xd0, 0xc8, 0x03, 0x27, 0x22, 0x02, 0xbb, 0xbc, 0x0b, 0x3c, 0x48, 0x03, 0x0c, 0xbc,
+	0xc0, 0x30, 0x48, 0x03, 0x08, 0xbd, 0xc8, 0x0b, 0x03, 0x85, 0x04, 0xc8, 0x8a, 0x0c, 0x08, 0x84,
+	0x84, 0x80, 0xdb, 0xc0, 0x80, 0x30, 0x80, 0xe0, 0xbb, 0xcb, 0xb8, 0x08, 0x68, 0x38, 0x00, 0x08,
+	0x85, 0x44, 0x02, 0x83, 0x0c, 0xbc, 0x0b, 0x8c, 0x8b, 0xd0, 0x08, 0x8c, 0x04, 0x33, 0x34, 0x84,
+	0x00, 0x88, 0x8c, 0x80, 0x86, 0x30, 0xc0, 0xc8, 0x80, 0x80, 0x35, 0x40, 0x83, 0x04, 0xc8, 0x30,
+	0x80, 0x05, 0x08, 0xd8, 0x0b, 0x8c, 0x3b, 0x00, 0x85, 0x40, 0x40, 0x03, 0x27, 0x22, 0x08, 0xb8,
+	0xcb, 0xac, 0xbb, 0xc8, 0xc0, 0x80, 0x80, 0x80, 0x45, 0x16, 0x14, 0x10, 0xa0, 0xba, 0xbb, 0xc0,
+	0xac, 0xbb, 0xbc, 0x0b, 0x08, 0x44, 0x43, 0x83, 0x84, 0x00, 0x8c, 0x80, 0x80, 0x8d, 0xfc, 0x99,
+	0x9c, 0x08, 0x08, 0x22, 0x30, 0x40, 0x08, 0x84, 0x40, 0x08, 0x08, 0xbd, 0xbc, 0xcb, 0xbb, 0xcb,
+	0x08, 0x34, 0x34, 0x26, 0x14, 0x22, 0x82, 0x80, 0xb8, 0xc8, 0xac, 0xac, 0xfb, 0x98, 0x80, 0x22,
+	0x16, 0x14, 0x13, 0x21, 0x02, 0x08, 0x08, 0x0c, 0xbc, 0xcb, 0xb0, 0x08, 0x58, 0x08, 0x34, 0x34,
+	0x33, 0x34, 0x40, 0x08, 0x0c, 0x8c, 0xbb, 0x8c, 0xcb, 0xb8, 0x8c, 0x80, 0x35, 0x48, 0x33, 0x03,
+	0x04, 0x84, 0x80, 0x80, 0xcd, 0xbe, 0x9c, 0x9a, 0x0a, 0x82, 0x33, 0x40, 0x80, 0x84, 0x04, 0x83,
+	0x00, 0x04, 0x24, 0x00, 0x0c, 0xbc, 0xbf, 0xc9, 0x89, 0x89, 0x02, 0x38, 0x30, 0x40, 0x34, 0x48,
+	0x08, 0x08, 0xbd, 0xc0, 0xb0, 0xc8, 0xc0, 0x0b, 0x0c, 0x08, 0x53, 0x33, 0x24, 0x40, 0x8b, 0x80,
+	0x80, 0x60, 0x08, 0xc8, 0x8b, 0xcc, 0x80, 0x84, 0x43, 0x33, 0x48, 0x30, 0x40, 0x80, 0x85, 0x0b,
+	0xbc, 0xbc, 0x80, 0x80, 0x50, 0x30, 0x50, 0x08, 0x34, 0x34, 0x83, 0x04, 0xc8, 0xcb, 0xb0, 0xbc,
+	0x80, 0x80, 0x0d, 0x03, 0x58, 0x30, 0x80, 0x05, 0x08, 0x08, 0x88, 0x00, 0x88, 0xef, 0xba, 0xb0,
+	0x08, 0x08, 0x45, 0x38, 0xc0, 0x80, 0x08, 0x08, 0x80, 0xb7, 0x08, 0xcc, 0x0b, 0x0c, 0x08, 0x58,
+	0x08, 0x48, 0x30, 0x80, 0x05, 0xc8, 0xc0, 0xbb, 0x08, 0x8c, 0x80, 0x80, 0x80, 0x8f, 0x80, 0x50,
+	0x43, 0x33, 0x48, 0xc0, 0x80, 0xb8, 0x88, 0x00, 0xf8, 0x8b, 0xbc, 0x08, 0x3d, 0x80, 0x80, 0x50,
+	0x30, 0x35, 0x43, 0x38, 0x80, 0x0c, 0xcc, 0x8a, 0x30, 0x80, 0x05, 0xc8, 0xc0, 0x80, 0x80, 0x04,
+	0x34, 0x80, 0xd0, 0x8b, 0xc8, 0x30, 0x00, 0x68, 0x80, 0x40, 0x08, 0x04, 0x58, 0xb8, 0x80, 0x80,
+	0x05, 0x58, 0x08, 0xbc, 0xbb, 0xaf, 0x8a, 0x20, 0x30, 0x84, 0x30, 0x80, 0x50, 0x34, 0x26, 0x82,
+	0x80, 0xbb, 0xbc, 0xfb, 0x0a, 0xaa, 0xb0, 0x80, 0x80, 0x35, 0x33, 0x40, 0x80, 0x80, 0x80, 0x80,
+	0x07, 0x80, 0xe0, 0xbb, 0x8b, 0x8c, 0x40, 0x30, 0x80, 0x00, 0x88, 0x8f, 0x80, 0x80, 0x80, 0x80,
+	0xf0, 0x89, 0x8d, 0x80, 0x8c, 0x85, 0x30, 0x34, 0x27, 0x01, 0x02, 0xbb, 0xcb, 0xbb, 0x8b, 0xcc,
+	0x0b, 0xbc, 0x80, 0x00, 0x44, 0x37, 0x41, 0x41, 0x81, 0x80, 0x80, 0xba, 0xbb, 0x8b, 0xcc, 0xb0,
+	0x88, 0x00, 0x88, 0x00, 0x78, 0x50, 0x33, 0x84, 0x03, 0x08, 0xd8, 0xb8, 0x08, 0x88, 0x00, 0x88,
+	0x00, 0x01, 0x1b, 0x00, 0x80, 0x08, 0x70, 0x64, 0x08, 0x08, 0x08, 0xe8, 0x0c, 0xcb, 0xbb, 0xbc,
+	0x80, 0x40, 0x34, 0x43, 0x16, 0x22, 0x28, 0x80, 0x80, 0x8b, 0xbd, 0xaf, 0xc9, 0x9a, 0xaa, 0x08,
+	0x48, 0x32, 0x03, 0x34, 0x84, 0x03, 0x08, 0x80, 0x08, 0xf0, 0x88, 0x8c, 0xd0, 0xb0, 0x88, 0x00,
+	0x88, 0x70, 0x80, 0x04, 0x08, 0x08, 0x0e, 0xc8, 0x80, 0x80, 0x80, 0x80, 0x00, 0x88, 0x17, 0x35,
+	0x34, 0x48, 0x08, 0x08, 0xbd, 0xbb, 0xbc, 0xc8, 0xc0, 0x08, 0x80, 0x44, 0x33, 0x03, 0x44, 0x83,
+	0x80, 0x50, 0x8b, 0x80, 0xbd, 0xc8, 0x0b, 0x8c, 0x40, 0x08, 0x84, 0x80, 0x80, 0x80, 0x70, 0x80,
+	0x04, 0x88, 0x00, 0xe8, 0x08, 0x08, 0x80, 0x08, 0x8f, 0x80, 0x50, 0x08, 0x08, 0x08, 0xe8, 0xc8,
+	0x80, 0x80, 0x80, 0x80, 0x0f, 0x88, 0x00, 0x35, 0x40, 0x84, 0x00, 0x88, 0x8c, 0x8c, 0x0c, 0xc8,
+	0x80, 0x0c, 0xc8, 0x80, 0x40, 0x80, 0x40, 0x80, 0x50, 0x80, 0x50, 0x08, 0x08, 0x08, 0xe8, 0x08,
+	0x08, 0x08, 0xf8, 0xb8, 0xc8, 0x80, 0x08, 0x05, 0x84, 0x80, 0x85, 0x80, 0x80, 0x80, 0x80, 0x00,
+	0x88, 0x00, 0x88, 0x47, 0x80, 0x07, 0x08, 0x08, 0x08, 0x0f, 0x88, 0x8b, 0x0d, 0x88, 0x00, 0x68,
+	0x30, 0x80, 0x85, 0x80, 0x50, 0x08, 0x80, 0x85, 0x80, 0x0c, 0xc8, 0x08, 0xd8, 0x80, 0x80, 0x0d,
+	0x08, 0x08, 0x68, 0x80, 0x40, 0x08, 0x40, 0x80, 0x80, 0x0e, 0x08, 0x0d, 0xb8, 0x88, 0x00, 0x78,
+	0x08, 0x08, 0x08, 0x80, 0xf8, 0x80, 0x08, 0x80, 0x8e, 0x00, 0x88, 0x00, 0x78, 0x80, 0x80, 0x80,
+	0x80, 0x80, 0x80, 0x08, 0xbf, 0x80, 0x00, 0x08, 0x88, 0x00, 0x88, 0xf0, 0x5f, 0x08, 0x08, 0x85,
+	0x40, 0x08, 0x08, 0x08, 0x08, 0x08, 0x9f, 0xd0, 0x80, 0x8c, 0x00, 0x58, 0x08, 0x84, 0x04, 0x48,
+	0x00, 0x01, 0x27, 0x00, 0x80, 0x48, 0xc0, 0x80, 0x80, 0x8c, 0x80, 0x80, 0x80, 0x00, 0x88, 0x00,
+	0x88, 0x47, 0x80, 0xf0, 0x88, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x70, 0x05, 0x06, 0x08,
+	0x08, 0x08, 0xf8, 0x08, 0x0d, 0x0c, 0x8b, 0x8b, 0x8c, 0x00, 0x04, 0x04, 0x34, 0x48, 0x80, 0x40,
+	0x80, 0x8c, 0xd0, 0xb0, 0xc8, 0x80, 0x80, 0x08, 0x80, 0x08, 0x80, 0x17, 0x80, 0x00, 0x8f, 0x08,
+	0x8d, 0x80, 0x80, 0x86, 0x84, 0x30, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x80, 0xf8, 0x0c, 0xf8,
+	0x08, 0x08, 0x08, 0x3e, 0x80, 0x50, 0x48, 0x08, 0x03, 0x58, 0x80, 0x80, 0xe0, 0xc0, 0xb0, 0xc0,
+	0x08, 0x80, 0x04, 0x58, 0x48, 0x08, 0x83, 0x80, 0x0d, 0x08, 0x0d, 0xb8, 0x08, 0x08, 0x78, 0x08,
+	0x08, 0x58, 0x80, 0xd0, 0x80, 0x80, 0x8c, 0xc0, 0x08, 0x84, 0x40, 0x80, 0x50, 0x08, 0x08, 0x8d,
+	0x00, 0x88, 0x00, 0x88, 0x8f, 0x80, 0x80, 0x0e, 0xc8, 0x80, 0x80, 0x08, 0x80, 0x07, 0x48, 0x03,
+	0x84, 0x84, 0x84, 0x80, 0x8b, 0xcc, 0xc0, 0x8a, 0x0b, 0x08, 0x08, 0x08, 0x78, 0x00, 0x08, 0x08,
+	0x06, 0x08, 0x08, 0x78, 0x08, 0x03, 0x04, 0x58, 0x08, 0x08, 0xc8, 0xc8, 0xc8, 0xcb, 0xb0, 0x08,
+	0x0d, 0x83, 0x80, 0x80, 0x06, 0x08, 0x04, 0x84, 0x80, 0x35, 0x88, 0x04, 0x03, 0x80, 0x08, 0x0f,
+	0xac, 0xbb, 0xc8, 0xcb, 0x8a, 0x08, 0x08, 0x05, 0x34, 0x84, 0x03, 0x84, 0x80, 0x50, 0xb8, 0x08,
+	0x08, 0x08, 0x08, 0x80, 0x08, 0xbf, 0xf0, 0xb8, 0xc8, 0x08, 0x0d, 0x08, 0x58, 0x08, 0x43, 0x30,
+	0x40, 0x40, 0x08, 0xc8, 0x08, 0x80, 0x0e, 0x08, 0x08, 0xd8, 0x08, 0xc8, 0x08, 0x8d, 0xc0, 0x08,
+	0x58, 0x08, 0x43, 0x24, 0x30, 0x03, 0x04, 0xc8, 0x08, 0x8c, 0xbc, 0x0c, 0xcb, 0x80, 0x08, 0x80,
+	0x00, 0xfd, 0x21, 0x00, 0x60, 0x08, 0x08, 0x68, 0x08, 0x48, 0x80, 0x04, 0x48, 0x30, 0x80, 0x05,
+	0x08, 0x0d, 0x0c, 0xbb, 0xbc, 0xc0, 0x80, 0x8b, 0x08, 0x05, 0x08, 0x35, 0x80, 0x04, 0x08, 0x85,
+	0x80, 0x85, 0x84, 0x80, 0x80, 0x80, 0x8d, 0x0c, 0xbc, 0xbb, 0x0d, 0xbb, 0x08, 0x08, 0x68, 0x30,
+	0x04, 0x03, 0x04, 0x84, 0x80, 0x04, 0x08, 0x08, 0x78, 0x80, 0x80, 0x80, 0x8d, 0x0c, 0xc8, 0x8b,
+	0x8b, 0x08, 0x80, 0x78, 0x40, 0x30, 0x40, 0x84, 0x30, 0x80, 0x80, 0x0e, 0x08, 0xd8, 0x80, 0x80,
+	0x80, 0x80, 0x8f, 0xc0, 0xc0, 0x08, 0x0c, 0x8b, 0x80, 0x80, 0x06, 0x03, 0x84, 0x40, 0x80, 0x80,
+	0x80, 0xf0, 0x08, 0xc8, 0x08, 0x08, 0x60, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x78, 0x03,
+	0x78, 0x81, 0x05, 0x08, 0x08, 0x88, 0x8e, 0x0c, 0x08, 0x0d, 0x48, 0x08, 0x08, 0x04, 0x08, 0x08,
+	0x08, 0x8f, 0x80, 0xd0, 0x08, 0x58, 0x08, 0x48, 0x80, 0x80, 0xe0, 0x80, 0xc0, 0xb8, 0x08, 0x8d,
+	0x80, 0x50, 0x08, 0x58, 0x08, 0x08, 0x80, 0x08, 0x0f, 0x08, 0xc8, 0x08, 0x08, 0x05, 0x08, 0x08,
+	0xf8, 0x80, 0x80, 0x8c, 0x80, 0x80, 0x06, 0x48, 0x30, 0x04, 0x03, 0x84, 0x00, 0x88, 0x00, 0x08,
+	0x88, 0x27, 0x08, 0x06, 0x08, 0x08, 0x08, 0x08, 0x08, 0xf8, 0x0a, 0x88, 0x00, 0x08, 0x88, 0x00,
+	0x88, 0x00, 0xff, 0xbe, 0xb8, 0x8c, 0x8b, 0x8c, 0x8b, 0x0d, 0x88, 0x0c, 0x08, 0x8d, 0x8b, 0x80,
+	0x80, 0x80, 0x70, 0x50, 0x48, 0x32, 0x30, 0x40, 0x08, 0x08, 0x05, 0x08, 0x08, 0x36, 0x40, 0x48,
+	0x33, 0x48, 0x30, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x08, 0x80, 0x08, 0xf8, 0xdf, 0x8b,
+	0xfc, 0xa0, 0xa9, 0xaa, 0xb8, 0xc0, 0xc0, 0x80, 0x0b, 0x8c, 0xc0, 0xb8, 0x08, 0x08, 0x8e, 0x80,
+	0x00, 0xf6, 0x23, 0x00, 0x80, 0x78, 0x38, 0x80, 0x80, 0x05, 0x08, 0x84, 0x44, 0x38, 0x43, 0x16,
+	0x22, 0x22, 0x23, 0x80, 0x04, 0x03, 0x08, 0x08, 0xb7, 0x80, 0x84, 0x80, 0x0c, 0x08, 0xbd, 0x8c,
+	0x0b, 0xbc, 0xbc, 0xc0, 0xc0, 0x8a, 0x80, 0x0c, 0x0c, 0xb8, 0xcc, 0x8a, 0xc0, 0xbb, 0x80, 0xd0,
+	0x08, 0x08, 0x08, 0x08, 0x78, 0xc0, 0x80, 0x34, 0x40, 0x78, 0x12, 0x22, 0x23, 0x33, 0x84, 0x84,
+	0x03, 0x88, 0x50, 0x08, 0x0c, 0x03, 0x84, 0x04, 0x03, 0x08, 0x80, 0x80, 0xcf, 0x0b, 0xc8, 0x8b,
+	0x0c, 0x08, 0x0d, 0x8b, 0xc8, 0xc0, 0x0c, 0xb8, 0xcb, 0x8b, 0xbc, 0x0c, 0x08, 0xc8, 0x08, 0x08,
+	0x05, 0x08, 0x85, 0x84, 0x24, 0x33, 0x84, 0x24, 0x03, 0xc8, 0x30, 0x80, 0xe0, 0x80, 0x08, 0x8c,
+	0x34, 0x34, 0x43, 0x42, 0x02, 0x48, 0x08, 0x08, 0x8c, 0xbc, 0x08, 0x8c, 0x0c, 0x0c, 0x48, 0x08,
+	0x0c, 0x08, 0xcc, 0xad, 0xb9, 0xaa, 0xbb, 0xbc, 0x80, 0xd0, 0x30, 0x03, 0x44, 0x33, 0x48, 0x30,
+	0x40, 0x80, 0x80, 0xe0, 0x08, 0x08, 0xbd, 0xbc, 0x30, 0x80, 0x80, 0x57, 0x22, 0x22, 0x32, 0x17,
+	0x12, 0x20, 0x08, 0x8b, 0xc0, 0xb8, 0xc8, 0x08, 0xcc, 0x83, 0x34, 0x8b, 0xd0, 0xc0, 0xba, 0x08,
+	0xbc, 0xaf, 0x80, 0x80, 0x8a, 0x73, 0x82, 0x20, 0x15, 0x80, 0x80, 0xb0, 0xfb, 0x9a, 0xa8, 0xba,
+	0xca, 0xb0, 0xbf, 0x10, 0x04, 0x01, 0x22, 0x02, 0x70, 0x43, 0x01, 0x28, 0x15, 0x91, 0x08, 0xb2,
+	0xbe, 0x0a, 0x22, 0xba, 0x0c, 0x83, 0xcb, 0x3c, 0x33, 0xb8, 0x88, 0x00, 0x8f, 0x4b, 0x48, 0x32,
+	0x43, 0x33, 0x43, 0x07, 0x98, 0x2a, 0xa8, 0xcb, 0x8a, 0xf0, 0xcc, 0x9a, 0x11, 0xa0, 0x80, 0x23,
+	0x80, 0x8b, 0x35, 0x83, 0xd0, 0x30, 0x53, 0x02, 0x8b, 0x08, 0xbd, 0x0c, 0x48, 0xbb, 0xaf, 0x89,
+	0x00, 0xf9, 0x2a, 0x00, 0xaa, 0x08, 0x33, 0x44, 0x0b, 0x33, 0x27, 0xa0, 0x8a, 0x73, 0x01, 0x08,
+	0x22, 0xa2, 0x9f, 0x28, 0x01, 0x08, 0x48, 0xbb, 0x8e, 0x20, 0x32, 0x08, 0x43, 0x73, 0x12, 0x80,
+	0x0a, 0x02, 0x80, 0x58, 0x43, 0xfb, 0x9b, 0x2a, 0xb0, 0xba, 0x08, 0xbc, 0xcf, 0x99, 0xa9, 0x0a,
+	0x32, 0x02, 0x48, 0x73, 0x84, 0x80, 0x20, 0x22, 0x02, 0xb8, 0xbc, 0xcf, 0xaa, 0x29, 0xa8, 0xba,
+	0x0b, 0x84, 0x80, 0x34, 0x34, 0x48, 0x73, 0x33, 0x82, 0x08, 0x20, 0x30, 0x00, 0x58, 0x27, 0xaa,
+	0x0a, 0x23, 0x80, 0xbc, 0x80, 0xfc, 0xac, 0xab, 0xf9, 0x9b, 0x18, 0x11, 0x12, 0x52, 0x11, 0x20,
+	0x38, 0x62, 0x80, 0xdc, 0xca, 0xaa, 0xca, 0x8c, 0x09, 0xa9, 0x29, 0x28, 0xb0, 0x8a, 0x30, 0x40,
+	0x40, 0x73, 0xa0, 0xaa, 0x50, 0x42, 0x01, 0x22, 0x22, 0x80, 0xc0, 0x48, 0x33, 0x40, 0x48, 0x83,
+	0x84, 0xc0, 0x80, 0x0c, 0x48, 0x16, 0x00, 0x28, 0x33, 0x26, 0x36, 0x34, 0x11, 0x01, 0x28, 0xaa,
+	0xcd, 0xda, 0xaa, 0x9a, 0x89, 0x9a, 0xba, 0x33, 0x33, 0x27, 0x15, 0x11, 0xa2, 0xaa, 0x08, 0xb3,
+	0x8c, 0x4b, 0x33, 0xdb, 0x30, 0x03, 0x08, 0x3e, 0x43, 0x83, 0x8b, 0x8c, 0xbc, 0x0c, 0x17, 0x03,
+	0xa8, 0x30, 0x42, 0x05, 0x21, 0x46, 0x33, 0x11, 0x41, 0x83, 0xa9, 0x8a, 0x03, 0xdc, 0xbc, 0xcb,
+	0xec, 0x8a, 0x08, 0x80, 0x80, 0x10, 0x08, 0x08, 0x08, 0x03, 0xf8, 0xbd, 0x99, 0xca, 0xaf, 0x8a,
+	0x88, 0x98, 0x80, 0x80, 0xaa, 0x9e, 0x0a, 0xca, 0xca, 0xc9, 0xad, 0x9b, 0x99, 0x80, 0x28, 0x60,
+	0x33, 0x34, 0x21, 0x21, 0x83, 0x30, 0x48, 0x43, 0xbb, 0xbc, 0x00, 0x88, 0x05, 0x48, 0x80, 0x04,
+	0xc3, 0x80, 0x34, 0x40, 0x43, 0x63, 0x42, 0x01, 0xb2, 0xb0, 0x30, 0x40, 0x8b, 0xbc, 0xbc, 0xc0,
+	0x00, 0xf6, 0x27, 0x00, 0x30, 0x17, 0x02, 0x22, 0x08, 0xb8, 0xf8, 0xbd, 0x09, 0x08, 0x8a, 0x8a,
+	0x30, 0x34, 0x47, 0x34, 0x23, 0x21, 0x01, 0x80, 0x08, 0x8b, 0x80, 0xe0, 0x03, 0x43, 0x43, 0x33,
+	0x73, 0x25, 0x13, 0x23, 0x21, 0x0a, 0x8b, 0x34, 0x03, 0xc8, 0xc8, 0x80, 0x04, 0x03, 0x08, 0x68,
+	0x43, 0x83, 0xb4, 0xb8, 0xc8, 0xc0, 0x9f, 0x9a, 0xaa, 0xbd, 0xaa, 0x0a, 0x0b, 0x08, 0x84, 0x80,
+	0xd0, 0x08, 0xbc, 0xbc, 0x9f, 0xa9, 0xa8, 0xe0, 0x99, 0xaa, 0x80, 0x80, 0xb3, 0xbc, 0x0c, 0x0c,
+	0xfb, 0xa0, 0x80, 0x80, 0x80, 0x80, 0x80, 0xd8, 0xc0, 0x08, 0x08, 0xd8, 0x0c, 0x0c, 0x8b, 0x4b,
+	0x48, 0x80, 0xbc, 0xbb, 0xbc, 0xec, 0xa9, 0xaa, 0x8a, 0x33, 0x40, 0x48, 0x30, 0x48, 0x07, 0x81,
+	0x80, 0xb0, 0xbb, 0xcb, 0x08, 0x08, 0xd8, 0x24, 0x24, 0x80, 0x80, 0x80, 0x80, 0x8e, 0x04, 0x03,
+	0x08, 0x68, 0x30, 0x34, 0x47, 0x11, 0x01, 0x22, 0x38, 0x08, 0x08, 0x44, 0x33, 0x03, 0x37, 0x82,
+	0x80, 0x30, 0x04, 0x03, 0x80, 0x08, 0x0f, 0x08, 0x48, 0x40, 0x43, 0x16, 0x22, 0x22, 0x32, 0x84,
+	0x03, 0x43, 0x73, 0x82, 0x02, 0x08, 0x88, 0x04, 0x83, 0x80, 0x80, 0xf0, 0x0b, 0x0c, 0x0c, 0x8b,
+	0x80, 0x80, 0x80, 0x00, 0x8f, 0x58, 0x38, 0x34, 0x73, 0x10, 0x80, 0x80, 0x00, 0xc8, 0xb8, 0xcf,
+	0xab, 0xab, 0x9d, 0xcb, 0x99, 0xa8, 0x80, 0x8a, 0x8b, 0x0c, 0x0c, 0x83, 0x80, 0x00, 0xaf, 0x8b,
+	0x80, 0x80, 0x8d, 0xd0, 0xbb, 0xcb, 0x8b, 0xfc, 0xb9, 0xa8, 0x0a, 0xbb, 0xc0, 0xfa, 0xab, 0x20,
+	0x82, 0xb0, 0x08, 0x0c, 0x8c, 0x40, 0x08, 0x08, 0x08, 0x08, 0x8f, 0xbb, 0xfc, 0xa9, 0x82, 0x32,
+	0x08, 0x08, 0xbc, 0x08, 0x44, 0x42, 0x02, 0x08, 0xc8, 0x0c, 0xb8, 0x08, 0x08, 0x36, 0x34, 0x08,
+	0x00, 0xe9, 0x24, 0x00, 0xd0, 0x80, 0x64, 0x43, 0x13, 0x82, 0x80, 0x80, 0x43, 0x83, 0x34, 0x83,
+	0x00, 0x58, 0x80, 0xcc, 0x4b, 0x65, 0x12, 0x18, 0x01, 0x98, 0x8a, 0x63, 0x43, 0x08, 0x41, 0x82,
+	0x20, 0x38, 0x33, 0x03, 0x74, 0x12, 0xa0, 0xba, 0xfb, 0x89, 0x22, 0x22, 0x83, 0x43, 0x08, 0x08,
+	0x74, 0x82, 0x80, 0x50, 0x82, 0xda, 0x89, 0x89, 0xb0, 0x48, 0x32, 0xc0, 0xfb, 0x9b, 0x01, 0xaa,
+	0x08, 0x73, 0xa0, 0x0a, 0x62, 0x01, 0xaa, 0x50, 0x01, 0xda, 0x0b, 0xc8, 0xeb, 0x89, 0x81, 0xb9,
+	0xca, 0x08, 0x0a, 0x0b, 0x83, 0x80, 0x8c, 0xd0, 0xb0, 0x08, 0x88, 0xe0, 0x08, 0x04, 0xec, 0x0a,
+	0x80, 0xd8, 0x9a, 0x08, 0xeb, 0xcb, 0x0b, 0xa8, 0xac, 0x0a, 0x08, 0xe8, 0x0a, 0x24, 0x14, 0x80,
+	0x52, 0x12, 0xca, 0x9c, 0x01, 0xca, 0xaa, 0x32, 0xb8, 0x9f, 0x10, 0x82, 0x3a, 0x72, 0x13, 0x00,
+	0x8a, 0xeb, 0xab, 0x80, 0x80, 0x73, 0x33, 0x82, 0x32, 0x32, 0xc0, 0x78, 0x35, 0x81, 0x99, 0x21,
+	0xaa, 0x9f, 0x21, 0x43, 0x81, 0x24, 0x33, 0xa0, 0x0a, 0x62, 0x12, 0xa0, 0x22, 0x87, 0xbb, 0x1b,
+	0x52, 0xa0, 0x3a, 0x74, 0x80, 0x99, 0x43, 0x25, 0x88, 0x40, 0x23, 0xb0, 0x0b, 0x28, 0xf8, 0xba,
+	0x29, 0xc8, 0xdb, 0x0a, 0x81, 0xa0, 0x10, 0x53, 0x82, 0x80, 0x80, 0x80, 0xbc, 0x8b, 0x40, 0x40,
+	0x80, 0x35, 0xc8, 0xca, 0xba, 0x08, 0xbc, 0xec, 0xa9, 0xdc, 0xac, 0xab, 0x9b, 0x99, 0x28, 0x22,
+	0x16, 0x01, 0x42, 0x36, 0x13, 0x10, 0x28, 0xca, 0xce, 0xba, 0xba, 0xcc, 0x9b, 0x99, 0x99, 0x10,
+	0x34, 0x35, 0x23, 0x61, 0x10, 0x90, 0x9b, 0x98, 0xac, 0xcb, 0x9a, 0x2a, 0x68, 0x31, 0x34, 0x23,
+	0x08, 0x08, 0x80, 0xec, 0xa9, 0x80, 0xea, 0x9b, 0x21, 0x35, 0x63, 0x44, 0x23, 0x11, 0x11, 0x08,
+	0x00, 0x08, 0x2e, 0x00, 0x9b, 0xa8, 0xaa, 0xcd, 0x9b, 0xa8, 0x00, 0x3b, 0x37, 0x35, 0x31, 0x45,
+	0x33, 0x91, 0x19, 0x21, 0xca, 0x8d, 0x10, 0x98, 0xae, 0x98, 0x0a, 0x89, 0x42, 0x34, 0x43, 0xb8,
+	0xc9, 0x0a, 0x08, 0x08, 0x38, 0x04, 0xdf, 0x9c, 0x29, 0x32, 0x25, 0x14, 0x82, 0xea, 0xbc, 0x99,
+	0x12, 0x01, 0x03, 0x91, 0xfd, 0xac, 0x09, 0x21, 0x32, 0x43, 0x82, 0xe9, 0xbb, 0x8a, 0x10, 0x32,
+	0x34, 0x92, 0xda, 0xbc, 0xac, 0x19, 0x30, 0x33, 0x31, 0xa0, 0xcc, 0xbb, 0x0a, 0x38, 0x38, 0x08,
+	0x40, 0xc8, 0xae, 0x0a, 0x08, 0xbb, 0x73, 0x17, 0x90, 0x19, 0x13, 0xe9, 0x9b, 0x11, 0xa0, 0x80,
+	0x35, 0x93, 0x08, 0x88, 0xb0, 0x43, 0x37, 0x01, 0x58, 0x13, 0xf9, 0x0b, 0x11, 0x81, 0x89, 0x54,
+	0x32, 0xb9, 0xac, 0x48, 0x11, 0x08, 0x72, 0x33, 0xa1, 0x9d, 0x21, 0x01, 0x80, 0x74, 0x12, 0xa9,
+	0x9a, 0x99, 0xa0, 0x22, 0x22, 0x03, 0x03, 0xfc, 0x9c, 0x33, 0x04, 0x2a, 0x34, 0x94, 0x9e, 0x28,
+	0x11, 0xb9, 0x28, 0x04, 0xda, 0x09, 0xa8, 0x80, 0x30, 0xf8, 0x0a, 0x28, 0xda, 0x0c, 0x28, 0xc8,
+	0x9c, 0x21, 0xa2, 0xab, 0x8b, 0xc0, 0xcb, 0x83, 0x80, 0x4c, 0xb2, 0xdf, 0x9d, 0x09, 0x09, 0x18,
+	0x32, 0xa8, 0xcc, 0xdb, 0x9b, 0x31, 0x23, 0x28, 0x32, 0xf0, 0xef, 0x09, 0x01, 0x80, 0x30, 0x01,
+	0xd9, 0x9b, 0x89, 0x00, 0x21, 0x26, 0x01, 0xb9, 0xbb, 0x98, 0x8a, 0x20, 0x54, 0x84, 0x09, 0xaa,
+	0x08, 0x08, 0x43, 0x43, 0x16, 0x22, 0x08, 0x38, 0xb3, 0xbc, 0x48, 0x17, 0x82, 0x22, 0x15, 0x22,
+	0x8a, 0x80, 0x30, 0x27, 0x22, 0x50, 0x42, 0x98, 0x8a, 0x60, 0x11, 0x40, 0x63, 0x22, 0x08, 0x98,
+	0x80, 0x80, 0x83, 0x43, 0x73, 0x01, 0xca, 0x0a, 0x80, 0x08, 0x36, 0x54, 0x80, 0x98, 0x80, 0xa0,
+	0x00, 0x1a, 0x2a, 0x00, 0x20, 0x62, 0x12, 0xa0, 0xcd, 0x99, 0xa0, 0x80, 0x38, 0x26, 0xc8, 0xcb,
+	0x89, 0x89, 0x0a, 0x32, 0x87, 0xc9, 0xbb, 0xa9, 0xa8, 0x8a, 0x43, 0x83, 0xfb, 0xad, 0xbb, 0x99,
+	0x08, 0x82, 0x80, 0xcb, 0xcb, 0xcf, 0x09, 0x08, 0x08, 0x08, 0xb0, 0xfb, 0x9b, 0xaa, 0x0a, 0x20,
+	0x80, 0x0c, 0x0c, 0xfb, 0x9c, 0x89, 0x22, 0x82, 0x80, 0x80, 0xbc, 0xdb, 0x80, 0x30, 0x40, 0x80,
+	0xd0, 0xb8, 0xbc, 0x0c, 0x48, 0x33, 0x43, 0x80, 0x80, 0x0d, 0x3c, 0x48, 0x33, 0x27, 0x08, 0x08,
+	0xb8, 0x80, 0x80, 0x75, 0x21, 0x01, 0x82, 0xb0, 0x08, 0x34, 0x24, 0x24, 0x03, 0x03, 0x08, 0x68,
+	0x03, 0x74, 0x31, 0x02, 0x01, 0x20, 0x80, 0x80, 0x35, 0x04, 0x08, 0x48, 0x40, 0x48, 0x73, 0x31,
+	0x82, 0x80, 0x03, 0x88, 0x44, 0x32, 0x30, 0x80, 0x80, 0xf0, 0x0b, 0x48, 0x30, 0x34, 0x80, 0x3c,
+	0x80, 0x00, 0x78, 0x33, 0x03, 0xd0, 0xb8, 0xc8, 0xbc, 0x0b, 0x34, 0x48, 0x80, 0x80, 0x80, 0xbe,
+	0xbc, 0x0b, 0xbc, 0xbc, 0xcb, 0xca, 0xb0, 0x08, 0x58, 0x48, 0x02, 0xcb, 0xbb, 0xc8, 0xbb, 0xcc,
+	0x80, 0x80, 0xec, 0x9c, 0x9a, 0xbc, 0x9c, 0x08, 0x08, 0xab, 0x0b, 0x88, 0xbc, 0x48, 0x40, 0xb8,
+	0xbc, 0xbc, 0xdf, 0xaa, 0x00, 0x88, 0x02, 0x82, 0xb0, 0xac, 0xbb, 0xaf, 0xa0, 0xd8, 0xa9, 0x89,
+	0xba, 0x0b, 0x43, 0x17, 0x82, 0x82, 0x00, 0x8b, 0x8b, 0x04, 0x84, 0x84, 0x80, 0xdb, 0xbb, 0xac,
+	0x88, 0x44, 0x08, 0x33, 0x74, 0x21, 0x21, 0x37, 0x12, 0x01, 0x08, 0x08, 0xad, 0x89, 0x52, 0x43,
+	0x41, 0x32, 0x25, 0x10, 0x19, 0x22, 0x31, 0x0b, 0x48, 0x06, 0x88, 0x62, 0x24, 0x12, 0x43, 0x32,
+	0x82, 0x20, 0x38, 0x33, 0x43, 0x24, 0x80, 0x84, 0x0b, 0x8f, 0x08, 0x82, 0x30, 0x64, 0x43, 0x01,
+	0x00, 0x2a, 0x2c, 0x00, 0x26, 0x12, 0x98, 0x08, 0xaa, 0xdd, 0x9a, 0x99, 0x28, 0x01, 0x02, 0x83,
+	0x84, 0xfb, 0x0a, 0x0a, 0x9e, 0x9b, 0x0a, 0xda, 0x89, 0x38, 0x28, 0x8a, 0x80, 0xcc, 0xeb, 0x9c,
+	0xab, 0xaa, 0xea, 0x99, 0xca, 0xeb, 0xaa, 0x9a, 0xcb, 0xaa, 0x29, 0x08, 0x0b, 0x48, 0x02, 0xac,
+	0xbb, 0xbc, 0xcf, 0xab, 0xcb, 0x9a, 0x9a, 0x8a, 0x80, 0x80, 0x8b, 0xcc, 0xbb, 0xfb, 0x9d, 0x90,
+	0x08, 0xa8, 0x32, 0x33, 0x80, 0x40, 0x34, 0xc0, 0xc0, 0x08, 0x84, 0x8b, 0x40, 0x34, 0x08, 0x8c,
+	0x80, 0x80, 0xe0, 0x78, 0x24, 0x12, 0x42, 0x35, 0x13, 0x11, 0x14, 0x03, 0x08, 0x8a, 0x33, 0x40,
+	0x83, 0x57, 0x42, 0x11, 0x11, 0x41, 0x21, 0x08, 0x38, 0x25, 0x28, 0x62, 0x33, 0x34, 0x41, 0x31,
+	0x22, 0x08, 0x02, 0x43, 0x33, 0x03, 0x58, 0x43, 0x08, 0x80, 0x58, 0x03, 0x0c, 0x08, 0x34, 0x40,
+	0x34, 0x17, 0x21, 0x80, 0x80, 0x80, 0xbc, 0xbb, 0xc8, 0xc8, 0xbb, 0x08, 0x58, 0x8b, 0x80, 0xe0,
+	0xcb, 0x9e, 0xaa, 0xaa, 0x0b, 0x8b, 0x80, 0x0d, 0xbc, 0x8b, 0x0c, 0xbc, 0xbb, 0xfc, 0xc9, 0x9a,
+	0xaa, 0x89, 0xba, 0xfa, 0xc9, 0xb9, 0x9b, 0xaa, 0x0b, 0xb8, 0xc0, 0x8b, 0xbc, 0x0c, 0xac, 0x0b,
+	0xbc, 0xfb, 0xba, 0xaa, 0xab, 0x0b, 0xc8, 0x80, 0x0c, 0x0c, 0xac, 0x8b, 0xc0, 0xb8, 0x8c, 0x80,
+	0x80, 0x0d, 0x03, 0x85, 0xc0, 0x80, 0x58, 0x0b, 0x8c, 0x84, 0x03, 0x08, 0x08, 0x05, 0x88, 0x05,
+	0x48, 0x43, 0x30, 0x48, 0x43, 0x33, 0x48, 0x70, 0x32, 0x20, 0x38, 0x83, 0x34, 0x88, 0x00, 0x74,
+	0x20, 0x22, 0x63, 0x43, 0x10, 0x21, 0x32, 0x32, 0x30, 0x70, 0x15, 0x01, 0x21, 0x22, 0x33, 0x48,
+	0x33, 0x27, 0x28, 0x08, 0x20, 0x84, 0x80, 0x64, 0x21, 0x22, 0x08, 0x02, 0x84, 0x80, 0x34, 0x84,
+	0x00, 0x25, 0x26, 0x00, 0x80, 0x58, 0x08, 0x48, 0x84, 0x80, 0x80, 0xcc, 0xbb, 0x8b, 0x80, 0x08,
+	0x70, 0x87, 0xa9, 0x89, 0x80, 0xb0, 0xc8, 0x80, 0xf8, 0xcb, 0x9a, 0x08, 0x88, 0x0b, 0x08, 0xbd,
+	0xcf, 0xb9, 0x89, 0xa0, 0xa8, 0x08, 0xac, 0xac, 0x9f, 0x19, 0xa9, 0xaa, 0xbb, 0x9f, 0xa9, 0x9c,
+	0x01, 0x82, 0x0b, 0xfb, 0x9a, 0xfa, 0xaa, 0xa0, 0x80, 0x89, 0xaa, 0x80, 0xc0, 0xc0, 0x80, 0x80,
+	0xbc, 0xfb, 0xa8, 0xa8, 0xab, 0x08, 0x84, 0xc0, 0xcb, 0x48, 0xb8, 0x0b, 0x3c, 0x48, 0xc0, 0x30,
+	0x48, 0x84, 0x03, 0x8c, 0x84, 0xb0, 0x8c, 0x40, 0x38, 0x40, 0x48, 0x16, 0x02, 0x28, 0x30, 0x08,
+	0xc8, 0x48, 0x43, 0x30, 0x73, 0x42, 0x14, 0x81, 0x22, 0x04, 0x08, 0x02, 0x42, 0x02, 0x8b, 0x74,
+	0x28, 0x21, 0x32, 0x62, 0x82, 0x38, 0x22, 0x70, 0x31, 0x20, 0x44, 0x01, 0x88, 0x83, 0x02, 0xb3,
+	0x08, 0x68, 0x08, 0x08, 0x04, 0x47, 0x01, 0x28, 0x85, 0xa0, 0x0a, 0x8a, 0x33, 0x80, 0x35, 0x33,
+	0x00, 0x04, 0x0d, 0x83, 0xdb, 0x0b, 0xec, 0xa9, 0xca, 0x0a, 0x82, 0x80, 0x80, 0x80, 0x85, 0xc0,
+	0x08, 0x04, 0x8c, 0x0b, 0xbc, 0x0c, 0x9f, 0x0a, 0xaa, 0xba, 0xbe, 0xaa, 0xaa, 0x9e, 0x80, 0x08,
+	0xb0, 0xb8, 0x80, 0xcc, 0x0b, 0x08, 0xd0, 0xb8, 0xc8, 0x0c, 0xb8, 0xcc, 0x83, 0xbb, 0xfc, 0x9b,
+	0xaa, 0xec, 0x09, 0x98, 0x80, 0x89, 0x20, 0x23, 0x00, 0x47, 0x01, 0x08, 0x8a, 0xba, 0xcb, 0x0b,
+	0x08, 0xbd, 0xc0, 0xbb, 0x4b, 0x8b, 0x58, 0x83, 0x40, 0x83, 0x8b, 0x35, 0x80, 0x37, 0x22, 0x60,
+	0x08, 0x2a, 0x23, 0x80, 0x48, 0x84, 0x80, 0xcb, 0x0c, 0x08, 0x08, 0x04, 0x84, 0x27, 0xaa, 0x62,
+	0x32, 0x40, 0x33, 0x43, 0x84, 0x09, 0x23, 0x08, 0x0b, 0x08, 0x08, 0xbd, 0xbc, 0x24, 0x33, 0x40,
+	0x00, 0x07, 0x26, 0x00, 0x73, 0x84, 0x80, 0x42, 0x03, 0x08, 0x22, 0x30, 0xb4, 0x08, 0x47, 0x10,
+	0x80, 0x80, 0x80, 0xf0, 0x0a, 0x08, 0xab, 0xb8, 0x80, 0x58, 0x80, 0x40, 0x34, 0x83, 0x34, 0x80,
+	0x50, 0x08, 0xb4, 0xc8, 0x0b, 0xf8, 0x9d, 0x89, 0x9a, 0xba, 0x8a, 0xbb, 0xc8, 0xc8, 0x03, 0x34,
+	0x80, 0x8c, 0x40, 0xfb, 0x0d, 0x81, 0xa0, 0xa9, 0xb8, 0xb0, 0xbc, 0xc0, 0x80, 0x80, 0xdf, 0x9b,
+	0x89, 0xbc, 0x9a, 0x22, 0xb2, 0x0b, 0x08, 0x85, 0x80, 0x80, 0x36, 0xc3, 0xbe, 0xaa, 0x80, 0xcd,
+	0x09, 0x21, 0xaa, 0xeb, 0x08, 0x28, 0xb0, 0x3a, 0x27, 0xa8, 0xaa, 0x23, 0x84, 0xc0, 0x33, 0x87,
+	0xa9, 0x89, 0x80, 0x83, 0xc0, 0x43, 0x83, 0xf0, 0x8a, 0x50, 0x98, 0x08, 0x35, 0x98, 0x8a, 0x33,
+	0x48, 0x42, 0x72, 0x22, 0x08, 0x08, 0xa8, 0x88, 0x00, 0x58, 0x08, 0xc8, 0x40, 0x08, 0x84, 0x64,
+	0x41, 0x01, 0x0a, 0x82, 0xb3, 0x8b, 0x74, 0x21, 0xa8, 0x20, 0x83, 0xb8, 0x3c, 0x34, 0x83, 0x80,
+	0x0d, 0x48, 0xc0, 0x0b, 0x37, 0x02, 0x9d, 0x41, 0x91, 0xbc, 0x41, 0x93, 0xaa, 0x52, 0x80, 0xb9,
+	0x83, 0x0b, 0x48, 0x80, 0xbc, 0x40, 0x97, 0x9c, 0x30, 0x86, 0x9a, 0x30, 0x91, 0xac, 0x89, 0xa2,
+	0x0e, 0x28, 0x08, 0x0b, 0x83, 0x80, 0x80, 0x80, 0x70, 0x03, 0xc8, 0xbc, 0x00, 0xc8, 0xbc, 0x30,
+	0x07, 0xa9, 0xab, 0x02, 0xf0, 0xaa, 0x52, 0x03, 0xaa, 0x8d, 0x14, 0xc0, 0x0b, 0x61, 0x92, 0xba,
+	0x89, 0x82, 0xea, 0x0b, 0x73, 0x88, 0x9a, 0x89, 0xa2, 0xc8, 0x0a, 0x64, 0x82, 0xdb, 0x28, 0x13,
+	0xdc, 0x28, 0x24, 0xb9, 0x9c, 0x02, 0xc0, 0xab, 0x32, 0x85, 0xb8, 0x8a, 0x21, 0xa0, 0x8d, 0x62,
+	0x13, 0xbc, 0x3b, 0x13, 0xcd, 0x49, 0x13, 0xb8, 0x0c, 0x20, 0xb8, 0x9c, 0x61, 0x82, 0xa9, 0x19,
+	0x00, 0xf4, 0x2c, 0x00, 0x82, 0xac, 0x42, 0x26, 0xa8, 0x0b, 0x21, 0xd2, 0x0b, 0x43, 0x84, 0xb9,
+	0x08, 0x22, 0xab, 0x48, 0x36, 0xa2, 0x8a, 0x30, 0xc3, 0x30, 0x24, 0x24, 0x80, 0x80, 0x8c, 0x40,
+	0x80, 0x50, 0x43, 0x08, 0x0c, 0x48, 0x83, 0x48, 0x54, 0x82, 0xaa, 0x38, 0x80, 0x0c, 0x78, 0x02,
+	0xa8, 0x8a, 0x30, 0x80, 0xe0, 0x30, 0x27, 0xa8, 0x8c, 0x40, 0x82, 0xaa, 0x60, 0x15, 0xcb, 0x1a,
+	0x13, 0xc0, 0x9b, 0x21, 0x94, 0xdc, 0x89, 0x33, 0xb8, 0x0f, 0x22, 0x92, 0xad, 0x20, 0x04, 0xb9,
+	0x2b, 0x41, 0xc0, 0xad, 0x11, 0x91, 0xe9, 0x09, 0x11, 0xa9, 0x8e, 0x10, 0x83, 0x9b, 0x2a, 0x22,
+	0xca, 0x8a, 0x03, 0xb4, 0xc8, 0x0b, 0x08, 0x8d, 0xc0, 0xcb, 0x30, 0xbc, 0x9f, 0x28, 0xa0, 0xab,
+	0x38, 0x84, 0xc0, 0x30, 0x84, 0x03, 0x08, 0x08, 0x06, 0xbc, 0xcb, 0x80, 0xc0, 0x8b, 0x80, 0xe0,
+	0x0b, 0x48, 0x03, 0x08, 0x35, 0x80, 0x80, 0x05, 0x08, 0x08, 0x36, 0xc0, 0x08, 0x08, 0x08, 0x08,
+	0x78, 0x40, 0xb3, 0xc8, 0x43, 0x84, 0xbb, 0x3b, 0x57, 0xb0, 0x0a, 0x34, 0x82, 0x0a, 0x72, 0x14,
+	0x99, 0x19, 0x51, 0x08, 0x9c, 0x10, 0x22, 0xea, 0x09, 0x41, 0x01, 0xa8, 0x72, 0x04, 0x98, 0x28,
+	0x14, 0xa0, 0x29, 0x21, 0x0a, 0xbb, 0x88, 0x85, 0x80, 0x00, 0x44, 0x03, 0xc8, 0x40, 0x26, 0xa8,
+	0x0a, 0x42, 0xb8, 0xae, 0x20, 0x22, 0x8a, 0x8b, 0x44, 0x83, 0xc0, 0x48, 0x33, 0xc8, 0xbb, 0x08,
+	0xbd, 0xaf, 0xa9, 0x82, 0x8a, 0x8b, 0x80, 0x50, 0x84, 0x80, 0x40, 0x80, 0xd0, 0xcb, 0x0b, 0xbc,
+	0xbb, 0xcc, 0xb0, 0x08, 0xfc, 0x89, 0x22, 0xb2, 0x8d, 0x80, 0xb3, 0x9e, 0x8c, 0x82, 0xd9, 0xa9,
+	0x02, 0xb2, 0xba, 0x08, 0x27, 0xa2, 0xba, 0x30, 0xc8, 0x9f, 0x89, 0xaa, 0xea, 0x89, 0x00, 0x0b,
+	0x00, 0xe8, 0x28, 0x00, 0x23, 0x24, 0x30, 0x43, 0x07, 0x08, 0x2a, 0x38, 0x08, 0xcf, 0x09, 0x01,
+	0xc8, 0x9c, 0x41, 0x11, 0xa9, 0x50, 0x43, 0x98, 0x08, 0x52, 0x03, 0xaa, 0x2a, 0x73, 0x01, 0xaa,
+	0x52, 0x12, 0x80, 0x80, 0x26, 0x08, 0x0b, 0x83, 0x80, 0x80, 0x0d, 0x88, 0x65, 0x10, 0x80, 0x15,
+	0x14, 0x12, 0x52, 0x01, 0x01, 0x28, 0xb0, 0xb8, 0xbc, 0xc8, 0x80, 0x80, 0x80, 0x80, 0x37, 0x04,
+	0x26, 0x22, 0x88, 0x30, 0x34, 0xb8, 0xcc, 0x30, 0x08, 0xc8, 0x0c, 0x08, 0x08, 0xd8, 0x48, 0x03,
+	0xd0, 0x0b, 0x08, 0xd8, 0xcb, 0x3a, 0x08, 0x0d, 0x08, 0xc8, 0x48, 0x30, 0x80, 0x80, 0x0e, 0x08,
+	0xbd, 0x9f, 0xa9, 0xc8, 0x9a, 0x8a, 0xb0, 0xf8, 0x0a, 0x22, 0x82, 0xb0, 0x08, 0x58, 0xcb, 0xb0,
+	0x0c, 0xac, 0xbb, 0xc8, 0x80, 0xbc, 0x0c, 0x48, 0x08, 0x0c, 0x08, 0xc8, 0x0c, 0x8b, 0x08, 0xcf,
+	0xa0, 0x02, 0x08, 0x0c, 0x33, 0x03, 0x04, 0x34, 0x08, 0xc8, 0x08, 0x85, 0xf0, 0xca, 0x08, 0xa1,
+	0xaa, 0x08, 0x17, 0x00, 0x88, 0x36, 0x23, 0x0a, 0x68, 0x33, 0x98, 0x9d, 0x41, 0x01, 0xaa, 0x3a,
+	0x62, 0xa0, 0x0a, 0x62, 0x01, 0x8a, 0x20, 0x33, 0xc8, 0x80, 0x40, 0x03, 0x34, 0x48, 0x30, 0x34,
+	0x34, 0x43, 0x83, 0x80, 0x04, 0x08, 0xbd, 0xbc, 0xc0, 0xc0, 0x80, 0x30, 0xc0, 0x03, 0x37, 0x24,
+	0x22, 0x38, 0x42, 0x32, 0xc0, 0x0b, 0xc8, 0x80, 0x0c, 0xbc, 0xcb, 0x80, 0x80, 0x80, 0x80, 0xb7,
+	0x80, 0x40, 0x30, 0x0c, 0x8c, 0x84, 0x80, 0x80, 0xe0, 0x80, 0x40, 0x08, 0xc8, 0x0c, 0xb8, 0xc8,
+	0xbc, 0xbb, 0xcc, 0xba, 0xcb, 0x80, 0xc0, 0x8b, 0x58, 0x33, 0x84, 0x8b, 0x80, 0x35, 0xc0, 0xcb,
+	0xbb, 0xc0, 0x9f, 0x0a, 0xaa, 0xba, 0xbb, 0x40, 0x08, 0x8c, 0x8b, 0x80, 0x60, 0x08, 0x08, 0x0d,
+	0x00, 0xf1, 0x25, 0x00, 0x84, 0x03, 0x8c, 0x80, 0x85, 0x84, 0x0b, 0x48, 0xc0, 0x0b, 0x08, 0x08,
+	0xcd, 0xbb, 0x40, 0x08, 0x08, 0x44, 0x43, 0x60, 0x22, 0x24, 0x01, 0x32, 0x33, 0xc3, 0xc0, 0x30,
+	0xc8, 0x9f, 0x08, 0x82, 0xaa, 0x0f, 0x11, 0x82, 0x80, 0x33, 0x17, 0x01, 0x28, 0x53, 0x22, 0x08,
+	0x38, 0x03, 0x08, 0xe8, 0xb0, 0xc8, 0x8b, 0xd0, 0xbb, 0xaf, 0x00, 0x0b, 0x80, 0x48, 0x83, 0x80,
+	0x70, 0x26, 0x21, 0x0a, 0x22, 0x15, 0xa0, 0x9d, 0x08, 0xca, 0xbc, 0x89, 0x80, 0xcf, 0x89, 0x11,
+	0x91, 0x98, 0x51, 0x13, 0x80, 0x52, 0x63, 0x80, 0x09, 0x31, 0x84, 0xbb, 0x0d, 0x11, 0xcb, 0x9d,
+	0x18, 0x90, 0xdc, 0x28, 0x12, 0x98, 0x2c, 0x73, 0x02, 0x98, 0x32, 0x44, 0x90, 0x89, 0x23, 0x01,
+	0xbd, 0x19, 0x80, 0xdd, 0x9b, 0x18, 0xa0, 0xbc, 0x2a, 0x32, 0xb2, 0x30, 0x74, 0x03, 0x88, 0x43,
+	0x24, 0xa8, 0xb9, 0x30, 0x88, 0xfb, 0x9f, 0x09, 0xb9, 0xca, 0x09, 0x98, 0xda, 0x89, 0x22, 0x08,
+	0x08, 0x78, 0x12, 0x00, 0x88, 0x03, 0x03, 0xcc, 0xc0, 0xb0, 0xcb, 0x0b, 0xbc, 0x9f, 0xab, 0x80,
+	0x80, 0xc0, 0xba, 0x43, 0x33, 0x03, 0x44, 0x38, 0x00, 0x74, 0x14, 0x08, 0xaa, 0x3a, 0x62, 0x80,
+	0xca, 0x0a, 0x08, 0x08, 0x08, 0x84, 0xcb, 0x3b, 0x47, 0x23, 0x08, 0x08, 0x45, 0x33, 0x14, 0x08,
+	0x82, 0x20, 0x33, 0x80, 0xd0, 0x8b, 0x0c, 0x08, 0x08, 0x08, 0xbf, 0x30, 0x74, 0x01, 0x08, 0x38,
+	0x25, 0x28, 0x20, 0x33, 0xc0, 0x08, 0x58, 0xb8, 0x8b, 0x8c, 0x0c, 0xbc, 0xbb, 0xc8, 0xbc, 0x0b,
+	0x3c, 0x08, 0xbd, 0x80, 0x40, 0xb4, 0x80, 0x34, 0x07, 0xc8, 0xa9, 0x02, 0xab, 0xbe, 0x8a, 0xa0,
+	0xfb, 0xac, 0x80, 0xa0, 0xab, 0x28, 0x33, 0xb8, 0x08, 0x75, 0x91, 0xaa, 0x20, 0x33, 0xac, 0xbb,
+	0x00, 0xf6, 0x25, 0x00, 0x80, 0xfc, 0x0a, 0x01, 0xa8, 0xae, 0x40, 0x01, 0xd0, 0x89, 0x20, 0x88,
+	0x00, 0x46, 0x13, 0xa0, 0x38, 0x45, 0x83, 0x89, 0x20, 0x32, 0x0b, 0xbc, 0x03, 0xc4, 0x9e, 0x2a,
+	0x24, 0xa2, 0x08, 0x56, 0x02, 0x98, 0x28, 0x14, 0xa2, 0x20, 0x16, 0x93, 0xaa, 0x2a, 0x33, 0xb4,
+	0x8b, 0x74, 0x91, 0xca, 0x80, 0x82, 0xda, 0x0c, 0x28, 0x08, 0xab, 0x33, 0x43, 0x80, 0x0c, 0x43,
+	0x43, 0x0b, 0x03, 0x04, 0xdf, 0xbb, 0x89, 0xa0, 0xaa, 0xbb, 0xc0, 0xf0, 0xa9, 0x80, 0x80, 0xb0,
+	0x08, 0x58, 0x08, 0xbc, 0x0b, 0x08, 0x08, 0x78, 0x83, 0xc0, 0xcb, 0x0b, 0x08, 0xf8, 0xbb, 0xb0,
+	0xcb, 0xbe, 0x0a, 0x08, 0x02, 0x33, 0x47, 0x12, 0x08, 0x22, 0x63, 0x21, 0x28, 0x30, 0xb8, 0xbc,
+	0xae, 0x0a, 0x08, 0x48, 0x45, 0x21, 0x88, 0xaa, 0x30, 0x46, 0x05, 0x32, 0x81, 0xa0, 0x0c, 0x48,
+	0x24, 0x03, 0x01, 0x82, 0xb0, 0x8b, 0x70, 0x15, 0xa9, 0xab, 0xaa, 0x0b, 0x48, 0x57, 0x23, 0x98,
+	0xb9, 0x80, 0x22, 0x72, 0x25, 0x81, 0xdb, 0xac, 0xaa, 0x98, 0x19, 0x32, 0xa2, 0xd9, 0x8d, 0x0b,
+	0x08, 0x41, 0x35, 0x12, 0xb9, 0xac, 0xa9, 0xbc, 0x9b, 0x08, 0x22, 0x80, 0xcb, 0xbf, 0xdd, 0x9a,
+	0x29, 0x33, 0x81, 0xcb, 0xdb, 0xaa, 0x89, 0x63, 0x33, 0x83, 0xa0, 0x89, 0xaa, 0x80, 0x43, 0x16,
+	0xe9, 0xbc, 0xaa, 0x9b, 0x10, 0x62, 0x11, 0xb8, 0xab, 0x22, 0x37, 0x33, 0x44, 0x82, 0xb0, 0x9b,
+	0x10, 0x20, 0x33, 0x33, 0x04, 0xbc, 0x80, 0x40, 0x80, 0x8c, 0x80, 0x35, 0x34, 0x17, 0x21, 0xd0,
+	0xb9, 0x28, 0x74, 0x34, 0x23, 0x82, 0xc9, 0xbb, 0x8c, 0x30, 0x34, 0x13, 0xb8, 0xdc, 0xac, 0x8b,
+	0x51, 0x33, 0x22, 0x83, 0xa0, 0xa9, 0x0a, 0x02, 0x33, 0x8b, 0xbd, 0x08, 0x0d, 0x8b, 0xd0, 0xfb,
+	0x00, 0x09, 0x2e, 0x00, 0x89, 0x40, 0x41, 0x31, 0xa0, 0xfa, 0xbc, 0xaa, 0x38, 0x44, 0x24, 0x11,
+	0xba, 0xcd, 0xaa, 0x18, 0x22, 0x14, 0x91, 0xeb, 0xdb, 0xca, 0x99, 0x18, 0x22, 0x33, 0x22, 0xa8,
+	0xdc, 0xaa, 0xa9, 0x80, 0x20, 0x32, 0xc3, 0xfa, 0xaf, 0xaa, 0xa9, 0x10, 0x53, 0x34, 0x03, 0x01,
+	0xb9, 0xbb, 0x0c, 0x61, 0x34, 0x34, 0x02, 0xa0, 0xae, 0x9a, 0x28, 0x63, 0x23, 0x12, 0xa9, 0xcd,
+	0xaa, 0x99, 0x10, 0x12, 0x21, 0x88, 0x00, 0xb8, 0x30, 0x74, 0x01, 0xaa, 0x80, 0x33, 0x48, 0xb8,
+	0xf0, 0xcf, 0x9c, 0x18, 0x53, 0x33, 0x33, 0x01, 0xa9, 0xac, 0x51, 0x44, 0x23, 0x33, 0x00, 0xbd,
+	0xac, 0x09, 0x32, 0x33, 0x24, 0x00, 0xdc, 0xaa, 0x10, 0x08, 0xb9, 0x9c, 0xb9, 0xbc, 0x89, 0x24,
+	0xc8, 0xbd, 0x9b, 0x80, 0x80, 0x50, 0x63, 0x88, 0xbe, 0xaa, 0x9a, 0x99, 0x51, 0x43, 0x92, 0xa9,
+	0x09, 0x21, 0x51, 0x31, 0x34, 0xc9, 0xbd, 0x0a, 0x18, 0xa9, 0xa9, 0x82, 0xfa, 0xbb, 0x2a, 0x37,
+	0x13, 0x33, 0x23, 0xfa, 0xcc, 0x09, 0x11, 0x08, 0x99, 0xb8, 0xec, 0xab, 0x09, 0x82, 0xa2, 0x22,
+	0x04, 0xc8, 0xaa, 0x32, 0x45, 0x13, 0x10, 0x00, 0xbb, 0x80, 0x67, 0x23, 0x91, 0x99, 0xbc, 0xc9,
+	0x80, 0x28, 0x32, 0x0b, 0xac, 0x08, 0x73, 0x54, 0x44, 0x22, 0x11, 0x08, 0x10, 0x32, 0x44, 0x14,
+	0x98, 0xdc, 0xac, 0xab, 0x88, 0x22, 0x24, 0x00, 0xbb, 0xdb, 0x9c, 0x28, 0x72, 0x33, 0x32, 0x90,
+	0xd8, 0xba, 0x0b, 0x38, 0x24, 0x15, 0x98, 0xac, 0xbc, 0xaa, 0x08, 0x41, 0x21, 0x01, 0x08, 0xb8,
+	0x30, 0x47, 0x25, 0x08, 0xbb, 0xeb, 0xaa, 0x10, 0x33, 0x12, 0xf9, 0xcd, 0xac, 0x9b, 0x18, 0x43,
+	0x24, 0x02, 0xa8, 0xbc, 0xab, 0x20, 0x36, 0x35, 0x12, 0x90, 0xeb, 0xaa, 0x99, 0x10, 0x42, 0x10,
+	0x00, 0xff, 0x31, 0x00, 0xca, 0xbc, 0xab, 0x00, 0x63, 0x33, 0x22, 0x01, 0xc9, 0xac, 0x99, 0x08,
+	0x10, 0x80, 0xea, 0xdc, 0xbb, 0xcb, 0x89, 0x10, 0x35, 0x14, 0x12, 0x81, 0x99, 0x0a, 0x52, 0x37,
+	0x45, 0x22, 0x02, 0x80, 0xb9, 0xab, 0x2b, 0x62, 0x52, 0x12, 0x01, 0xda, 0xcc, 0xaa, 0x99, 0x22,
+	0x35, 0x24, 0x02, 0xb9, 0xbd, 0xac, 0x9b, 0x00, 0x33, 0x13, 0xc8, 0xdd, 0xbb, 0xac, 0x88, 0x52,
+	0x33, 0x13, 0x91, 0xc8, 0xdb, 0x0a, 0x40, 0x35, 0x34, 0x32, 0x01, 0xaa, 0xbc, 0x99, 0x10, 0x22,
+	0x43, 0x81, 0xcb, 0xbc, 0x99, 0x12, 0x54, 0x25, 0x01, 0xb9, 0xdc, 0xac, 0xaa, 0x98, 0x01, 0x32,
+	0x02, 0xba, 0xdf, 0xbb, 0xbc, 0xaa, 0x10, 0x41, 0x31, 0x23, 0x98, 0xc9, 0x99, 0x21, 0x37, 0x26,
+	0x24, 0x12, 0x80, 0x99, 0x9a, 0x8a, 0x29, 0x21, 0x23, 0x33, 0x64, 0x01, 0x22, 0xa8, 0xfb, 0xad,
+	0x8a, 0x88, 0x62, 0x34, 0x34, 0x03, 0xb0, 0xbd, 0xbd, 0xbc, 0x9a, 0x98, 0x81, 0x01, 0x81, 0xa9,
+	0xca, 0xca, 0x89, 0x80, 0x53, 0x62, 0x42, 0x32, 0x34, 0x43, 0x22, 0x11, 0x08, 0xa8, 0xda, 0xcb,
+	0xbb, 0x8b, 0x2a, 0x36, 0x35, 0x23, 0x82, 0xbc, 0xaf, 0xbb, 0x0a, 0x42, 0x45, 0x33, 0x23, 0x90,
+	0xea, 0xbb, 0xbd, 0xab, 0x9a, 0x09, 0x18, 0x21, 0x13, 0x02, 0xa8, 0xb8, 0xcb, 0x08, 0x74, 0x26,
+	0x34, 0x23, 0x13, 0x99, 0xdb, 0xaa, 0xac, 0x9b, 0x99, 0x8a, 0x00, 0x38, 0x73, 0x32, 0x24, 0x21,
+	0xaa, 0xfb, 0xbc, 0xaa, 0x00, 0x43, 0x25, 0x14, 0x00, 0xb9, 0xbd, 0xae, 0xab, 0xab, 0x98, 0x18,
+	0x42, 0x44, 0x33, 0x34, 0x33, 0x22, 0x23, 0x28, 0x32, 0x83, 0xb4, 0xf8, 0xa9, 0xbc, 0xbc, 0xa9,
+	0x0a, 0x08, 0x38, 0x34, 0x03, 0xc8, 0xbc, 0xbf, 0xad, 0x08, 0x51, 0x35, 0x43, 0x23, 0x90, 0xeb,
+	0x00, 0x03, 0x36, 0x00, 0xdb, 0xab, 0xa9, 0x00, 0x22, 0x33, 0x32, 0x01, 0x80, 0x08, 0x80, 0x24,
+	0x37, 0x25, 0x43, 0x21, 0x11, 0x80, 0x80, 0x20, 0x80, 0x84, 0x43, 0x08, 0xac, 0xac, 0xfb, 0xad,
+	0xcb, 0xba, 0x9a, 0x9a, 0x12, 0x35, 0x43, 0x13, 0x80, 0xda, 0xcb, 0xbc, 0xba, 0x9a, 0x82, 0x15,
+	0x34, 0x25, 0x13, 0x81, 0xa9, 0xbd, 0xad, 0xba, 0x0b, 0x28, 0x64, 0x34, 0x33, 0x04, 0x01, 0xb9,
+	0xc9, 0x99, 0x19, 0x52, 0x44, 0x33, 0x13, 0x98, 0xbc, 0xbf, 0xcb, 0xba, 0x9a, 0x99, 0x12, 0x21,
+	0x21, 0xb0, 0xca, 0xbf, 0xac, 0x9b, 0x29, 0x71, 0x53, 0x53, 0x23, 0x23, 0x00, 0xba, 0xbe, 0xbc,
+	0x9b, 0x19, 0x62, 0x43, 0x43, 0x12, 0x80, 0xca, 0xcc, 0xbb, 0xa9, 0x08, 0x41, 0x44, 0x32, 0x12,
+	0x80, 0xca, 0xdb, 0xba, 0x99, 0x18, 0x40, 0x13, 0x04, 0x01, 0xab, 0xbd, 0xcb, 0xab, 0x99, 0x31,
+	0x44, 0x36, 0x53, 0x22, 0x12, 0x00, 0xc9, 0xdb, 0xca, 0xab, 0x8a, 0x40, 0x44, 0x44, 0x32, 0x12,
+	0x98, 0xeb, 0xcc, 0xba, 0xab, 0x9a, 0x21, 0x53, 0x43, 0x33, 0x02, 0x98, 0xdb, 0xac, 0x9c, 0x89,
+	0x10, 0x41, 0x23, 0x23, 0x01, 0x80, 0x99, 0x8b, 0x80, 0x62, 0x33, 0x36, 0x22, 0x83, 0xc0, 0xdc,
+	0xcc, 0xcb, 0xaa, 0x09, 0x20, 0x35, 0x44, 0x32, 0x13, 0x81, 0xca, 0xcc, 0xcc, 0xaa, 0x9a, 0x00,
+	0x41, 0x43, 0x24, 0x23, 0x02, 0x88, 0xca, 0xbc, 0xbc, 0xab, 0xaa, 0x80, 0x42, 0x63, 0x42, 0x33,
+	0x33, 0x33, 0x12, 0x01, 0xa9, 0xcc, 0xbc, 0xbb, 0xac, 0xac, 0xaa, 0xda, 0xaa, 0x99, 0x28, 0x44,
+	0x54, 0x33, 0x23, 0x12, 0x98, 0xbd, 0xdc, 0xbb, 0xab, 0x89, 0x53, 0x44, 0x44, 0x32, 0x12, 0x01,
+	0xb8, 0xbc, 0xcd, 0xcb, 0xba, 0xbb, 0x89, 0x18, 0x44, 0x44, 0x24, 0x23, 0x13, 0x81, 0xa8, 0xbc,
+	0x00, 0x0e, 0x36, 0x00, 0xcd, 0xbb, 0xba, 0x99, 0x18, 0x31, 0x45, 0x42, 0x22, 0x22, 0x11, 0x88,
+	0xab, 0xbe, 0xdb, 0xca, 0xaa, 0x89, 0x19, 0x33, 0x65, 0x33, 0x35, 0x32, 0x12, 0x90, 0xeb, 0xbc,
+	0xcc, 0xab, 0xab, 0x8a, 0x18, 0x42, 0x53, 0x33, 0x43, 0x12, 0x00, 0xaa, 0xda, 0xbc, 0xcb, 0xba,
+	0x9a, 0x08, 0x43, 0x46, 0x33, 0x35, 0x32, 0x13, 0x81, 0xb8, 0xdc, 0xbc, 0xac, 0xbb, 0xaa, 0x08,
+	0x41, 0x44, 0x24, 0x34, 0x22, 0x12, 0x81, 0x98, 0xba, 0xcc, 0xbb, 0x9c, 0x9a, 0x00, 0x31, 0x44,
+	0x43, 0x23, 0x23, 0x81, 0xb0, 0xdc, 0xbc, 0xcc, 0xba, 0xab, 0x89, 0x18, 0x53, 0x36, 0x44, 0x33,
+	0x24, 0x13, 0x00, 0xba, 0xcd, 0xbc, 0xbc, 0xbb, 0xaa, 0x99, 0x11, 0x42, 0x34, 0x43, 0x22, 0x12,
+	0x90, 0xb9, 0xdc, 0xbb, 0xbc, 0xaa, 0x9a, 0x10, 0x42, 0x35, 0x43, 0x33, 0x23, 0x12, 0x80, 0xc9,
+	0xbd, 0xdc, 0xcb, 0xbb, 0xac, 0xaa, 0x0a, 0x18, 0x22, 0x35, 0x25, 0x14, 0x13, 0x02, 0x80, 0xa9,
+	0xad, 0xaa, 0x9b, 0x89, 0x80, 0x83, 0x33, 0x27, 0x41, 0x82, 0x80, 0xb0, 0xfb, 0xb9, 0x9c, 0xac,
+	0xab, 0xab, 0x8a, 0x30, 0x37, 0x35, 0x26, 0x23, 0x24, 0x32, 0x23, 0x32, 0x01, 0xc8, 0xcb, 0xdc,
+	0xab, 0xbb, 0xa8, 0x09, 0x21, 0x15, 0x25, 0x43, 0x22, 0x33, 0x01, 0x01, 0x08, 0xb8, 0xc0, 0xfb,
+	0xca, 0x99, 0x28, 0x72, 0x44, 0x33, 0x24, 0x32, 0x01, 0x90, 0xdb, 0xcb, 0xcc, 0xba, 0xbc, 0x99,
+	0x0a, 0x08, 0x11, 0x23, 0x34, 0x34, 0x41, 0x11, 0x82, 0xaa, 0xfa, 0xb9, 0xa9, 0x0a, 0x80, 0x33,
+	0x47, 0x32, 0x44, 0x22, 0x13, 0xa0, 0xfa, 0xdb, 0xbb, 0xbc, 0xbb, 0xab, 0x9a, 0x11, 0x44, 0x44,
+	0x33, 0x23, 0x21, 0x88, 0xc9, 0xcb, 0xbb, 0xbc, 0xab, 0x89, 0x38, 0x73, 0x33, 0x44, 0x13, 0x11,
+	0x00, 0x0a, 0x2c, 0x00, 0xa0, 0xba, 0xcd, 0xcc, 0xdb, 0xab, 0x9c, 0x9b, 0x89, 0x10, 0x21, 0x43,
+	0x44, 0x43, 0x32, 0x13, 0x81, 0xa9, 0xda, 0xcb, 0xc9, 0x99, 0xa9, 0x80, 0x80, 0x48, 0x38, 0x03,
+	0x08, 0xbd, 0xbc, 0x9f, 0xc9, 0x98, 0x80, 0x80, 0x23, 0x37, 0x63, 0x32, 0x24, 0x33, 0x21, 0x14,
+	0x11, 0x22, 0x82, 0xb0, 0xcb, 0xeb, 0xca, 0xa9, 0x80, 0x2a, 0x80, 0x34, 0x48, 0x83, 0x80, 0xd0,
+	0xb8, 0xbc, 0x0c, 0x48, 0x38, 0x34, 0x43, 0x16, 0x14, 0x63, 0x22, 0x24, 0x12, 0x11, 0x08, 0x0a,
+	0x9e, 0xdb, 0xca, 0xac, 0xac, 0xab, 0xaa, 0x99, 0x0a, 0x08, 0x15, 0x63, 0x23, 0x34, 0x13, 0x13,
+	0x28, 0xb0, 0x00, 0x88, 0xc0, 0xc0, 0xbb, 0xbc, 0xbb, 0xbc, 0xc8, 0x8b, 0xbc, 0x8b, 0xcc, 0xc0,
+	0xba, 0xcb, 0xc0, 0x80, 0x30, 0x27, 0x25, 0x43, 0x81, 0x82, 0x98, 0xb8, 0xb0, 0xc8, 0xc0, 0x0b,
+	0x0c, 0x83, 0x34, 0x27, 0x21, 0x80, 0xb0, 0xcb, 0xbb, 0xbf, 0xbc, 0xcb, 0xbb, 0x9c, 0x9a, 0x08,
+	0x38, 0x30, 0x43, 0x73, 0x24, 0x63, 0x11, 0x11, 0x08, 0x9a, 0xca, 0xca, 0xab, 0x9c, 0x9c, 0x9a,
+	0x0a, 0x0b, 0x08, 0xc8, 0xc0, 0x0b, 0x0c, 0x48, 0x63, 0x42, 0x63, 0x22, 0x32, 0x13, 0x12, 0x02,
+	0x83, 0xc0, 0x08, 0x08, 0x04, 0x08, 0x85, 0x40, 0x08, 0x84, 0x84, 0x00, 0x88, 0x00, 0x88, 0x0f,
+	0xbc, 0xbf, 0xeb, 0xdb, 0xaa, 0xaa, 0x98, 0x11, 0x35, 0x54, 0x43, 0x42, 0x22, 0x11, 0x00, 0x89,
+	0x99, 0x9a, 0x0a, 0xaa, 0xe8, 0xba, 0xdc, 0xac, 0xcb, 0xab, 0x8b, 0x9a, 0x12, 0x54, 0x34, 0x25,
+	0x24, 0x12, 0x12, 0x21, 0x11, 0x21, 0x01, 0x08, 0xeb, 0xeb, 0xbb, 0xae, 0xab, 0xac, 0xba, 0x9a,
+	0x09, 0x31, 0x54, 0x32, 0x32, 0x13, 0x82, 0x80, 0xb3, 0x08, 0x0c, 0xbc, 0xcb, 0xbb, 0xc0, 0xb8,
+	0x00, 0xfb, 0x24, 0x00, 0x0c, 0x8c, 0x00, 0x53, 0x73, 0x31, 0x14, 0x12, 0xa0, 0xdb, 0xca, 0xcb,
+	0xbb, 0xca, 0xa9, 0xd9, 0xa9, 0xa9, 0xaa, 0xab, 0x88, 0x40, 0x64, 0x45, 0x53, 0x43, 0x43, 0x22,
+	0x22, 0x01, 0x90, 0xba, 0xdc, 0xbb, 0xdb, 0xba, 0xb9, 0x9c, 0xbb, 0xca, 0xaa, 0x9b, 0x0a, 0x28,
+	0x45, 0x34, 0x45, 0x33, 0x24, 0x11, 0x81, 0x98, 0x9a, 0x89, 0x22, 0x53, 0x44, 0x13, 0x81, 0xc0,
+	0xe9, 0xba, 0xac, 0x9a, 0x19, 0x32, 0x54, 0x24, 0x22, 0x80, 0x99, 0xae, 0xab, 0x9d, 0x9a, 0x99,
+	0xa9, 0xa9, 0x8a, 0xba, 0xc0, 0x08, 0x30, 0x35, 0x37, 0x35, 0x35, 0x43, 0x22, 0x10, 0xa0, 0xb9,
+	0xd9, 0xaa, 0x9b, 0xac, 0xa9, 0x9d, 0x98, 0xaa, 0xea, 0xb9, 0x9c, 0x9c, 0x80, 0x42, 0x63, 0x53,
+	0x32, 0x32, 0x21, 0x10, 0x0a, 0xac, 0xab, 0xaf, 0xca, 0xaa, 0xaa, 0xcb, 0xb9, 0xc9, 0x89, 0x20,
+	0x64, 0x63, 0x42, 0x33, 0x32, 0x21, 0x98, 0xb8, 0xbd, 0xdb, 0xac, 0xaa, 0xbb, 0xaa, 0xbb, 0xad,
+	0xac, 0xcb, 0xab, 0x9a, 0x21, 0x55, 0x45, 0x43, 0x43, 0x32, 0x32, 0x11, 0x01, 0x98, 0xa9, 0xab,
+	0xbd, 0xcb, 0xdb, 0xcb, 0xcb, 0xbb, 0xba, 0x8a, 0x38, 0x34, 0x37, 0x34, 0x33, 0x14, 0x02, 0x91,
+	0x98, 0xcb, 0xbb, 0xbc, 0xac, 0xca, 0xb9, 0xbc, 0xba, 0xbb, 0x9b, 0x08, 0x44, 0x36, 0x35, 0x35,
+	0x33, 0x43, 0x23, 0x21, 0x01, 0x90, 0xb9, 0xcc, 0xdb, 0xcb, 0xcb, 0xbb, 0xbc, 0xcb, 0xcb, 0xaa,
+	0x9a, 0x10, 0x51, 0x44, 0x43, 0x43, 0x23, 0x22, 0x01, 0x00, 0xa9, 0xaa, 0xba, 0x9e, 0x9a, 0xaa,
+	0xca, 0xba, 0xac, 0xab, 0x8b, 0x80, 0x36, 0x37, 0x34, 0x33, 0x23, 0x82, 0x90, 0xac, 0xeb, 0xaa,
+	0x9a, 0x9b, 0x9a, 0xda, 0xdb, 0xcb, 0xbc, 0xbc, 0x9c, 0x98, 0x21, 0x44, 0x34, 0x44, 0x33, 0x32,
+	0x00, 0x11, 0x36, 0x00, 0x22, 0x21, 0x21, 0x21, 0x12, 0x12, 0x32, 0xbb, 0xef, 0xdb, 0xdb, 0xba,
+	0x9a, 0xa9, 0x88, 0x11, 0x81, 0x01, 0x9a, 0x9d, 0xcb, 0xc9, 0x99, 0x89, 0x52, 0x33, 0x36, 0x43,
+	0x02, 0x83, 0x80, 0xc9, 0x9a, 0xaa, 0x20, 0x30, 0x73, 0x22, 0x15, 0x23, 0x22, 0x22, 0x03, 0x53,
+	0x38, 0x80, 0x84, 0x04, 0xc8, 0xfa, 0xdb, 0xcd, 0xca, 0xab, 0xcb, 0x99, 0x89, 0x09, 0x00, 0x08,
+	0x08, 0x80, 0x02, 0x16, 0x36, 0x45, 0x33, 0x35, 0x22, 0x12, 0x12, 0x80, 0x88, 0xa9, 0x89, 0x20,
+	0x20, 0x80, 0x0c, 0xcf, 0xfa, 0xbb, 0xbb, 0x9c, 0x09, 0x38, 0x52, 0x33, 0x24, 0x12, 0x99, 0xac,
+	0xbd, 0xba, 0xba, 0x89, 0x80, 0x32, 0x73, 0x31, 0x82, 0x32, 0x32, 0x43, 0x16, 0x26, 0x43, 0x34,
+	0x22, 0x12, 0x80, 0xa9, 0xaa, 0x9d, 0x9c, 0xc9, 0xa9, 0xcb, 0xcc, 0xbb, 0xbc, 0xbc, 0xca, 0xba,
+	0xba, 0x9b, 0xaa, 0x80, 0x30, 0x43, 0x33, 0x27, 0x28, 0x22, 0x23, 0x24, 0x73, 0x31, 0x42, 0x43,
+	0x05, 0x03, 0x12, 0x01, 0x08, 0xa8, 0x08, 0x88, 0x50, 0x08, 0xbc, 0xaf, 0xbd, 0xbd, 0xdb, 0xaa,
+	0xab, 0x89, 0x98, 0x01, 0x01, 0x38, 0x0b, 0x08, 0x0d, 0x3b, 0x74, 0x31, 0x26, 0x22, 0x31, 0x12,
+	0x22, 0x20, 0x33, 0x64, 0x32, 0x34, 0x34, 0x41, 0x41, 0x18, 0x80, 0x89, 0xba, 0xca, 0x80, 0x0b,
+	0x08, 0xbd, 0xec, 0xab, 0xbc, 0x9c, 0x9a, 0x0a, 0x0b, 0x38, 0x80, 0x80, 0x60, 0x03, 0x74, 0x31,
+	0x34, 0x41, 0x33, 0x34, 0x43, 0x11, 0x22, 0x08, 0x08, 0xb8, 0xc8, 0xc8, 0x0b, 0x08, 0x58, 0x80,
+	0x35, 0x33, 0x44, 0x02, 0xb8, 0xff, 0xba, 0xbb, 0xbc, 0xbb, 0xba, 0x9a, 0xaa, 0xdb, 0xca, 0xcb,
+	0xbb, 0xab, 0x08, 0x38, 0x57, 0x33, 0x44, 0x42, 0x32, 0x11, 0x11, 0x11, 0x28, 0x80, 0x32, 0x08,
+	0x00, 0x12, 0x25, 0x00, 0xac, 0xdc, 0xbe, 0xfb, 0xba, 0xba, 0xbb, 0xcb, 0xa9, 0xba, 0x99, 0x28,
+	0x38, 0x38, 0x42, 0x08, 0x08, 0x8c, 0xc0, 0xcb, 0x0b, 0x48, 0x43, 0x56, 0x43, 0x43, 0x32, 0x34,
+	0x21, 0x13, 0x08, 0x21, 0x02, 0x32, 0x30, 0x04, 0x08, 0x0d, 0x08, 0xbc, 0xaf, 0xc9, 0xba, 0xda,
+	0xbb, 0xcc, 0xab, 0xa9, 0x80, 0x22, 0x63, 0x63, 0x53, 0x22, 0x33, 0x32, 0x88, 0x20, 0x28, 0x80,
+	0x30, 0x73, 0x22, 0x22, 0x03, 0x08, 0x08, 0x44, 0x73, 0x14, 0x33, 0x42, 0x43, 0x11, 0x22, 0xa8,
+	0xbb, 0xbb, 0xbc, 0xec, 0xa9, 0xca, 0xea, 0xca, 0xdb, 0xbb, 0xbc, 0xaa, 0x9a, 0xa8, 0x80, 0x00,
+	0x82, 0x32, 0x24, 0x46, 0x32, 0x43, 0x53, 0x12, 0x31, 0x12, 0x82, 0xb0, 0xb0, 0xaf, 0xdb, 0xb9,
+	0xa9, 0xa0, 0x08, 0x08, 0xc0, 0x08, 0xc8, 0x08, 0xbd, 0xbb, 0xcf, 0xcb, 0xaa, 0x99, 0xaa, 0x0b,
+	0x08, 0xc8, 0xbb, 0xdf, 0xca, 0xba, 0x99, 0x10, 0x22, 0x55, 0x24, 0x43, 0x13, 0x12, 0x01, 0x80,
+	0x08, 0x02, 0x33, 0x43, 0x17, 0x14, 0x81, 0xa0, 0xda, 0xcb, 0x9b, 0x98, 0x08, 0x38, 0x73, 0x24,
+	0x33, 0x42, 0x82, 0x82, 0x20, 0x80, 0x80, 0x8c, 0x8b, 0xe0, 0x80, 0x0c, 0xcb, 0x0b, 0x08, 0x08,
+	0x08, 0x08, 0xf8, 0xd8, 0x80, 0xac, 0xac, 0x8b, 0x80, 0x85, 0x30, 0x44, 0x02, 0x83, 0x34, 0x80,
+	0xd0, 0x80, 0x0c, 0x08, 0x58, 0x17, 0x43, 0x41, 0x32, 0x25, 0x11, 0x82, 0xa0, 0xd8, 0xa9, 0x9a,
+	0x9e, 0x99, 0x8c, 0xa9, 0xa9, 0xbf, 0xbb, 0xbd, 0xcb, 0xaa, 0xa9, 0xa9, 0xa9, 0x82, 0x80, 0x30,
+	0x40, 0x80, 0x50, 0x33, 0x27, 0x25, 0x53, 0x32, 0x24, 0x04, 0x11, 0x21, 0x11, 0x52, 0x31, 0x22,
+	0x22, 0x80, 0x80, 0x80, 0xbd, 0x0c, 0x0c, 0xb8, 0x8b, 0x8c, 0xd0, 0xbe, 0xca, 0xa9, 0xdc, 0xcb,
+	0x00, 0xf7, 0x32, 0x00, 0x9a, 0xa8, 0x80, 0x22, 0x82, 0x8a, 0x80, 0xb4, 0xdb, 0xba, 0x8b, 0x0c,
+	0x08, 0x74, 0x24, 0x33, 0x34, 0x43, 0x83, 0xa9, 0x0a, 0xb8, 0x0b, 0x78, 0x35, 0x31, 0x62, 0x42,
+	0x21, 0x18, 0xa0, 0xc0, 0x9a, 0x0a, 0x0b, 0x08, 0x43, 0x80, 0x04, 0xc8, 0xfb, 0xaf, 0xaa, 0xca,
+	0xa9, 0x99, 0x99, 0x9a, 0x08, 0x08, 0xfb, 0x9b, 0xca, 0xa9, 0x0a, 0x3b, 0x33, 0x34, 0x33, 0x77,
+	0x11, 0x08, 0x18, 0x12, 0x12, 0x35, 0x25, 0x14, 0x22, 0x52, 0x12, 0x81, 0x01, 0x21, 0x80, 0x20,
+	0x40, 0x38, 0x80, 0x80, 0x80, 0xfe, 0xad, 0xac, 0xca, 0xaa, 0x8a, 0x80, 0x89, 0x20, 0x30, 0xac,
+	0xbb, 0xaf, 0xdb, 0xaa, 0x9b, 0xa8, 0x20, 0x33, 0x27, 0x23, 0x02, 0xe8, 0xab, 0xca, 0xca, 0x89,
+	0x22, 0x53, 0x42, 0x43, 0x13, 0x82, 0x20, 0x38, 0x80, 0x80, 0x50, 0x24, 0x37, 0x63, 0x32, 0x23,
+	0x01, 0x80, 0x08, 0xb0, 0x08, 0x03, 0x85, 0x00, 0x34, 0xc0, 0xbc, 0x9f, 0xc9, 0xdb, 0xbb, 0xac,
+	0xbc, 0xaa, 0xa9, 0xa9, 0xa9, 0xad, 0xc9, 0xba, 0xaa, 0x8a, 0x0b, 0x48, 0x24, 0x33, 0x27, 0x23,
+	0x35, 0x43, 0x33, 0x26, 0x40, 0x32, 0x34, 0x42, 0x32, 0x32, 0x03, 0x21, 0x22, 0x80, 0x30, 0x74,
+	0x01, 0x91, 0x08, 0xeb, 0xeb, 0xbb, 0xae, 0xba, 0xac, 0xaa, 0xaa, 0xba, 0x9b, 0xbc, 0xad, 0xbd,
+	0xda, 0xaa, 0xaa, 0x99, 0x08, 0x11, 0x22, 0x24, 0x84, 0x82, 0x20, 0x20, 0x80, 0x74, 0x33, 0x34,
+	0x35, 0x26, 0x22, 0x32, 0x21, 0x08, 0x08, 0x82, 0x20, 0x33, 0x67, 0x21, 0x11, 0x11, 0xa0, 0xca,
+	0xcc, 0xab, 0xbb, 0xbc, 0x89, 0x80, 0x08, 0x80, 0x08, 0xfc, 0x9e, 0xaa, 0xcb, 0x9a, 0x19, 0x12,
+	0x22, 0x35, 0x14, 0xa2, 0x80, 0x8a, 0x9e, 0xaa, 0x20, 0x23, 0x17, 0x45, 0x22, 0x32, 0x22, 0x21,
+	0x00, 0x07, 0x2b, 0x00, 0x80, 0x38, 0x73, 0x53, 0x52, 0x24, 0x43, 0x12, 0x31, 0x01, 0x00, 0x08,
+	0x88, 0x20, 0x60, 0x41, 0x13, 0x22, 0x82, 0xb0, 0xbf, 0xcb, 0xbd, 0xbc, 0x9a, 0xaa, 0xab, 0x0c,
+	0xc9, 0xbd, 0xdb, 0xbb, 0xbe, 0xca, 0xa9, 0x99, 0x8b, 0x89, 0x88, 0x90, 0xaa, 0x80, 0xba, 0xcb,
+	0x3b, 0x34, 0x78, 0x54, 0x34, 0x32, 0x53, 0x32, 0x11, 0x01, 0x21, 0x23, 0x51, 0x31, 0x34, 0x21,
+	0x82, 0x83, 0xb3, 0xec, 0xcb, 0xbb, 0xbe, 0xbd, 0xa9, 0xc8, 0xaa, 0xab, 0xda, 0xeb, 0xaa, 0xab,
+	0xac, 0xaa, 0x9a, 0xaa, 0x9a, 0x0a, 0x8a, 0xb0, 0x03, 0x58, 0x08, 0x08, 0x44, 0x33, 0x57, 0x25,
+	0x32, 0x34, 0x32, 0x23, 0x32, 0x36, 0x32, 0x33, 0x45, 0x32, 0x22, 0x34, 0x43, 0x22, 0x32, 0x33,
+	0x01, 0x8a, 0x33, 0x87, 0x10, 0x22, 0x25, 0xca, 0xa9, 0x98, 0xab, 0x9f, 0x80, 0xa9, 0xda, 0x9c,
+	0x99, 0xca, 0xc9, 0xa9, 0xa0, 0xec, 0xaa, 0x99, 0x99, 0xaa, 0x22, 0x33, 0xcb, 0x0b, 0x03, 0x0d,
+	0x3b, 0x47, 0x23, 0x41, 0x43, 0x25, 0x30, 0x52, 0x33, 0x23, 0x12, 0x12, 0x32, 0x72, 0x32, 0x26,
+	0x12, 0x11, 0x80, 0xc0, 0xba, 0xda, 0x99, 0x8a, 0xda, 0xcb, 0xb9, 0xae, 0xcb, 0xaa, 0xdb, 0xcc,
+	0xbb, 0xcb, 0xca, 0xab, 0x98, 0xa9, 0xcb, 0xba, 0xbc, 0xcc, 0xbb, 0x9a, 0x9a, 0x99, 0x89, 0x08,
+	0x08, 0x33, 0x64, 0x43, 0x08, 0x28, 0x32, 0x38, 0x73, 0x37, 0x24, 0x23, 0x43, 0x22, 0x98, 0x21,
+	0x42, 0x11, 0x30, 0x34, 0x04, 0x08, 0x34, 0x34, 0x08, 0x8a, 0xb0, 0xbe, 0xae, 0x89, 0xa1, 0x80,
+	0x22, 0x32, 0xfb, 0xbb, 0x9c, 0xcb, 0xa9, 0x89, 0x0a, 0x0b, 0xcb, 0x30, 0x73, 0x22, 0x20, 0x20,
+	0xb4, 0xbb, 0x40, 0x26, 0x34, 0x36, 0x26, 0x21, 0x18, 0x22, 0x12, 0x41, 0x52, 0x23, 0x22, 0x42,
+	0x00, 0x22, 0x2f, 0x00, 0x26, 0x31, 0x32, 0x24, 0x12, 0x89, 0xa9, 0x00, 0x28, 0x70, 0x53, 0x12,
+	0xa0, 0x89, 0xa9, 0xab, 0xbb, 0xc8, 0xc0, 0x9e, 0x9c, 0x98, 0xaa, 0xa8, 0x08, 0xbc, 0xff, 0xba,
+	0xcb, 0xaa, 0xaa, 0x90, 0xa0, 0xcb, 0xbc, 0xba, 0xcb, 0x9d, 0x0a, 0x99, 0xba, 0xcc, 0x09, 0x9a,
+	0xaa, 0x32, 0x06, 0xdc, 0xaa, 0x9a, 0xbb, 0x0c, 0x31, 0x15, 0x98, 0x21, 0x32, 0xbb, 0x30, 0x77,
+	0x10, 0x18, 0x31, 0x11, 0x29, 0x61, 0x34, 0x13, 0x08, 0x08, 0x9d, 0xcb, 0x28, 0x41, 0x12, 0x22,
+	0x32, 0x80, 0xbc, 0x0b, 0x08, 0x08, 0x8e, 0xc0, 0xf8, 0xc9, 0x89, 0x80, 0xb0, 0xea, 0xcb, 0xbd,
+	0xad, 0xaa, 0x88, 0x08, 0x80, 0x82, 0x80, 0xab, 0x8f, 0x29, 0x28, 0x20, 0x33, 0x40, 0x08, 0x78,
+	0x35, 0x34, 0x31, 0x11, 0x22, 0xb0, 0x30, 0x47, 0x24, 0x44, 0x43, 0x32, 0x10, 0x01, 0x33, 0x21,
+	0x34, 0x14, 0x12, 0x80, 0x23, 0x73, 0x21, 0x28, 0x82, 0xb0, 0xfb, 0x9c, 0x89, 0x80, 0x50, 0x23,
+	0x84, 0xc0, 0xa9, 0xaa, 0xba, 0xca, 0xb0, 0xb8, 0xcf, 0x0a, 0x0a, 0xaa, 0x08, 0x08, 0xc8, 0xef,
+	0x99, 0x9a, 0x99, 0x41, 0x34, 0x02, 0x01, 0x01, 0x08, 0xbb, 0x43, 0x03, 0x84, 0x40, 0x17, 0x12,
+	0x22, 0x35, 0x34, 0x21, 0x08, 0x08, 0x8b, 0x80, 0x65, 0x63, 0x21, 0x18, 0x80, 0xa9, 0xbd, 0xbb,
+	0xda, 0xb9, 0xae, 0xa9, 0xcb, 0xcb, 0xaa, 0x99, 0xae, 0xbc, 0xbc, 0xcb, 0xbb, 0xaa, 0x89, 0xaa,
+	0x9a, 0x9d, 0xdb, 0xca, 0xab, 0x9a, 0x9b, 0xaa, 0x80, 0x8a, 0x8b, 0x34, 0x47, 0x02, 0x28, 0x20,
+	0x38, 0x88, 0x47, 0x34, 0x24, 0x42, 0x24, 0x12, 0x81, 0x23, 0x42, 0x18, 0x34, 0x23, 0x82, 0x53,
+	0x44, 0x13, 0x11, 0x82, 0x02, 0xab, 0x0c, 0x38, 0x40, 0x30, 0x74, 0x01, 0x08, 0xba, 0xba, 0xb8,
+	0x00, 0x00, 0x24, 0x00, 0xd0, 0x0b, 0x0c, 0xac, 0x3b, 0x34, 0x08, 0x88, 0x00, 0x88, 0xff, 0x19,
+	0x20, 0x28, 0x63, 0x25, 0x13, 0x88, 0x42, 0x12, 0x22, 0x62, 0x13, 0x12, 0x23, 0x45, 0x25, 0x22,
+	0x32, 0x24, 0x82, 0x89, 0x08, 0x80, 0x48, 0x26, 0x43, 0x12, 0xa0, 0x88, 0x00, 0xbc, 0x80, 0x80,
+	0xbd, 0xaf, 0x89, 0xb0, 0xb0, 0x80, 0x80, 0xfd, 0xbe, 0xba, 0xac, 0xaa, 0x9b, 0xa0, 0xa9, 0xec,
+	0xaa, 0xba, 0xb9, 0x9c, 0x9a, 0xda, 0xbb, 0x9c, 0xa0, 0x9c, 0x2a, 0x22, 0xe8, 0xeb, 0xaa, 0xc9,
+	0xaa, 0x39, 0x33, 0xa2, 0x80, 0x26, 0xa1, 0x0a, 0x73, 0x24, 0x81, 0x21, 0x43, 0x80, 0x40, 0x36,
+	0x33, 0x81, 0x82, 0xaa, 0xbd, 0x0c, 0x48, 0x21, 0x21, 0x82, 0x03, 0xac, 0xbb, 0x0c, 0x88, 0x8b,
+	0xbd, 0xf8, 0xca, 0xcb, 0x08, 0x08, 0xaa, 0xbe, 0xbd, 0xae, 0xaa, 0x8a, 0x18, 0x28, 0x28, 0x22,
+	0x88, 0xca, 0x80, 0x17, 0x14, 0x11, 0x14, 0x12, 0x20, 0x72, 0x26, 0x12, 0x21, 0x22, 0x80, 0x89,
+	0x52, 0x34, 0x24, 0x35, 0x35, 0x01, 0x18, 0x22, 0x11, 0x21, 0x41, 0x12, 0xaa, 0x80, 0x03, 0x03,
+	0x04, 0x84, 0xc0, 0xbf, 0xad, 0xba, 0xa9, 0x20, 0x24, 0x34, 0x01, 0xac, 0xaa, 0xba, 0xfa, 0x89,
+	0xa0, 0xaa, 0x9e, 0x08, 0x08, 0x0b, 0x48, 0x02, 0xfb, 0xac, 0xab, 0xa9, 0x2a, 0x67, 0x22, 0x10,
+	0x21, 0x18, 0x99, 0x98, 0x01, 0x80, 0x8b, 0x40, 0x40, 0x08, 0x34, 0x73, 0x15, 0x08, 0x9a, 0xad,
+	0xcb, 0x09, 0x41, 0x33, 0x84, 0x82, 0x80, 0xea, 0xbc, 0xda, 0xba, 0xbc, 0xaa, 0xbb, 0xbd, 0xab,
+	0x9a, 0xc8, 0xc9, 0xcc, 0xeb, 0xba, 0xaa, 0x98, 0x09, 0x89, 0x80, 0x82, 0x0a, 0xaf, 0xcb, 0xaa,
+	0x9b, 0xaa, 0xa8, 0xbb, 0x0c, 0x73, 0x23, 0x22, 0x08, 0x83, 0x8b, 0x08, 0x45, 0x83, 0x64, 0x63,
+	0x00, 0xd1, 0x32, 0x00, 0x23, 0x22, 0x31, 0x12, 0x32, 0x25, 0x34, 0x12, 0x52, 0x45, 0x43, 0x32,
+	0x23, 0x53, 0x31, 0x24, 0x21, 0x13, 0x33, 0x34, 0x35, 0x35, 0x22, 0x21, 0x33, 0x01, 0x0a, 0x88,
+	0xfa, 0x89, 0x80, 0x80, 0xfa, 0x99, 0x9a, 0xca, 0xaa, 0xcc, 0xcc, 0xbc, 0xb9, 0xba, 0x99, 0xa9,
+	0xaa, 0xb0, 0xbb, 0xdf, 0xca, 0xaa, 0xba, 0xa9, 0x00, 0x8a, 0x0b, 0x08, 0x84, 0x04, 0x83, 0x80,
+	0xe0, 0xbb, 0x80, 0x74, 0x32, 0x45, 0x25, 0x21, 0x21, 0x18, 0xa0, 0x80, 0x20, 0x16, 0x43, 0x31,
+	0x22, 0x44, 0x33, 0x12, 0x83, 0xb0, 0xac, 0x8b, 0x84, 0x0b, 0x3c, 0x47, 0x11, 0x98, 0xbc, 0xde,
+	0xbb, 0xba, 0xba, 0xcc, 0xaa, 0xaa, 0xb9, 0xbb, 0xce, 0xca, 0xba, 0xca, 0xaa, 0xab, 0xbb, 0x0b,
+	0x21, 0x24, 0x82, 0x80, 0xbb, 0xfb, 0xaa, 0xba, 0x80, 0x54, 0x44, 0x26, 0x11, 0x81, 0x31, 0x11,
+	0x21, 0x34, 0x42, 0x28, 0x34, 0x36, 0x42, 0x23, 0x24, 0x00, 0x81, 0xa9, 0x9c, 0x08, 0x58, 0x52,
+	0x44, 0x12, 0x81, 0x80, 0x12, 0x08, 0x52, 0x43, 0x10, 0x21, 0x27, 0x12, 0x28, 0x43, 0x81, 0x80,
+	0xda, 0xfb, 0xac, 0x89, 0x19, 0x18, 0xa0, 0xa9, 0xdc, 0xaa, 0xcc, 0xaa, 0xba, 0x99, 0x89, 0xca,
+	0xbc, 0xa9, 0x80, 0x20, 0x33, 0xf0, 0xae, 0x99, 0x09, 0x48, 0x73, 0x33, 0x33, 0x63, 0x02, 0x10,
+	0x11, 0x43, 0x24, 0x43, 0x12, 0x32, 0x22, 0x43, 0x33, 0x53, 0x08, 0x98, 0xaa, 0xdf, 0xaa, 0x80,
+	0x11, 0x10, 0x23, 0xc8, 0xbe, 0xca, 0xba, 0xbc, 0x9a, 0xb0, 0xda, 0xbc, 0xaa, 0x9a, 0x89, 0xa0,
+	0xfa, 0xbd, 0xbc, 0xbb, 0xaa, 0x09, 0x08, 0x43, 0x12, 0x80, 0xea, 0xbb, 0xbc, 0xa9, 0xa0, 0xba,
+	0x0b, 0x43, 0x73, 0x42, 0x13, 0x51, 0x32, 0x82, 0xa0, 0x0b, 0x48, 0x75, 0x35, 0x43, 0x31, 0x22,
+	0x00, 0x0e, 0x34, 0x00, 0x10, 0x80, 0x80, 0x89, 0x80, 0x32, 0x02, 0x83, 0x34, 0x34, 0x43, 0xf8,
+	0xdb, 0xaa, 0xbd, 0xcb, 0x8a, 0x09, 0x0a, 0x41, 0x83, 0xfb, 0xaa, 0xcc, 0xab, 0x8b, 0x99, 0x89,
+	0x32, 0x44, 0x31, 0x41, 0x34, 0x31, 0x33, 0x04, 0x9a, 0x28, 0x56, 0x32, 0x35, 0x35, 0x31, 0x20,
+	0x08, 0xcb, 0xcb, 0x0a, 0x12, 0x21, 0x08, 0x82, 0xb3, 0x08, 0x34, 0xf8, 0xbe, 0x9b, 0xbb, 0xcf,
+	0x9a, 0x00, 0x00, 0x20, 0x01, 0xeb, 0xcc, 0xb9, 0xaa, 0xab, 0x99, 0x32, 0x51, 0x11, 0x01, 0x08,
+	0x08, 0x16, 0x02, 0xab, 0xbf, 0x9b, 0x10, 0x72, 0x32, 0x34, 0x22, 0x82, 0xa9, 0xbc, 0x0c, 0x33,
+	0x27, 0x21, 0x43, 0x22, 0x53, 0x34, 0x13, 0x08, 0x18, 0x82, 0xa9, 0x0b, 0x08, 0x48, 0x73, 0x27,
+	0x81, 0x99, 0xab, 0xc9, 0xbc, 0xac, 0x09, 0x99, 0x9c, 0x89, 0xcb, 0xaf, 0x89, 0xa0, 0xfb, 0xab,
+	0xbb, 0xbc, 0xaa, 0x80, 0x99, 0x80, 0x20, 0x28, 0x8a, 0xbb, 0x08, 0x58, 0x84, 0x54, 0x26, 0x22,
+	0x43, 0x34, 0x33, 0x31, 0x35, 0x23, 0x21, 0x21, 0x32, 0x45, 0x44, 0x34, 0x33, 0x33, 0x31, 0x12,
+	0x22, 0x02, 0x08, 0x43, 0x80, 0x80, 0x80, 0x00, 0xcf, 0x80, 0xc0, 0xeb, 0xbc, 0xcb, 0xec, 0xaa,
+	0x99, 0x90, 0x99, 0xa0, 0xd9, 0xdc, 0xaa, 0xab, 0xcb, 0xab, 0xac, 0xba, 0xdb, 0xab, 0x90, 0x9a,
+	0x0c, 0x98, 0xda, 0xbc, 0x99, 0x89, 0x19, 0x73, 0x24, 0x14, 0x22, 0x13, 0x81, 0x22, 0x44, 0x53,
+	0x33, 0x24, 0x14, 0x33, 0x53, 0x34, 0x35, 0x21, 0x21, 0x00, 0x08, 0x68, 0x32, 0x25, 0x13, 0x23,
+	0x01, 0xa9, 0xa9, 0x08, 0xab, 0x0c, 0xb8, 0xbf, 0xbc, 0x08, 0x08, 0x8a, 0xbb, 0xbf, 0xcf, 0xba,
+	0xaa, 0x9b, 0x9a, 0x08, 0x08, 0xda, 0xbd, 0xcb, 0xcb, 0xab, 0x9b, 0xca, 0xda, 0x9a, 0x09, 0x08,
+	0x00, 0xda, 0x2c, 0x00, 0x12, 0x20, 0xba, 0x9f, 0x9a, 0x8a, 0xaa, 0x72, 0x35, 0x12, 0x31, 0x23,
+	0x01, 0x38, 0x56, 0x11, 0x08, 0x43, 0x25, 0x22, 0x72, 0x32, 0x21, 0x32, 0x34, 0x01, 0x00, 0x41,
+	0x33, 0x23, 0x35, 0x23, 0x01, 0x38, 0x33, 0xb3, 0xbf, 0x8a, 0x80, 0xbb, 0x8c, 0xc0, 0xfb, 0x0c,
+	0x08, 0xa8, 0xcc, 0xbb, 0xca, 0xeb, 0xb8, 0xa8, 0xca, 0xba, 0x9c, 0xb9, 0xae, 0x9a, 0x99, 0xcb,
+	0xa9, 0xab, 0xaa, 0xbb, 0x30, 0x40, 0xcb, 0xcb, 0x0b, 0x08, 0x84, 0x04, 0xc3, 0xc0, 0x0b, 0x24,
+	0x24, 0x03, 0x08, 0x0d, 0xb8, 0x8c, 0x34, 0x26, 0x22, 0x52, 0x14, 0xa0, 0x0a, 0x62, 0x81, 0x00,
+	0x22, 0xb8, 0xbb, 0x74, 0x33, 0x82, 0x08, 0x23, 0xfb, 0xcb, 0x89, 0xa9, 0x9d, 0x41, 0x25, 0x08,
+	0x88, 0x00, 0xa8, 0xba, 0x03, 0xf8, 0xbc, 0x2a, 0x22, 0x38, 0x73, 0x44, 0x82, 0x88, 0x89, 0xc9,
+	0xac, 0x38, 0x54, 0x13, 0x42, 0x33, 0x14, 0x21, 0x53, 0x12, 0x09, 0x2a, 0x22, 0x22, 0x27, 0x37,
+	0x13, 0x12, 0x23, 0x08, 0xad, 0x9b, 0x09, 0x08, 0x28, 0x63, 0x12, 0x80, 0x32, 0xc3, 0xea, 0xcb,
+	0xc9, 0xda, 0xaa, 0x09, 0x9a, 0x89, 0x80, 0xa8, 0xdf, 0xac, 0xbc, 0xac, 0xab, 0x98, 0x98, 0x99,
+	0xc9, 0x99, 0xbc, 0xbd, 0xab, 0xcb, 0xbc, 0xab, 0xa9, 0xd9, 0x09, 0x23, 0x01, 0xbd, 0xae, 0xcb,
+	0xbc, 0x99, 0x10, 0x81, 0x48, 0x33, 0x16, 0x10, 0x10, 0x84, 0x01, 0x28, 0x52, 0x12, 0x40, 0x64,
+	0x33, 0x43, 0x32, 0x32, 0x08, 0x28, 0x22, 0x32, 0x56, 0x35, 0x43, 0x22, 0x23, 0x22, 0x12, 0x23,
+	0x34, 0x12, 0x80, 0x33, 0x66, 0x33, 0x43, 0x43, 0x82, 0x99, 0xaa, 0xa9, 0xbd, 0xab, 0x22, 0x80,
+	0x80, 0x27, 0x23, 0xaa, 0xb0, 0xb8, 0xff, 0xad, 0x9a, 0xba, 0xba, 0x9a, 0x89, 0xcb, 0x9b, 0x9c,
+	0x00, 0x05, 0x2d, 0x00, 0xed, 0xca, 0xa9, 0xba, 0xab, 0x9a, 0xa9, 0xbd, 0x9a, 0x89, 0x9b, 0xcc,
+	0xba, 0xad, 0xac, 0x09, 0x18, 0x00, 0x21, 0x45, 0x02, 0x08, 0x08, 0xb2, 0x8a, 0x64, 0x25, 0x01,
+	0x62, 0x35, 0x33, 0x42, 0x33, 0x02, 0x11, 0x33, 0x15, 0x00, 0x33, 0x57, 0x22, 0x43, 0x43, 0x21,
+	0x11, 0x23, 0x15, 0x88, 0x08, 0x11, 0x81, 0x41, 0x53, 0x02, 0x08, 0x21, 0x84, 0xc0, 0x9d, 0x99,
+	0xc9, 0x9a, 0xaa, 0xa9, 0xdf, 0xa9, 0x98, 0xd9, 0xcc, 0xaa, 0xaa, 0xca, 0xaa, 0x9a, 0xdb, 0xac,
+	0x8a, 0xa8, 0xce, 0xab, 0xaa, 0xba, 0x9c, 0x89, 0xb8, 0xac, 0x19, 0x33, 0x98, 0xac, 0x89, 0xb0,
+	0xea, 0x0a, 0x08, 0x8a, 0x70, 0x64, 0x12, 0x00, 0x22, 0x53, 0x22, 0x14, 0x12, 0x01, 0x42, 0x34,
+	0x34, 0x43, 0x22, 0x34, 0x53, 0x24, 0x13, 0x01, 0x32, 0x24, 0x32, 0x33, 0x42, 0x28, 0x28, 0x35,
+	0x22, 0x8a, 0x3a, 0x73, 0x80, 0x80, 0x20, 0x80, 0x8b, 0x35, 0xc3, 0xbe, 0x9e, 0x98, 0x9a, 0xab,
+	0xd9, 0xb9, 0x9c, 0x0a, 0x08, 0xea, 0xbb, 0x9c, 0xab, 0xbc, 0xbc, 0xcb, 0xad, 0x98, 0x08, 0x98,
+	0xa8, 0x80, 0xb3, 0xc8, 0xc0, 0xb0, 0xec, 0xab, 0x9c, 0xc8, 0xc9, 0x8b, 0x22, 0x08, 0xa8, 0x33,
+	0x80, 0xbf, 0x38, 0x42, 0xeb, 0x8b, 0x40, 0x80, 0x80, 0x36, 0x03, 0xa8, 0x38, 0x33, 0xf0, 0xaa,
+	0x28, 0xb0, 0x80, 0x74, 0x05, 0x01, 0x28, 0x31, 0x00, 0x08, 0x72, 0x21, 0x08, 0x44, 0x33, 0x34,
+	0x61, 0x33, 0x11, 0x99, 0xaa, 0xaa, 0x0b, 0x70, 0x63, 0x12, 0x21, 0x53, 0x24, 0x21, 0x11, 0x80,
+	0xca, 0x9b, 0x88, 0x86, 0x80, 0x42, 0x43, 0x13, 0x80, 0x0a, 0xbe, 0xbd, 0xac, 0xa9, 0x99, 0x9c,
+	0x10, 0x82, 0xaa, 0xbe, 0xa9, 0xbc, 0xbe, 0xbb, 0xbc, 0xaf, 0x89, 0x10, 0x00, 0xb9, 0xb9, 0xdb,
+	0x00, 0xe3, 0x30, 0x00, 0xac, 0x9a, 0xc9, 0xda, 0x80, 0x81, 0x00, 0x28, 0x01, 0xa8, 0x08, 0xc8,
+	0xcf, 0xab, 0x08, 0x08, 0x72, 0x14, 0x11, 0x41, 0x44, 0x01, 0x88, 0x21, 0x32, 0x40, 0x53, 0x14,
+	0x88, 0x38, 0x74, 0x11, 0x81, 0x11, 0x01, 0x08, 0x31, 0x26, 0x12, 0x32, 0x45, 0x23, 0x01, 0x11,
+	0x43, 0x13, 0x14, 0x01, 0xca, 0x9c, 0x0a, 0xa8, 0xaa, 0xaf, 0xba, 0xa0, 0xa8, 0xab, 0x9f, 0xac,
+	0x0a, 0x12, 0xa2, 0xfa, 0x09, 0x81, 0x02, 0x32, 0x02, 0xdf, 0x9c, 0xaa, 0xcc, 0xac, 0x8a, 0x89,
+	0x98, 0x99, 0xa9, 0xb0, 0x30, 0x02, 0xb4, 0xfb, 0xac, 0x18, 0x42, 0x21, 0x22, 0x32, 0x08, 0x08,
+	0xd8, 0xfb, 0xbf, 0x8a, 0x99, 0x80, 0x30, 0x42, 0x43, 0x33, 0x12, 0x02, 0x08, 0x03, 0x84, 0x84,
+	0x80, 0x34, 0x67, 0x23, 0x03, 0xa2, 0xc9, 0xbb, 0xbc, 0x9b, 0xaa, 0xa8, 0x3b, 0x57, 0x12, 0x10,
+	0x41, 0x21, 0xca, 0x89, 0x02, 0xdb, 0x0a, 0x64, 0x01, 0x09, 0x41, 0x12, 0xc9, 0xbb, 0xa9, 0xbd,
+	0xab, 0x72, 0x13, 0xa0, 0x10, 0x22, 0x08, 0x0b, 0x08, 0xf8, 0xbd, 0x0b, 0x08, 0x08, 0x60, 0x63,
+	0x02, 0x00, 0x0a, 0xaa, 0x00, 0x02, 0x83, 0x80, 0x35, 0x40, 0x48, 0x36, 0x82, 0x0a, 0x38, 0x24,
+	0xbb, 0x8b, 0x44, 0x83, 0x34, 0x47, 0x01, 0xa9, 0x10, 0x02, 0x80, 0x30, 0x34, 0x84, 0x80, 0x80,
+	0xe0, 0x0b, 0x0c, 0xb8, 0xc8, 0xdf, 0x9a, 0x18, 0x12, 0x80, 0x20, 0x80, 0x9f, 0x8a, 0x02, 0xeb,
+	0xab, 0xa9, 0xdb, 0xbc, 0xc9, 0xa9, 0xcb, 0xab, 0xbc, 0xbc, 0xad, 0x89, 0x90, 0xa8, 0xaa, 0xab,
+	0xc8, 0x8a, 0xd0, 0xe0, 0xab, 0x0a, 0x82, 0x80, 0x84, 0x84, 0x0b, 0x73, 0x83, 0xa8, 0x8a, 0x30,
+	0x80, 0x35, 0x47, 0x22, 0x43, 0x53, 0x23, 0x13, 0x14, 0x33, 0x51, 0x18, 0x20, 0x28, 0x32, 0x56,
+	0x00, 0x0b, 0x31, 0x00, 0x33, 0x18, 0x12, 0x27, 0x21, 0x31, 0x25, 0x00, 0x28, 0x43, 0x11, 0x80,
+	0x50, 0x21, 0xa8, 0x0a, 0x8b, 0xcb, 0x8b, 0x34, 0xb4, 0x9f, 0xab, 0x0a, 0xa8, 0xcb, 0xba, 0x9f,
+	0xad, 0x99, 0x0a, 0xbc, 0xcb, 0x80, 0xc0, 0xcb, 0xc9, 0xba, 0x9d, 0x8a, 0xa9, 0xbd, 0xac, 0x09,
+	0x89, 0x80, 0x80, 0x0b, 0x8b, 0x0c, 0xc8, 0xfb, 0xac, 0x8b, 0xa9, 0xaa, 0xbb, 0xcb, 0x80, 0x70,
+	0x42, 0x80, 0x80, 0x80, 0x03, 0x03, 0x08, 0x0e, 0x88, 0x44, 0x32, 0x80, 0x80, 0x85, 0x34, 0x43,
+	0x83, 0xc0, 0x0c, 0x78, 0x41, 0x18, 0x20, 0x21, 0x83, 0x33, 0x27, 0x01, 0x38, 0x62, 0x23, 0x80,
+	0x8a, 0x33, 0x27, 0x21, 0x32, 0x08, 0xac, 0x38, 0x77, 0x02, 0x10, 0x32, 0x24, 0x21, 0x63, 0x31,
+	0x11, 0x10, 0x23, 0x82, 0xba, 0x30, 0x73, 0x22, 0x32, 0x25, 0x08, 0x38, 0x63, 0x14, 0x80, 0x0a,
+	0x08, 0x08, 0x08, 0x08, 0x68, 0x0b, 0x03, 0x35, 0xcb, 0xbf, 0xa9, 0x9c, 0xbc, 0xcb, 0xdb, 0xbb,
+	0xba, 0xba, 0x9d, 0xbb, 0xbc, 0xbb, 0xcc, 0xbc, 0xcc, 0x9b, 0xab, 0xcb, 0xca, 0xcb, 0xcb, 0xab,
+	0xaa, 0xba, 0xfb, 0xba, 0xa9, 0xaa, 0x9b, 0x0a, 0xaa, 0x9d, 0x9c, 0x98, 0xad, 0x9a, 0x89, 0x08,
+	0x8a, 0x48, 0x30, 0x43, 0x73, 0x44, 0x11, 0x11, 0x21, 0x42, 0x12, 0x55, 0x32, 0x32, 0x53, 0x53,
+	0x23, 0x43, 0x43, 0x32, 0x23, 0x34, 0x43, 0x23, 0x34, 0x44, 0x43, 0x32, 0x33, 0x25, 0x23, 0x43,
+	0x43, 0x22, 0x11, 0x22, 0x14, 0x13, 0x11, 0x34, 0x13, 0x22, 0x23, 0x33, 0x80, 0x80, 0x47, 0x04,
+	0x08, 0x8a, 0xb0, 0xcb, 0x80, 0x80, 0xfc, 0xac, 0xad, 0xaa, 0xbb, 0xad, 0xba, 0xbb, 0xae, 0xcb,
+	0xbb, 0xbc, 0xbb, 0xbc, 0xcb, 0xdb, 0xac, 0xcb, 0x99, 0x9b, 0xdb, 0xb9, 0xda, 0xba, 0xac, 0xaa,
+	0x00, 0xd1, 0x33, 0x00, 0xcc, 0xaa, 0xb9, 0xba, 0xbc, 0xab, 0xb8, 0xa9, 0xa9, 0xa8, 0xbe, 0x9d,
+	0x9a, 0xa9, 0xab, 0xa8, 0xb0, 0x8b, 0x80, 0x80, 0x80, 0x70, 0x34, 0x33, 0x85, 0x80, 0x80, 0x37,
+	0x37, 0x43, 0x22, 0x31, 0x42, 0x34, 0x24, 0x25, 0x33, 0x22, 0x42, 0x34, 0x43, 0x43, 0x43, 0x34,
+	0x22, 0x32, 0x43, 0x33, 0x44, 0x34, 0x32, 0x22, 0x33, 0x35, 0x24, 0x24, 0x12, 0x02, 0x23, 0x13,
+	0x43, 0x13, 0x21, 0x52, 0x25, 0x14, 0x21, 0x11, 0x12, 0x20, 0x82, 0x80, 0xc0, 0x8b, 0x0c, 0x8c,
+	0xbb, 0xbc, 0xc8, 0x8b, 0xec, 0xdc, 0xcb, 0xba, 0xca, 0xaa, 0xbb, 0xce, 0xba, 0x9b, 0xa9, 0xcb,
+	0xcb, 0xbb, 0xdd, 0xaa, 0xaa, 0xcb, 0xbb, 0xbb, 0xdb, 0xbb, 0xbc, 0xba, 0xbb, 0xdb, 0xbb, 0xcc,
+	0xca, 0xaa, 0x98, 0x9a, 0xbb, 0xbb, 0xac, 0xab, 0x8a, 0xfa, 0xb9, 0xcb, 0x99, 0xaa, 0x0a, 0xb8,
+	0x00, 0x08, 0x58, 0x40, 0xb8, 0x58, 0x33, 0x48, 0x03, 0x47, 0x33, 0x34, 0x55, 0x22, 0x22, 0x42,
+	0x33, 0x24, 0x23, 0x31, 0x24, 0x43, 0x34, 0x26, 0x22, 0x32, 0x32, 0x25, 0x24, 0x32, 0x23, 0x24,
+	0x43, 0x22, 0x25, 0x43, 0x33, 0x43, 0x33, 0x12, 0x43, 0x32, 0x24, 0x43, 0x11, 0x01, 0x82, 0x25,
+	0x41, 0x41, 0x01, 0x28, 0x80, 0x33, 0x48, 0x38, 0x80, 0x80, 0xe0, 0xcb, 0x80, 0xcb, 0xac, 0xbb,
+	0xec, 0xbd, 0xab, 0xba, 0xcc, 0xac, 0xaa, 0xdb, 0xab, 0x9a, 0xbb, 0xdc, 0xab, 0xba, 0xbb, 0xcc,
+	0xab, 0xbb, 0xbc, 0xad, 0xb9, 0xb9, 0xcc, 0xab, 0xad, 0xcb, 0xab, 0xac, 0xaa, 0xac, 0xcb, 0xaa,
+	0xb9, 0x9a, 0xa8, 0xaa, 0xbb, 0xaf, 0x9c, 0x89, 0x80, 0xb0, 0x80, 0x80, 0xd0, 0x48, 0x33, 0x84,
+	0x03, 0x58, 0x48, 0x08, 0x33, 0x74, 0x33, 0x22, 0x52, 0x41, 0x13, 0x34, 0x25, 0x32, 0x13, 0x14,
+	0x00, 0xe3, 0x2d, 0x00, 0x43, 0x33, 0x42, 0x43, 0x13, 0x14, 0x41, 0x41, 0x31, 0x21, 0x34, 0x34,
+	0x41, 0x31, 0x14, 0x43, 0x31, 0x42, 0x41, 0x13, 0x22, 0x22, 0x86, 0x82, 0x22, 0x62, 0x21, 0x08,
+	0x08, 0x8b, 0x84, 0x80, 0x80, 0x80, 0xcd, 0x9e, 0x0a, 0xab, 0xea, 0x08, 0xaa, 0xea, 0x9b, 0x9c,
+	0x0a, 0xaa, 0x8a, 0x8a, 0xaf, 0xab, 0x8a, 0x80, 0x00, 0xc8, 0x08, 0xbd, 0x9f, 0xa9, 0xaa, 0xba,
+	0xfa, 0xa9, 0xab, 0xda, 0x9c, 0x99, 0x0a, 0xa8, 0x0b, 0x8b, 0xd0, 0x80, 0x40, 0x33, 0x04, 0x48,
+	0x03, 0x04, 0x88, 0x00, 0x88, 0x70, 0x80, 0x80, 0x80, 0x80, 0x80, 0x57, 0x36, 0x21, 0x28, 0x62,
+	0x21, 0x21, 0x52, 0x43, 0x13, 0x22, 0x82, 0x80, 0x80, 0x80, 0x80, 0xe8, 0xbc, 0xbb, 0xbc, 0xbc,
+	0x30, 0x80, 0x05, 0x03, 0xc4, 0x30, 0x34, 0x83, 0x34, 0x34, 0x08, 0xc8, 0x0c, 0xcb, 0xbb, 0xc8,
+	0xfb, 0xcb, 0xdb, 0xba, 0xba, 0xcb, 0xc9, 0x99, 0xc9, 0x9b, 0x9c, 0x9a, 0xaa, 0x8a, 0xb0, 0xbc,
+	0x9f, 0xab, 0xca, 0xaa, 0xb9, 0xba, 0xcb, 0xae, 0xab, 0xda, 0x89, 0x0a, 0xa8, 0x08, 0x08, 0x0d,
+	0x8b, 0x40, 0x84, 0x03, 0x08, 0x85, 0xcb, 0xb8, 0x58, 0x33, 0x48, 0x30, 0x34, 0x04, 0x88, 0x27,
+	0x25, 0x43, 0x31, 0x13, 0x15, 0x13, 0x34, 0x63, 0x33, 0x32, 0x13, 0x34, 0x23, 0x34, 0x36, 0x43,
+	0x22, 0x32, 0x33, 0x54, 0x32, 0x32, 0x44, 0x22, 0x02, 0x11, 0x14, 0x14, 0x48, 0x31, 0x13, 0x02,
+	0x08, 0x33, 0x43, 0x43, 0x73, 0x33, 0x12, 0x32, 0x32, 0x43, 0x33, 0x24, 0x24, 0x80, 0x80, 0xbf,
+	0xac, 0x0a, 0xba, 0xbe, 0xca, 0xcb, 0xbd, 0xaa, 0x9b, 0xa9, 0x9c, 0x9c, 0x9a, 0xdc, 0xba, 0x9a,
+	0x9a, 0xda, 0xbb, 0xcc, 0xcc, 0xbb, 0xaa, 0xac, 0xcb, 0xca, 0xcb, 0xac, 0xab, 0xaa, 0xab, 0x9b,
+	0x00, 0xd6, 0x2d, 0x00, 0xcb, 0xad, 0xab, 0xb9, 0xba, 0xac, 0xc9, 0xac, 0xbd, 0xbb, 0xba, 0xcb,
+	0xbb, 0xca, 0xcb, 0xdb, 0xa9, 0x9b, 0xa9, 0x80, 0x80, 0x08, 0x84, 0x80, 0x40, 0x34, 0x46, 0x11,
+	0x22, 0x52, 0x21, 0x82, 0x32, 0x56, 0x32, 0x31, 0x41, 0x33, 0x21, 0x52, 0x45, 0x52, 0x21, 0x21,
+	0x23, 0x24, 0x43, 0x43, 0x35, 0x31, 0x32, 0x33, 0x34, 0x53, 0x33, 0x44, 0x42, 0x21, 0x12, 0x33,
+	0x53, 0x32, 0x43, 0x52, 0x11, 0x01, 0x22, 0x34, 0x22, 0x13, 0x63, 0x22, 0x81, 0x21, 0x34, 0x13,
+	0x20, 0x62, 0x11, 0x00, 0x0b, 0x83, 0x08, 0x80, 0xbd, 0xbc, 0xbb, 0xfc, 0xbb, 0x9c, 0xab, 0xac,
+	0xcb, 0xba, 0xca, 0xdc, 0x9b, 0x9a, 0xb9, 0xdc, 0xba, 0xba, 0xbe, 0xbb, 0xca, 0xda, 0xba, 0xac,
+	0xbb, 0xae, 0xbb, 0xaa, 0xbb, 0xad, 0xca, 0xba, 0xbb, 0x9c, 0xaa, 0xab, 0xcb, 0xba, 0xcc, 0xbb,
+	0xb9, 0xbb, 0xad, 0xcb, 0xc9, 0xcb, 0xaa, 0xbb, 0xc9, 0x9b, 0x9c, 0xc9, 0xc9, 0x90, 0x08, 0xa8,
+	0x80, 0x30, 0x08, 0x58, 0x03, 0x84, 0x84, 0x40, 0x16, 0x20, 0x22, 0x25, 0x22, 0x82, 0x26, 0x43,
+	0x32, 0x52, 0x53, 0x12, 0x31, 0x61, 0x32, 0x52, 0x31, 0x23, 0x32, 0x24, 0x43, 0x34, 0x43, 0x33,
+	0x32, 0x61, 0x22, 0x24, 0x32, 0x53, 0x23, 0x12, 0x23, 0x73, 0x21, 0x31, 0x52, 0x23, 0x21, 0x32,
+	0x44, 0x43, 0x22, 0x33, 0x43, 0x33, 0x43, 0x32, 0x25, 0x23, 0x21, 0x22, 0x33, 0x33, 0x40, 0x80,
+	0x85, 0xb4, 0x80, 0x84, 0x03, 0x08, 0x08, 0x08, 0x80, 0x08, 0x70, 0x62, 0x08, 0xbc, 0x08, 0x08,
+	0x08, 0xbf, 0xc0, 0xfb, 0xbb, 0xbc, 0xcb, 0xb9, 0xbc, 0xcb, 0xbb, 0xdb, 0xba, 0x9a, 0xaa, 0x9d,
+	0x9c, 0xac, 0xcb, 0xba, 0xba, 0xcc, 0xba, 0xcd, 0xba, 0x9c, 0x9c, 0xbb, 0xaa, 0xcb, 0xcb, 0xaa,
+	0x00, 0xe3, 0x2f, 0x00, 0xbb, 0xb9, 0xad, 0xab, 0xcb, 0xac, 0xcb, 0x99, 0xab, 0x9c, 0xaa, 0xda,
+	0xa9, 0xa9, 0xae, 0xba, 0xdb, 0xba, 0xba, 0xda, 0x9b, 0x9a, 0xba, 0x8a, 0x80, 0x80, 0x80, 0x06,
+	0x08, 0x08, 0x08, 0x8f, 0x84, 0x80, 0x80, 0x80, 0xe0, 0x48, 0x33, 0x43, 0x24, 0x33, 0x64, 0x41,
+	0x41, 0x32, 0x14, 0x33, 0x21, 0x32, 0x32, 0x17, 0x23, 0x54, 0x32, 0x32, 0x43, 0x25, 0x23, 0x24,
+	0x23, 0x43, 0x32, 0x24, 0x43, 0x34, 0x24, 0x43, 0x33, 0x34, 0x63, 0x22, 0x22, 0x33, 0x23, 0x33,
+	0x54, 0x22, 0x32, 0x42, 0x22, 0x43, 0x33, 0x73, 0x22, 0x33, 0x31, 0x44, 0x22, 0x13, 0x43, 0x21,
+	0x28, 0x80, 0xb0, 0x08, 0x48, 0xc0, 0x48, 0x30, 0x08, 0x58, 0x03, 0x58, 0x08, 0xbc, 0xbb, 0xfc,
+	0xa9, 0xab, 0xaa, 0xbe, 0xc9, 0xbb, 0xca, 0xcb, 0xad, 0xba, 0xcc, 0xca, 0xca, 0xaa, 0xbb, 0xcb,
+	0xcb, 0xba, 0xbc, 0xab, 0xbb, 0xbb, 0xae, 0xab, 0xad, 0xca, 0xaa, 0xac, 0xad, 0xba, 0xbc, 0xbb,
+	0xdb, 0xaa, 0xab, 0xaa, 0xbb, 0xab, 0xa9, 0xdb, 0xaa, 0xda, 0xc9, 0x9b, 0xbc, 0xcb, 0x99, 0x9c,
+	0x9a, 0xaa, 0xba, 0x80, 0x80, 0x8c, 0x40, 0x80, 0x80, 0x36, 0x33, 0x44, 0x25, 0x14, 0x42, 0x43,
+	0x31, 0x34, 0x25, 0x32, 0x33, 0x34, 0x41, 0x33, 0x34, 0x41, 0x31, 0x42, 0x41, 0x33, 0x26, 0x33,
+	0x34, 0x34, 0x43, 0x34, 0x32, 0x14, 0x33, 0x22, 0x43, 0x32, 0x14, 0x33, 0x53, 0x32, 0x24, 0x43,
+	0x32, 0x43, 0x53, 0x12, 0x13, 0x23, 0x14, 0x42, 0x21, 0x22, 0x38, 0x08, 0x08, 0x08, 0x08, 0x0f,
+	0x08, 0xc8, 0x08, 0x0d, 0xb8, 0x8c, 0xc0, 0xb8, 0x08, 0x8d, 0xc0, 0xb8, 0x08, 0x8d, 0xc0, 0x08,
+	0xbc, 0xbc, 0xfb, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xdb, 0xb9, 0xa9, 0x9c, 0x9c,
+	0x00, 0x07, 0x2d, 0x00, 0xc9, 0xbb, 0x9c, 0xcb, 0xa9, 0xab, 0xbd, 0xcb, 0x9b, 0xbc, 0x9b, 0x8a,
+	0xba, 0x8a, 0xac, 0xc8, 0xb0, 0x08, 0x0d, 0xb8, 0xc8, 0xc8, 0xcb, 0xbb, 0xcb, 0xcb, 0xc0, 0xba,
+	0xcb, 0xbb, 0xec, 0xa9, 0x0a, 0x8a, 0x0b, 0xc8, 0x30, 0x80, 0x35, 0x64, 0x41, 0x41, 0x22, 0x13,
+	0x22, 0x62, 0x21, 0x21, 0x22, 0x83, 0x80, 0x04, 0x03, 0x04, 0x34, 0x24, 0x24, 0x33, 0x34, 0x43,
+	0x16, 0x22, 0x04, 0x21, 0x30, 0x08, 0x03, 0x34, 0x25, 0x73, 0x31, 0x42, 0x32, 0x42, 0x42, 0x43,
+	0x33, 0x34, 0x21, 0x14, 0x42, 0x41, 0x31, 0x26, 0x12, 0x13, 0x21, 0x01, 0x80, 0x83, 0xc0, 0xb8,
+	0x8c, 0xfb, 0xaa, 0xaa, 0xbb, 0x80, 0x04, 0x17, 0x22, 0x22, 0x23, 0x84, 0x33, 0x40, 0x03, 0x08,
+	0xe8, 0xbb, 0xcb, 0xcb, 0x08, 0x80, 0x58, 0x80, 0x80, 0xbd, 0xcb, 0xdc, 0xca, 0xc9, 0xbb, 0xbc,
+	0xad, 0xac, 0xaa, 0xab, 0x9a, 0xaa, 0xa8, 0xbb, 0xcf, 0xd9, 0xaa, 0xaa, 0xab, 0xab, 0xba, 0xad,
+	0xa9, 0xab, 0x38, 0x40, 0x73, 0x12, 0x80, 0xb0, 0xeb, 0xca, 0xcb, 0xbb, 0xbc, 0xbd, 0xcb, 0xaa,
+	0xbb, 0x89, 0x00, 0x28, 0x30, 0x80, 0x80, 0xe0, 0xb8, 0x8c, 0xcb, 0x08, 0x08, 0x08, 0x36, 0x64,
+	0x41, 0x33, 0x26, 0x33, 0x21, 0x12, 0x02, 0x08, 0x08, 0x08, 0x08, 0x05, 0x58, 0x33, 0x73, 0x24,
+	0x33, 0x25, 0x12, 0x21, 0x20, 0x80, 0x80, 0x0c, 0x8c, 0x0b, 0x08, 0x37, 0x26, 0x35, 0x25, 0x32,
+	0x33, 0x34, 0x32, 0x32, 0x12, 0x82, 0xb0, 0xb0, 0x0c, 0x08, 0x48, 0x64, 0x41, 0x41, 0x11, 0x21,
+	0x28, 0x00, 0xcb, 0xb0, 0xfb, 0xba, 0x9d, 0x9b, 0x0a, 0x38, 0x32, 0x17, 0x24, 0x23, 0x03, 0x22,
+	0x08, 0x80, 0xbc, 0xc8, 0x9f, 0xab, 0xaa, 0x0a, 0x38, 0x34, 0x33, 0x25, 0x03, 0x08, 0xbd, 0xfb,
+	0x00, 0x25, 0x2d, 0x00, 0xbd, 0xbc, 0xac, 0xad, 0x9a, 0xab, 0xb8, 0x90, 0x28, 0x21, 0x20, 0x03,
+	0x08, 0xbd, 0xbb, 0xfc, 0xc9, 0xb9, 0xa9, 0xa9, 0x0b, 0x08, 0x84, 0x73, 0x12, 0x85, 0x01, 0x98,
+	0xda, 0xac, 0xbd, 0xcb, 0xba, 0xbc, 0xbb, 0xba, 0x9a, 0xaa, 0x38, 0x08, 0x84, 0x03, 0xc8, 0xb8,
+	0xbd, 0xcb, 0xca, 0x80, 0x80, 0x34, 0x64, 0x43, 0x53, 0x43, 0x43, 0x31, 0x12, 0x21, 0x08, 0xaa,
+	0xea, 0xb9, 0x9c, 0x9c, 0x9b, 0x0a, 0x08, 0x08, 0x43, 0x33, 0x43, 0x43, 0x83, 0x04, 0x83, 0x04,
+	0x03, 0x44, 0x72, 0x33, 0x54, 0x33, 0x35, 0x33, 0x44, 0x21, 0x23, 0x12, 0x11, 0x82, 0x98, 0xb8,
+	0xca, 0xb0, 0x8b, 0x80, 0x80, 0x80, 0x07, 0x08, 0x04, 0x08, 0x08, 0x08, 0x88, 0x8f, 0x08, 0x3e,
+	0x30, 0x40, 0x27, 0x23, 0x35, 0x43, 0x31, 0x42, 0x21, 0x01, 0x20, 0x0b, 0xbc, 0x9f, 0xcb, 0x9b,
+	0xbc, 0xc9, 0xa9, 0xab, 0xaa, 0xeb, 0xa9, 0x0a, 0xab, 0xbb, 0xec, 0xa9, 0x9c, 0x9c, 0x9a, 0xaa,
+	0xba, 0x0b, 0x0c, 0x0c, 0x8b, 0x80, 0xd0, 0x80, 0x0c, 0xbc, 0xcb, 0xeb, 0xca, 0xc9, 0xb9, 0xca,
+	0x9a, 0xaa, 0xba, 0x8a, 0x0c, 0x08, 0x8c, 0x80, 0xd0, 0xc0, 0xbb, 0x0c, 0xcb, 0xbb, 0xbc, 0xc0,
+	0x80, 0x80, 0x85, 0x24, 0x33, 0x34, 0x33, 0x85, 0x03, 0x08, 0xd8, 0x80, 0xc8, 0x80, 0x80, 0x60,
+	0x48, 0x33, 0x27, 0x43, 0x14, 0x33, 0x23, 0x15, 0x21, 0x20, 0x82, 0x03, 0x03, 0x04, 0x84, 0x34,
+	0x48, 0x16, 0x42, 0x21, 0x14, 0x20, 0x82, 0x80, 0x80, 0x80, 0x80, 0x60, 0x40, 0x48, 0x63, 0x42,
+	0x43, 0x53, 0x42, 0x02, 0x23, 0x12, 0x08, 0x02, 0x88, 0x0b, 0xc8, 0x08, 0x8c, 0x0c, 0x08, 0x08,
+	0x05, 0x48, 0x80, 0xd0, 0xb8, 0xbc, 0xec, 0xa9, 0xaa, 0xba, 0xca, 0x8a, 0x0b, 0x8c, 0x84, 0x43,
+	0x00, 0x1c, 0x27, 0x00, 0x33, 0x30, 0x00, 0x08, 0x8f, 0xbb, 0xbc, 0xbc, 0xcb, 0xeb, 0xaa, 0xda,
+	0xa9, 0xa9, 0xab, 0xbb, 0xbc, 0xbf, 0xcb, 0xbc, 0xbc, 0xab, 0xbb, 0xca, 0xa9, 0x0a, 0x0b, 0x3b,
+	0x40, 0x43, 0x63, 0x22, 0x28, 0xb0, 0xb8, 0xc8, 0xac, 0xac, 0xbb, 0xbc, 0xcb, 0xbb, 0xcb, 0xb8,
+	0x08, 0x08, 0x08, 0xf8, 0xbc, 0xcb, 0xeb, 0xaa, 0xaa, 0xb0, 0x08, 0x08, 0x35, 0x34, 0x73, 0x43,
+	0x33, 0x34, 0x41, 0x21, 0x28, 0x38, 0x38, 0x48, 0x30, 0x48, 0x30, 0x34, 0x64, 0x41, 0x21, 0x21,
+	0x02, 0xb2, 0x80, 0xc0, 0xc8, 0x8b, 0xbc, 0xc0, 0x48, 0x78, 0x41, 0x52, 0x33, 0x43, 0x33, 0x24,
+	0x32, 0x31, 0x42, 0x28, 0x80, 0x80, 0x80, 0x80, 0x44, 0x73, 0x11, 0x14, 0x14, 0x28, 0x08, 0x08,
+	0xbb, 0xcb, 0xbb, 0xaf, 0xab, 0xaa, 0x0b, 0x08, 0x74, 0x31, 0x14, 0x43, 0x21, 0x28, 0x80, 0x80,
+	0x08, 0xbc, 0xbc, 0xbb, 0xbc, 0x88, 0x80, 0x36, 0x73, 0x12, 0x20, 0xa8, 0xf8, 0xb9, 0xdc, 0xba,
+	0xbc, 0xbc, 0xbb, 0xcb, 0xa9, 0x99, 0x08, 0x28, 0x02, 0x33, 0x80, 0xd0, 0xcb, 0xbb, 0xaf, 0xab,
+	0x9d, 0xa9, 0xaa, 0x80, 0x30, 0x48, 0x17, 0x32, 0x20, 0x08, 0xbb, 0xcf, 0xda, 0xbb, 0xac, 0xcb,
+	0xbb, 0xab, 0xab, 0xa9, 0xa8, 0x83, 0x48, 0x30, 0x08, 0x0d, 0xac, 0xbb, 0xbc, 0x0b, 0x08, 0x68,
+	0x33, 0x37, 0x34, 0x35, 0x34, 0x14, 0x23, 0x21, 0x81, 0xa0, 0xaa, 0x9e, 0xac, 0xc9, 0xb9, 0xa9,
+	0x80, 0x80, 0x30, 0x24, 0x24, 0x33, 0x84, 0x24, 0x30, 0x30, 0x50, 0x48, 0x33, 0x47, 0x32, 0x45,
+	0x52, 0x32, 0x32, 0x24, 0x32, 0x22, 0x21, 0x21, 0x08, 0x0b, 0xbb, 0x0c, 0xac, 0x08, 0x08, 0x08,
+	0x68, 0x80, 0x40, 0x08, 0x80, 0x08, 0x80, 0xf8, 0x88, 0xe0, 0x03, 0x03, 0x74, 0x32, 0x52, 0x33,
+	0x00, 0x2c, 0x2c, 0x00, 0x42, 0x41, 0x11, 0x82, 0x20, 0x8a, 0xbb, 0xaf, 0xad, 0xab, 0xcb, 0xba,
+	0xaa, 0xad, 0xa9, 0xac, 0xaa, 0xaa, 0x8b, 0xdb, 0xad, 0x9a, 0x9e, 0x9b, 0x9a, 0xba, 0xba, 0x8b,
+	0x0c, 0xc8, 0x80, 0x08, 0x80, 0x08, 0x8f, 0xcb, 0xcb, 0xbb, 0xcf, 0xb9, 0xc9, 0x9b, 0x9c, 0xa9,
+	0xaa, 0xb0, 0x80, 0x8b, 0x80, 0x80, 0x00, 0x8f, 0xbc, 0xbc, 0xc0, 0xbb, 0x0c, 0x8b, 0x80, 0x80,
+	0x36, 0x34, 0x33, 0x44, 0x32, 0x30, 0x80, 0x80, 0xbe, 0xc8, 0x0b, 0x8c, 0x8b, 0x40, 0x40, 0x64,
+	0x41, 0x25, 0x22, 0x23, 0x24, 0x23, 0x21, 0x02, 0x38, 0x80, 0x40, 0x80, 0x44, 0x48, 0x25, 0x51,
+	0x41, 0x31, 0x21, 0x28, 0x08, 0x0b, 0xbc, 0xcb, 0xb0, 0x0c, 0x08, 0x48, 0x34, 0x17, 0x25, 0x43,
+	0x42, 0x31, 0x12, 0x21, 0x01, 0x82, 0x08, 0x8b, 0x80, 0xe0, 0x80, 0x84, 0x30, 0x40, 0x40, 0x08,
+	0x8c, 0xfb, 0xbc, 0xac, 0xbd, 0xca, 0xab, 0xba, 0x9b, 0x9a, 0x08, 0x38, 0x43, 0x42, 0x25, 0x22,
+	0x22, 0x80, 0x80, 0x8c, 0x8b, 0x0d, 0x8c, 0xc0, 0x80, 0x8b, 0x80, 0xe0, 0x08, 0xbc, 0xaf, 0xfb,
+	0xba, 0xcb, 0xbb, 0xbc, 0xab, 0xbb, 0xc9, 0x98, 0x80, 0x38, 0x32, 0x17, 0x14, 0x11, 0x22, 0x82,
+	0x83, 0x03, 0x84, 0x34, 0x48, 0x33, 0x03, 0x44, 0x33, 0x03, 0x04, 0x08, 0xbd, 0xec, 0xc9, 0xbb,
+	0xdc, 0xb8, 0x9a, 0x99, 0xaa, 0x80, 0x20, 0x24, 0x33, 0x27, 0x14, 0x23, 0x21, 0x23, 0x73, 0x21,
+	0x41, 0x32, 0x52, 0x31, 0x22, 0x24, 0x51, 0x01, 0x01, 0xb2, 0xb0, 0x9f, 0xcb, 0xc9, 0x9a, 0x9c,
+	0x9b, 0xaa, 0xa0, 0x08, 0x48, 0x38, 0x34, 0x73, 0x12, 0x22, 0x32, 0x33, 0x34, 0x33, 0x74, 0x41,
+	0x12, 0x14, 0x13, 0x42, 0x21, 0x22, 0x82, 0xb3, 0xb8, 0xbd, 0x9f, 0xab, 0xaa, 0xaa, 0xcb, 0xb0,
+	0x00, 0x0c, 0x26, 0x00, 0x80, 0x08, 0x68, 0x48, 0x32, 0x03, 0x84, 0x04, 0x48, 0x38, 0x34, 0x33,
+	0x25, 0x33, 0x34, 0x43, 0x42, 0x38, 0x03, 0x08, 0xd8, 0xbc, 0xfb, 0xcb, 0xbb, 0xbc, 0xc9, 0xa9,
+	0xab, 0xaa, 0x0e, 0x9a, 0xa8, 0x80, 0xc0, 0xb0, 0x8b, 0xbc, 0xbc, 0xbb, 0x08, 0x8d, 0x80, 0x80,
+	0x8d, 0x00, 0x88, 0x0e, 0x08, 0xbd, 0xbb, 0xdf, 0xa9, 0xbb, 0x9c, 0x9c, 0x9b, 0x9a, 0xba, 0xba,
+	0xc0, 0x08, 0x0c, 0x08, 0xc8, 0x80, 0x8c, 0xbc, 0x08, 0x8c, 0x04, 0x03, 0x44, 0x42, 0x32, 0x43,
+	0x33, 0x34, 0x33, 0x04, 0x03, 0x08, 0x0e, 0x08, 0x08, 0x85, 0x84, 0x24, 0x30, 0x43, 0x43, 0x33,
+	0x64, 0x21, 0x82, 0x23, 0x30, 0x48, 0x30, 0x34, 0x34, 0x17, 0x23, 0x34, 0x42, 0x23, 0x14, 0x14,
+	0x32, 0x82, 0x83, 0x03, 0x08, 0x08, 0x68, 0x30, 0x04, 0x43, 0x03, 0x34, 0x48, 0x80, 0x04, 0x08,
+	0x08, 0xbe, 0xc0, 0xbb, 0xc0, 0x08, 0x08, 0x85, 0x84, 0x24, 0x30, 0x84, 0x03, 0x84, 0x80, 0x80,
+	0x0d, 0xcc, 0xba, 0xb8, 0x8c, 0x8b, 0x80, 0x80, 0xf0, 0x08, 0x8c, 0x8b, 0xcc, 0xbb, 0xcb, 0x9f,
+	0xac, 0xa9, 0xa9, 0x8a, 0x8a, 0x03, 0x58, 0x38, 0x00, 0x84, 0x80, 0x00, 0xf8, 0xbb, 0xcb, 0xac,
+	0xbb, 0xbc, 0x80, 0x0c, 0x48, 0x80, 0x80, 0x80, 0x80, 0xf0, 0xc8, 0xfb, 0xca, 0xb9, 0xca, 0xa9,
+	0x89, 0x8a, 0x30, 0x08, 0x44, 0x48, 0x38, 0x80, 0x08, 0x0d, 0xbc, 0xcb, 0xbb, 0xcb, 0x8b, 0x0c,
+	0x03, 0x84, 0x44, 0x32, 0x30, 0x80, 0x80, 0xf0, 0xbb, 0xaf, 0xab, 0x9d, 0xc9, 0x98, 0x80, 0x20,
+	0x38, 0x43, 0x33, 0x24, 0x84, 0x80, 0x80, 0x8c, 0xbc, 0xcb, 0x0c, 0x0b, 0x08, 0x84, 0x44, 0x62,
+	0x12, 0x22, 0x38, 0x08, 0x0c, 0xcb, 0xbb, 0xaf, 0xa9, 0xaa, 0x08, 0x08, 0x34, 0x27, 0x23, 0x15,
+	0x00, 0xee, 0x2d, 0x00, 0x21, 0x10, 0x00, 0x8b, 0xdb, 0x8a, 0xbb, 0x0d, 0x8b, 0x04, 0x33, 0x34,
+	0x64, 0x21, 0x22, 0x38, 0x08, 0x0c, 0xcb, 0xbb, 0xc0, 0x0c, 0xb8, 0x84, 0x24, 0x73, 0x31, 0x14,
+	0x14, 0x83, 0x12, 0xa0, 0x08, 0xcb, 0x0b, 0xbc, 0x8b, 0x00, 0x88, 0x27, 0x33, 0x27, 0x51, 0x11,
+	0x28, 0x80, 0x80, 0xc0, 0xb0, 0xb8, 0x08, 0x08, 0x78, 0x33, 0x34, 0x46, 0x31, 0x22, 0x22, 0x23,
+	0x80, 0xc0, 0xc8, 0xc0, 0x0b, 0x0c, 0x08, 0x48, 0x40, 0x43, 0x33, 0x27, 0x21, 0x38, 0x08, 0x08,
+	0xc8, 0xc8, 0xc0, 0x0b, 0xc8, 0x80, 0x04, 0x03, 0x44, 0x33, 0x43, 0x03, 0x84, 0x00, 0xd8, 0xc0,
+	0xb8, 0x8b, 0x8c, 0x0c, 0x0c, 0x48, 0x08, 0x48, 0x80, 0x40, 0x8b, 0xd0, 0x8b, 0xfc, 0xa9, 0xab,
+	0xda, 0xa9, 0x0a, 0x0b, 0x08, 0x80, 0x58, 0x30, 0x80, 0x80, 0x80, 0xf0, 0xc8, 0xcb, 0xbb, 0xfb,
+	0xaa, 0xba, 0xb0, 0xc0, 0xb8, 0x80, 0x8c, 0xbc, 0xc0, 0xcb, 0xbb, 0xaf, 0xc9, 0xba, 0xaa, 0xba,
+	0x0b, 0x08, 0x08, 0x68, 0x80, 0x04, 0x88, 0x00, 0x88, 0x8e, 0xbc, 0xcb, 0xac, 0xbb, 0xbc, 0xc0,
+	0x80, 0x80, 0x80, 0x80, 0x80, 0xf0, 0xc9, 0xb8, 0xbd, 0xcb, 0xca, 0xba, 0xb8, 0x08, 0x08, 0x36,
+	0x30, 0x35, 0x48, 0x83, 0x84, 0x84, 0x80, 0x80, 0x8c, 0xd0, 0x80, 0x80, 0x80, 0x36, 0x48, 0x83,
+	0x84, 0x03, 0x08, 0x08, 0x08, 0xf0, 0xc8, 0xb8, 0xc8, 0x08, 0x04, 0x34, 0x73, 0x22, 0x52, 0x12,
+	0x22, 0x32, 0x33, 0x48, 0x03, 0x80, 0x85, 0x40, 0x03, 0x27, 0x42, 0x42, 0x21, 0x22, 0x32, 0x38,
+	0x80, 0x80, 0x80, 0xf0, 0x08, 0x8c, 0x40, 0x48, 0x73, 0x11, 0x14, 0x14, 0x13, 0x12, 0x15, 0x21,
+	0x22, 0x32, 0x83, 0x24, 0x24, 0x17, 0x13, 0x34, 0x41, 0x11, 0x20, 0x08, 0x08, 0x8b, 0x0c, 0xbc,
+	0x00, 0x2c, 0x26, 0x00, 0xcb, 0x0b, 0x08, 0x58, 0x43, 0x33, 0x47, 0x11, 0x23, 0x12, 0x23, 0x33,
+	0x40, 0x08, 0x80, 0x85, 0x80, 0x50, 0x03, 0x34, 0x08, 0x04, 0x8c, 0xcb, 0xcb, 0xbb, 0xec, 0xc9,
+	0xb9, 0xaa, 0xaa, 0x08, 0x48, 0x48, 0x32, 0x30, 0x40, 0xc0, 0x08, 0xbc, 0xbc, 0xcb, 0xeb, 0xaa,
+	0xaa, 0xba, 0x08, 0x08, 0x68, 0x08, 0x0c, 0xcb, 0xbb, 0xbc, 0xce, 0x9b, 0xbc, 0xcb, 0xbb, 0x9a,
+	0xba, 0xb0, 0x80, 0xd0, 0xc0, 0xba, 0xcb, 0x9e, 0x9c, 0xac, 0xab, 0xab, 0xaa, 0x8b, 0x4b, 0x48,
+	0x02, 0x43, 0x38, 0xc0, 0xb8, 0xfc, 0x9b, 0xdc, 0xaa, 0xca, 0xaa, 0xbb, 0xab, 0xb0, 0x00, 0x88,
+	0x80, 0x00, 0xbe, 0xc0, 0xbb, 0xdb, 0xba, 0xb8, 0x8c, 0xc0, 0x03, 0x34, 0x73, 0x52, 0x11, 0x01,
+	0x08, 0xba, 0xbb, 0xaf, 0xcb, 0xba, 0xac, 0xc9, 0x98, 0x08, 0x22, 0x17, 0x13, 0x14, 0x01, 0x82,
+	0x0a, 0xb8, 0xc8, 0x80, 0xd0, 0x80, 0x84, 0x24, 0x26, 0x73, 0x21, 0x04, 0x12, 0x81, 0x80, 0x89,
+	0xaa, 0x8a, 0xcb, 0xb0, 0x08, 0x58, 0x43, 0x36, 0x34, 0x43, 0x33, 0x12, 0x20, 0x80, 0x80, 0x80,
+	0x80, 0x06, 0x43, 0x43, 0x36, 0x54, 0x32, 0x24, 0x23, 0x11, 0x12, 0xa0, 0xb0, 0x0b, 0xbc, 0x8b,
+	0x00, 0x88, 0x27, 0x27, 0x43, 0x52, 0x22, 0x24, 0x10, 0x83, 0x82, 0x80, 0x80, 0x80, 0x84, 0x24,
+	0x26, 0x23, 0x35, 0x43, 0x13, 0x14, 0x21, 0x08, 0x08, 0xbb, 0xbc, 0xbb, 0xc8, 0x03, 0x44, 0x33,
+	0x73, 0x42, 0x32, 0x22, 0x23, 0x83, 0x80, 0xbc, 0xad, 0xbb, 0x0c, 0x48, 0x38, 0x27, 0x51, 0x11,
+	0x41, 0x21, 0x01, 0x82, 0xb0, 0xfb, 0xca, 0xbb, 0xdb, 0x99, 0xa9, 0x0a, 0x8a, 0xbb, 0xb8, 0x0d,
+	0xac, 0xb8, 0xac, 0xac, 0x9f, 0x99, 0x8a, 0x80, 0x33, 0x43, 0x33, 0x43, 0x30, 0xd0, 0xb0, 0xec,
+	0x00, 0x30, 0x2d, 0x00, 0xad, 0xbc, 0xeb, 0xaa, 0xba, 0xba, 0xa9, 0xab, 0xd9, 0x99, 0xa9, 0xaa,
+	0xaa, 0xcb, 0xad, 0x9c, 0x9c, 0xa9, 0xa8, 0x80, 0x03, 0x08, 0x04, 0x08, 0xd8, 0xc8, 0xbb, 0xdf,
+	0xbb, 0xbd, 0xbb, 0xac, 0xa9, 0x9a, 0xa9, 0xba, 0xba, 0xc0, 0xb8, 0x8b, 0xcc, 0xbe, 0xbc, 0xeb,
+	0x9a, 0x98, 0x88, 0x22, 0x22, 0x33, 0x33, 0x34, 0x34, 0x17, 0x10, 0x0a, 0x9d, 0xbc, 0xcb, 0xa9,
+	0x89, 0x20, 0x80, 0x03, 0x08, 0x08, 0x78, 0x83, 0x40, 0x8b, 0xfc, 0xb9, 0xca, 0x08, 0x38, 0x44,
+	0x24, 0x32, 0x23, 0x15, 0x43, 0x33, 0x42, 0x01, 0x08, 0xba, 0x0b, 0x08, 0x44, 0x36, 0x34, 0x43,
+	0x33, 0x51, 0x31, 0x41, 0x11, 0x80, 0xa0, 0x9e, 0xab, 0x0a, 0x08, 0x72, 0x41, 0x52, 0x22, 0x32,
+	0x34, 0x34, 0x43, 0x12, 0x02, 0x01, 0x82, 0x20, 0x33, 0x27, 0x43, 0x24, 0x32, 0x23, 0x15, 0x23,
+	0x22, 0x08, 0x08, 0x0c, 0x0c, 0x8b, 0x04, 0x73, 0x41, 0x41, 0x32, 0x24, 0x43, 0x12, 0x12, 0x02,
+	0xa8, 0xb8, 0xc0, 0xb8, 0x58, 0x38, 0x40, 0x17, 0x23, 0x34, 0x34, 0x23, 0x84, 0x02, 0xa8, 0xb8,
+	0xbb, 0xcc, 0xba, 0xb8, 0xbc, 0x08, 0x0d, 0x48, 0x08, 0x08, 0x0d, 0xcb, 0xbb, 0xbc, 0xbb, 0xc8,
+	0xc8, 0x80, 0x04, 0x03, 0x44, 0x33, 0x43, 0x80, 0x80, 0xbd, 0xfb, 0xad, 0xbb, 0xbb, 0xcc, 0xba,
+	0x9a, 0xaa, 0xa8, 0x08, 0x08, 0xc8, 0x8c, 0xcb, 0xcb, 0xae, 0xc9, 0xc9, 0x9b, 0xaa, 0x0a, 0x3b,
+	0x08, 0x84, 0x84, 0x00, 0xc8, 0xc8, 0xcb, 0xbb, 0x9f, 0xbc, 0xcb, 0xc9, 0x99, 0x89, 0x0a, 0x08,
+	0x0b, 0xbc, 0x0b, 0xcc, 0xad, 0xd9, 0xc9, 0xb9, 0x9b, 0xaa, 0xa8, 0x83, 0x24, 0x40, 0x83, 0x48,
+	0xc0, 0x80, 0xcb, 0xfb, 0xac, 0xcb, 0xac, 0x9a, 0x9a, 0x0a, 0xa8, 0x80, 0x80, 0x80, 0x80, 0x80,
+	0x00, 0xcb, 0x1e, 0x00, 0xbf, 0xec, 0xc9, 0xbb, 0x9c, 0x9a, 0x08, 0x8a, 0x08, 0x80, 0x08, 0x80,
+	0x08, 0xf8, 0xad, 0xfb, 0xc9, 0xb9, 0xa0, 0x80, 0x20, 0x43, 0x32, 0x43, 0x33, 0x43, 0x24, 0x80,
+	0xcb, 0x9f, 0xad, 0xab, 0xab, 0x89, 0x0a, 0x08, 0x83, 0x34, 0x64, 0x43, 0x13, 0x34, 0x01, 0x82,
+	0x80, 0x30, 0x48, 0x17, 0x24, 0x41, 0x32, 0x24, 0x43, 0x32, 0x24, 0x82, 0xa2, 0xa8, 0x9e, 0xa9,
+	0x98, 0x82, 0x03, 0x73, 0x42, 0x24, 0x35, 0x43, 0x33, 0x23, 0x23, 0x21, 0x20, 0x83, 0x73, 0x12,
+	0x44, 0x31, 0x43, 0x53, 0x23, 0x25, 0x14, 0x01, 0x01, 0xa9, 0xa9, 0x89, 0x8a, 0x0b, 0x08, 0x08,
+	0x78, 0x72, 0x32, 0x44, 0x22, 0x13, 0x82, 0x80, 0xb0, 0x08, 0x48, 0x80, 0x04, 0x03, 0x44, 0x36,
+	0x34, 0x43, 0x13, 0x22, 0xab, 0xba, 0xbf, 0xab, 0xbc, 0xca, 0xc9, 0xa9, 0x89, 0x20, 0x33, 0x73,
+	0x32, 0x20, 0x0b, 0xbb, 0xbc, 0xbb, 0xbc, 0xbc, 0xc0, 0x0b, 0x0c, 0x33, 0x74, 0x41, 0x11, 0x01,
+	0xa8, 0xea, 0xb9, 0xca, 0xa9, 0x9c, 0x9c, 0x9a, 0x0a, 0x38, 0x78, 0x21, 0x21, 0x08, 0xa8, 0xdc,
+	0x9c, 0xcb, 0x9b, 0xbc, 0xab, 0x9c, 0xa8, 0x20, 0x33, 0x26, 0x14, 0x22, 0x28, 0x8a, 0xc0, 0xb0,
+	0xbc, 0x8b, 0xdb, 0x0b, 0x0c, 0x48, 0x83, 0x24, 0x00, 0xc8, 0xbc, 0xbf, 0xeb, 0xba, 0xda, 0xaa,
+	0x9c, 0xa9, 0x89, 0x29, 0x21, 0x22, 0x16, 0x12, 0x82, 0x83, 0xc0, 0x80, 0xbb, 0xbc, 0xc8, 0x8b,
+	0x80, 0x80, 0x06, 0x03, 0x08, 0xbe, 0xfb, 0xcb, 0xdb, 0xac, 0xcb, 0xb9, 0xac, 0x99, 0x8a, 0x08,
+	0x82, 0x22, 0x63, 0x21, 0x82, 0x83, 0x80, 0x80, 0xcc, 0xc0, 0x80, 0x80, 0x40, 0x40, 0x83, 0x44,
+	0x08, 0x08, 0xbc, 0xec, 0xda, 0xba, 0xbd, 0xaa, 0xbb, 0x89, 0x89, 0x02, 0x33, 0x43, 0x43, 0x73,
+	0x00, 0xc8, 0x2e, 0x00, 0x21, 0x08, 0x08, 0x8b, 0x0b, 0x8c, 0x84, 0x54, 0x22, 0x24, 0x21, 0x25,
+	0x21, 0x22, 0x30, 0x8b, 0xfc, 0xb9, 0xbc, 0xa9, 0x0a, 0x08, 0x02, 0x84, 0x43, 0x48, 0x32, 0x17,
+	0x12, 0x22, 0x80, 0x0b, 0x0c, 0x48, 0x72, 0x61, 0x21, 0x32, 0x32, 0x14, 0x33, 0x14, 0x23, 0x08,
+	0xa8, 0xfb, 0x9b, 0x9c, 0x08, 0x08, 0x22, 0x03, 0x43, 0x24, 0x33, 0x27, 0x53, 0x11, 0x01, 0x08,
+	0x08, 0x48, 0x32, 0x17, 0x43, 0x33, 0x42, 0x21, 0x22, 0x32, 0x42, 0x08, 0xb8, 0xcc, 0xea, 0x9a,
+	0x08, 0x08, 0x33, 0x24, 0x24, 0x33, 0x34, 0x17, 0x21, 0x22, 0x38, 0xb8, 0xc0, 0xb8, 0x08, 0x68,
+	0x48, 0x02, 0x83, 0x04, 0x08, 0x04, 0x08, 0x08, 0x08, 0x8f, 0xcb, 0x0c, 0x0b, 0x88, 0x50, 0x03,
+	0x34, 0x48, 0x03, 0x04, 0x48, 0x08, 0xd0, 0xc0, 0xb0, 0xcb, 0xbb, 0xc0, 0xb8, 0x88, 0x00, 0x08,
+	0x88, 0x00, 0x88, 0xaf, 0x08, 0x8f, 0xc8, 0x08, 0x0d, 0xb8, 0x08, 0x68, 0x08, 0x48, 0x80, 0x80,
+	0xe0, 0xc0, 0xb0, 0xc0, 0x0b, 0xbc, 0x8b, 0xdb, 0xbb, 0xd0, 0x80, 0xc0, 0x80, 0xc0, 0xb8, 0xc8,
+	0xc8, 0xc0, 0x80, 0x80, 0x8c, 0x0c, 0x0c, 0x08, 0x08, 0x08, 0x08, 0x8f, 0x8b, 0xcc, 0xc0, 0xb0,
+	0x08, 0x0c, 0xc8, 0xcb, 0x0b, 0xbc, 0x0b, 0xbc, 0xc8, 0xcb, 0xeb, 0xca, 0xa9, 0xa0, 0x08, 0x08,
+	0x88, 0x80, 0x0d, 0x08, 0x58, 0x40, 0x48, 0x08, 0xc8, 0xc0, 0x80, 0x84, 0x84, 0x03, 0xc8, 0xf8,
+	0xc9, 0xc9, 0x99, 0xab, 0xbc, 0xbc, 0xcb, 0xbb, 0xa9, 0x28, 0x30, 0x17, 0x21, 0x20, 0x22, 0x73,
+	0x41, 0x32, 0x32, 0x22, 0x20, 0x30, 0x78, 0x22, 0x32, 0x02, 0xac, 0xaf, 0xad, 0xbb, 0xac, 0xca,
+	0xca, 0xba, 0xab, 0x8b, 0x20, 0x72, 0x42, 0x23, 0x24, 0x22, 0x33, 0x35, 0x52, 0x22, 0x32, 0x11,
+	0x00, 0xfb, 0x2d, 0x00, 0x21, 0x42, 0x42, 0x21, 0x08, 0xea, 0xdb, 0xcb, 0xdb, 0x9a, 0xbb, 0xca,
+	0xaa, 0x9a, 0x0a, 0x23, 0x37, 0x25, 0x33, 0x43, 0x21, 0x32, 0x52, 0x22, 0x33, 0x41, 0x11, 0x21,
+	0x42, 0x14, 0x23, 0x04, 0xa8, 0xcc, 0xbd, 0xcb, 0xbb, 0xac, 0xab, 0xbb, 0xab, 0xb0, 0x53, 0x34,
+	0x35, 0x34, 0x32, 0x12, 0x12, 0x22, 0x62, 0x21, 0x41, 0x12, 0x22, 0x15, 0x34, 0x43, 0x33, 0x10,
+	0xaa, 0xcd, 0xad, 0xcb, 0xab, 0xbb, 0xbb, 0x9c, 0x9a, 0x28, 0x60, 0x13, 0x34, 0x21, 0x28, 0x8a,
+	0x80, 0x80, 0x85, 0x84, 0x33, 0x34, 0x73, 0x43, 0x53, 0x12, 0x83, 0x80, 0x9c, 0xdc, 0xba, 0xba,
+	0xbc, 0xac, 0xba, 0x99, 0x8a, 0x20, 0x30, 0x33, 0x40, 0xc0, 0x0c, 0x0b, 0x8c, 0x00, 0x48, 0x40,
+	0x48, 0x73, 0x31, 0x34, 0x23, 0x84, 0x80, 0xda, 0xcb, 0xdb, 0xaa, 0xbb, 0xcb, 0x9b, 0x9c, 0x89,
+	0x80, 0x32, 0x83, 0x84, 0x80, 0xc0, 0xc8, 0x80, 0x40, 0x30, 0x85, 0x24, 0x30, 0x64, 0x21, 0x14,
+	0x82, 0xa0, 0xeb, 0xcb, 0xad, 0xaa, 0x9b, 0x9b, 0xda, 0xa9, 0x00, 0x88, 0x33, 0x17, 0x12, 0x82,
+	0x80, 0x80, 0x40, 0x48, 0x33, 0x30, 0x85, 0x40, 0x08, 0x03, 0x04, 0x08, 0xd8, 0xcf, 0xda, 0xab,
+	0xba, 0xa9, 0xa9, 0xaa, 0xb8, 0x80, 0x40, 0x24, 0x17, 0x14, 0x83, 0x82, 0xa0, 0x38, 0x48, 0x48,
+	0x32, 0x80, 0x80, 0xe0, 0x80, 0x80, 0x08, 0xf0, 0xad, 0xdc, 0xaa, 0x9b, 0x9a, 0x08, 0x08, 0x08,
+	0x08, 0x58, 0x43, 0x16, 0x34, 0x21, 0x38, 0x0b, 0x08, 0x48, 0x30, 0x34, 0x84, 0x00, 0x88, 0x00,
+	0x78, 0x48, 0x08, 0xb8, 0xcc, 0xad, 0x9c, 0x08, 0x08, 0x02, 0x03, 0x48, 0x80, 0x35, 0x17, 0x23,
+	0x14, 0x82, 0x80, 0xb0, 0x03, 0x34, 0x34, 0x83, 0x04, 0x48, 0x80, 0x04, 0x43, 0x03, 0xb4, 0xc8,
+	0x00, 0x0a, 0x26, 0x00, 0xcb, 0xc0, 0x80, 0x84, 0x33, 0x80, 0x85, 0x30, 0x04, 0x27, 0x21, 0x82,
+	0x80, 0xc0, 0xb0, 0x08, 0x08, 0x05, 0x03, 0x08, 0x80, 0x08, 0x17, 0x34, 0x04, 0x08, 0xc8, 0xc8,
+	0xc8, 0x80, 0x80, 0x05, 0x08, 0x0d, 0x08, 0x08, 0x08, 0x88, 0x0f, 0xbc, 0xcb, 0xeb, 0xaa, 0xa0,
+	0x08, 0xb8, 0x08, 0x58, 0x40, 0x48, 0x33, 0x53, 0x38, 0x80, 0x0c, 0x8c, 0xbb, 0x8c, 0xcb, 0xcb,
+	0xbb, 0xbc, 0xbb, 0xbc, 0x0c, 0xac, 0xbb, 0xbc, 0xc0, 0xbb, 0x80, 0x3c, 0x80, 0x35, 0x84, 0x24,
+	0x26, 0x21, 0x02, 0x02, 0x88, 0xc0, 0xc8, 0x9f, 0xab, 0x9c, 0x9c, 0x9a, 0xac, 0x89, 0xaa, 0xb0,
+	0x08, 0x08, 0x88, 0x87, 0x30, 0x80, 0x04, 0x34, 0x24, 0x17, 0x32, 0x22, 0x83, 0x83, 0x04, 0x08,
+	0x88, 0xcc, 0xfb, 0xca, 0xb9, 0x9a, 0x8a, 0x0b, 0x8b, 0xd0, 0x80, 0x84, 0x24, 0x03, 0x43, 0x43,
+	0x48, 0x38, 0x43, 0x63, 0x42, 0x21, 0x14, 0x20, 0x82, 0x23, 0x40, 0x08, 0x08, 0xbd, 0x9f, 0xc9,
+	0x89, 0x89, 0x0a, 0x0b, 0xac, 0x08, 0x3c, 0x48, 0x30, 0x43, 0x30, 0x80, 0x05, 0x43, 0x73, 0x32,
+	0x15, 0x11, 0x22, 0x82, 0x33, 0x83, 0x04, 0xc8, 0xcb, 0xeb, 0x9c, 0xab, 0xaa, 0xba, 0xfa, 0xa9,
+	0xab, 0x8a, 0x8a, 0x30, 0x80, 0x50, 0x80, 0x80, 0x45, 0x73, 0x11, 0x14, 0x12, 0x02, 0x82, 0x33,
+	0x40, 0x08, 0x0c, 0xec, 0xba, 0xca, 0xca, 0xa9, 0xca, 0xca, 0xab, 0x9c, 0xaa, 0x00, 0x88, 0x00,
+	0x88, 0x00, 0x86, 0x34, 0x17, 0x23, 0x14, 0x42, 0x21, 0x22, 0x32, 0x42, 0x38, 0x80, 0x0c, 0xbc,
+	0xcb, 0xb0, 0xbc, 0xcb, 0xeb, 0xaa, 0xac, 0xa0, 0x08, 0x08, 0x08, 0x04, 0x58, 0x33, 0x27, 0x43,
+	0x24, 0x33, 0x14, 0x14, 0x33, 0x51, 0x11, 0x21, 0x08, 0x80, 0xbb, 0xc8, 0xbb, 0xfc, 0xa9, 0xcb,
+	0x00, 0x09, 0x2d, 0x00, 0xab, 0x9c, 0xa8, 0xa0, 0x08, 0x48, 0x38, 0x34, 0x43, 0x36, 0x42, 0x43,
+	0x31, 0x22, 0x24, 0x01, 0x32, 0x08, 0x0c, 0xcb, 0xfb, 0xb9, 0xbc, 0xcb, 0xbb, 0xcc, 0xab, 0xba,
+	0xa9, 0xaa, 0x8b, 0x0b, 0x58, 0x48, 0x32, 0x43, 0x33, 0x43, 0x24, 0x03, 0x03, 0x84, 0x00, 0xd8,
+	0xbc, 0xbb, 0xbf, 0x9c, 0x9c, 0xcb, 0xb9, 0xbc, 0xa9, 0x8c, 0xa9, 0x80, 0x80, 0x80, 0x40, 0x48,
+	0x24, 0x33, 0x34, 0x33, 0x04, 0x03, 0x40, 0x40, 0x80, 0x80, 0x8d, 0xbc, 0xc0, 0xb8, 0x08, 0x8d,
+	0x80, 0x8c, 0x0c, 0x08, 0x04, 0x34, 0x03, 0x44, 0x48, 0x02, 0x43, 0x42, 0x32, 0x43, 0x83, 0x84,
+	0x80, 0x40, 0x40, 0x08, 0x84, 0x8b, 0xd0, 0x08, 0x08, 0x85, 0x04, 0x83, 0x80, 0x05, 0x48, 0x48,
+	0x33, 0x84, 0x03, 0x84, 0x00, 0x88, 0x86, 0x84, 0x03, 0x08, 0xd8, 0x80, 0x0c, 0x08, 0x08, 0x0e,
+	0xc8, 0xca, 0xb0, 0x08, 0x3c, 0x80, 0x80, 0x80, 0x08, 0x80, 0x08, 0x27, 0x78, 0x80, 0xc0, 0x08,
+	0x8c, 0x80, 0x80, 0xe0, 0x08, 0xbc, 0xc8, 0xcb, 0xb0, 0xc8, 0xcb, 0xbb, 0xcb, 0xcb, 0xb8, 0xc0,
+	0x08, 0x08, 0x08, 0x08, 0x08, 0x17, 0x58, 0x08, 0x58, 0xb8, 0x80, 0x80, 0x80, 0x8e, 0x80, 0x80,
+	0xf0, 0x80, 0xd0, 0x80, 0xc0, 0xb0, 0xc8, 0xb8, 0xbc, 0xc8, 0x80, 0x0c, 0x08, 0x08, 0x68, 0x30,
+	0x40, 0x84, 0x43, 0x33, 0x40, 0x33, 0x04, 0x43, 0x43, 0x33, 0x34, 0x48, 0x33, 0x48, 0x80, 0x80,
+	0xe0, 0xc0, 0xba, 0xcb, 0xbb, 0xac, 0xc8, 0xb0, 0x03, 0x58, 0x43, 0x16, 0x34, 0x43, 0x33, 0x34,
+	0x23, 0x34, 0x42, 0x21, 0x21, 0x83, 0x03, 0x08, 0x88, 0xe0, 0xcb, 0xbb, 0xfb, 0xda, 0xb9, 0xa9,
+	0x9c, 0x98, 0x8a, 0x80, 0x43, 0x33, 0x43, 0x37, 0x41, 0x21, 0x23, 0x32, 0x38, 0x48, 0x08, 0x08,
+	0x00, 0x1e, 0x23, 0x00, 0x80, 0x0e, 0xcb, 0xb8, 0xcb, 0xcb, 0x9e, 0x9c, 0xac, 0xcb, 0xba, 0xac,
+	0xbb, 0x9c, 0x9c, 0x09, 0x8a, 0x80, 0x30, 0x83, 0x44, 0x02, 0x33, 0x44, 0x38, 0x03, 0x84, 0x80,
+	0x80, 0xe0, 0xb8, 0xbc, 0xec, 0xc9, 0xdb, 0xca, 0xba, 0xac, 0xab, 0x9d, 0x9a, 0x99, 0x89, 0x10,
+	0x32, 0x25, 0x54, 0x22, 0x53, 0x22, 0x32, 0x31, 0x12, 0x32, 0x38, 0x80, 0x0c, 0xc8, 0xc0, 0xbb,
+	0xbc, 0xbb, 0xbc, 0xbc, 0xcb, 0xbb, 0xc0, 0x08, 0x58, 0x48, 0x32, 0x37, 0x43, 0x33, 0x34, 0x43,
+	0x33, 0x23, 0x15, 0x21, 0x22, 0x02, 0x02, 0x84, 0x03, 0x58, 0x08, 0x48, 0xc0, 0x80, 0x8b, 0x8c,
+	0xbc, 0x8b, 0xcc, 0xc0, 0x80, 0x80, 0x40, 0x40, 0x33, 0x27, 0x15, 0x13, 0x42, 0x21, 0x21, 0x23,
+	0x30, 0x80, 0x80, 0x08, 0xbf, 0xc0, 0xbb, 0xcb, 0xdc, 0xca, 0xc9, 0xb9, 0xca, 0xa9, 0xaa, 0x8a,
+	0x8a, 0x40, 0x48, 0x33, 0x43, 0x43, 0x33, 0x34, 0x48, 0x08, 0x0c, 0x0c, 0xbb, 0xaf, 0xc9, 0xba,
+	0xda, 0x99, 0x9c, 0x9a, 0xaa, 0xba, 0xbb, 0xc8, 0xc0, 0x80, 0x80, 0x80, 0x60, 0x48, 0x48, 0x02,
+	0x43, 0x02, 0x84, 0x30, 0x80, 0x0d, 0xc8, 0xc0, 0xc0, 0xba, 0xcb, 0x0b, 0xbc, 0x0b, 0x8c, 0xcb,
+	0x08, 0x8c, 0xc0, 0x08, 0x84, 0x40, 0x48, 0x33, 0x24, 0x54, 0x42, 0x23, 0x14, 0x14, 0x12, 0x22,
+	0x38, 0x08, 0xc8, 0x0b, 0xbc, 0xaf, 0xa9, 0xda, 0x0a, 0xaa, 0x80, 0x0b, 0x03, 0x58, 0x43, 0x73,
+	0x31, 0x42, 0x41, 0x41, 0x22, 0x13, 0x52, 0x81, 0x22, 0x08, 0x08, 0x8b, 0xbc, 0xac, 0xac, 0xbb,
+	0xaf, 0xa9, 0xa8, 0xa8, 0x08, 0x48, 0x80, 0x85, 0x24, 0x03, 0x43, 0x30, 0x04, 0x48, 0x80, 0x08,
+	0x80, 0x08, 0x80, 0x08, 0xf0, 0x8a, 0xf0, 0xb8, 0x08, 0xbd, 0xc8, 0xcb, 0x0b, 0xbc, 0xbb, 0xc8,
+	0x00, 0xfd, 0x25, 0x00, 0xd0, 0xb0, 0x08, 0x80, 0x08, 0x80, 0x78, 0x40, 0x80, 0x04, 0x03, 0x44,
+	0x08, 0x03, 0x08, 0x08, 0x0f, 0x0c, 0xbb, 0xbc, 0xfb, 0x9a, 0xac, 0xa9, 0xaa, 0x0b, 0x08, 0x08,
+	0x85, 0x34, 0x17, 0x23, 0x14, 0x42, 0x21, 0x22, 0x02, 0x38, 0xc0, 0x08, 0xbc, 0xc8, 0xcb, 0xbb,
+	0xcb, 0xb8, 0xbc, 0xc8, 0x80, 0x08, 0x50, 0x48, 0x30, 0x44, 0x32, 0x43, 0x16, 0x22, 0x22, 0x20,
+	0x84, 0x80, 0x80, 0x80, 0x8d, 0x0c, 0x0c, 0x0c, 0x0b, 0x88, 0x0c, 0x08, 0x88, 0x00, 0x88, 0x00,
+	0xf8, 0x0a, 0x88, 0x00, 0x88, 0x00, 0x88, 0x57, 0x60, 0x48, 0x48, 0x08, 0x83, 0x80, 0x05, 0x08,
+	0x0d, 0xb8, 0x8c, 0x8b, 0xcc, 0xc0, 0x8a, 0xcb, 0xb0, 0xc8, 0x80, 0x80, 0x80, 0x80, 0x07, 0x43,
+	0x30, 0x34, 0x04, 0x33, 0x04, 0x03, 0x08, 0x08, 0x0f, 0xac, 0xbb, 0xbc, 0xcb, 0xeb, 0x98, 0x0b,
+	0x0b, 0x80, 0x84, 0x34, 0x43, 0x33, 0x43, 0x73, 0x12, 0x22, 0x20, 0x30, 0x80, 0x80, 0x80, 0x0f,
+	0xac, 0xb8, 0xcb, 0xac, 0xb8, 0xcb, 0xb8, 0x08, 0x8d, 0x40, 0x08, 0x84, 0x34, 0x83, 0x34, 0x34,
+	0x48, 0x83, 0x84, 0x84, 0x80, 0x80, 0x80, 0x8d, 0x80, 0x0d, 0x0c, 0xb8, 0x08, 0x8d, 0xc0, 0xb8,
+	0x08, 0x8d, 0x8b, 0x8c, 0x8b, 0x08, 0x8e, 0x00, 0x88, 0x60, 0x80, 0x84, 0x40, 0x48, 0x80, 0x84,
+	0x80, 0x80, 0x80, 0x80, 0xf0, 0xc8, 0xb8, 0xc8, 0xbc, 0xc0, 0xbb, 0xcb, 0xb8, 0xbc, 0xc8, 0x80,
+	0x0c, 0x88, 0x00, 0x85, 0x40, 0x40, 0x48, 0x83, 0x40, 0x08, 0x08, 0x08, 0x08, 0x8f, 0x8b, 0x8c,
+	0xbc, 0xc0, 0x0c, 0x0b, 0x8c, 0xc0, 0x80, 0x80, 0x80, 0x80, 0x07, 0x48, 0x38, 0x40, 0x48, 0x48,
+	0x38, 0x30, 0x40, 0x80, 0x04, 0x08, 0x08, 0x08, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x78, 0x07,
+	0x00, 0xfa, 0x20, 0x00, 0x60, 0x40, 0x48, 0x83, 0x34, 0x48, 0x42, 0x02, 0x43, 0x02, 0x34, 0x33,
+	0x40, 0x84, 0x03, 0x84, 0x04, 0x88, 0x04, 0x08, 0x08, 0x80, 0x08, 0x08, 0x80, 0x08, 0x70, 0x84,
+	0x87, 0x40, 0x38, 0x40, 0x48, 0x30, 0x48, 0x30, 0x80, 0x05, 0x48, 0x08, 0x08, 0xe0, 0x80, 0x0c,
+	0xcb, 0x0b, 0xbc, 0xbb, 0xad, 0xbb, 0xbc, 0xcb, 0x8a, 0x0c, 0x8b, 0xd0, 0x80, 0x80, 0xd0, 0x08,
+	0x08, 0x08, 0x8e, 0xc0, 0xb8, 0xc8, 0x0c, 0xcb, 0xbb, 0xec, 0xa9, 0xca, 0x9a, 0x9d, 0xba, 0xaa,
+	0xba, 0xbb, 0xb8, 0x0d, 0xc8, 0x80, 0x80, 0x80, 0x80, 0x70, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+	0x80, 0xf8, 0x8b, 0xf0, 0x09, 0xe0, 0x80, 0xb8, 0x08, 0x88, 0x00, 0x78, 0x00, 0x85, 0x34, 0x03,
+	0x34, 0x43, 0x17, 0x12, 0x52, 0x11, 0x22, 0x22, 0x32, 0x24, 0x03, 0x43, 0x30, 0x04, 0x03, 0x04,
+	0x03, 0x85, 0x04, 0x83, 0x34, 0x40, 0x43, 0x33, 0x43, 0x43, 0x33, 0x64, 0x21, 0x22, 0x22, 0x43,
+	0x02, 0x83, 0x04, 0x03, 0x08, 0x08, 0x08, 0x08, 0x80, 0x08, 0xbf, 0x08, 0xf8, 0x09, 0x08, 0x08,
+	0x78, 0x81, 0x80, 0x08, 0x80, 0xf8, 0x09, 0x0e, 0x0c, 0x0b, 0xbc, 0x8b, 0xbc, 0xcb, 0xcb, 0x0b,
+	0xbc, 0xcb, 0xbb, 0xcb, 0xcb, 0xbb, 0x0c, 0xcb, 0xc0, 0xb0, 0xcb, 0xc0, 0xba, 0xfb, 0x9a, 0xda,
+	0x99, 0xca, 0x9a, 0xaa, 0xba, 0xca, 0x8a, 0xcb, 0x0b, 0xac, 0x0c, 0xbb, 0xc8, 0xc0, 0xc0, 0x80,
+	0x0b, 0xc8, 0xc8, 0xc0, 0xc0, 0xba, 0xb8, 0xbc, 0x0c, 0x0c, 0xb8, 0x80, 0x40, 0x80, 0x05, 0x48,
+	0x30, 0x40, 0x40, 0x08, 0x84, 0x84, 0x03, 0x34, 0x40, 0x83, 0x04, 0x03, 0x04, 0x84, 0x84, 0x84,
+	0x33, 0x34, 0x33, 0x74, 0x41, 0x22, 0x13, 0x24, 0x23, 0x32, 0x32, 0x43, 0x33, 0x43, 0x43, 0x33,
+	0x00, 0x0b, 0x25, 0x00, 0x24, 0x54, 0x22, 0x22, 0x32, 0x43, 0x33, 0x34, 0x26, 0x42, 0x42, 0x41,
+	0x11, 0x14, 0x12, 0x02, 0x82, 0x80, 0x80, 0x80, 0x80, 0x87, 0x00, 0x03, 0x85, 0x34, 0x08, 0x84,
+	0x80, 0x80, 0x00, 0x88, 0xf0, 0x09, 0x80, 0x8e, 0xc0, 0xc0, 0xbb, 0xbc, 0xae, 0xbc, 0xca, 0xab,
+	0x9c, 0xca, 0x89, 0xa9, 0xb8, 0xb0, 0x0c, 0xac, 0xbb, 0xec, 0xc9, 0xc9, 0xb9, 0x9b, 0xad, 0xba,
+	0xc9, 0xac, 0xba, 0xdb, 0xba, 0xac, 0xbb, 0x9c, 0x9c, 0x99, 0x0a, 0x0b, 0x80, 0x8b, 0x80, 0x0d,
+	0xbc, 0xbb, 0xcc, 0xea, 0x9a, 0xaa, 0x8a, 0xbb, 0xc0, 0xb8, 0xc8, 0xc8, 0x80, 0x0c, 0x08, 0x08,
+	0x05, 0x34, 0x24, 0x54, 0x22, 0x24, 0x21, 0x23, 0x30, 0x08, 0x04, 0x08, 0x85, 0x34, 0x48, 0x73,
+	0x11, 0x14, 0x14, 0x13, 0x14, 0x23, 0x14, 0x14, 0x43, 0x41, 0x32, 0x24, 0x33, 0x34, 0x21, 0x24,
+	0x21, 0x38, 0x38, 0x03, 0x34, 0x43, 0x54, 0x42, 0x43, 0x31, 0x34, 0x41, 0x31, 0x22, 0x22, 0x83,
+	0x43, 0x83, 0x34, 0x83, 0x04, 0x03, 0x08, 0x08, 0xf0, 0xb8, 0x0d, 0x8b, 0x8b, 0x80, 0x80, 0x07,
+	0x83, 0x04, 0x08, 0x08, 0xe8, 0x8b, 0xfc, 0x99, 0xca, 0xa9, 0x9c, 0xaa, 0xac, 0xca, 0xca, 0xc9,
+	0xbb, 0xbc, 0xcb, 0xb9, 0x9c, 0xab, 0xaa, 0xb0, 0x0b, 0xbc, 0xbb, 0xfc, 0xc9, 0xba, 0xcb, 0xad,
+	0xaa, 0xbb, 0xc9, 0x9b, 0xa9, 0x9d, 0xc9, 0xa9, 0xab, 0x9d, 0xab, 0x9c, 0xaa, 0xb0, 0xb0, 0x80,
+	0x84, 0x00, 0x88, 0x0d, 0xcc, 0xb0, 0xcb, 0x0b, 0x0c, 0x08, 0x58, 0x38, 0x34, 0x43, 0x33, 0x03,
+	0x04, 0x84, 0x84, 0x30, 0x44, 0x32, 0x73, 0x32, 0x25, 0x23, 0x43, 0x32, 0x22, 0x32, 0x16, 0x22,
+	0x52, 0x43, 0x33, 0x26, 0x43, 0x32, 0x32, 0x33, 0x14, 0x12, 0x22, 0x32, 0x33, 0x43, 0x37, 0x41,
+	0x00, 0x24, 0x2e, 0x00, 0x33, 0x14, 0x23, 0x14, 0x22, 0x38, 0x32, 0x03, 0x27, 0x42, 0x42, 0x41,
+	0x41, 0x11, 0x01, 0x08, 0x8a, 0xbb, 0xec, 0xa9, 0xaa, 0xb0, 0xb0, 0x08, 0x08, 0x88, 0x8e, 0xbc,
+	0xf0, 0xaa, 0xba, 0xad, 0x89, 0xba, 0xb0, 0xc8, 0xc0, 0xbb, 0xcf, 0xba, 0xcd, 0xba, 0xbc, 0xbb,
+	0xca, 0xba, 0xb9, 0xa9, 0xa9, 0xab, 0xbb, 0xec, 0xc9, 0xbb, 0xca, 0xab, 0xca, 0x9a, 0x0b, 0xab,
+	0xb8, 0xfc, 0xc9, 0xb9, 0xad, 0xca, 0xba, 0xba, 0xba, 0x8a, 0x80, 0x80, 0x34, 0x48, 0x83, 0x84,
+	0x80, 0x80, 0x80, 0x80, 0x70, 0x40, 0x03, 0x34, 0x43, 0x43, 0x80, 0x30, 0x0c, 0x08, 0x08, 0x78,
+	0x48, 0x25, 0x34, 0x44, 0x43, 0x22, 0x24, 0x13, 0x13, 0x14, 0x21, 0x22, 0x62, 0x11, 0x34, 0x41,
+	0x41, 0x31, 0x21, 0x01, 0x32, 0x38, 0x40, 0x43, 0x33, 0x27, 0x43, 0x43, 0x25, 0x12, 0x12, 0x12,
+	0x22, 0x80, 0x80, 0x80, 0x50, 0x08, 0x58, 0x08, 0x03, 0x08, 0x80, 0xf0, 0xb8, 0xc8, 0x0c, 0xc8,
+	0x80, 0x80, 0x85, 0x84, 0x03, 0x88, 0x00, 0x0e, 0xac, 0x9f, 0xb9, 0xca, 0xa9, 0x9c, 0xaa, 0xaa,
+	0xa8, 0xac, 0xbb, 0xbc, 0x9f, 0xc9, 0xa9, 0xa9, 0xaa, 0xb8, 0xc0, 0x80, 0xc0, 0xb8, 0xc8, 0xbc,
+	0xfb, 0x9a, 0xac, 0xab, 0xaa, 0xbb, 0xbb, 0xc8, 0xc8, 0xc0, 0xc0, 0xb0, 0xb8, 0x8c, 0x8b, 0x8c,
+	0x00, 0x88, 0x70, 0x08, 0x03, 0x04, 0x08, 0x08, 0x08, 0x8f, 0xc0, 0x08, 0x08, 0x08, 0x08, 0x07,
+	0x48, 0x30, 0x40, 0x80, 0x04, 0x58, 0x08, 0x03, 0x44, 0x48, 0x32, 0x43, 0x73, 0x11, 0x20, 0x22,
+	0x08, 0x03, 0x84, 0x80, 0x85, 0x30, 0x40, 0x40, 0x48, 0x48, 0x38, 0x30, 0x80, 0x85, 0x40, 0x08,
+	0x34, 0x40, 0x33, 0x40, 0x34, 0x43, 0x38, 0x40, 0x08, 0x58, 0x0b, 0x88, 0x00, 0xe8, 0x08, 0x08,
+	0x00, 0x11, 0x22, 0x00, 0x80, 0x8e, 0x80, 0xd0, 0x80, 0xd0, 0x80, 0x80, 0x08, 0x80, 0x08, 0x07,
+	0x40, 0x08, 0x80, 0x08, 0x0f, 0xb8, 0x8c, 0xcb, 0xb8, 0xcc, 0xb0, 0x8b, 0x0c, 0xbc, 0xc0, 0xc0,
+	0xb0, 0x8b, 0x0c, 0xc8, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0xcf, 0xe8, 0x0c, 0xac,
+	0xb8, 0xc0, 0x8b, 0x0c, 0xc8, 0x80, 0x0c, 0xc8, 0x80, 0xc8, 0x80, 0x80, 0x08, 0x87, 0x80, 0x04,
+	0x03, 0x04, 0x08, 0x85, 0x80, 0x80, 0xe0, 0x08, 0x08, 0x8d, 0x00, 0x08, 0x88, 0x00, 0x78, 0x00,
+	0x80, 0x08, 0x07, 0x48, 0x80, 0x04, 0x03, 0x44, 0x38, 0x40, 0x48, 0x48, 0x08, 0x08, 0x08, 0x68,
+	0x08, 0x08, 0x08, 0x08, 0x08, 0x07, 0x80, 0x50, 0x08, 0x80, 0x05, 0x08, 0x85, 0x40, 0x48, 0x08,
+	0x03, 0x40, 0x80, 0x50, 0x80, 0x80, 0x80, 0xf0, 0x08, 0x08, 0x08, 0x08, 0x08, 0x88, 0x00, 0x88,
+	0x00, 0x78, 0x87, 0x80, 0x80, 0x80, 0x80, 0x00, 0x88, 0x00, 0x08, 0x08, 0x08, 0xff, 0x8a, 0x9f,
+	0x00, 0x0e, 0x88, 0xc0, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xf8, 0x8f, 0x80,
+	0x80, 0x8f, 0x08, 0x0d, 0x08, 0x0d, 0xc8, 0x80, 0x8b, 0x80, 0xe0, 0x08, 0x08, 0x08, 0x08, 0x80,
+	0x08, 0x17, 0x80, 0x00, 0x88, 0x00, 0xaf, 0x08, 0xf8, 0x08, 0xd8, 0x80, 0xd0, 0x80, 0xc0, 0x08,
+	0x08, 0x08, 0x88, 0x80, 0x00, 0x78, 0x82, 0x70, 0x80, 0x04, 0x48, 0x80, 0x80, 0x08, 0x80, 0x08,
+	0xf0, 0x89, 0xe0, 0x08, 0x08, 0x8d, 0x00, 0x08, 0x88, 0x00, 0x78, 0x00, 0x50, 0x48, 0x80, 0x04,
+	0x43, 0x80, 0x04, 0x03, 0x08, 0x08, 0x08, 0x08, 0xf8, 0x89, 0xf0, 0x80, 0x0c, 0x08, 0xc8, 0x08,
+	0x08, 0x80, 0x70, 0x08, 0x58, 0x48, 0x38, 0x30, 0x40, 0x30, 0x50, 0x08, 0x80, 0x08, 0x80, 0xf8,
+	0x00, 0x05, 0x25, 0x00, 0xd0, 0xb0, 0xb8, 0xc8, 0x80, 0x8c, 0xd0, 0x80, 0x80, 0x8c, 0x40, 0x80,
+	0x80, 0x05, 0x84, 0x40, 0x48, 0x48, 0x08, 0x83, 0x80, 0xd0, 0x08, 0x0d, 0xb8, 0x8c, 0x8b, 0x8c,
+	0x0c, 0x0c, 0x0c, 0xb8, 0x80, 0x80, 0x8d, 0x04, 0x08, 0x04, 0x48, 0x40, 0x48, 0x48, 0x38, 0x80,
+	0x80, 0x80, 0x80, 0xf8, 0x08, 0x0d, 0x0c, 0x0b, 0x8c, 0xc0, 0xb0, 0x08, 0xd8, 0x80, 0x80, 0x80,
+	0x06, 0x48, 0x48, 0x30, 0x48, 0x03, 0x84, 0x84, 0x80, 0x04, 0x08, 0xc8, 0x08, 0xd8, 0x08, 0x0d,
+	0xb8, 0x08, 0x8d, 0x80, 0x8c, 0x80, 0x00, 0x08, 0x78, 0x00, 0x84, 0x04, 0x03, 0x04, 0x84, 0x84,
+	0x40, 0x08, 0x08, 0x08, 0x08, 0x8f, 0x80, 0xc0, 0x08, 0x0d, 0xb8, 0x08, 0xe8, 0x80, 0x80, 0x80,
+	0x80, 0x80, 0x70, 0x50, 0x08, 0x03, 0x04, 0x08, 0x85, 0x80, 0x80, 0x80, 0x8e, 0x80, 0xd0, 0x08,
+	0xd8, 0x80, 0x80, 0x0d, 0x08, 0x0d, 0x08, 0xc8, 0x08, 0x08, 0x05, 0x08, 0x68, 0x08, 0x48, 0x80,
+	0x80, 0x80, 0x80, 0xf0, 0x88, 0xd0, 0x08, 0x08, 0x08, 0x08, 0xf8, 0x08, 0x08, 0x08, 0x08, 0x08,
+	0x9f, 0x08, 0x08, 0x08, 0x78, 0x01, 0x08, 0x78, 0x80, 0x80, 0x80, 0x0e, 0x08, 0x08, 0x88, 0x00,
+	0x88, 0x00, 0x88, 0x70, 0x84, 0x00, 0x88, 0x80, 0x00, 0x88, 0xf0, 0x0e, 0x08, 0x06, 0x08, 0x08,
+	0x08, 0x07, 0x88, 0x00, 0x88, 0x8e, 0x80, 0x80, 0x00, 0x78, 0x00, 0x08, 0x85, 0x00, 0x88, 0x70,
+	0xb8, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x8b, 0x80,
+	0x80, 0x80, 0x80, 0x00, 0x88, 0x77, 0x82, 0x80, 0x17, 0x80, 0x80, 0xf0, 0x88, 0x80, 0xe0, 0x08,
+	0xc8, 0x08, 0x08, 0x0e, 0x08, 0xc8, 0x08, 0x08, 0x08, 0x80, 0x70, 0x00, 0x08, 0x86, 0x80, 0x50,
+	0x00, 0x00, 0x26, 0x00, 0x80, 0x08, 0x08, 0x80, 0x8f, 0x80, 0x8c, 0x8b, 0xd8, 0xc0, 0x08, 0xc8,
+	0x08, 0x04, 0x08, 0x04, 0x58, 0x30, 0x80, 0x05, 0x48, 0x80, 0x80, 0x80, 0x08, 0x80, 0xf8, 0x09,
+	0x08, 0xf8, 0x08, 0x0c, 0xc8, 0x80, 0x08, 0x80, 0x08, 0x07, 0x03, 0x04, 0x34, 0x03, 0x04, 0x84,
+	0x80, 0x80, 0xe0, 0xb8, 0x08, 0x8d, 0xc0, 0x08, 0x80, 0x80, 0x08, 0x80, 0x08, 0x08, 0x80, 0x08,
+	0x70, 0x06, 0x86, 0x84, 0x84, 0x03, 0x03, 0x08, 0x08, 0xf8, 0x8b, 0xbc, 0xb8, 0x0d, 0x0c, 0x08,
+	0x08, 0x08, 0x05, 0x84, 0x40, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x88, 0x00, 0x08, 0x08,
+	0xf8, 0xaf, 0x8f, 0xcb, 0xb8, 0xc8, 0x80, 0x80, 0x08, 0x87, 0x84, 0x03, 0x03, 0x84, 0x80, 0x00,
+	0x0f, 0x8b, 0x8b, 0x8c, 0x0c, 0x08, 0x08, 0x08, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x80, 0x80,
+	0x80, 0x77, 0x27, 0x58, 0x48, 0x08, 0x08, 0xc8, 0xc8, 0xc0, 0xc0, 0x8a, 0xc0, 0x80, 0x40, 0x08,
+	0x84, 0x34, 0x48, 0x08, 0x03, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+	0xf8, 0xcf, 0x8f, 0x80, 0x8c, 0x40, 0x80, 0x85, 0x84, 0x33, 0x40, 0x08, 0x84, 0x80, 0x80, 0x8d,
+	0xd0, 0x80, 0x8b, 0x80, 0x8d, 0x80, 0x80, 0x80, 0x07, 0x08, 0x08, 0x80, 0x08, 0x08, 0x80, 0x27,
+	0x08, 0x07, 0x08, 0x08, 0x08, 0x08, 0x8f, 0xc8, 0x08, 0x0d, 0x8b, 0x80, 0x80, 0x08, 0x80, 0x07,
+	0x00, 0x68, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x9f, 0x08, 0x88, 0x8f, 0x80, 0x0d, 0x08, 0xd8,
+	0x80, 0x80, 0x80, 0x60, 0x80, 0x80, 0x86, 0x30, 0x80, 0x80, 0x80, 0x80, 0x80, 0x9f, 0x08, 0x0f,
+	0x0c, 0xb8, 0x80, 0xc8, 0x08, 0x08, 0x08, 0x07, 0x48, 0x08, 0x84, 0x04, 0x83, 0x04, 0x08, 0x08,
+	0x00, 0x01, 0x21, 0x00, 0x80, 0x08, 0x8f, 0xc8, 0xc0, 0xb8, 0x88, 0x8c, 0xd0, 0x08, 0x08, 0x08,
+	0x86, 0x40, 0x48, 0x83, 0x34, 0x03, 0x03, 0x85, 0x04, 0x88, 0xc0, 0x08, 0xbd, 0xc0, 0xbb, 0xc0,
+	0x8b, 0x0c, 0xc8, 0x80, 0x40, 0x08, 0x04, 0x84, 0x84, 0x24, 0x03, 0x43, 0x30, 0x04, 0x03, 0x08,
+	0x08, 0x8f, 0x0b, 0xbc, 0xbc, 0xcb, 0xca, 0xba, 0xb8, 0x08, 0x08, 0x78, 0x48, 0x02, 0x43, 0x33,
+	0x43, 0x30, 0x04, 0x03, 0x08, 0x05, 0x8c, 0xc0, 0xb8, 0xbc, 0xc8, 0xfb, 0x9a, 0xaa, 0xa8, 0x8b,
+	0x80, 0x00, 0x68, 0x43, 0x33, 0x43, 0x24, 0x33, 0x34, 0x48, 0x08, 0x08, 0x0d, 0xb8, 0x8c, 0xcb,
+	0xcb, 0x0b, 0xbc, 0xcb, 0xb0, 0x0c, 0xc8, 0x80, 0x84, 0x40, 0x42, 0x32, 0x43, 0x16, 0x22, 0x38,
+	0x02, 0x08, 0x08, 0x8d, 0xcb, 0xcb, 0xbb, 0x0c, 0xcb, 0x0b, 0x0c, 0x0c, 0x08, 0x08, 0x58, 0x80,
+	0x34, 0x40, 0x43, 0x33, 0x03, 0x44, 0x83, 0x40, 0x08, 0xc8, 0xc8, 0x0b, 0xcc, 0xba, 0x8b, 0xbc,
+	0xb8, 0x08, 0x88, 0x00, 0x78, 0x00, 0x85, 0x34, 0x48, 0x48, 0x38, 0x03, 0x58, 0x08, 0x03, 0xd0,
+	0x08, 0xc8, 0xc8, 0x0b, 0xbc, 0xc8, 0xb8, 0xc8, 0x80, 0x80, 0x78, 0x08, 0x03, 0x03, 0x85, 0x04,
+	0x83, 0x80, 0x05, 0x88, 0x00, 0x88, 0xf0, 0x08, 0x8c, 0xc0, 0xb8, 0x08, 0x0d, 0xc8, 0x80, 0x08,
+	0x80, 0x06, 0x48, 0x08, 0x84, 0x04, 0x48, 0x08, 0x08, 0x08, 0xe8, 0x08, 0xd0, 0x80, 0x0c, 0xb8,
+	0x08, 0xd8, 0x08, 0x08, 0x80, 0x78, 0x80, 0x80, 0x05, 0x48, 0x80, 0x04, 0x08, 0x08, 0x08, 0x08,
+	0x8f, 0x08, 0x8d, 0x8b, 0xd0, 0x08, 0xc8, 0x80, 0x08, 0x60, 0x08, 0x84, 0x40, 0x08, 0x84, 0x84,
+	0x80, 0x04, 0x08, 0xd8, 0x80, 0xd0, 0x80, 0x8b, 0x8c, 0xd0, 0x80, 0x8b, 0x80, 0x80, 0x80, 0x07,
+	0x00, 0xfd, 0x24, 0x00, 0x84, 0x04, 0x83, 0x04, 0x03, 0x04, 0x48, 0x80, 0xd0, 0x08, 0x0c, 0x8c,
+	0x0b, 0xbc, 0xc8, 0x80, 0x0c, 0x08, 0x08, 0x08, 0x06, 0x48, 0x40, 0x48, 0x83, 0x34, 0x48, 0x48,
+	0x08, 0x08, 0x08, 0x08, 0x0f, 0xbb, 0xc8, 0xcb, 0xbb, 0xc0, 0x8b, 0xd0, 0x80, 0x30, 0x50, 0x48,
+	0x83, 0x34, 0x03, 0x53, 0x48, 0x38, 0x30, 0x80, 0x80, 0x0e, 0xc8, 0xc0, 0xbb, 0xbc, 0xbb, 0x8c,
+	0xcb, 0x8b, 0x0c, 0x08, 0x58, 0x48, 0x33, 0x34, 0x33, 0x34, 0x34, 0x48, 0x48, 0x08, 0x08, 0xc8,
+	0xc8, 0x0b, 0xbc, 0xbc, 0xcb, 0xbb, 0x8b, 0xcc, 0xc0, 0x80, 0x80, 0x04, 0x43, 0x24, 0x33, 0x34,
+	0x17, 0x21, 0x10, 0x83, 0x80, 0xc0, 0xb8, 0xbc, 0xbc, 0xcb, 0xca, 0xba, 0xb8, 0x8c, 0xc0, 0x08,
+	0x08, 0x85, 0x84, 0x24, 0x33, 0x34, 0x43, 0x33, 0x03, 0x44, 0x08, 0x08, 0x0d, 0xcb, 0xb8, 0xcb,
+	0x9f, 0x0a, 0xaa, 0x8a, 0x80, 0x80, 0x80, 0x86, 0x84, 0x33, 0x40, 0x83, 0x44, 0x38, 0x03, 0x58,
+	0x08, 0x08, 0x08, 0x0e, 0x0c, 0xbb, 0x0c, 0xac, 0x8b, 0x8b, 0xd0, 0x80, 0x40, 0x08, 0x04, 0x84,
+	0x34, 0x48, 0x48, 0x08, 0x83, 0x80, 0x80, 0x80, 0xf0, 0x88, 0x8c, 0xc0, 0xc8, 0xc0, 0x80, 0x0c,
+	0x08, 0x8c, 0x40, 0x08, 0x58, 0x48, 0x38, 0x30, 0x80, 0x05, 0x08, 0x88, 0x00, 0x88, 0x8f, 0xd0,
+	0x80, 0x8b, 0x8c, 0x80, 0x0d, 0x08, 0x08, 0x08, 0x06, 0x08, 0x85, 0x40, 0x08, 0x84, 0x80, 0x85,
+	0x80, 0x80, 0x0d, 0x08, 0x0d, 0xb8, 0xc8, 0x08, 0xd8, 0x80, 0x80, 0x80, 0x60, 0x80, 0x50, 0x48,
+	0x08, 0x03, 0x80, 0x05, 0x08, 0x08, 0xe8, 0x08, 0xd8, 0x80, 0x0c, 0xc8, 0x80, 0x0c, 0x08, 0x08,
+	0x08, 0x08, 0x07, 0x58, 0x48, 0x08, 0x83, 0x04, 0x08, 0x58, 0xc0, 0x80, 0x80, 0x8c, 0x0c, 0x0c,
+	0x00, 0xff, 0x26, 0x00, 0x8b, 0x0c, 0x08, 0x0d, 0x08, 0x84, 0x80, 0x50, 0x48, 0x48, 0x38, 0x80,
+	0x84, 0x04, 0x88, 0x00, 0x88, 0x00, 0x8f, 0x8b, 0x8c, 0x0c, 0x0c, 0x0c, 0x8b, 0xc0, 0x08, 0x08,
+	0x85, 0x40, 0x48, 0x30, 0x48, 0x03, 0x84, 0x84, 0x84, 0x80, 0x80, 0x80, 0xe0, 0xb8, 0xc8, 0xc8,
+	0xbb, 0x8c, 0xcb, 0xb8, 0xc8, 0x08, 0x08, 0x68, 0x30, 0x04, 0x43, 0x43, 0x33, 0x24, 0x40, 0x02,
+	0x84, 0x80, 0xd0, 0xc0, 0xb0, 0xcb, 0xbb, 0xaf, 0xa9, 0xaa, 0xbb, 0xc0, 0x80, 0x80, 0x85, 0x24,
+	0x73, 0x21, 0x23, 0x15, 0x23, 0x12, 0x83, 0x03, 0xc8, 0xc0, 0xbb, 0xec, 0xc9, 0xb9, 0x9c, 0x9c,
+	0xb9, 0x0a, 0x8a, 0x80, 0x03, 0x74, 0x11, 0x34, 0x43, 0x33, 0x42, 0x23, 0x12, 0x83, 0x80, 0xcb,
+	0xcb, 0x9e, 0xbc, 0xad, 0xab, 0xab, 0xab, 0xaa, 0x0b, 0x08, 0x34, 0x24, 0x17, 0x24, 0x63, 0x21,
+	0x32, 0x31, 0x21, 0x28, 0xb0, 0xb8, 0xaf, 0xcb, 0xcb, 0xdb, 0xba, 0x9a, 0x9c, 0x99, 0x08, 0x28,
+	0x33, 0x33, 0x57, 0x32, 0x33, 0x23, 0x35, 0x21, 0x31, 0x08, 0xb8, 0xbc, 0x9f, 0xcb, 0xbb, 0xbc,
+	0xab, 0x9c, 0x0a, 0x8a, 0x30, 0x33, 0x44, 0x25, 0x14, 0x34, 0x21, 0x14, 0x22, 0x28, 0x80, 0xc0,
+	0xbb, 0xcb, 0x9f, 0xac, 0xba, 0xab, 0xaa, 0x8b, 0x80, 0x44, 0x32, 0x43, 0x16, 0x34, 0x21, 0x22,
+	0x32, 0x08, 0x08, 0xd8, 0xc0, 0xbb, 0xbc, 0xbb, 0xaf, 0xac, 0xa9, 0xaa, 0x88, 0x40, 0x38, 0x64,
+	0x41, 0x41, 0x31, 0x21, 0x21, 0x83, 0x80, 0x8b, 0xcc, 0xfb, 0x99, 0xaa, 0xaa, 0xab, 0xb8, 0x8c,
+	0x8b, 0x08, 0x60, 0x48, 0x73, 0x11, 0x42, 0x21, 0x22, 0x02, 0x02, 0xb8, 0xd8, 0xfb, 0x9a, 0xac,
+	0xa9, 0xaa, 0xb8, 0x80, 0x40, 0x80, 0x85, 0x03, 0x34, 0x34, 0x33, 0x34, 0x04, 0x83, 0x80, 0x80,
+	0x00, 0x05, 0x20, 0x00, 0xf0, 0xbb, 0xaf, 0xab, 0x9d, 0xa9, 0x0a, 0x08, 0x42, 0x32, 0x43, 0x33,
+	0x27, 0x21, 0x22, 0x33, 0x83, 0x80, 0x00, 0x0f, 0xbb, 0xbc, 0xcb, 0x9e, 0x9c, 0xcb, 0xc9, 0x09,
+	0x0a, 0x22, 0x52, 0x42, 0x23, 0x34, 0x42, 0x41, 0x11, 0x22, 0x08, 0x08, 0xb8, 0xbc, 0xbc, 0x9f,
+	0xa9, 0x9c, 0xbc, 0xc9, 0x9b, 0xaa, 0x80, 0x20, 0x24, 0x46, 0x31, 0x13, 0x24, 0x23, 0x15, 0x21,
+	0x22, 0x08, 0x0b, 0xbc, 0xcb, 0x0b, 0xbc, 0xae, 0xca, 0x9c, 0xab, 0x9c, 0x0a, 0x2a, 0x38, 0x03,
+	0x27, 0x22, 0x62, 0x31, 0x42, 0x12, 0x24, 0x28, 0x08, 0x08, 0xb8, 0x08, 0x8d, 0xcb, 0xcb, 0xbe,
+	0xca, 0xab, 0x9c, 0x0a, 0x0b, 0x80, 0x03, 0x58, 0x33, 0x43, 0x37, 0x41, 0x41, 0x11, 0x01, 0x82,
+	0x08, 0x80, 0x08, 0xd0, 0xac, 0xfb, 0xbb, 0xca, 0xab, 0xa9, 0xab, 0xb8, 0x80, 0x58, 0x30, 0x34,
+	0x64, 0x23, 0x34, 0x22, 0x22, 0x08, 0x03, 0xc8, 0x08, 0x0d, 0xcb, 0x9e, 0x9c, 0x9c, 0x9b, 0x0a,
+	0x8a, 0xb0, 0x30, 0x80, 0x35, 0x34, 0x73, 0x32, 0x52, 0x11, 0x82, 0x80, 0x80, 0x0b, 0x8c, 0xcb,
+	0xcb, 0xbb, 0xaf, 0xa9, 0xa8, 0x80, 0x30, 0x40, 0x84, 0x24, 0x33, 0x64, 0x21, 0x14, 0x42, 0x10,
+	0x80, 0x80, 0xbb, 0xcb, 0xac, 0xbb, 0xbc, 0xbb, 0xad, 0x8b, 0x80, 0x50, 0x43, 0x33, 0x43, 0x73,
+	0x12, 0x22, 0x23, 0x33, 0x40, 0x08, 0x08, 0xbd, 0xbc, 0xfb, 0xba, 0xda, 0x99, 0xaa, 0xaa, 0x80,
+	0x80, 0x58, 0x33, 0x24, 0x24, 0x33, 0x04, 0x83, 0x04, 0x48, 0x80, 0x08, 0xbd, 0xbc, 0xbb, 0xaf,
+	0xda, 0x99, 0x9c, 0x0a, 0x8a, 0x0a, 0x38, 0x40, 0x43, 0x33, 0x03, 0x04, 0x84, 0x80, 0x80, 0x8d,
+	0x80, 0x80, 0x0e, 0xbc, 0xc0, 0xbb, 0x8b, 0x8c, 0x0c, 0x08, 0x08, 0x68, 0x30, 0x34, 0x34, 0x43,
+	0x00, 0xfc, 0x27, 0x00, 0x83, 0x80, 0x80, 0xe0, 0x08, 0x8c, 0x00, 0x08, 0xe8, 0x08, 0x08, 0x80,
+	0x08, 0x70, 0x40, 0x48, 0x33, 0x24, 0x24, 0x33, 0x27, 0x28, 0x02, 0xb8, 0xc0, 0x0b, 0xbc, 0xc0,
+	0xb0, 0x08, 0x08, 0x0e, 0x48, 0x08, 0x48, 0x03, 0x34, 0x30, 0x35, 0x03, 0x53, 0x33, 0x84, 0x03,
+	0xc8, 0xb8, 0xed, 0xa9, 0xca, 0xaa, 0x0a, 0xab, 0xc8, 0x80, 0x80, 0x80, 0x60, 0x48, 0x30, 0x08,
+	0x04, 0x48, 0x40, 0x08, 0x84, 0xc0, 0xb8, 0xbc, 0xaf, 0xc9, 0xba, 0xaa, 0x0b, 0xbb, 0x08, 0x08,
+	0x08, 0x70, 0x08, 0x84, 0x04, 0x08, 0x03, 0x08, 0x80, 0x07, 0x08, 0xd8, 0xc0, 0xc0, 0xba, 0xcb,
+	0x0b, 0x0c, 0x0c, 0x08, 0x03, 0x04, 0x34, 0x84, 0x43, 0x83, 0x84, 0x30, 0x00, 0x88, 0x00, 0x78,
+	0x00, 0x0d, 0x08, 0x8c, 0x8b, 0xd0, 0x08, 0x58, 0x38, 0x40, 0x43, 0x33, 0x73, 0x22, 0x02, 0x32,
+	0x80, 0x80, 0x80, 0x80, 0x8f, 0xc0, 0x80, 0x0c, 0x8c, 0xc0, 0x80, 0x8b, 0x80, 0x86, 0x30, 0x44,
+	0x32, 0x43, 0x33, 0x43, 0x30, 0x00, 0x88, 0xf0, 0xc0, 0xba, 0xb8, 0xbc, 0xbc, 0xc0, 0xbb, 0xc0,
+	0xb8, 0xc8, 0x08, 0x58, 0x80, 0x34, 0x40, 0x43, 0x38, 0x84, 0x84, 0x80, 0xc0, 0xb8, 0xbc, 0xbc,
+	0xcb, 0xbb, 0x8b, 0xcc, 0x0b, 0x0c, 0x8b, 0x80, 0x0d, 0x03, 0x58, 0x30, 0x40, 0x84, 0x03, 0x84,
+	0x84, 0x00, 0x0d, 0xb8, 0xc0, 0x8b, 0xbc, 0xc8, 0xc0, 0x80, 0x80, 0xd0, 0x48, 0x08, 0x08, 0x04,
+	0x84, 0x34, 0x48, 0x48, 0x38, 0x08, 0x84, 0x00, 0xd8, 0x80, 0x0c, 0x8c, 0xc0, 0x80, 0x80, 0x80,
+	0x80, 0x07, 0x48, 0x08, 0x43, 0x30, 0x40, 0x84, 0x03, 0x84, 0x40, 0x80, 0x08, 0x0d, 0xc8, 0xc0,
+	0xb8, 0xc0, 0x8b, 0x0c, 0x08, 0x08, 0x08, 0x78, 0x30, 0x40, 0x40, 0x83, 0x34, 0x04, 0x83, 0x04,
+	0x00, 0x08, 0x25, 0x00, 0x80, 0x08, 0xf0, 0xb0, 0xb8, 0xbc, 0xbc, 0xcb, 0x0b, 0xac, 0x88, 0x8b,
+	0x08, 0x60, 0x80, 0x44, 0x83, 0x34, 0x33, 0x25, 0x03, 0x03, 0x04, 0x88, 0xd0, 0xc8, 0x0b, 0xcc,
+	0xad, 0xb9, 0xaa, 0xbb, 0xbc, 0xc0, 0x80, 0x80, 0x04, 0x84, 0x34, 0x33, 0x55, 0x22, 0x31, 0x38,
+	0x03, 0x58, 0xb8, 0x80, 0xcc, 0xbb, 0xcb, 0xcb, 0xbb, 0xbc, 0xbb, 0xc8, 0xc8, 0x80, 0x04, 0x03,
+	0x44, 0x33, 0x43, 0x24, 0x03, 0x43, 0x30, 0x80, 0x80, 0x08, 0x8f, 0x8b, 0xcc, 0xbb, 0xc0, 0x8b,
+	0x0c, 0x0c, 0x88, 0x00, 0x88, 0x87, 0x03, 0x43, 0x30, 0x40, 0x40, 0x08, 0x84, 0x80, 0x80, 0xf0,
+	0x80, 0xc0, 0x80, 0x8b, 0x08, 0x80, 0x08, 0x08, 0x80, 0x78, 0x83, 0x07, 0x08, 0x04, 0x08, 0x08,
+	0x08, 0x8f, 0x80, 0x8c, 0xd0, 0x80, 0xc0, 0x08, 0x58, 0x08, 0x48, 0x30, 0x40, 0x40, 0x48, 0x08,
+	0x03, 0x08, 0x80, 0x80, 0x8f, 0x8c, 0xcb, 0xb8, 0xbc, 0xc8, 0xc0, 0x80, 0x8b, 0x58, 0x80, 0x04,
+	0x43, 0x03, 0x34, 0x84, 0x03, 0x04, 0x03, 0x08, 0x0e, 0x0c, 0xbb, 0xc8, 0xcb, 0xbb, 0xcb, 0xb8,
+	0x8c, 0x80, 0x80, 0x80, 0x37, 0x48, 0x33, 0x84, 0x43, 0x83, 0x84, 0x30, 0x00, 0x8d, 0xc0, 0xb8,
+	0x8c, 0xcb, 0xcb, 0xb8, 0x8b, 0x8c, 0xc0, 0x03, 0x08, 0x05, 0x34, 0x03, 0x44, 0x83, 0x34, 0x08,
+	0x84, 0x80, 0x80, 0x8d, 0x0c, 0x0c, 0x0c, 0x8b, 0x8b, 0x0c, 0xc8, 0x08, 0x58, 0x80, 0x84, 0x34,
+	0x48, 0x83, 0x84, 0x84, 0x30, 0x08, 0xc8, 0x08, 0xd8, 0xc8, 0xc0, 0x80, 0x8b, 0xd0, 0x08, 0x08,
+	0x08, 0x08, 0x78, 0x40, 0x30, 0x80, 0x05, 0x03, 0x58, 0x08, 0x80, 0x0d, 0xc8, 0x80, 0x0c, 0x8c,
+	0x0b, 0xc8, 0x08, 0x8c, 0x80, 0x80, 0x80, 0x07, 0x08, 0x04, 0x48, 0x40, 0x08, 0x84, 0x80, 0x80,
+	0x00, 0x02, 0x21, 0x00, 0x80, 0xf8, 0x80, 0x0c, 0x8c, 0xc0, 0x80, 0xc0, 0x08, 0xc8, 0x80, 0x80,
+	0x08, 0x80, 0x07, 0x80, 0x85, 0x04, 0x83, 0x40, 0x30, 0x00, 0x08, 0x88, 0x00, 0x08, 0x88, 0xbf,
+	0xf8, 0x08, 0x0d, 0x0c, 0x0b, 0x8c, 0xc0, 0x80, 0x80, 0x80, 0x86, 0x84, 0x33, 0x84, 0x24, 0x03,
+	0x03, 0x04, 0x88, 0x00, 0x88, 0xf0, 0xc8, 0xb8, 0x8c, 0xcb, 0xcb, 0xc0, 0x8a, 0x0b, 0x8c, 0x80,
+	0x85, 0x03, 0x34, 0x34, 0x33, 0x40, 0x34, 0x48, 0x38, 0x00, 0xd8, 0x80, 0x0c, 0xbc, 0x8b, 0xdb,
+	0xbb, 0xac, 0xc8, 0x0b, 0x80, 0x3c, 0x80, 0x05, 0x43, 0x43, 0x83, 0x34, 0x48, 0x83, 0x80, 0x80,
+	0x80, 0xf8, 0x80, 0x0c, 0x8c, 0x0b, 0x8c, 0x8b, 0x8c, 0x80, 0x00, 0x88, 0x70, 0x40, 0x30, 0x40,
+	0x48, 0x80, 0x40, 0x80, 0x8c, 0x80, 0x8c, 0xd0, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x78, 0x02,
+	0x06, 0x58, 0x08, 0x03, 0x08, 0x08, 0x08, 0xf8, 0x88, 0xbd, 0xb8, 0xd8, 0x8b, 0xd0, 0x80, 0x80,
+	0x85, 0x84, 0x83, 0x04, 0x33, 0x40, 0x40, 0x48, 0x08, 0x08, 0x08, 0x0e, 0x0c, 0xbb, 0xc8, 0xbb,
+	0xcc, 0xb0, 0x8b, 0x0c, 0x08, 0x04, 0x84, 0x34, 0x48, 0x33, 0x48, 0x03, 0x84, 0x84, 0x00, 0x88,
+	0x8c, 0x8c, 0x0c, 0xbc, 0x0b, 0xbc, 0x8c, 0x0b, 0x8c, 0x80, 0x50, 0x48, 0x48, 0x32, 0x30, 0x04,
+	0x03, 0x04, 0x58, 0x08, 0x0c, 0x08, 0x8c, 0x8b, 0x8c, 0x0c, 0x0c, 0x0c, 0x08, 0x08, 0x08, 0x68,
+	0x30, 0x40, 0x40, 0x83, 0x04, 0x03, 0x08, 0xb5, 0x08, 0xd8, 0xc8, 0xc0, 0xc0, 0x80, 0x0b, 0xc8,
+	0x08, 0x08, 0x08, 0x87, 0x30, 0x40, 0x84, 0x24, 0x30, 0x08, 0x04, 0x08, 0xd8, 0x08, 0xcc, 0xc0,
+	0x8a, 0xcb, 0xb0, 0x08, 0x0d, 0x08, 0x08, 0x68, 0x08, 0x43, 0x30, 0x40, 0x84, 0x84, 0x83, 0x80,
+	0x00, 0x04, 0x23, 0x00, 0x80, 0x08, 0xbf, 0xc0, 0x0b, 0xbc, 0x0b, 0x8c, 0x8b, 0x80, 0x80, 0x80,
+	0x70, 0x50, 0x48, 0x38, 0x30, 0x40, 0x48, 0x80, 0x04, 0x08, 0xd8, 0xc0, 0xc0, 0xb0, 0x8b, 0x0c,
+	0x0c, 0x0c, 0x08, 0x08, 0x80, 0x05, 0x58, 0x38, 0x40, 0x30, 0x80, 0x85, 0x40, 0x08, 0x80, 0x08,
+	0x8e, 0xc0, 0x80, 0x0c, 0x8c, 0xc0, 0x80, 0x80, 0x80, 0x80, 0x07, 0x83, 0x40, 0x80, 0x04, 0x58,
+	0x08, 0x08, 0x08, 0x80, 0x08, 0xf0, 0x09, 0x8d, 0xc0, 0xb8, 0x08, 0x08, 0x08, 0x80, 0x08, 0x17,
+	0x60, 0x30, 0x80, 0x85, 0x40, 0x08, 0x80, 0x80, 0xe8, 0x08, 0xc8, 0xc8, 0x08, 0x0d, 0x8b, 0xc8,
+	0x80, 0x80, 0x08, 0x80, 0x70, 0x00, 0x85, 0x84, 0x84, 0x03, 0x08, 0x88, 0x00, 0x88, 0xf0, 0x09,
+	0x0d, 0xc8, 0xc0, 0xb8, 0x80, 0x8c, 0x00, 0x88, 0x00, 0x08, 0x07, 0x85, 0x84, 0x83, 0x04, 0x48,
+	0x08, 0x08, 0x08, 0xe8, 0x08, 0x0c, 0xc8, 0xc0, 0x08, 0x0c, 0x08, 0x8c, 0x80, 0x00, 0x85, 0x40,
+	0x40, 0x48, 0x48, 0x38, 0x80, 0x40, 0x08, 0xc8, 0x08, 0xd8, 0xc8, 0x80, 0x0c, 0x0c, 0x08, 0x8c,
+	0x80, 0x80, 0x80, 0x87, 0x40, 0x38, 0x40, 0x48, 0x48, 0x08, 0x48, 0x08, 0x0c, 0xb8, 0x08, 0xbd,
+	0xc8, 0xc0, 0x80, 0x0c, 0x08, 0x8c, 0x40, 0x08, 0x58, 0x48, 0x38, 0x30, 0x40, 0x48, 0x80, 0x04,
+	0x08, 0x0d, 0xb8, 0xc8, 0xc8, 0x0b, 0x8c, 0x8b, 0x8c, 0xd0, 0x80, 0x40, 0x08, 0x58, 0x38, 0x40,
+	0x30, 0x40, 0x48, 0x30, 0x80, 0x00, 0x08, 0x8f, 0x8b, 0x8c, 0x0c, 0xbc, 0x80, 0x0c, 0xc8, 0x80,
+	0x40, 0x80, 0x58, 0x30, 0x40, 0x40, 0x48, 0x08, 0x03, 0x80, 0x08, 0x08, 0x80, 0x9f, 0x0d, 0x0c,
+	0xc8, 0xb0, 0x08, 0x08, 0x88, 0x00, 0x78, 0x00, 0x85, 0x04, 0x48, 0x08, 0x03, 0x08, 0x08, 0x08,
+	0x00, 0x02, 0x1d, 0x00, 0x80, 0x9f, 0xe0, 0xc0, 0x80, 0x0b, 0x08, 0x88, 0x00, 0x88, 0x70, 0x81,
+	0x86, 0x84, 0x30, 0x08, 0x08, 0x80, 0x08, 0x80, 0xf8, 0x89, 0x0e, 0xc8, 0x80, 0x0c, 0xc8, 0x80,
+	0x80, 0x80, 0x78, 0x80, 0x84, 0x03, 0x58, 0x48, 0x08, 0x08, 0x08, 0x08, 0x08, 0x8f, 0xc0, 0xb8,
+	0x08, 0x8d, 0xc0, 0x08, 0xc8, 0x08, 0x80, 0x05, 0x08, 0x85, 0x84, 0x30, 0x40, 0x80, 0x85, 0x80,
+	0x80, 0x00, 0x0f, 0x08, 0x0c, 0x0c, 0xb8, 0x80, 0x8c, 0x80, 0xe0, 0x80, 0x84, 0x80, 0x40, 0x80,
+	0x85, 0x03, 0x84, 0x40, 0x08, 0x08, 0x80, 0x08, 0x8f, 0x80, 0x8c, 0x8b, 0xd8, 0x80, 0xc8, 0x08,
+	0x08, 0x08, 0x08, 0x78, 0x01, 0x85, 0x04, 0x03, 0x58, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8f, 0x0d,
+	0xb8, 0x08, 0x8d, 0xc0, 0x08, 0x08, 0x08, 0x08, 0x78, 0x00, 0x04, 0x84, 0x84, 0x03, 0x80, 0x85,
+	0x80, 0xd0, 0x80, 0xd0, 0xc0, 0xb0, 0xb8, 0x08, 0x8d, 0xc0, 0x80, 0x08, 0x85, 0x80, 0x85, 0x84,
+	0x03, 0x03, 0x04, 0x03, 0x80, 0x08, 0x80, 0xf8, 0x09, 0x0e, 0x0c, 0x0b, 0x8c, 0x0b, 0xc8, 0x08,
+	0x80, 0x08, 0x87, 0x30, 0x40, 0x40, 0x48, 0x48, 0x38, 0x80, 0x80, 0x80, 0x80, 0x8f, 0x8b, 0x8c,
+	0x0c, 0x0c, 0x8b, 0x08, 0x0d, 0x08, 0x58, 0x08, 0x58, 0x48, 0x08, 0x83, 0x04, 0x48, 0x80, 0x80,
+	0x80, 0x80, 0xf0, 0xc8, 0x08, 0x8c, 0x8b, 0xd0, 0x08, 0x80, 0x08, 0x60, 0x80, 0x40, 0x80, 0x05,
+	0x08, 0x04, 0x08, 0x88, 0x00, 0x08, 0x88, 0x9f, 0xe8, 0x80, 0x0c, 0xc8, 0x80, 0x80, 0x80, 0x06,
+	0x48, 0x08, 0x84, 0x40, 0x08, 0x40, 0x08, 0x08, 0x80, 0x0f, 0x08, 0x8c, 0x8b, 0xd0, 0xb8, 0x08,
+	0x8d, 0x80, 0x80, 0x86, 0x30, 0x40, 0x40, 0x03, 0x03, 0x50, 0x08, 0x80, 0x08, 0xf8, 0x80, 0x0c,
+	0x00, 0x00, 0x25, 0x00, 0xd0, 0xb0, 0xb8, 0xc8, 0x80, 0xc8, 0x58, 0x08, 0x48, 0x30, 0x04, 0x43,
+	0x30, 0x04, 0x03, 0x08, 0x08, 0x08, 0x8f, 0x8c, 0x8b, 0xcc, 0xb0, 0x8c, 0x0b, 0xc8, 0x08, 0x80,
+	0x78, 0x08, 0x43, 0x38, 0x84, 0x24, 0x30, 0x48, 0x80, 0x80, 0x00, 0x0f, 0x8b, 0x8b, 0xcc, 0xb0,
+	0x8c, 0x0b, 0xc8, 0x08, 0x08, 0x60, 0x08, 0x84, 0x34, 0x48, 0x38, 0x04, 0x83, 0x40, 0x80, 0x8c,
+	0xd0, 0xb0, 0xc8, 0xb8, 0xc8, 0x0c, 0xb8, 0x08, 0x08, 0x08, 0x08, 0x07, 0x50, 0x48, 0x30, 0x48,
+	0x30, 0x80, 0x05, 0x08, 0xd8, 0x80, 0xd0, 0xc0, 0xb0, 0xb8, 0xc8, 0x08, 0x80, 0x08, 0x08, 0x80,
+	0x17, 0x68, 0x48, 0x08, 0x83, 0x80, 0x05, 0x08, 0x08, 0x08, 0x0f, 0x88, 0x8b, 0x0d, 0xc8, 0x80,
+	0xd0, 0x80, 0x48, 0x80, 0x80, 0x05, 0x48, 0x80, 0x04, 0x08, 0x08, 0x08, 0x08, 0x88, 0x80, 0xaf,
+	0x80, 0x8f, 0x80, 0x0c, 0x08, 0x08, 0x88, 0x80, 0x70, 0x81, 0x86, 0x00, 0x03, 0x08, 0x80, 0x08,
+	0x80, 0xf0, 0x8a, 0x80, 0x8f, 0x80, 0x0d, 0x08, 0x08, 0x88, 0x00, 0x88, 0x70, 0x01, 0x06, 0x88,
+	0x85, 0x80, 0x40, 0x80, 0x8c, 0x00, 0xd8, 0xc8, 0x80, 0xd0, 0x80, 0xc0, 0x08, 0x08, 0x08, 0x86,
+	0x80, 0x50, 0x48, 0x08, 0x84, 0x80, 0x04, 0x08, 0x08, 0x88, 0x8e, 0xc0, 0x08, 0x0d, 0x0c, 0xb8,
+	0x80, 0x80, 0x80, 0x80, 0x80, 0x17, 0x68, 0x48, 0x08, 0x83, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80,
+	0x9f, 0xe0, 0xc0, 0xb0, 0xc0, 0x08, 0x08, 0x8c, 0x04, 0x08, 0x58, 0x30, 0x80, 0x85, 0x04, 0x48,
+	0x08, 0x48, 0x80, 0xd0, 0x80, 0xb8, 0x08, 0x0e, 0x0c, 0x8b, 0x8b, 0x80, 0x8d, 0x40, 0x80, 0x80,
+	0x86, 0x84, 0x83, 0x40, 0x80, 0x84, 0x80, 0x50, 0x8b, 0x80, 0x80, 0x0e, 0x0c, 0x0c, 0xb8, 0xc0,
+	0x00, 0xfd, 0x26, 0x00, 0x80, 0xc8, 0x84, 0x80, 0x40, 0x80, 0x04, 0x84, 0x40, 0x08, 0x84, 0x80,
+	0x80, 0x80, 0x00, 0x8f, 0xc8, 0x08, 0x0d, 0xb8, 0x08, 0x8d, 0x80, 0x80, 0x80, 0x80, 0x07, 0x04,
+	0x48, 0x80, 0x04, 0x08, 0x84, 0x80, 0x00, 0x0f, 0x08, 0xc8, 0x80, 0x0c, 0x08, 0x0d, 0x08, 0x8c,
+	0x80, 0x80, 0x86, 0x80, 0x04, 0x48, 0x80, 0x40, 0x08, 0x80, 0x08, 0x80, 0x80, 0x08, 0xaf, 0x80,
+	0x8f, 0x80, 0xd0, 0x08, 0x08, 0x80, 0x08, 0x80, 0x78, 0x01, 0x68, 0x80, 0x40, 0x08, 0x80, 0x08,
+	0x80, 0x08, 0x9f, 0x80, 0xf0, 0x08, 0x08, 0x08, 0x8d, 0x80, 0x80, 0x80, 0x07, 0x08, 0x08, 0x05,
+	0x08, 0x68, 0x08, 0x08, 0x08, 0x08, 0x08, 0x8f, 0x08, 0xd8, 0x08, 0x08, 0x80, 0x0f, 0x08, 0x08,
+	0x04, 0x08, 0x08, 0x08, 0x78, 0x81, 0x80, 0x80, 0x07, 0x08, 0x08, 0xe8, 0x80, 0x80, 0x80, 0x0e,
+	0x88, 0x00, 0x88, 0x00, 0x88, 0x80, 0x00, 0x88, 0x00, 0x88, 0x00, 0x77, 0x82, 0x80, 0x80, 0x08,
+	0x80, 0x08, 0x08, 0x08, 0x08, 0xf8, 0xcf, 0x80, 0x08, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08,
+	0x08, 0x08, 0x78, 0x77, 0x01, 0x88, 0x17, 0x80, 0x80, 0x80, 0x8f, 0x08, 0x88, 0xf0, 0x08, 0x08,
+	0x08, 0x8e, 0x80, 0x80, 0x80, 0x00, 0x07, 0x08, 0x68, 0x08, 0x08, 0x04, 0x08, 0x08, 0x08, 0x08,
+	0x08, 0xf8, 0x0a, 0xf8, 0x08, 0x08, 0x0d, 0x08, 0x88, 0x00, 0x88, 0x00, 0x78, 0x01, 0x78, 0x80,
+	0x30, 0x00, 0x08, 0x88, 0x00, 0x08, 0x88, 0xbf, 0xf8, 0x08, 0xd8, 0x80, 0x80, 0x80, 0x80, 0x80,
+	0x80, 0x17, 0x80, 0x70, 0x80, 0x80, 0x05, 0x08, 0x08, 0x88, 0x00, 0x8f, 0x08, 0xd8, 0x08, 0x08,
+	0x0e, 0x08, 0x08, 0x08, 0x86, 0x80, 0x80, 0x86, 0x80, 0x80, 0x00, 0x78, 0x8b, 0x00, 0x08, 0x88,
+	0x00, 0x00, 0x1f, 0x00, 0x0f, 0x08, 0x08, 0x08, 0xf8, 0x83, 0x00, 0x88, 0x00, 0x06, 0x08, 0x08,
+	0x86, 0x80, 0x80, 0xe0, 0x08, 0x08, 0xd8, 0x08, 0x08, 0x8d, 0x80, 0x80, 0x80, 0x80, 0x17, 0x08,
+	0x68, 0x80, 0x84, 0x00, 0x88, 0x00, 0x88, 0x00, 0xf8, 0x89, 0xf0, 0x08, 0x0c, 0x08, 0xc8, 0x08,
+	0x08, 0x05, 0x08, 0x68, 0x08, 0x03, 0x40, 0x80, 0x50, 0x80, 0x80, 0x80, 0x0f, 0x08, 0x8c, 0x8b,
+	0xd0, 0x08, 0xc8, 0x08, 0x08, 0x80, 0x70, 0x08, 0x58, 0x08, 0x84, 0x30, 0x80, 0x50, 0x80, 0x80,
+	0xf0, 0x80, 0x80, 0x0c, 0xc8, 0x80, 0x0c, 0x08, 0xd8, 0x80, 0x04, 0x08, 0x88, 0x86, 0x40, 0x08,
+	0x48, 0x80, 0x80, 0x80, 0x08, 0x80, 0x08, 0xf0, 0x8a, 0xf0, 0x08, 0x08, 0x8d, 0x80, 0x80, 0x80,
+	0x07, 0x08, 0x88, 0x05, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xff, 0x88,
+	0x80, 0x08, 0x80, 0x08, 0x80, 0x78, 0x86, 0x80, 0x80, 0x00, 0x08, 0x88, 0xbf, 0x08, 0x80, 0x08,
+	0x80, 0x08, 0x80, 0x08, 0x80, 0x77, 0x02, 0x08, 0x08, 0x08, 0x08, 0x80, 0x08, 0x80, 0x08, 0xff,
+	0x8c, 0x80, 0x9f, 0x80, 0x80, 0x80, 0x80, 0x27, 0x08, 0x78, 0x80, 0x80, 0x05, 0x08, 0x88, 0x00,
+	0x88, 0x00, 0x9f, 0x08, 0x8e, 0x80, 0x0c, 0x88, 0x00, 0x0f, 0x83, 0x08, 0x80, 0x05, 0x58, 0x08,
+	0x03, 0x08, 0x05, 0x08, 0x08, 0xe8, 0x08, 0xd8, 0x80, 0x0c, 0xc8, 0x80, 0xd0, 0x80, 0x80, 0x80,
+	0x60, 0x08, 0x84, 0x40, 0x48, 0x08, 0x84, 0x80, 0x80, 0x80, 0x80, 0x8f, 0xc0, 0x08, 0x8c, 0x8b,
+	0xd0, 0x80, 0x08, 0x08, 0x80, 0x78, 0x00, 0x04, 0x58, 0x38, 0x00, 0x84, 0x80, 0x80, 0x00, 0x08,
+	0x9f, 0xd0, 0xb8, 0x08, 0x8d, 0xc0, 0x80, 0x08, 0x80, 0x08, 0x70, 0x80, 0x85, 0x30, 0x40, 0x80,
+	0x00, 0x02, 0x23, 0x00, 0x80, 0x08, 0x08, 0x80, 0xf8, 0x89, 0x0e, 0x0c, 0xc8, 0xb0, 0x08, 0x08,
+	0x08, 0x08, 0x88, 0x17, 0x50, 0x30, 0x00, 0x85, 0x40, 0x80, 0x80, 0x80, 0x80, 0x8f, 0xd0, 0x80,
+	0x8b, 0x8c, 0xd0, 0x80, 0x80, 0x80, 0x80, 0x87, 0x30, 0x00, 0x04, 0x58, 0x80, 0x04, 0x08, 0x08,
+	0x08, 0xf8, 0x08, 0x8c, 0xc0, 0x08, 0x0c, 0xc8, 0x80, 0x08, 0x80, 0x06, 0x88, 0x85, 0x40, 0x08,
+	0x03, 0x08, 0x05, 0x08, 0x88, 0xf0, 0x80, 0xc0, 0x08, 0x8c, 0xc0, 0x08, 0xc8, 0x08, 0x80, 0x08,
+	0x87, 0x30, 0x00, 0x04, 0x58, 0x80, 0x40, 0x80, 0x08, 0x80, 0x0f, 0x08, 0x8c, 0xc0, 0x08, 0x8c,
+	0x80, 0x8c, 0x00, 0x88, 0x70, 0x08, 0x48, 0x80, 0x04, 0x48, 0x80, 0x80, 0x05, 0x08, 0xd8, 0x80,
+	0x08, 0x0d, 0xc8, 0x80, 0x0c, 0x08, 0xd8, 0x80, 0x08, 0x85, 0x00, 0x58, 0x08, 0x58, 0x08, 0x84,
+	0x80, 0x40, 0x08, 0xd0, 0x08, 0x08, 0x8d, 0x80, 0x8c, 0xc0, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+	0x78, 0x83, 0x70, 0x80, 0x85, 0x80, 0x80, 0x80, 0x00, 0x88, 0x00, 0xaf, 0x80, 0x8e, 0x80, 0x0d,
+	0x08, 0x08, 0x08, 0x08, 0x08, 0x78, 0x82, 0x60, 0x80, 0x40, 0x80, 0x80, 0x00, 0x88, 0x00, 0xf8,
+	0x0a, 0x88, 0x8f, 0x80, 0xe0, 0x80, 0x80, 0x80, 0x08, 0x80, 0x07, 0x80, 0x50, 0x08, 0x80, 0x78,
+	0x08, 0x08, 0x08, 0x08, 0x8e, 0x80, 0x80, 0x0d, 0x88, 0x00, 0x0f, 0x08, 0x08, 0x08, 0x68, 0x80,
+	0x80, 0x50, 0x08, 0x80, 0x08, 0x87, 0x80, 0x80, 0xd0, 0x08, 0x08, 0x08, 0x8f, 0x00, 0x08, 0x88,
+	0x0e, 0x08, 0x04, 0x08, 0x08, 0x88, 0x70, 0x00, 0x08, 0x08, 0x88, 0xb7, 0x80, 0x80, 0x80, 0x80,
+	0x80, 0x9f, 0x08, 0x08, 0x08, 0x08, 0x88, 0x00, 0x88, 0x00, 0x88, 0x70, 0x27, 0x80, 0x80, 0x80,
+	0x00, 0x00, 0x17, 0x00, 0x80, 0x08, 0x08, 0x08, 0x08, 0xf8, 0xcf, 0x80, 0x08, 0x08, 0x80, 0x08,
+	0x80, 0x08, 0x80, 0x08, 0x77, 0x04, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x08, 0xff,
+	0x8d, 0x80, 0x80, 0x80, 0x00, 0x88, 0x80, 0x80, 0x80, 0x70, 0x37, 0x80, 0x80, 0x80, 0x80, 0x80,
+	0x80, 0x80, 0x08, 0x08, 0xff, 0x8e, 0x80, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x78, 0x27,
+	0x80, 0x80, 0x80, 0x80, 0x00, 0x88, 0x00, 0x88, 0x80, 0xff, 0x8d, 0x00, 0x88, 0x00, 0x88, 0x00,
+	0x08, 0x08, 0x08, 0x77, 0x02, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x80, 0x08, 0x08, 0xff, 0x8e,
+	0x80, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x70, 0x7b, 0x03, 0x08, 0x08, 0x08, 0x08, 0xf8, 0x8d,
+	0x80, 0x80, 0x80, 0x80, 0x80, 0x57, 0x08, 0x08, 0x08, 0x08, 0x80, 0x08, 0xf0, 0xf3, 0xd3, 0x08,
+	0x80, 0x08, 0x80, 0x08, 0x80, 0x80, 0x08, 0x80, 0x67, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+	0x08, 0x80, 0xff, 0x09, 0x88, 0x00, 0x88, 0x00, 0x88, 0x80, 0x80, 0x80, 0x70, 0x37, 0x80, 0x80,
+	0x80, 0x80, 0x80, 0x80, 0x80, 0x08, 0xff, 0x8c, 0x80, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00,
+	0x77, 0x03, 0x08, 0x08, 0x08, 0x08, 0x88, 0x00, 0x88, 0xf0, 0xcf, 0x08, 0x08, 0x80, 0x08, 0x80,
+	0x08, 0x80, 0x08, 0x77, 0x02, 0x08, 0x08, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x80, 0x80, 0x80,
+	0x08, 0x08, 0x08, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
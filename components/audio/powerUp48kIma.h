@@ -0,0 +1,8 @@
+
+#include <stdint.h>
+
+#define POWERUP48KIMA_BITS_PER_SAMPLE 4
+#define POWERUP48KIMA_SAMPLE_RATE 48000
+#define POWERUP48KIMA_SAMPLES 60480
+
+extern const uint8_t powerUp48kIma[];
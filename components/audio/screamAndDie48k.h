@@ -5,4 +5,4 @@
 #define SCREAMANDDIE48K_SAMPLE_RATE 48000
 #define SCREAMANDDIE48K_SAMPLES 86158
 
-const uint8_t screamAndDie48k[];
+extern const uint8_t screamAndDie48k[];
@@ -0,0 +1,234 @@
+#include <stdlib.h> // NULL
+#include <stdbool.h>
+
+#include "driver/uart.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_rom_crc.h"
+
+#include "capture.h"
+
+#define TAG "capture"
+
+#define PORT UART_NUM_0
+#define TX_BUF_SZ 8192 // UART driver ring buffer
+#define RX_BUF_SZ 256
+#define HEADER_SZ 9
+#define CRC_SZ 4
+
+#define LIT_MAX 128
+#define REP_MAX 64
+#define ZERO_MAX 16384
+
+static uint16_t *prev; // last sent frame
+static size_t prev_len; // pixels in prev
+static bool key = true;
+static uint16_t seq;
+static bool ready;
+
+// Encoded frame being sent, handed to the UART as its TX ring has room
+static uint8_t *out;
+static size_t out_sz; // allocated bytes
+static size_t out_n, sent;
+
+// Bytes needed to encode len pixels, if none of them form runs
+static size_t capture_out_max(size_t len)
+{
+	return HEADER_SZ + 2*len + (len + LIT_MAX-1)/LIT_MAX + CRC_SZ;
+}
+
+// Allocate frame memory, in PSRAM if available.
+static void *capture_alloc(size_t size)
+{
+	void *p = heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+	if (p == NULL) p = heap_caps_malloc(size, MALLOC_CAP_8BIT);
+	return p;
+}
+
+// Give the UART as much of the encoded frame as fits in its TX ring,
+// so the call does not block.
+static void capture_send(void)
+{
+	size_t room = 0;
+	if (uart_get_tx_buffer_free_size(PORT, &room) != ESP_OK) return;
+	size_t n = out_n - sent;
+	if (n > room) n = room;
+	int w = n ? uart_write_bytes(PORT, out + sent, n) : 0;
+	if (w > 0) sent += w;
+}
+
+static inline void capture_pixel(uint16_t p)
+{
+	out[out_n++] = p;
+	out[out_n++] = p >> 8;
+}
+
+// Emit pending literal pixels lit[0..n-1].
+static void capture_literal(const uint16_t *lit, size_t n)
+{
+	while (n) {
+		size_t k = (n < LIT_MAX) ? n : LIT_MAX;
+		out[out_n++] = k-1;
+		for (size_t i = 0; i < k; i++) capture_pixel(lit[i]);
+		lit += k;
+		n -= k;
+	}
+}
+
+// Emit a run of n copies of pixel p.
+static void capture_run(uint16_t p, size_t n)
+{
+	while (n) {
+		if (p == 0) {
+			size_t k = (n < ZERO_MAX) ? n : ZERO_MAX;
+			out[out_n++] = 0xC0 | ((k-1) >> 8);
+			out[out_n++] = (k-1) & 0xFF;
+			n -= k;
+		} else {
+			size_t k = (n < REP_MAX) ? n : REP_MAX;
+			out[out_n++] = 0x80 | (k-1);
+			capture_pixel(p);
+			n -= k;
+		}
+	}
+}
+
+// Initialize capture on the console UART. Must be called before use.
+// The frame being sent and a copy of the last sent frame are kept (in
+// PSRAM if available). Without memory for the copy, every frame is sent
+// as a key frame.
+// baud: UART baud rate, e.g. 921600.
+// Return zero if successful, or non-zero otherwise.
+int32_t capture_init(uint32_t baud)
+{
+	if (ready) return 0;
+	if (!uart_is_driver_installed(PORT) &&
+		uart_driver_install(PORT, RX_BUF_SZ, TX_BUF_SZ, 0, NULL, 0) != ESP_OK) {
+		ESP_LOGE(TAG, "uart_driver_install fail");
+		return -1;
+	}
+	if (uart_set_baudrate(PORT, baud) != ESP_OK) {
+		ESP_LOGE(TAG, "uart_set_baudrate fail");
+		return -1;
+	}
+	key = true;
+	seq = 0;
+	ready = true;
+	return 0;
+}
+
+// Free resources used by capture.
+// Return zero if successful, or non-zero otherwise.
+int32_t capture_deinit(void)
+{
+	if (!ready) return -1;
+	if (prev != NULL) heap_caps_free(prev);
+	prev = NULL;
+	prev_len = 0;
+	if (out != NULL) heap_caps_free(out);
+	out = NULL;
+	out_sz = out_n = sent = 0;
+	ready = false;
+	return 0;
+}
+
+// Send the next frame as a key frame.
+void capture_key(void)
+{
+	key = true;
+}
+
+// Encode the current frame buffer contents and start sending them, unless
+// the previous frame is still being sent. Call before or after
+// lcdWriteFrame(), once per frame: each call only hands the UART what its
+// TX ring has room for, and the rest of the frame goes on the next calls.
+// Return the size of the frame in bytes, zero if the frame was skipped,
+// or negative on error.
+int32_t capture_frame(TFT_t *dev)
+{
+	if (!ready || !dev->_use_frame_buffer) return -1;
+	if (sent < out_n) { // still sending
+		capture_send();
+		return 0;
+	}
+
+	size_t len = dev->_width*dev->_height;
+	if (out_sz < capture_out_max(len)) {
+		if (out != NULL) heap_caps_free(out);
+		out_sz = capture_out_max(len);
+		out = capture_alloc(out_sz);
+		if (out == NULL) {
+			ESP_LOGE(TAG, "no memory for %u byte frames", (unsigned)out_sz);
+			out_sz = 0;
+			return -1;
+		}
+	}
+	if (prev_len != len) { // first frame or new size
+		if (prev != NULL) heap_caps_free(prev);
+		prev = capture_alloc(len*sizeof(uint16_t));
+		if (prev == NULL) ESP_LOGW(TAG, "no memory for deltas, sending key frames");
+		prev_len = (prev != NULL) ? len : 0;
+		key = true;
+	}
+	if (prev == NULL || seq % CAPTURE_KEY_INTERVAL == 0) key = true;
+
+	// Header
+	out_n = sent = 0;
+	out[out_n++] = 0xA5;
+	out[out_n++] = 0x5A;
+	out[out_n++] = key ? 'K' : 'D';
+	out[out_n++] = seq;
+	out[out_n++] = seq >> 8;
+	out[out_n++] = dev->_width;
+	out[out_n++] = dev->_width >> 8;
+	out[out_n++] = dev->_height;
+	out[out_n++] = dev->_height >> 8;
+
+	// Payload: the XOR difference, run-length encoded. prev is updated
+	// to the current frame along the way.
+	const uint16_t *cur = dev->_frame_buffer;
+	uint16_t lit[LIT_MAX];
+	size_t nlit = 0;
+	for (size_t i = 0; i < len; ) {
+		uint16_t d = cur[i];
+		if (!key) d ^= prev[i];
+		if (prev != NULL) prev[i] = cur[i];
+
+		// Measure the run starting here
+		size_t n = 1;
+		while (i+n < len) {
+			uint16_t e = cur[i+n];
+			if (!key) e ^= prev[i+n];
+			if (e != d) break;
+			if (prev != NULL) prev[i+n] = cur[i+n];
+			n++;
+		}
+		if (n >= 3 || (d == 0 && n >= 2)) {
+			capture_literal(lit, nlit);
+			nlit = 0;
+			capture_run(d, n);
+		} else {
+			for (size_t k = 0; k < n; k++) {
+				lit[nlit++] = d;
+				if (nlit == LIT_MAX) {
+					capture_literal(lit, nlit);
+					nlit = 0;
+				}
+			}
+		}
+		i += n;
+	}
+	capture_literal(lit, nlit);
+
+	// Trailer
+	uint32_t crc = esp_rom_crc32_le(0, out + HEADER_SZ, out_n - HEADER_SZ);
+	out[out_n++] = crc;
+	out[out_n++] = crc >> 8;
+	out[out_n++] = crc >> 16;
+	out[out_n++] = crc >> 24;
+
+	key = false;
+	seq++;
+	capture_send();
+	return out_n;
+}
@@ -0,0 +1,54 @@
+#ifndef CAPTURE_H_
+#define CAPTURE_H_
+
+#include <stdint.h>
+
+#include "lcd.h"
+
+// This component streams screen captures over the serial console.
+// Each frame is XORed with the previously sent frame, so unchanged
+// pixels become zero, and the result is run-length encoded. Frames are
+// sent in a framed binary format that the host script capture_rx.py
+// decodes into an animated capture. The frame buffer must be enabled.
+//
+// Frame format (multi-byte fields little-endian):
+//   sync    2 bytes  0xA5 0x5A
+//   type    1 byte   'K' key frame (XOR with zero), 'D' delta frame
+//   seq     2 bytes  frame sequence number
+//   width   2 bytes
+//   height  2 bytes
+//   payload          RLE tokens, until width*height pixels are decoded
+//   crc     4 bytes  CRC-32 of the payload
+// RLE tokens (pixels are 16-bit little-endian):
+//   0x00-0x7F        literal: n = t+1 pixels follow
+//   0x80-0xBF        repeat: next pixel n = (t&0x3F)+1 times
+//   0xC0-0xFF, b     zero run: n = ((t&0x3F)<<8 | b)+1 zero pixels
+//
+// Text logged on the same UART is skipped by the host between frames.
+
+#define CAPTURE_KEY_INTERVAL 64 // Frames between key frames
+
+// Initialize capture on the console UART. Must be called before use.
+// The frame being sent and a copy of the last sent frame are kept (in
+// PSRAM if available). Without memory for the copy, every frame is sent
+// as a key frame.
+// baud: UART baud rate, e.g. 921600.
+// Return zero if successful, or non-zero otherwise.
+int32_t capture_init(uint32_t baud);
+
+// Free resources used by capture.
+// Return zero if successful, or non-zero otherwise.
+int32_t capture_deinit(void);
+
+// Encode the current frame buffer contents and start sending them, unless
+// the previous frame is still being sent. Call before or after
+// lcdWriteFrame(), once per frame: each call only hands the UART what its
+// TX ring has room for, and the rest of the frame goes on the next calls.
+// Return the size of the frame in bytes, zero if the frame was skipped,
+// or negative on error.
+int32_t capture_frame(TFT_t *dev);
+
+// Send the next frame as a key frame.
+void capture_key(void);
+
+#endif /* CAPTURE_H_ */
@@ -0,0 +1,170 @@
+#!/usr/bin/python3
+
+"""
+Receive screen captures sent by the capture component and reconstruct
+the frames. Reads from a serial port (needs pyserial) or from a file
+holding a raw dump of the serial output. Frames are written as an
+animated GIF if Pillow is installed, otherwise as numbered PPM files.
+
+Examples:
+    ./capture_rx.py /dev/ttyUSB0 -b 921600 -n 100 -o capture.gif
+    ./capture_rx.py dump.bin -o frames/
+"""
+
+import argparse
+import pathlib
+import struct
+import sys
+import time
+import zlib
+
+SYNC = b"\xA5\x5A"
+HEADER = struct.Struct("<2scHHH")  # sync, type, seq, width, height
+
+
+class Reader:
+    """Byte reader over a serial port or file, with a small lookahead."""
+
+    def __init__(self, stream):
+        self.stream = stream
+        self.buf = bytearray()
+
+    def read(self, n):
+        while len(self.buf) < n:
+            data = self.stream.read(max(n - len(self.buf), 4096))
+            if not data:
+                raise EOFError
+            self.buf += data
+        out = bytes(self.buf[:n])
+        del self.buf[:n]
+        return out
+
+    def sync(self):
+        """Skip console text until the frame sync bytes."""
+        prev = b""
+        while True:
+            b = self.read(1)
+            if prev + b == SYNC:
+                return
+            prev = b
+
+
+class Payload:
+    """Wrap a reader and keep the payload bytes for the CRC check."""
+
+    def __init__(self, reader):
+        self.reader = reader
+        self.data = bytearray()
+
+    def read(self, n):
+        b = self.reader.read(n)
+        self.data += b
+        return b
+
+
+def decode(payload, count):
+    """Decode RLE tokens into a list of count 16-bit pixels."""
+    pix = []
+    while len(pix) < count:
+        t = payload.read(1)[0]
+        if t < 0x80:
+            n = t + 1
+            pix.extend(struct.unpack("<%dH" % n, payload.read(2 * n)))
+        elif t < 0xC0:
+            (p,) = struct.unpack("<H", payload.read(2))
+            pix.extend([p] * ((t & 0x3F) + 1))
+        else:
+            n = ((t & 0x3F) << 8 | payload.read(1)[0]) + 1
+            pix.extend([0] * n)
+    if len(pix) != count:
+        raise ValueError("payload overruns frame")
+    return pix
+
+
+def to_rgb(pix):
+    """Convert RGB565 pixels to packed 8-bit RGB bytes."""
+    out = bytearray(3 * len(pix))
+    for i, p in enumerate(pix):
+        r, g, b = p >> 11, (p >> 5) & 0x3F, p & 0x1F
+        out[3 * i] = (r << 3) | (r >> 2)
+        out[3 * i + 1] = (g << 2) | (g >> 4)
+        out[3 * i + 2] = (b << 3) | (b >> 2)
+    return bytes(out)
+
+
+def frames(reader):
+    """Yield (seq, width, height, pixels, payload bytes) for each good frame."""
+    screen = None
+    while True:
+        reader.sync()
+        _, kind, seq, width, height = HEADER.unpack(SYNC + reader.read(HEADER.size - 2))
+        if kind not in (b"K", b"D") or width == 0 or height == 0:
+            continue
+        payload = Payload(reader)
+        try:
+            diff = decode(payload, width * height)
+        except ValueError:
+            continue
+        (crc,) = struct.unpack("<I", reader.read(4))
+        if crc != zlib.crc32(payload.data):
+            print("frame %d: bad CRC, waiting for key frame" % seq, file=sys.stderr)
+            screen = None
+            continue
+        if kind == b"K":
+            screen = diff
+        elif screen is None or len(screen) != len(diff):
+            continue  # no key frame yet
+        else:
+            screen = [a ^ b for a, b in zip(screen, diff)]
+        yield seq, width, height, screen, len(payload.data)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("source", help="serial port or raw dump file")
+    parser.add_argument("-b", "--baud", type=int, default=921600)
+    parser.add_argument("-n", "--frames", type=int, default=0, help="stop after this many frames")
+    parser.add_argument("-o", "--output", default="capture.gif", help="GIF file, or directory for PPM files")
+    args = parser.parse_args()
+
+    if pathlib.Path(args.source).is_file():
+        stream = open(args.source, "rb")
+    else:
+        import serial  # pylint: disable=import-outside-toplevel
+
+        stream = serial.Serial(args.source, args.baud, timeout=1)
+
+    try:
+        from PIL import Image  # pylint: disable=import-outside-toplevel
+    except ImportError:
+        Image = None
+
+    images, times = [], []
+    count, start = 0, time.time()
+    try:
+        for seq, width, height, screen, size in frames(Reader(stream)):
+            rgb = to_rgb(screen)
+            times.append(time.time())
+            if Image is not None and not args.output.endswith("/"):
+                images.append(Image.frombytes("RGB", (width, height), rgb))
+            else:
+                out = pathlib.Path(args.output)
+                out.mkdir(parents=True, exist_ok=True)
+                with open(out / ("frame%05d.ppm" % count), "wb") as f:
+                    f.write(b"P6 %d %d 255\n" % (width, height) + rgb)
+            count += 1
+            print("frame %d seq %d payload %d bytes" % (count, seq, size))
+            if args.frames and count >= args.frames:
+                break
+    except (EOFError, KeyboardInterrupt):
+        pass
+
+    if count:
+        print("%d frames, %.1f fps" % (count, count / max(time.time() - start, 1e-6)))
+    if images:
+        durations = [max(int(1000 * (b - a)), 20) for a, b in zip(times, times[1:] + times[-1:])]
+        images[0].save(args.output, save_all=True, append_images=images[1:], duration=durations, loop=0)
+
+
+if __name__ == "__main__":
+    main()
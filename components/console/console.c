@@ -0,0 +1,184 @@
+#include <stdio.h> // vsnprintf
+#include <stdarg.h>
+#include <string.h> // memcpy
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
+#include "console.h"
+
+#define PRINT_MAX 160 // Maximum characters per console_printf()
+#define LINE_H LCD_CHAR_H // Pixel rows per text row
+
+// Mutex protected ring buffer of lines. Line i is kept in slot i%CONSOLE_ROWS,
+// which is also the text row it occupies in display memory.
+static SemaphoreHandle_t mutex;
+static char text[CONSOLE_ROWS][CONSOLE_COLS];
+static uint8_t tlen[CONSOLE_ROWS];
+static bool dirty[CONSOLE_ROWS];
+static uint32_t head; // Line being written
+static bool reset; // Clear requested
+
+// Only used by console_update()
+static TFT_t *lcd;
+static TFT_t canvas;
+static uint16_t line_buf[LINE_H*LCD_W];
+static char dtext[CONSOLE_ROWS][CONSOLE_COLS];
+static uint8_t dlen[CONSOLE_ROWS];
+static bool ddirty[CONSOLE_ROWS];
+static uint32_t top; // Line shown at the top of the screen
+static uint16_t fg_color, bg_color;
+static TickType_t period, last;
+
+// Append a character to the ring buffer. Called with the mutex held.
+static void console_putc(char c)
+{
+	uint32_t slot = head % CONSOLE_ROWS;
+	if (c == '\r') {
+		tlen[slot] = 0;
+		dirty[slot] = true;
+		return;
+	}
+	if (c == '\n' || tlen[slot] == CONSOLE_COLS) {
+		head++;
+		slot = head % CONSOLE_ROWS;
+		tlen[slot] = 0;
+		dirty[slot] = true;
+		if (c == '\n') return;
+	}
+	text[slot][tlen[slot]++] = c;
+	dirty[slot] = true;
+}
+
+// Draw the lines in slots s1 to s2 with one window write.
+static void console_draw_slots(uint32_t s1, uint32_t s2)
+{
+	lcdBeginWindow(lcd, 0, s1*LINE_H, LCD_W-1, (s2+1)*LINE_H-1);
+	for (uint32_t s = s1; s <= s2; s++) {
+		lcdFillScreen(&canvas, bg_color);
+		int32_t x = 0;
+		for (uint32_t i = 0; i < dlen[s]; i++)
+			x = lcdDrawChar(&canvas, x, 0, dtext[s][i], fg_color);
+		lcdPushPixels(lcd, line_buf, LINE_H*LCD_W);
+	}
+	lcdEndWindow(lcd);
+}
+
+// Initialize the console and clear the screen. Must be called before use.
+// dev: display device, already initialized with lcdInit().
+// per: minimum period in milliseconds between screen updates. Calls to
+// console_update() sooner than this return without drawing.
+// Return zero if successful, or non-zero otherwise.
+int32_t console_init(TFT_t *dev, uint32_t per)
+{
+	if (dev == NULL || dev->_use_frame_buffer) return -1;
+	if (mutex == NULL) mutex = xSemaphoreCreateMutex();
+	if (mutex == NULL) return -1;
+	lcd = dev;
+	lcdCanvasInit(&canvas, line_buf, LCD_W, LINE_H);
+	fg_color = WHITE;
+	bg_color = BLACK;
+	period = pdMS_TO_TICKS(per);
+	last = xTaskGetTickCount() - period;
+
+	// Scroll the text rows, keep any leftover rows at the bottom fixed
+	lcdScrollArea(lcd, 0, CONSOLE_ROWS*LINE_H, LCD_H-CONSOLE_ROWS*LINE_H);
+	lcdFillScreen(lcd, bg_color);
+	console_clear();
+	return 0;
+}
+
+// Free resources used by the console and reset the display scroll.
+// Return zero if successful, or non-zero otherwise.
+int32_t console_deinit(void)
+{
+	if (lcd == NULL) return -1;
+	lcdScrollArea(lcd, 0, LCD_H, 0);
+	lcdScrollStart(lcd, 0);
+	lcd = NULL;
+	return 0;
+}
+
+// Set the text colors. Applies to lines drawn afterward.
+// fg: foreground color.
+// bg: background color.
+void console_set_color(uint16_t fg, uint16_t bg)
+{
+	fg_color = fg;
+	bg_color = bg;
+}
+
+// Write formatted text to the console. Long lines wrap.
+// Safe to call from any task, but not from an ISR. Text written before
+// console_init() is dropped.
+// Return the number of characters written.
+int32_t console_printf(const char *fmt, ...)
+{
+	char str[PRINT_MAX];
+	va_list args;
+
+	if (mutex == NULL) return 0;
+	va_start(args, fmt);
+	int32_t n = vsnprintf(str, sizeof(str), fmt, args);
+	va_end(args);
+	if (n < 0) return n;
+	if (n >= sizeof(str)) n = sizeof(str)-1;
+
+	xSemaphoreTake(mutex, portMAX_DELAY);
+	for (int32_t i = 0; i < n; i++) console_putc(str[i]);
+	xSemaphoreGive(mutex);
+	return n;
+}
+
+// Clear the console.
+void console_clear(void)
+{
+	if (mutex == NULL) return;
+	xSemaphoreTake(mutex, portMAX_DELAY);
+	head = 0;
+	memset(tlen, 0, sizeof(tlen));
+	memset(dirty, 0, sizeof(dirty));
+	reset = true;
+	xSemaphoreGive(mutex);
+}
+
+// Draw pending console output. Call periodically, e.g. once per frame,
+// from the task that owns the display.
+void console_update(void)
+{
+	if (lcd == NULL) return;
+	TickType_t now = xTaskGetTickCount();
+	if (now - last < period) return;
+	last = now;
+
+	// Take a snapshot of the changed lines
+	xSemaphoreTake(mutex, portMAX_DELAY);
+	bool clear = reset;
+	uint32_t ntop = (head >= CONSOLE_ROWS) ? head - CONSOLE_ROWS + 1 : 0;
+	for (uint32_t s = 0; s < CONSOLE_ROWS; s++) {
+		ddirty[s] = dirty[s] || clear;
+		if (ddirty[s]) {
+			dlen[s] = tlen[s];
+			memcpy(dtext[s], text[s], tlen[s]);
+		}
+		dirty[s] = false;
+	}
+	reset = false;
+	xSemaphoreGive(mutex);
+
+	// Scroll first, so reused rows appear at the bottom before redrawing
+	if (clear || ntop != top) {
+		top = ntop;
+		lcdScrollStart(lcd, (top % CONSOLE_ROWS) * LINE_H);
+	}
+
+	// Redraw each run of adjacent changed rows with one window write
+	for (uint32_t s1 = 0; s1 < CONSOLE_ROWS; s1++) {
+		if (!ddirty[s1]) continue;
+		uint32_t s2 = s1;
+		while (s2+1 < CONSOLE_ROWS && ddirty[s2+1]) s2++;
+		console_draw_slots(s1, s2);
+		s1 = s2;
+	}
+}
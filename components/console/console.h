@@ -0,0 +1,48 @@
+#ifndef CONSOLE_H_
+#define CONSOLE_H_
+
+#include <stdint.h>
+
+#include "lcd.h"
+
+// This component is a scrolling text console on the display. Text written
+// with console_printf() is kept in a ring buffer of lines, one line per text
+// row on the screen. Nothing is drawn until console_update() is called, which
+// draws only the new or changed lines and scrolls with the panel's vertical
+// scroll registers. A burst of output therefore costs one partial update.
+// The console draws in direct mode (no frame buffer) and owns the whole
+// screen while in use.
+
+#define CONSOLE_ROWS (LCD_H/LCD_CHAR_H) // Text rows on screen
+#define CONSOLE_COLS (LCD_W/LCD_CHAR_W) // Characters per row
+
+// Initialize the console and clear the screen. Must be called before use.
+// dev: display device, already initialized with lcdInit().
+// per: minimum period in milliseconds between screen updates. Calls to
+// console_update() sooner than this return without drawing.
+// Return zero if successful, or non-zero otherwise.
+int32_t console_init(TFT_t *dev, uint32_t per);
+
+// Free resources used by the console and reset the display scroll.
+// Return zero if successful, or non-zero otherwise.
+int32_t console_deinit(void);
+
+// Set the text colors. Applies to lines drawn afterward.
+// fg: foreground color.
+// bg: background color.
+void console_set_color(uint16_t fg, uint16_t bg);
+
+// Write formatted text to the console. Long lines wrap.
+// Safe to call from any task, but not from an ISR. Text written before
+// console_init() is dropped.
+// Return the number of characters written.
+int32_t console_printf(const char *fmt, ...) __attribute__((format(printf, 1, 2)));
+
+// Clear the console.
+void console_clear(void);
+
+// Draw pending console output. Call periodically, e.g. once per frame,
+// from the task that owns the display.
+void console_update(void);
+
+#endif /* CONSOLE_H_ */
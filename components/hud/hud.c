@@ -0,0 +1,190 @@
+#include <stdio.h> // snprintf
+#include <inttypes.h> // PRIu32
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_freertos_hooks.h"
+#include "esp_heap_caps.h"
+#include "esp_rom_sys.h"
+#include "esp_timer.h"
+
+#include "hud.h"
+
+#define GRAPH_Y (HUD_H-16) // Top row of the graph
+#define GRAPH_H 16 // Graph height in pixels
+#define TEXT_COLOR rgb565(255, 255, 255)
+#define BACK_COLOR rgb565(  0,   0,  64)
+#define GRAPH_COLOR rgb565(  0, 255,   0)
+#define SLOW_COLOR rgb565(255,   0,   0)
+#define LINE_COLOR rgb565(128, 128, 128)
+#define CAL_MS 50 // Idle time to calibrate the idle count rate
+
+static TFT_t *lcd;
+static TFT_t canvas;
+static uint16_t hud_buf[HUD_W*HUD_H];
+static int32_t hud_x, hud_y;
+static int64_t period;
+
+// Frame time history, one entry per graph column
+static uint32_t ftime[HUD_W];
+static uint32_t fidx;
+static int64_t last_frame, last_draw;
+static uint32_t frames;
+static uint32_t cost_max; // Overlay cost in microseconds
+
+// Idle hook counts per core. The CPU load is estimated from the idle count
+// rate relative to that of an idle core, per MHz of CPU clock so a clock
+// change does not read as load. The idle rate is measured by hud_init()
+// and raised to the highest rate seen after, in case a core was busy then.
+static volatile uint32_t idle_cnt[portNUM_PROCESSORS];
+static uint32_t idle_last[portNUM_PROCESSORS];
+static uint32_t idle_max[portNUM_PROCESSORS]; // counts per second per MHz
+
+static bool hud_idle0(void) {idle_cnt[0]++; return false;}
+#if portNUM_PROCESSORS > 1
+static bool hud_idle1(void) {idle_cnt[1]++; return false;}
+#endif
+
+static const esp_freertos_idle_cb_t idle_hook[portNUM_PROCESSORS] = {
+	hud_idle0,
+#if portNUM_PROCESSORS > 1
+	hud_idle1,
+#endif
+};
+
+// Redraw the statistics into the overlay buffer.
+// now: current time in microseconds.
+static void hud_draw(int64_t now)
+{
+	char str[24];
+	int64_t elapsed = now - last_draw;
+	if (elapsed <= 0) elapsed = 1;
+	uint32_t fps10 = frames * 10000000LL / elapsed; // tenths of FPS
+	uint32_t ft = ftime[(fidx+HUD_W-1) % HUD_W];
+
+	lcdFillScreen(&canvas, BACK_COLOR);
+	snprintf(str, sizeof(str), "FPS%3"PRIu32".%"PRIu32" %2"PRIu32".%"PRIu32"ms",
+		fps10/10, fps10%10, ft/1000, ft%1000/100);
+	lcdDrawString(&canvas, 0, 0, str, TEXT_COLOR);
+
+	snprintf(str, sizeof(str), "CPU");
+	int32_t x = lcdDrawString(&canvas, 0, LCD_CHAR_H, str, TEXT_COLOR);
+	uint32_t mhz = esp_rom_get_cpu_ticks_per_us();
+	for (uint32_t c = 0; c < portNUM_PROCESSORS; c++) {
+		uint32_t cnt = idle_cnt[c];
+		uint32_t rate = (cnt - idle_last[c]) * 1000000LL / elapsed / mhz;
+		idle_last[c] = cnt;
+		if (rate > idle_max[c]) idle_max[c] = rate;
+		uint32_t load = idle_max[c] ? 100 - rate * 100 / idle_max[c] : 0;
+		snprintf(str, sizeof(str), "%4"PRIu32"%%", load);
+		x = lcdDrawString(&canvas, x, LCD_CHAR_H, str, TEXT_COLOR);
+	}
+
+	snprintf(str, sizeof(str), "HEAP %"PRIu32,
+		(uint32_t)heap_caps_get_free_size(MALLOC_CAP_DEFAULT));
+	lcdDrawString(&canvas, 0, 2*LCD_CHAR_H, str, TEXT_COLOR);
+
+	snprintf(str, sizeof(str), "HUD %"PRIu32"us", cost_max);
+	lcdDrawString(&canvas, 0, 3*LCD_CHAR_H, str, TEXT_COLOR);
+
+	// Graph of frame times, oldest on the left
+	for (uint32_t i = 0; i < HUD_W; i++) {
+		uint32_t t = ftime[(fidx+i) % HUD_W];
+		int32_t h = t * GRAPH_H / (HUD_GRAPH_MS*1000);
+		if (h > GRAPH_H) h = GRAPH_H;
+		if (h) lcdDrawVLine(&canvas, i, HUD_H-h, h,
+			h == GRAPH_H ? SLOW_COLOR : GRAPH_COLOR);
+	}
+	lcdDrawHLine(&canvas, 0, GRAPH_Y, HUD_W, LINE_COLOR);
+
+	frames = 0;
+	cost_max = 0;
+	last_draw = now;
+}
+
+// Measure the idle count rate of each core while the calling task sleeps.
+static void hud_calibrate(void)
+{
+	uint32_t cnt[portNUM_PROCESSORS];
+
+	for (uint32_t c = 0; c < portNUM_PROCESSORS; c++) cnt[c] = idle_cnt[c];
+	int64_t t0 = esp_timer_get_time();
+	vTaskDelay(pdMS_TO_TICKS(CAL_MS) + 1);
+	int64_t elapsed = esp_timer_get_time() - t0;
+	uint32_t mhz = esp_rom_get_cpu_ticks_per_us();
+	for (uint32_t c = 0; c < portNUM_PROCESSORS; c++) {
+		idle_last[c] = idle_cnt[c];
+		idle_max[c] = (idle_last[c] - cnt[c]) * 1000000LL / elapsed / mhz;
+	}
+}
+
+// Initialize the overlay. Must be called before use. Blocks for about
+// 50 ms to measure the rate of an idle core, so call it while the other
+// tasks are idle.
+// dev: display device, already initialized with lcdInit().
+// corner: corner of the screen used by the overlay.
+// per: period in milliseconds between overlay redraws.
+// Return zero if successful, or non-zero otherwise.
+int32_t hud_init(TFT_t *dev, hud_corner_t corner, uint32_t per)
+{
+	if (dev == NULL) return -1;
+	if (lcd == NULL) {
+		for (uint32_t c = 0; c < portNUM_PROCESSORS; c++)
+			if (esp_register_freertos_idle_hook_for_cpu(idle_hook[c], c) != ESP_OK)
+				return -1;
+	}
+	hud_calibrate();
+	lcd = dev;
+	lcdCanvasInit(&canvas, hud_buf, HUD_W, HUD_H);
+	lcdFillScreen(&canvas, BACK_COLOR);
+	hud_x = (corner == HUD_TOP_RIGHT || corner == HUD_BOTTOM_RIGHT) ? dev->_width-HUD_W : 0;
+	hud_y = (corner == HUD_BOTTOM_LEFT || corner == HUD_BOTTOM_RIGHT) ? dev->_height-HUD_H : 0;
+	period = (int64_t)per * 1000;
+	for (uint32_t i = 0; i < HUD_W; i++) ftime[i] = 0;
+	fidx = 0;
+	frames = 0;
+	cost_max = 0;
+	last_frame = last_draw = esp_timer_get_time();
+	return 0;
+}
+
+// Free resources used by the overlay (idle hooks).
+// Return zero if successful, or non-zero otherwise.
+int32_t hud_deinit(void)
+{
+	if (lcd == NULL) return -1;
+	for (uint32_t c = 0; c < portNUM_PROCESSORS; c++)
+		esp_deregister_freertos_idle_hook_for_cpu(idle_hook[c], c);
+	lcd = NULL;
+	return 0;
+}
+
+// Mark the end of a frame and update the overlay.
+// In frame buffer mode, call after drawing the frame and before
+// lcdWriteFrame(), since the overlay is copied into the frame buffer
+// every frame. In direct mode, the overlay region is written to the
+// display only when it is redrawn.
+void hud_frame(void)
+{
+	if (lcd == NULL) return;
+	int64_t now = esp_timer_get_time();
+	ftime[fidx] = now - last_frame;
+	fidx = (fidx+1) % HUD_W;
+	last_frame = now;
+	frames++;
+
+	bool draw = (now - last_draw >= period);
+	if (draw) hud_draw(now);
+
+	if (lcd->_use_frame_buffer) {
+		for (int32_t y = 0; y < HUD_H; y++)
+			lcdDrawMultiPixels(lcd, hud_x, hud_y+y, HUD_W, hud_buf+y*HUD_W);
+	} else if (draw) {
+		lcdBeginWindow(lcd, hud_x, hud_y, hud_x+HUD_W-1, hud_y+HUD_H-1);
+		lcdPushPixels(lcd, hud_buf, HUD_W*HUD_H);
+		lcdEndWindow(lcd);
+	}
+
+	uint32_t cost = esp_timer_get_time() - now;
+	if (cost > cost_max) cost_max = cost;
+}
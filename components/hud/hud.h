@@ -0,0 +1,48 @@
+#ifndef HUD_H_
+#define HUD_H_
+
+#include <stdint.h>
+
+#include "lcd.h"
+
+// This component is a performance overlay drawn in a corner of the display.
+// It shows the frame rate, the last frame time and a graph of recent frame
+// times, the CPU load of each core, the free heap, and its own cost.
+// Call hud_frame() once per frame. The statistics are redrawn on a fixed
+// period into a small private buffer, and only the overlay region is
+// written to the display.
+
+#define HUD_W 96 // Overlay width in pixels
+#define HUD_H 48 // Overlay height in pixels
+
+// Frame time at the top of the graph in milliseconds
+#define HUD_GRAPH_MS 40
+
+typedef enum {
+	HUD_TOP_LEFT,
+	HUD_TOP_RIGHT,
+	HUD_BOTTOM_LEFT,
+	HUD_BOTTOM_RIGHT,
+} hud_corner_t;
+
+// Initialize the overlay. Must be called before use. Blocks for about
+// 50 ms to measure the rate of an idle core, so call it while the other
+// tasks are idle.
+// dev: display device, already initialized with lcdInit().
+// corner: corner of the screen used by the overlay.
+// per: period in milliseconds between overlay redraws.
+// Return zero if successful, or non-zero otherwise.
+int32_t hud_init(TFT_t *dev, hud_corner_t corner, uint32_t per);
+
+// Free resources used by the overlay (idle hooks).
+// Return zero if successful, or non-zero otherwise.
+int32_t hud_deinit(void);
+
+// Mark the end of a frame and update the overlay.
+// In frame buffer mode, call after drawing the frame and before
+// lcdWriteFrame(), since the overlay is copied into the frame buffer
+// every frame. In direct mode, the overlay region is written to the
+// display only when it is redrawn.
+void hud_frame(void);
+
+#endif /* HUD_H_ */
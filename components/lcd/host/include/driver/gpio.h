@@ -0,0 +1,15 @@
+// Host build: output levels are kept for the panels (see sim_spi.c).
+#ifndef GPIO_H_
+#define GPIO_H_
+
+#include <stdint.h>
+#include "esp_err.h"
+
+typedef int gpio_num_t;
+typedef enum {GPIO_MODE_INPUT, GPIO_MODE_OUTPUT} gpio_mode_t;
+
+esp_err_t gpio_reset_pin(gpio_num_t pin);
+esp_err_t gpio_set_direction(gpio_num_t pin, gpio_mode_t mode);
+esp_err_t gpio_set_level(gpio_num_t pin, uint32_t level);
+
+#endif /* GPIO_H_ */
@@ -0,0 +1,65 @@
+// Host build: a bus of simulated panels, see sim_spi.c.
+#ifndef SPI_MASTER_H_
+#define SPI_MASTER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+
+typedef enum {SPI1_HOST, SPI2_HOST, SPI3_HOST} spi_host_device_t;
+
+#define SPI_DMA_CH_AUTO 3
+#define SPI_MASTER_FREQ_40M (80 * 1000 * 1000 / 2)
+#define SPI_DEVICE_NO_DUMMY (1<<6)
+
+#define SPI_TRANS_USE_RXDATA (1<<2)
+#define SPI_TRANS_USE_TXDATA (1<<3)
+#define SPI_TRANS_CS_KEEP_ACTIVE (1<<8)
+
+typedef struct {
+	int mosi_io_num;
+	int miso_io_num;
+	int sclk_io_num;
+	int quadwp_io_num;
+	int quadhd_io_num;
+	int max_transfer_sz;
+	uint32_t flags;
+} spi_bus_config_t;
+
+typedef struct {
+	uint8_t mode;
+	int clock_speed_hz;
+	int spics_io_num;
+	uint32_t flags;
+	int queue_size;
+} spi_device_interface_config_t;
+
+typedef struct {
+	uint32_t flags;
+	size_t length; // bits
+	size_t rxlength; // bits
+	void *user;
+	union {
+		const void *tx_buffer;
+		uint8_t tx_data[4];
+	};
+	union {
+		void *rx_buffer;
+		uint8_t rx_data[4];
+	};
+} spi_transaction_t;
+
+typedef struct spi_device_t *spi_device_handle_t;
+
+esp_err_t spi_bus_initialize(spi_host_device_t host, const spi_bus_config_t *cfg, int dma);
+esp_err_t spi_bus_add_device(spi_host_device_t host, const spi_device_interface_config_t *cfg, spi_device_handle_t *handle);
+esp_err_t spi_bus_remove_device(spi_device_handle_t handle);
+esp_err_t spi_device_queue_trans(spi_device_handle_t handle, spi_transaction_t *trans, TickType_t wait);
+esp_err_t spi_device_get_trans_result(spi_device_handle_t handle, spi_transaction_t **trans, TickType_t wait);
+esp_err_t spi_device_transmit(spi_device_handle_t handle, spi_transaction_t *trans);
+esp_err_t spi_device_polling_transmit(spi_device_handle_t handle, spi_transaction_t *trans);
+esp_err_t spi_device_acquire_bus(spi_device_handle_t handle, TickType_t wait);
+void spi_device_release_bus(spi_device_handle_t handle);
+
+#endif /* SPI_MASTER_H_ */
@@ -0,0 +1,14 @@
+#ifndef ESP_ERR_H_
+#define ESP_ERR_H_
+
+#include <assert.h>
+
+typedef int esp_err_t;
+
+#define ESP_OK 0
+#define ESP_FAIL -1
+#define ESP_ERR_INVALID_ARG 0x102
+#define ESP_ERR_INVALID_STATE 0x103
+#define ESP_ERR_TIMEOUT 0x107
+
+#endif /* ESP_ERR_H_ */
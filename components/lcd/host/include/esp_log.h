@@ -0,0 +1,17 @@
+// Host build: log to stderr, keeping stdout for results.
+#ifndef ESP_LOG_H_
+#define ESP_LOG_H_
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#define ESP_LOG_HOST(l, tag, fmt, ...) \
+	fprintf(stderr, l " (%s) " fmt "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGE(tag, fmt, ...) ESP_LOG_HOST("E", tag, fmt, ##__VA_ARGS__)
+#define ESP_LOGW(tag, fmt, ...) ESP_LOG_HOST("W", tag, fmt, ##__VA_ARGS__)
+#define ESP_LOGI(tag, fmt, ...) do {if (sim_verbose) ESP_LOG_HOST("I", tag, fmt, ##__VA_ARGS__);} while (0)
+#define ESP_LOGD(tag, fmt, ...) do {} while (0)
+
+extern int sim_verbose;
+
+#endif /* ESP_LOG_H_ */
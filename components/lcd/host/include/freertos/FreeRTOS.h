@@ -0,0 +1,16 @@
+// Host build: the subset of FreeRTOS used by the lcd component.
+#ifndef FREERTOS_H_
+#define FREERTOS_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+
+#define configTICK_RATE_HZ 100
+#define portTICK_PERIOD_MS ((TickType_t)(1000 / configTICK_RATE_HZ))
+#define portMAX_DELAY 0xFFFFFFFFU
+
+#endif /* FREERTOS_H_ */
@@ -0,0 +1,9 @@
+// Host build: there is one task, delays return at once.
+#ifndef TASK_H_
+#define TASK_H_
+
+#include "freertos/FreeRTOS.h"
+
+static inline void vTaskDelay(TickType_t ticks) {}
+
+#endif /* TASK_H_ */
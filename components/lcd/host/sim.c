@@ -0,0 +1,276 @@
+// Host simulator for the lcd component. Runs lcd.c against simulated
+// panels on a SPI bus (sim_spi.c) and checks what reaches their GRAM,
+// for reads and for several panels sharing the bus.
+//
+// Usage:
+//   lcd_sim test
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lcd.h"
+#include "sim.h"
+
+#define CS0 5
+#define DC0 4
+#define CS1 15
+#define DC1 2
+
+static TFT_t dev0, dev1;
+static uint32_t failed;
+
+static void check(bool ok, const char *name, const char *fmt, double val)
+{
+	printf("%-28s %s  ", name, ok ? "pass" : "FAIL");
+	printf(fmt, val);
+	printf("\n");
+	if (!ok) failed++;
+}
+
+// A color that differs between neighbouring pixels and between rows
+static uint16_t pattern(int32_t x, int32_t y, uint32_t seed)
+{
+	uint32_t v = (x * 0x9E37U + y * 0x85EBU + seed) * 0x2545F491U;
+	return v >> 16;
+}
+
+static void gram_fill(int32_t cs, uint32_t seed)
+{
+	uint16_t *gram = sim_gram(cs);
+	for (int32_t y = 0; y < SIM_GRAM_H; y++) {
+		for (int32_t x = 0; x < SIM_GRAM_W; x++) gram[y*SIM_GRAM_W + x] = pattern(x, y, seed);
+	}
+}
+
+// Pixels of a read rectangle that differ from the GRAM, counting pixels
+// off screen that were not left as is
+static uint32_t read_errors(int32_t cs, int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *colors)
+{
+	const uint16_t *gram = sim_gram(cs);
+	uint32_t bad = 0;
+	for (int32_t j = 0; j < h; j++) {
+		for (int32_t i = 0; i < w; i++) {
+			int32_t px = x+i, py = y+j;
+			bool on = px >= 0 && px < LCD_W && py >= 0 && py < LCD_H;
+			uint16_t want = on ? gram[py*SIM_GRAM_W + px] : 0xDEAD;
+			bad += colors[j*w + i] != want;
+		}
+	}
+	return bad;
+}
+
+// Read a rectangle from the panel and compare it with the GRAM
+static void read_case(const char *name, int32_t x, int32_t y, int32_t w, int32_t h)
+{
+	uint16_t *colors = malloc(w*h*sizeof(uint16_t));
+	for (int32_t i = 0; i < w*h; i++) colors[i] = 0xDEAD;
+	uint32_t errors = sim_errors;
+	lcdReadPixels(&dev0, x, y, w, h, colors);
+	uint32_t bad = read_errors(CS0, x, y, w, h, colors);
+	check(bad == 0 && sim_errors == errors, name, "%.0f pixels differ", bad);
+	free(colors);
+}
+
+// Memory read: one dummy byte, then R, G, B per pixel at the read clock
+static void test_read(void)
+{
+	gram_fill(CS0, 1);
+	sim_log_clear();
+	read_case("read full screen", 0, 0, LCD_W, LCD_H);
+
+	uint32_t dummy = 0, reads = 0, bytes = 0, fast = 0;
+	for (size_t i = 0; i < sim_nlog; i++) {
+		if (!sim_log[i].read) continue;
+		if (reads++ == 0) dummy = sim_log[i].bytes;
+		else bytes += sim_log[i].bytes;
+		fast += sim_log[i].hz > SIM_READ_HZ;
+	}
+	check(dummy == 1, "read dummy byte first", "%.0f bytes", dummy);
+	check(bytes == LCD_W*LCD_H*3 && fast == 0, "read 3 bytes per pixel", "%.0f bytes", bytes);
+
+	// The write clock is back for the next draw
+	sim_log_clear();
+	lcdDrawPixel(&dev0, 0, 0, RED);
+	check(sim_nlog && sim_log[sim_nlog-1].hz > SIM_READ_HZ, "read restores write clock",
+		"%.0f Hz", sim_nlog ? sim_log[sim_nlog-1].hz : 0);
+
+	gram_fill(CS0, 2);
+	read_case("read one pixel", 17, 33, 1, 1);
+	read_case("read across chunks", 3, 10, 7, 100);
+	read_case("read clipped top left", -5, -3, 20, 10);
+	read_case("read clipped bottom right", LCD_W-8, LCD_H-4, 16, 12);
+	read_case("read off screen", LCD_W, 0, 4, 4);
+
+	// Colors survive a write and read back
+	uint16_t row[LCD_W], back[LCD_W];
+	for (int32_t i = 0; i < LCD_W; i++) row[i] = pattern(i, 0, 3);
+	lcdDrawMultiPixels(&dev0, 0, 100, LCD_W, row);
+	lcdReadPixels(&dev0, 0, 100, LCD_W, 1, back);
+	check(!memcmp(row, back, sizeof(row)), "read back written row", "%.0f", 0);
+}
+
+// With a frame buffer, reads come from it and leave the bus alone
+static void test_read_frame(void)
+{
+	uint16_t colors[40*30];
+
+	lcdFrameEnable(&dev0);
+	for (int32_t y = 0; y < LCD_H; y++) {
+		for (int32_t x = 0; x < LCD_W; x++) dev0._frame_buffer[y*LCD_W + x] = pattern(x, y, 4);
+	}
+	sim_log_clear();
+	for (int32_t i = 0; i < 40*30; i++) colors[i] = 0xDEAD;
+	lcdReadPixels(&dev0, LCD_W-30, -10, 40, 30, colors);
+	uint32_t bad = 0;
+	for (int32_t j = 0; j < 30; j++) {
+		for (int32_t i = 0; i < 40; i++) {
+			int32_t x = LCD_W-30+i, y = j-10;
+			bool on = x < LCD_W && y >= 0;
+			bad += colors[j*40 + i] != (on ? pattern(x, y, 4) : 0xDEAD);
+		}
+	}
+	check(bad == 0 && sim_nlog == 0, "read frame buffer clipped", "%.0f pixels differ", bad);
+	lcdFrameDisable(&dev0);
+}
+
+// Pixels of the screen area of a panel that differ from a pattern
+static uint32_t frame_errors(int32_t cs, uint32_t seed)
+{
+	const uint16_t *gram = sim_gram(cs);
+	uint32_t bad = 0;
+	for (int32_t y = 0; y < LCD_H; y++) {
+		for (int32_t x = 0; x < LCD_W; x++) bad += gram[y*SIM_GRAM_W + x] != pattern(x, y, seed);
+	}
+	return bad;
+}
+
+static void frame_fill(TFT_t *dev, uint32_t seed)
+{
+	for (int32_t y = 0; y < dev->_height; y++) {
+		for (int32_t x = 0; x < dev->_width; x++) dev->_frame_buffer[y*dev->_width + x] = pattern(x, y, seed);
+	}
+}
+
+// Two panels on the bus written together, chunks queued to each in turn
+static void test_frames(void)
+{
+	TFT_t *devs[] = {&dev0, &dev1};
+
+	lcdFrameEnable(&dev0);
+	lcdFrameEnable(&dev1);
+	frame_fill(&dev0, 5);
+	frame_fill(&dev1, 5);
+	gram_fill(CS0, 0);
+	gram_fill(CS1, 0);
+	sim_log_clear();
+	lcdWriteFrames(devs, 2);
+	uint32_t bad = frame_errors(CS0, 5) + frame_errors(CS1, 5);
+	bad += memcmp(sim_gram(CS0), sim_gram(CS1), SIM_GRAM_W*LCD_H*sizeof(uint16_t)) != 0;
+	check(bad == 0, "frames identical", "%.0f pixels differ", bad);
+
+	// Chunks alternate between the panels, a full buffer each
+	uint32_t chunks[2] = {0}, order = 0, size = 0;
+	int32_t last = -1;
+	for (size_t i = 0; i < sim_nlog; i++) {
+		const sim_trans_t *t = &sim_log[i];
+		if (!t->queued) continue;
+		order += t->cs == last;
+		size += t->bytes != 1024 || !t->dc;
+		chunks[t->cs == CS1]++;
+		last = t->cs;
+	}
+	check(order == 0 && size == 0, "frames round-robin", "%.0f chunks in a row", order);
+	check(chunks[0] == LCD_W*LCD_H/512 && chunks[1] == chunks[0], "frames chunk count",
+		"%.0f chunks per panel", chunks[0]);
+
+	// Different frames stay on their own panel
+	frame_fill(&dev1, 6);
+	lcdWriteFrames(devs, 2);
+	bad = frame_errors(CS0, 5) + frame_errors(CS1, 6);
+	check(bad == 0, "frames to own panel", "%.0f pixels differ", bad);
+
+	// A half resolution panel is written after the others
+	lcdFrameDisable(&dev1);
+	lcdFrameEnableHalf(&dev1);
+	frame_fill(&dev1, 7);
+	lcdWriteFrames(devs, 2);
+	const uint16_t *gram = sim_gram(CS1);
+	bad = frame_errors(CS0, 5);
+	for (int32_t y = 0; y < LCD_H; y++) {
+		for (int32_t x = 0; x < LCD_W; x++) bad += gram[y*SIM_GRAM_W + x] != pattern(x/2, y/2, 7);
+	}
+	check(bad == 0, "frames with half resolution", "%.0f pixels differ", bad);
+	lcdFrameDisable(&dev0);
+	lcdFrameDisable(&dev1);
+}
+
+// Direct mode draws reach only the panel drawn on
+static void test_direct(void)
+{
+	uint16_t colors[64];
+	size_t size = SIM_GRAM_W*SIM_GRAM_H*sizeof(uint16_t);
+	uint16_t *before = malloc(size);
+
+	for (int32_t i = 0; i < 64; i++) colors[i] = pattern(i, 0, 8);
+	gram_fill(CS0, 0);
+	gram_fill(CS1, 0);
+	memcpy(before, sim_gram(CS1), size);
+	sim_log_clear();
+	lcdFillRect(&dev0, 10, 10, 50, 30, RED);
+	lcdDrawPixel(&dev0, 100, 100, GREEN);
+	lcdDrawString(&dev0, 0, 200, "dev0", WHITE);
+	lcdBeginWindow(&dev0, 200, 50, 207, 57);
+	lcdPushPixels(&dev0, colors, 64);
+	lcdEndWindow(&dev0);
+	uint32_t other = 0;
+	for (size_t i = 0; i < sim_nlog; i++) other += sim_log[i].cs != CS0;
+	uint32_t bad = memcmp(before, sim_gram(CS1), size) != 0;
+	const uint16_t *gram = sim_gram(CS0);
+	bad += gram[10*SIM_GRAM_W + 10] != RED || gram[30*SIM_GRAM_W + 50] != RED;
+	bad += gram[100*SIM_GRAM_W + 100] != GREEN;
+	bad += gram[57*SIM_GRAM_W + 207] != colors[63];
+	check(other == 0 && bad == 0, "direct draws to own CS", "%.0f transactions elsewhere", other);
+
+	memcpy(before, sim_gram(CS0), size);
+	sim_log_clear();
+	lcdFillRect(&dev1, 0, 0, 20, 20, BLUE);
+	lcdBeginWindow(&dev1, 0, 0, 7, 7);
+	lcdPushPixels(&dev1, colors, 64);
+	lcdEndWindow(&dev1);
+	other = 0;
+	for (size_t i = 0; i < sim_nlog; i++) other += sim_log[i].cs != CS1;
+	bad = memcmp(before, sim_gram(CS0), size) != 0;
+	bad += sim_gram(CS1)[20*SIM_GRAM_W + 20] != BLUE;
+	check(other == 0 && bad == 0, "direct draws to second CS", "%.0f transactions elsewhere", other);
+	free(before);
+}
+
+static int cmd_test(void)
+{
+	test_read();
+	test_read_frame();
+	test_frames();
+	test_direct();
+	check(sim_errors == 0, "bus used correctly", "%.0f errors", sim_errors);
+	printf("%s\n", failed ? "FAILED" : "PASSED");
+	return failed != 0;
+}
+
+int main(int argc, char *argv[])
+{
+	const char *cmd = argc > 1 ? argv[1] : "";
+	int ret;
+
+	sim_panel(CS0, DC0);
+	lcdInitPanel(&dev0, CS0, DC0, -1, -1);
+	sim_panel(CS1, DC1);
+	lcdInitPanel(&dev1, CS1, DC1, -1, -1);
+	if (!strcmp(cmd, "test")) {
+		ret = cmd_test();
+	} else {
+		fprintf(stderr, "usage: %s test\n", argv[0]);
+		return 2;
+	}
+	return ret;
+}
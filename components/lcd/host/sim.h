@@ -0,0 +1,47 @@
+#ifndef SIM_H_
+#define SIM_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Host simulator of the SPI bus and the panels on it. Each panel has its
+// own CS and DC pin and a GRAM that follows the column/page address set,
+// memory write and memory read commands (0x2A, 0x2B, 0x2C, 0x2E). Queued
+// transactions run in bus order when a result is collected or a polling
+// transaction needs the bus, as DMA would send them. Misuse of the bus
+// that would hang or corrupt a real one is counted in sim_errors.
+
+#define SIM_GRAM_W 320
+#define SIM_GRAM_H 320
+#define SIM_READ_HZ 6666666 // fastest read clock of the panel, Hz
+
+extern int sim_verbose; // show info logs
+extern uint32_t sim_errors; // bus misuse, see above
+
+// A transaction as the bus ran it
+typedef struct {
+	int8_t cs; // CS pin of the device
+	bool queued; // sent with spi_device_queue_trans
+	bool read;
+	bool dc; // DC level of the panel while sent
+	int32_t hz; // clock of the device
+	uint32_t bytes;
+} sim_trans_t;
+
+extern sim_trans_t *sim_log;
+extern size_t sim_nlog;
+
+// Add a panel, before lcdInitPanel is called for it.
+// cs: chip select GPIO.
+// dc: data/command GPIO.
+void sim_panel(int32_t cs, int32_t dc);
+
+// Return the GRAM of the panel on a CS, SIM_GRAM_W*SIM_GRAM_H pixels in
+// row-major order, or NULL if there is none.
+uint16_t *sim_gram(int32_t cs);
+
+// Clear the transaction log.
+void sim_log_clear(void);
+
+#endif /* SIM_H_ */
@@ -0,0 +1,310 @@
+// SPI master driver and panels for the host simulator. Devices queue
+// transactions into their own queues; the bus runs them in the order they
+// were queued, applying each to the panel selected by the device's CS.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "driver/gpio.h"
+#include "driver/spi_master.h"
+#include "sim.h"
+
+#define PANELS 4
+#define GPIOS 64
+#define DEV_QUEUE 16 // transactions per device, queued or not yet collected
+#define BUS_QUEUE 64 // transactions queued on the bus, not yet sent
+
+typedef struct {
+	int32_t cs, dc;
+	uint16_t *gram;
+	uint8_t cmd; // last command
+	uint32_t nparam; // parameter bytes since the command
+	uint8_t param[4];
+	int32_t xs, xe, ys, ye; // address window
+	int32_t x, y; // memory pointer
+	bool dummy; // a read has not yet sent its dummy byte
+	uint8_t hi; // first byte of a pixel being written
+} panel_t;
+
+struct spi_device_t {
+	int32_t cs;
+	int32_t clock_hz;
+	int32_t queue_size;
+	spi_transaction_t *pending[DEV_QUEUE]; // oldest first
+	uint32_t npending, nsent; // of pending, how many the bus has sent
+	bool acquired;
+};
+
+typedef struct {
+	spi_device_handle_t dev;
+	spi_transaction_t *trans;
+} bus_trans_t;
+
+int sim_verbose;
+uint32_t sim_errors;
+sim_trans_t *sim_log;
+size_t sim_nlog;
+
+static panel_t panels[PANELS];
+static uint32_t npanels;
+static uint8_t levels[GPIOS];
+static bool bus_ready;
+static bus_trans_t bus[BUS_QUEUE]; // queued, oldest first
+static uint32_t nbus;
+static spi_device_handle_t owner; // device holding the bus, if acquired
+static spi_device_handle_t selected; // device whose CS was kept active
+static size_t log_cap;
+
+static void error(const char *msg, int32_t cs)
+{
+	fprintf(stderr, "sim: %s (cs %d)\n", msg, (int)cs);
+	sim_errors++;
+}
+
+void sim_panel(int32_t cs, int32_t dc)
+{
+	if (npanels == PANELS) {error("too many panels", cs); return;}
+	panel_t *p = &panels[npanels++];
+	memset(p, 0, sizeof(*p));
+	p->cs = cs;
+	p->dc = dc;
+	p->gram = calloc(SIM_GRAM_W*SIM_GRAM_H, sizeof(uint16_t));
+	if (p->gram == NULL) {perror("gram"); exit(1);}
+	p->xe = SIM_GRAM_W-1;
+	p->ye = SIM_GRAM_H-1;
+}
+
+static panel_t *panel_find(int32_t cs)
+{
+	for (uint32_t i = 0; i < npanels; i++) {
+		if (panels[i].cs == cs) return &panels[i];
+	}
+	return NULL;
+}
+
+uint16_t *sim_gram(int32_t cs)
+{
+	panel_t *p = panel_find(cs);
+	return p ? p->gram : NULL;
+}
+
+void sim_log_clear(void)
+{
+	sim_nlog = 0;
+}
+
+static void log_put(spi_device_handle_t dev, bool queued, bool read, bool dc, uint32_t bytes)
+{
+	if (sim_nlog == log_cap) {
+		log_cap = log_cap ? log_cap * 2 : 1024;
+		sim_log = realloc(sim_log, log_cap * sizeof(sim_trans_t));
+		if (sim_log == NULL) {perror("sim_log"); exit(1);}
+	}
+	sim_log[sim_nlog++] = (sim_trans_t){dev->cs, queued, read, dc, dev->clock_hz, bytes};
+}
+
+// Advance the memory pointer through the address window
+static void panel_next(panel_t *p)
+{
+	if (++p->x <= p->xe) return;
+	p->x = p->xs;
+	if (++p->y > p->ye) p->y = p->ys;
+}
+
+static void panel_write(panel_t *p, bool dc, const uint8_t *data, size_t n)
+{
+	for (size_t i = 0; i < n; i++) {
+		uint8_t b = data[i];
+		if (!dc) {
+			p->cmd = b;
+			p->nparam = 0;
+			if (b == 0x2C || b == 0x2E) {
+				p->x = p->xs;
+				p->y = p->ys;
+				p->dummy = true;
+			}
+			continue;
+		}
+		uint32_t k = p->nparam++;
+		if (p->cmd == 0x2A || p->cmd == 0x2B) {
+			if (k < 4) p->param[k] = b;
+			if (k != 3) continue;
+			int32_t s = p->param[0] << 8 | p->param[1];
+			int32_t e = p->param[2] << 8 | p->param[3];
+			if (p->cmd == 0x2A) {p->xs = s; p->xe = e;}
+			else {p->ys = s; p->ye = e;}
+		} else if (p->cmd == 0x2C) {
+			if ((k & 1) == 0) {p->hi = b; continue;}
+			if (p->x < SIM_GRAM_W && p->y < SIM_GRAM_H) p->gram[p->y*SIM_GRAM_W + p->x] = p->hi << 8 | b;
+			panel_next(p);
+		}
+	}
+}
+
+// The panel sends a dummy byte, then R, G and B of each pixel in the
+// high bits of a byte.
+static void panel_read(panel_t *p, uint8_t *data, size_t n)
+{
+	for (size_t i = 0; i < n; i++) {
+		if (p->cmd != 0x2E) {data[i] = 0xFF; continue;} // bus floats
+		if (p->dummy) {data[i] = 0xA5; p->dummy = false; continue;}
+		uint32_t k = p->nparam++ % 3;
+		uint16_t c = (p->x < SIM_GRAM_W && p->y < SIM_GRAM_H) ? p->gram[p->y*SIM_GRAM_W + p->x] : 0;
+		if (k == 0) data[i] = (c >> 8) & 0xF8;
+		else if (k == 1) data[i] = (c >> 3) & 0xFC;
+		else {data[i] = (c << 3) & 0xF8; panel_next(p);}
+	}
+}
+
+// Clock a transaction out to the panel on the device's CS
+static void bus_send(spi_device_handle_t dev, spi_transaction_t *t, bool queued)
+{
+	panel_t *p = panel_find(dev->cs);
+	bool dc = p ? levels[p->dc] : true;
+	size_t bytes = t->length / 8;
+	bool read = t->rx_buffer != NULL && !(t->flags & SPI_TRANS_USE_RXDATA);
+
+	if (selected != NULL && selected != dev) error("CS of another device still active", dev->cs);
+	if (read && dev->clock_hz > SIM_READ_HZ) error("read clock too fast", dev->cs);
+	log_put(dev, queued, read, dc, bytes);
+	if (p != NULL) {
+		if (read) {
+			size_t rx = t->rxlength ? t->rxlength / 8 : bytes;
+			panel_read(p, t->rx_buffer, rx);
+		} else {
+			const uint8_t *tx = (t->flags & SPI_TRANS_USE_TXDATA) ? t->tx_data : t->tx_buffer;
+			panel_write(p, dc, tx, bytes);
+		}
+	}
+	if (t->flags & SPI_TRANS_CS_KEEP_ACTIVE) {
+		selected = dev;
+	} else {
+		selected = NULL;
+		if (p != NULL && p->cmd == 0x2E) p->cmd = 0; // CS high ends a read
+	}
+}
+
+// Send the oldest queued transaction
+static void bus_step(void)
+{
+	bus_trans_t bt = bus[0];
+	memmove(bus, bus+1, --nbus * sizeof(bus_trans_t));
+	bus_send(bt.dev, bt.trans, true);
+	bt.dev->nsent++;
+}
+
+esp_err_t gpio_reset_pin(gpio_num_t pin)
+{
+	return ESP_OK;
+}
+
+esp_err_t gpio_set_direction(gpio_num_t pin, gpio_mode_t mode)
+{
+	return ESP_OK;
+}
+
+esp_err_t gpio_set_level(gpio_num_t pin, uint32_t level)
+{
+	if (pin < 0 || pin >= GPIOS) return ESP_ERR_INVALID_ARG;
+	levels[pin] = level != 0;
+	return ESP_OK;
+}
+
+esp_err_t spi_bus_initialize(spi_host_device_t host, const spi_bus_config_t *cfg, int dma)
+{
+	if (bus_ready) return ESP_ERR_INVALID_STATE;
+	bus_ready = true;
+	return ESP_OK;
+}
+
+esp_err_t spi_bus_add_device(spi_host_device_t host, const spi_device_interface_config_t *cfg, spi_device_handle_t *handle)
+{
+	if (!bus_ready) return ESP_ERR_INVALID_STATE;
+	if (cfg->queue_size > DEV_QUEUE) return ESP_ERR_INVALID_ARG;
+	spi_device_handle_t dev = calloc(1, sizeof(struct spi_device_t));
+	if (dev == NULL) return ESP_FAIL;
+	dev->cs = cfg->spics_io_num;
+	dev->clock_hz = cfg->clock_speed_hz;
+	dev->queue_size = cfg->queue_size;
+	*handle = dev;
+	return ESP_OK;
+}
+
+esp_err_t spi_bus_remove_device(spi_device_handle_t dev)
+{
+	if (dev->npending || dev->acquired) {
+		error("device removed while busy", dev->cs);
+		return ESP_ERR_INVALID_STATE;
+	}
+	free(dev);
+	return ESP_OK;
+}
+
+esp_err_t spi_device_queue_trans(spi_device_handle_t dev, spi_transaction_t *t, TickType_t wait)
+{
+	if (owner != NULL && owner != dev) {
+		error("queued while another device holds the bus", dev->cs);
+		return ESP_ERR_INVALID_STATE;
+	}
+	if (dev->npending == dev->queue_size || nbus == BUS_QUEUE) {
+		error("queue full, would block forever", dev->cs);
+		return ESP_ERR_TIMEOUT;
+	}
+	dev->pending[dev->npending++] = t;
+	bus[nbus++] = (bus_trans_t){dev, t};
+	return ESP_OK;
+}
+
+esp_err_t spi_device_get_trans_result(spi_device_handle_t dev, spi_transaction_t **t, TickType_t wait)
+{
+	if (dev->npending == 0) {
+		error("no transaction to wait for, would block forever", dev->cs);
+		return ESP_ERR_TIMEOUT;
+	}
+	while (dev->nsent == 0) bus_step();
+	*t = dev->pending[0];
+	memmove(dev->pending, dev->pending+1, --dev->npending * sizeof(dev->pending[0]));
+	dev->nsent--;
+	return ESP_OK;
+}
+
+esp_err_t spi_device_polling_transmit(spi_device_handle_t dev, spi_transaction_t *t)
+{
+	if (owner != NULL && owner != dev) {
+		error("polled while another device holds the bus", dev->cs);
+		return ESP_ERR_INVALID_STATE;
+	}
+	if ((t->flags & SPI_TRANS_CS_KEEP_ACTIVE) && owner != dev) {
+		error("CS kept active without acquiring the bus", dev->cs);
+		return ESP_ERR_INVALID_ARG;
+	}
+	while (nbus) bus_step(); // the bus finishes queued work first
+	bus_send(dev, t, false);
+	return ESP_OK;
+}
+
+esp_err_t spi_device_transmit(spi_device_handle_t dev, spi_transaction_t *t)
+{
+	return spi_device_polling_transmit(dev, t);
+}
+
+esp_err_t spi_device_acquire_bus(spi_device_handle_t dev, TickType_t wait)
+{
+	if (owner != NULL) {
+		error("bus acquired twice", dev->cs);
+		return ESP_ERR_INVALID_STATE;
+	}
+	while (nbus) bus_step();
+	owner = dev;
+	dev->acquired = true;
+	return ESP_OK;
+}
+
+void spi_device_release_bus(spi_device_handle_t dev)
+{
+	if (owner != dev) error("bus released by a device not holding it", dev->cs);
+	if (selected == dev) error("bus released with CS still active", dev->cs);
+	owner = NULL;
+	dev->acquired = false;
+}
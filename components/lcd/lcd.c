@@ -32,6 +32,9 @@
 #ifndef CONFIG_MOSI_GPIO
 #define CONFIG_MOSI_GPIO 23
 #endif
+#ifndef CONFIG_MISO_GPIO
+#define CONFIG_MISO_GPIO 19
+#endif
 #ifndef CONFIG_SCLK_GPIO
 #define CONFIG_SCLK_GPIO 18
 #endif
@@ -59,6 +62,7 @@
 #endif
 
 #define SPI_DEFAULT_FREQUENCY SPI_MASTER_FREQ_40M; // MHz
+#define SPI_READ_FREQUENCY 6000000 // Hz, panel read cycle is slower than write
 #define swap(T,a,b) {T t = (a); (a) = (b); (b) = t;}
 
 #define M_PIf 3.14159265358979323846f
@@ -69,6 +73,7 @@ static const int32_t SPI_Command_Mode = 0;
 static const int32_t SPI_Data_Mode = 1;
 
 static int32_t clock_speed_hz = SPI_DEFAULT_FREQUENCY;
+static bool bus_ready; // bus initialized by the first panel
 
 #include "glcdfont.c" // unsigned char font[];
 
@@ -85,7 +90,9 @@ static void delayMS(int32_t ms) {
 #define BUF_LEN 512
 static uint16_t buffer[BUF_LEN];
 
-static void spi_master_init(TFT_t *dev, int16_t GPIO_MOSI, int16_t GPIO_SCLK, int16_t GPIO_CS, int16_t GPIO_DC, int16_t GPIO_RESET, int16_t GPIO_BL)
+static void spi_master_add_device(TFT_t *dev, int32_t speed);
+
+static void spi_master_init(TFT_t *dev, int16_t GPIO_MOSI, int16_t GPIO_MISO, int16_t GPIO_SCLK, int16_t GPIO_CS, int16_t GPIO_DC, int16_t GPIO_RESET, int16_t GPIO_BL)
 {
 	esp_err_t ret;
 
@@ -125,10 +132,11 @@ static void spi_master_init(TFT_t *dev, int16_t GPIO_MOSI, int16_t GPIO_SCLK, in
 	}
 
 	ESP_LOGI(TAG, "GPIO_MOSI=%hd",GPIO_MOSI);
+	ESP_LOGI(TAG, "GPIO_MISO=%hd",GPIO_MISO);
 	ESP_LOGI(TAG, "GPIO_SCLK=%hd",GPIO_SCLK);
 	spi_bus_config_t buscfg = {
 		.mosi_io_num = GPIO_MOSI,
-		.miso_io_num = -1,
+		.miso_io_num = GPIO_MISO,
 		.sclk_io_num = GPIO_SCLK,
 		.quadwp_io_num = -1,
 		.quadhd_io_num = -1,
@@ -136,19 +144,34 @@ static void spi_master_init(TFT_t *dev, int16_t GPIO_MOSI, int16_t GPIO_SCLK, in
 		.flags = 0
 	};
 
-	ret = spi_bus_initialize( HOST_ID, &buscfg, SPI_DMA_CH_AUTO );
-	ESP_LOGD(TAG, "spi_bus_initialize=%d",(int)ret);
-	assert(ret==ESP_OK);
+	// Panels after the first share the bus, each with its own CS and DC
+	if ( !bus_ready ) {
+		ret = spi_bus_initialize( HOST_ID, &buscfg, SPI_DMA_CH_AUTO );
+		ESP_LOGD(TAG, "spi_bus_initialize=%d",(int)ret);
+		assert(ret==ESP_OK);
+		bus_ready = true;
+	}
+
+	dev->_cs = GPIO_CS;
+	dev->_dc = GPIO_DC;
+	dev->_bl = GPIO_BL;
+	spi_master_add_device(dev, clock_speed_hz);
+}
 
+// Add the panel as a device on the bus at the given clock speed
+static void spi_master_add_device(TFT_t *dev, int32_t speed)
+{
 	spi_device_interface_config_t devcfg;
+	esp_err_t ret;
+
 	memset(&devcfg, 0, sizeof(devcfg));
-	devcfg.clock_speed_hz = clock_speed_hz;
+	devcfg.clock_speed_hz = speed;
 	devcfg.queue_size = 7;
 	devcfg.mode = 3;
 	devcfg.flags = SPI_DEVICE_NO_DUMMY;
 
-	if ( GPIO_CS >= 0 ) {
-		devcfg.spics_io_num = GPIO_CS;
+	if ( dev->_cs >= 0 ) {
+		devcfg.spics_io_num = dev->_cs;
 	} else {
 		devcfg.spics_io_num = -1;
 	}
@@ -157,8 +180,6 @@ static void spi_master_init(TFT_t *dev, int16_t GPIO_MOSI, int16_t GPIO_SCLK, in
 	ret = spi_bus_add_device( HOST_ID, &devcfg, &handle);
 	ESP_LOGD(TAG, "spi_bus_add_device=%d",(int)ret);
 	assert(ret==ESP_OK);
-	dev->_dc = GPIO_DC;
-	dev->_bl = GPIO_BL;
 	dev->_SPIHandle = handle;
 }
 
@@ -198,7 +219,6 @@ static bool spi_master_write_data_byte(TFT_t *dev, uint8_t data)
 	return spi_master_write_bytes( dev->_SPIHandle, &Byte, 1 );
 }
 
-#if 0
 static bool spi_master_write_data_word(TFT_t *dev, uint16_t data)
 {
 	static uint8_t Byte[2];
@@ -207,7 +227,6 @@ static bool spi_master_write_data_word(TFT_t *dev, uint16_t data)
 	gpio_set_level( dev->_dc, SPI_Data_Mode );
 	return spi_master_write_bytes( dev->_SPIHandle, Byte, 2);
 }
-#endif
 
 static bool spi_master_write_addr(TFT_t *dev, uint16_t addr1, uint16_t addr2)
 {
@@ -228,6 +247,7 @@ inline static bool spi_master_write_color(TFT_t *dev, uint16_t color, size_t siz
 	for (size_t i = 0; i < n; i++) buffer[i] = temp;
 	gpio_set_level(dev->_dc, SPI_Data_Mode);
 	while (size) {
+		if (n > size) n = size; // last partial block
 		spi_master_write_bytes(dev->_SPIHandle, (uint8_t *)buffer, n*sizeof(uint16_t));
 		size -= n;
 	}
@@ -301,18 +321,245 @@ inline static bool spi_master_write_colors(TFT_t *dev, uint16_t *colors, size_t
 	return true;
 }
 
+/* * * * * * * * * * Stream * * * * * * * * * */
+
+// Pixels pushed through lcdPushPixels are byte swapped into one of these
+// buffers, which is then queued to the SPI driver. While one buffer is being
+// sent by DMA, the next one is filled, so the bus is kept busy back-to-back.
+// Buffers may be queued to different panels on the bus; each remembers its
+// panel so the result is collected from the right device.
+#define STREAM_BUFS 2
+static uint16_t stream_buf[STREAM_BUFS][BUF_LEN];
+static spi_transaction_t stream_trans[STREAM_BUFS];
+static uint32_t stream_idx; // buffer being filled
+static size_t stream_fill; // elements in buffer being filled
+static uint32_t stream_pending; // transactions queued, not yet finished
+static spi_device_handle_t stream_dev[STREAM_BUFS]; // device of each queued buffer
+
+// Wait for the oldest queued stream transaction to finish.
+static void spi_stream_wait(void)
+{
+	spi_transaction_t *rtrans;
+	uint32_t oldest = (stream_idx + STREAM_BUFS - stream_pending) % STREAM_BUFS;
+	esp_err_t ret = spi_device_get_trans_result(stream_dev[oldest], &rtrans, portMAX_DELAY);
+	assert(ret==ESP_OK);
+	stream_pending--;
+}
+
+// Queue the buffer being filled and advance to the next one.
+static void spi_stream_queue(TFT_t *dev)
+{
+	if (stream_fill == 0) return;
+	spi_transaction_t *t = &stream_trans[stream_idx];
+	memset(t, 0, sizeof(spi_transaction_t));
+	t->length = stream_fill * sizeof(uint16_t) * 8;
+	t->tx_buffer = stream_buf[stream_idx];
+	esp_err_t ret = spi_device_queue_trans(dev->_SPIHandle, t, portMAX_DELAY);
+	assert(ret==ESP_OK);
+	stream_dev[stream_idx] = dev->_SPIHandle;
+	stream_pending++;
+	stream_idx = (stream_idx + 1) % STREAM_BUFS;
+	stream_fill = 0;
+}
+
+// Swap size colors into the stream buffers, queuing each one as it fills.
+// size is number of elements, not bytes.
+static void spi_stream_colors(TFT_t *dev, const uint16_t *colors, size_t size)
+{
+	while (size) {
+		if (stream_fill == 0 && stream_pending == STREAM_BUFS)
+			spi_stream_wait(); // buffer still in flight
+		uint16_t *dst = stream_buf[stream_idx] + stream_fill;
+		size_t n = BUF_LEN - stream_fill;
+		if (n > size) n = size;
+		for (size_t i = 0; i < n; i++) dst[i] = SWAP16(colors[i]);
+		stream_fill += n;
+		colors += n;
+		size -= n;
+		if (stream_fill == BUF_LEN) spi_stream_queue(dev);
+	}
+}
+
+// Same as spi_stream_colors, but send each color twice.
+// size is number of elements before doubling.
+static void spi_stream_colors2(TFT_t *dev, const uint16_t *colors, size_t size)
+{
+	while (size) {
+		if (stream_fill == 0 && stream_pending == STREAM_BUFS)
+			spi_stream_wait(); // buffer still in flight
+		uint16_t *dst = stream_buf[stream_idx] + stream_fill;
+		size_t n = (BUF_LEN - stream_fill) / 2;
+		if (n > size) n = size;
+		for (size_t i = 0; i < n; i++) {
+			uint16_t c = SWAP16(colors[i]);
+			*dst++ = c;
+			*dst++ = c;
+		}
+		stream_fill += n*2;
+		colors += n;
+		size -= n;
+		if (stream_fill == BUF_LEN) spi_stream_queue(dev);
+	}
+}
+
+// Queue any partially filled buffer and wait for all transfers to finish.
+static void spi_stream_flush(TFT_t *dev)
+{
+	spi_stream_queue(dev);
+	while (stream_pending) spi_stream_wait();
+}
+
+// Set the display address window and start a memory write.
+// Coordinates are screen coordinates, already clipped.
+static void spi_master_write_window(TFT_t *dev, int32_t x1, int32_t y1, int32_t x2, int32_t y2)
+{
+	spi_master_write_command(dev, 0x2A);	// set column(x) address
+	spi_master_write_addr(dev, x1 + dev->_offsetx, x2 + dev->_offsetx);
+	spi_master_write_command(dev, 0x2B);	// set Page(y) address
+	spi_master_write_addr(dev, y1 + dev->_offsety, y2 + dev->_offsety);
+	spi_master_write_command(dev, 0x2C);	// Memory Write
+	gpio_set_level(dev->_dc, SPI_Data_Mode);
+}
+
+// Re-add the device with a new clock speed. The SPI driver fixes the clock
+// when a device is added, so this is how reads get a slower clock.
+static void spi_master_set_clock(TFT_t *dev, int32_t speed)
+{
+	esp_err_t ret;
+
+	ret = spi_bus_remove_device(dev->_SPIHandle);
+	assert(ret==ESP_OK);
+	spi_master_add_device(dev, speed);
+}
+
+// Write a command and keep CS asserted, so the read that follows belongs
+// to it. The bus must be acquired.
+static void spi_master_read_command(TFT_t *dev, uint8_t cmd)
+{
+	spi_transaction_t SPITransaction;
+	esp_err_t ret;
+
+	memset(&SPITransaction, 0, sizeof(spi_transaction_t));
+	SPITransaction.flags = SPI_TRANS_CS_KEEP_ACTIVE | SPI_TRANS_USE_TXDATA;
+	SPITransaction.length = 8;
+	SPITransaction.tx_data[0] = cmd;
+	gpio_set_level(dev->_dc, SPI_Command_Mode);
+	ret = spi_device_polling_transmit(dev->_SPIHandle, &SPITransaction);
+	assert(ret==ESP_OK);
+	gpio_set_level(dev->_dc, SPI_Data_Mode);
+}
+
+// Read bytes following spi_master_read_command. CS stays asserted until
+// a read with keep false ends the command.
+static void spi_master_read_bytes(TFT_t *dev, uint8_t *data, size_t size, bool keep)
+{
+	spi_transaction_t SPITransaction;
+	esp_err_t ret;
+
+	memset(&SPITransaction, 0, sizeof(spi_transaction_t));
+	SPITransaction.flags = keep ? SPI_TRANS_CS_KEEP_ACTIVE : 0;
+	SPITransaction.length = size * 8;
+	SPITransaction.rxlength = size * 8;
+	SPITransaction.rx_buffer = data;
+	ret = spi_device_polling_transmit(dev->_SPIHandle, &SPITransaction);
+	assert(ret==ESP_OK);
+}
+
+
+/* * * * * * * * * * Layers * * * * * * * * * */
+
+// The screen is divided into blocks. Draw calls into the frame buffer mark
+// the blocks they touch, both in the selected layer (to be restored from the
+// background later) and in the send set (to be written by lcdWriteFrame).
+#define LAYER_BLK 16 // Block width & height in pixels
+#define LAYER_COLS ((LCD_W+LAYER_BLK-1)/LAYER_BLK)
+#define LAYER_ROWS ((LCD_H+LAYER_BLK-1)/LAYER_BLK)
+_Static_assert(LAYER_COLS <= 32, "one bit per block column in a uint32_t");
+
+// A horizontal run of one color in the background
+typedef struct {
+	uint16_t len;
+	uint16_t color;
+} lcd_run_t;
+
+struct lcd_layers_s {
+	lcd_run_t *runs; // background, run-length encoded by row
+	uint32_t row[LCD_H]; // index of the first run of each row
+	int32_t sel; // layer marked by draw calls
+	uint32_t dirty[LCD_LAYERS][LAYER_ROWS]; // blocks drawn per layer
+	uint32_t send[LAYER_ROWS]; // blocks changed since last write
+};
+
+// Mark the blocks covered by a rectangle already clipped to the screen
+static inline void lcdMark(TFT_t *dev, int32_t x1, int32_t y1, int32_t x2, int32_t y2)
+{
+	struct lcd_layers_s *ls = dev->_layers;
+	if (ls == NULL) return;
+	uint32_t bits = (2U << (x2/LAYER_BLK)) - (1U << (x1/LAYER_BLK));
+	for (int32_t r = y1/LAYER_BLK; r <= y2/LAYER_BLK; r++) {
+		ls->dirty[ls->sel][r] |= bits;
+		ls->send[r] |= bits;
+	}
+}
+
+// Find the next span of consecutive set bits at or after column *c1.
+// Return false if there are no more set bits.
+static inline bool lcdNextSpan(uint32_t bits, int32_t *c1, int32_t *c2)
+{
+	if (*c1 >= 32) return false;
+	bits &= ~((1U << *c1) - 1);
+	if (bits == 0) return false;
+	*c1 = __builtin_ctz(bits);
+	uint32_t rest = ~bits & ~((1U << *c1) - 1);
+	*c2 = rest ? __builtin_ctz(rest) - 1 : 31;
+	return true;
+}
+
+// Copy a rectangle of the background into the frame buffer
+static void lcdRestore(TFT_t *dev, int32_t x1, int32_t y1, int32_t x2, int32_t y2)
+{
+	struct lcd_layers_s *ls = dev->_layers;
+	for (int32_t y = y1; y <= y2; y++) {
+		const lcd_run_t *run = ls->runs + ls->row[y];
+		int32_t x = 0;
+		while (x + run->len <= x1) x += (run++)->len; // skip to x1
+		uint16_t *ptr = dev->_frame_buffer + y*dev->_width + x1;
+		int32_t avail = x + run->len - x1;
+		int32_t n = x2 - x1 + 1;
+		while (1) {
+			int32_t k = (avail < n) ? avail : n;
+			uint16_t color = run->color;
+			n -= k;
+			while (k--) *ptr++ = color;
+			if (n == 0) break;
+			avail = (++run)->len;
+		}
+	}
+}
+
 
 /* * * * * * * * * * LCD * * * * * * * * * */
 
 void lcdInit(TFT_t *dev)
+{
+	lcdInitPanel(dev, CONFIG_CS_GPIO, CONFIG_DC_GPIO, CONFIG_RESET_GPIO, CONFIG_BL_GPIO);
+}
+
+// Initialize a panel on the shared bus. Each panel needs its own CS and DC.
+// cs:Chip select GPIO
+// dc:Data/command GPIO
+// reset:Reset GPIO, -1 if not connected
+// bl:Backlight GPIO, -1 if not connected
+void lcdInitPanel(TFT_t *dev, int16_t cs, int16_t dc, int16_t reset, int16_t bl)
 {
 	spi_master_init(dev,
 		CONFIG_MOSI_GPIO,
+		CONFIG_MISO_GPIO,
 		CONFIG_SCLK_GPIO,
-		CONFIG_CS_GPIO,
-		CONFIG_DC_GPIO,
-		CONFIG_RESET_GPIO,
-		CONFIG_BL_GPIO);
+		cs,
+		dc,
+		reset,
+		bl);
 
 	dev->_width = CONFIG_WIDTH;
 	dev->_height = CONFIG_HEIGHT;
@@ -324,6 +571,9 @@ void lcdInit(TFT_t *dev)
 	dev->_font_back_color = BLACK;
 	dev->_use_frame_buffer = false;
 	dev->_frame_buffer = NULL;
+	dev->_frame_scale = 1;
+	dev->_win_active = false;
+	dev->_layers = NULL;
 
 	spi_master_write_command(dev, 0x01);	// Software Reset
 	delayMS(5); // 150
@@ -415,6 +665,30 @@ void lcdInit(TFT_t *dev)
 	}
 }
 
+// Initialize an off-screen canvas over a pixel buffer supplied by the caller.
+// Draw calls on the canvas render into buf as they would into a frame buffer,
+// so the result can be sent with lcdPushPixels. Do not call lcdWriteFrame,
+// lcdFrameDisable or display configuration functions on a canvas.
+// buf:width*height pixels
+// width:canvas width
+// height:canvas height
+void lcdCanvasInit(TFT_t *dev, uint16_t *buf, int32_t width, int32_t height)
+{
+	memset(dev, 0, sizeof(TFT_t));
+	dev->_width = width;
+	dev->_height = height;
+	dev->_font_direction = DIRECTION0;
+	dev->_font_size = 1;
+	dev->_font_back_en = false;
+	dev->_font_back_color = BLACK;
+	dev->_cs = -1;
+	dev->_dc = -1;
+	dev->_bl = -1;
+	dev->_use_frame_buffer = true;
+	dev->_frame_buffer = buf;
+	dev->_frame_scale = 1;
+}
+
 // Fill screen
 // color:color
 void lcdFillScreen(TFT_t *dev, uint16_t color) {
@@ -427,6 +701,7 @@ void lcdFillScreen(TFT_t *dev, uint16_t color) {
 			memcpy(ptr, dev->_frame_buffer, n*sizeof(uint16_t));
 			ptr += n; len -= n;
 		}
+		lcdMark(dev, 0, 0, dev->_width-1, dev->_height-1);
 	} else {
 		spi_master_write_command(dev, 0x2A);	// set column(x) address
 		spi_master_write_addr(dev, 0, dev->_width-1);
@@ -447,6 +722,7 @@ void lcdDrawPixel(TFT_t *dev, int32_t x, int32_t y, uint16_t color){
 
 	if (dev->_use_frame_buffer) {
 		dev->_frame_buffer[y*dev->_width+x] = color;
+		lcdMark(dev, x, y, x, y);
 	} else {
 		int32_t _x = x + dev->_offsetx;
 		int32_t _y = y + dev->_offsety;
@@ -479,6 +755,7 @@ void lcdDrawMultiPixels(TFT_t *dev, int32_t x, int32_t y, int32_t size, uint16_t
 		for(int32_t i = _x1; i <= _x2; i++){
 			dev->_frame_buffer[y*dev->_width+i] = colors[index++];
 		}
+		lcdMark(dev, _x1, y, _x2, y);
 	} else {
 		int32_t _x1 = x + dev->_offsetx;
 		int32_t _x2 = _x1 + (size-1);
@@ -494,6 +771,137 @@ void lcdDrawMultiPixels(TFT_t *dev, int32_t x, int32_t y, int32_t size, uint16_t
 	}
 }
 
+// Begin streaming pixels into a window - assume x1 <= x2 && y1 <= y2
+// x1:Start X coordinate
+// y1:Start Y coordinate
+// x2:End X coordinate
+// y2:End Y coordinate
+// Pixels are then supplied with lcdPushPixels in row-major order, in chunks
+// of any size. Parts of the window off screen are clipped. No other lcd
+// function may be called until lcdEndWindow.
+void lcdBeginWindow(TFT_t *dev, int32_t x1, int32_t y1, int32_t x2, int32_t y2) {
+	dev->_win_x1 = x1;
+	dev->_win_y1 = y1;
+	dev->_win_x2 = x2;
+	dev->_win_y2 = y2;
+	dev->_win_x = x1;
+	dev->_win_y = y1;
+	dev->_win_active = true;
+
+	if (dev->_use_frame_buffer) return;
+	if (x2 < 0 || x1 >= dev->_width) return; // off screen
+	if (y2 < 0 || y1 >= dev->_height) return;
+	if (x1 < 0) x1 = 0; // clip
+	if (x2 >= dev->_width) x2=dev->_width-1;
+	if (y1 < 0) y1 = 0;
+	if (y2 >= dev->_height) y2=dev->_height-1;
+
+	spi_master_write_window(dev, x1, y1, x2, y2);
+}
+
+// Push pixels into the window opened by lcdBeginWindow
+// colors:colors
+// size:Number of colors
+// In direct mode, colors are swapped into DMA buffers and queued, so the
+// caller may reuse its array as soon as this function returns.
+void lcdPushPixels(TFT_t *dev, const uint16_t *colors, size_t size) {
+	if (!dev->_win_active) return;
+
+	while (size && dev->_win_y <= dev->_win_y2) {
+		// Pixels remaining in the current window row
+		int32_t n = dev->_win_x2 - dev->_win_x + 1;
+		if (n > size) n = size;
+
+		if (dev->_win_y >= 0 && dev->_win_y < dev->_height) {
+			int32_t x = dev->_win_x, len = n;
+			const uint16_t *src = colors;
+			if (x < 0) {src -= x; len += x; x = 0;} // clip
+			if (x+len > dev->_width) len = dev->_width-x;
+			if (len > 0) {
+				if (dev->_use_frame_buffer) {
+					memcpy(&dev->_frame_buffer[dev->_win_y*dev->_width+x], src, len*sizeof(uint16_t));
+					lcdMark(dev, x, dev->_win_y, x+len-1, dev->_win_y);
+				} else {
+					spi_stream_colors(dev, src, len);
+				}
+			}
+		}
+
+		colors += n;
+		size -= n;
+		dev->_win_x += n;
+		if (dev->_win_x > dev->_win_x2) {
+			dev->_win_x = dev->_win_x1;
+			dev->_win_y++;
+		}
+	}
+}
+
+// End streaming pixels and wait until all have been sent to the display
+void lcdEndWindow(TFT_t *dev) {
+	if (!dev->_win_active) return;
+	if (!dev->_use_frame_buffer) spi_stream_flush(dev);
+	dev->_win_active = false;
+}
+
+// Read a rectangle of pixels, from the frame buffer if enabled, otherwise
+// from the panel memory (RAMRD). Pixels outside the screen are left as is.
+// x:Start X coordinate
+// y:Start Y coordinate
+// w:Width of rectangle
+// h:Height of rectangle
+// colors:Destination, w*h pixels in row-major order
+#define READ_PIXELS 340 // Pixels per read transaction, 3 bytes each
+void lcdReadPixels(TFT_t *dev, int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *colors) {
+	int32_t x1 = x, y1 = y, x2 = x+w-1, y2 = y+h-1;
+	if (x2 < 0 || x1 >= dev->_width) return; // off screen
+	if (y2 < 0 || y1 >= dev->_height) return;
+	if (x1 < 0) x1 = 0; // clip
+	if (x2 >= dev->_width) x2=dev->_width-1;
+	if (y1 < 0) y1 = 0;
+	if (y2 >= dev->_height) y2=dev->_height-1;
+	int32_t cw = x2-x1+1;
+	colors += (y1-y)*w + (x1-x);
+
+	if (dev->_use_frame_buffer) {
+		for (int32_t j = y1; j <= y2; j++) {
+			memcpy(colors, &dev->_frame_buffer[j*dev->_width+x1], cw*sizeof(uint16_t));
+			colors += w;
+		}
+		return;
+	}
+	if (dev->_win_active) {
+		ESP_LOGE(TAG, "read during window write");
+		return;
+	}
+
+	// The panel sends one dummy byte, then 3 bytes (R, G, B) per pixel
+	static uint32_t read_buf[READ_PIXELS*3/sizeof(uint32_t)];
+	uint8_t *bytes = (uint8_t *)read_buf;
+	size_t size = cw*(y2-y1+1);
+	int32_t col = 0;
+
+	spi_master_set_clock(dev, SPI_READ_FREQUENCY);
+	spi_device_acquire_bus(dev->_SPIHandle, portMAX_DELAY);
+	spi_master_write_command(dev, 0x2A);	// set column(x) address
+	spi_master_write_addr(dev, x1 + dev->_offsetx, x2 + dev->_offsetx);
+	spi_master_write_command(dev, 0x2B);	// set Page(y) address
+	spi_master_write_addr(dev, y1 + dev->_offsety, y2 + dev->_offsety);
+	spi_master_read_command(dev, 0x2E);	// Memory Read
+	spi_master_read_bytes(dev, bytes, 1, true);
+	while (size) {
+		size_t n = (size < READ_PIXELS) ? size : READ_PIXELS;
+		size -= n;
+		spi_master_read_bytes(dev, bytes, n*3, size != 0);
+		for (const uint8_t *p = bytes; n; n--, p += 3) {
+			colors[col] = rgb565(p[0], p[1], p[2]);
+			if (++col == cw) {col = 0; colors += w;}
+		}
+	}
+	spi_device_release_bus(dev->_SPIHandle);
+	spi_master_set_clock(dev, clock_speed_hz);
+}
+
 // Draw Horizontal Line
 // x:X coordinate
 // y:Y coordinate
@@ -511,6 +919,7 @@ void lcdDrawHLine(TFT_t *dev, int32_t x, int32_t y, int32_t w, uint16_t color) {
 		for(int32_t i = _x1; i <= _x2; i++){
 			dev->_frame_buffer[y*dev->_width+i] = color;
 		}
+		lcdMark(dev, _x1, y, _x2, y);
 	} else {
 		int32_t _x1 = x + dev->_offsetx;
 		int32_t _x2 = _x1 + (w-1);
@@ -544,6 +953,7 @@ void lcdDrawVLine(TFT_t *dev, int32_t x, int32_t y, int32_t h, uint16_t color) {
 		for (int32_t j = y; j <= y2; j++){
 			dev->_frame_buffer[j*dev->_width+x] = color;
 		}
+		lcdMark(dev, x, y, x, y2);
 	} else {
 		int32_t _x1 =  x  + dev->_offsetx;
 		int32_t _x2 = _x1 + dev->_offsetx;
@@ -560,160 +970,175 @@ void lcdDrawVLine(TFT_t *dev, int32_t x, int32_t y, int32_t h, uint16_t color) {
 	}
 }
 
-#if 0
-// Draw line
-// x1:Start X coordinate
-// y1:Start Y coordinate
-// x2:End	X coordinate
-// y2:End	Y coordinate
-// color:color
-void lcdDrawLine(TFT_t *dev, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint16_t color) {
-	int32_t i;
-	int32_t dx, dy;
-	int32_t sx, sy;
-	int32_t E;
-
-	/* distance between two points */
-	dx = ( x2 > x1 ) ? x2 - x1 : x1 - x2;
-	dy = ( y2 > y1 ) ? y2 - y1 : y1 - y2;
-
-	/* direction of two point */
-	sx = ( x2 > x1 ) ? 1 : -1;
-	sy = ( y2 > y1 ) ? 1 : -1;
-
-	/* inclination < 1 */
-	if ( dx > dy ) {
-		E = -dx;
-		for ( i = 0 ; i <= dx ; i++ ) {
-			lcdDrawPixel(dev, x1, y1, color);
-			x1 += sx;
-			E += 2 * dy;
-			if ( E >= 0 ) {
-			y1 += sy;
-			E -= 2 * dx;
-		}
-	}
+// Cohen-Sutherland outcodes
+#define CS_INSIDE 0
+#define CS_LEFT   1
+#define CS_RIGHT  2
+#define CS_TOP    4
+#define CS_BOTTOM 8
 
-	/* inclination >= 1 */
-	} else {
-		E = -dy;
-		for ( i = 0 ; i <= dy ; i++ ) {
-			lcdDrawPixel(dev, x1, y1, color);
-			y1 += sy;
-			E += 2 * dx;
-			if ( E >= 0 ) {
-				x1 += sx;
-				E -= 2 * dy;
-			}
+static inline int32_t lcdOutCode(TFT_t *dev, int32_t x, int32_t y)
+{
+	int32_t code = CS_INSIDE;
+	if (x < 0) code |= CS_LEFT;
+	else if (x >= dev->_width) code |= CS_RIGHT;
+	if (y < 0) code |= CS_TOP;
+	else if (y >= dev->_height) code |= CS_BOTTOM;
+	return code;
+}
+
+// Clip the line (x0,y0)-(x1,y1) to the screen using Cohen-Sutherland.
+// Return false if the line is entirely off screen.
+static bool lcdClipLine(TFT_t *dev, int32_t *x0, int32_t *y0, int32_t *x1, int32_t *y1)
+{
+	int32_t code0 = lcdOutCode(dev, *x0, *y0);
+	int32_t code1 = lcdOutCode(dev, *x1, *y1);
+
+	while (code0 | code1) {
+		if (code0 & code1) return false; // trivially reject
+		int32_t code = code0 ? code0 : code1;
+		int64_t dx = *x1 - *x0, dy = *y1 - *y0;
+		int32_t x, y;
+		if (code & CS_BOTTOM) {
+			y = dev->_height-1;
+			x = *x0 + dx * (y - *y0) / dy;
+		} else if (code & CS_TOP) {
+			y = 0;
+			x = *x0 + dx * (y - *y0) / dy;
+		} else if (code & CS_RIGHT) {
+			x = dev->_width-1;
+			y = *y0 + dy * (x - *x0) / dx;
+		} else { // CS_LEFT
+			x = 0;
+			y = *y0 + dy * (x - *x0) / dx;
+		}
+		if (code == code0) {
+			*x0 = x; *y0 = y;
+			code0 = lcdOutCode(dev, x, y);
+		} else {
+			*x1 = x; *y1 = y;
+			code1 = lcdOutCode(dev, x, y);
 		}
 	}
+	return true;
 }
-#endif
 
-#if 0
-// Draw line
-// x1:Start X coordinate
-// y1:Start Y coordinate
-// x2:End	X coordinate
-// y2:End	Y coordinate
-// color:color
-// Bresenham's algorithm - thx Wikipedia
-void lcdDrawLine(TFT_t *dev, int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint16_t color) {
-  bool steep = abs(y1 - y0) > abs(x1 - x0);
+// Draw a run of pixels already clipped to the screen.
+// Horizontal runs (h == 1) and vertical runs (w == 1) are each a single
+// window write in direct mode.
+static void lcdDrawRun(TFT_t *dev, int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color)
+{
+	if (dev->_use_frame_buffer) {
+		uint16_t *ptr = dev->_frame_buffer + y*dev->_width + x;
+		lcdMark(dev, x, y, x+w-1, y+h-1);
+		if (h == 1) {
+			while (w--) *ptr++ = color;
+		} else {
+			while (h--) {*ptr = color; ptr += dev->_width;}
+		}
+	} else {
+		int32_t _x = x + dev->_offsetx;
+		int32_t _y = y + dev->_offsety;
 
-  if (steep) {
-    swap(int32_t, x0, y0);
-    swap(int32_t, x1, y1);
-  }
+		spi_master_write_command(dev, 0x2A);	// set column(x) address
+		spi_master_write_addr(dev, _x, _x+w-1);
+		spi_master_write_command(dev, 0x2B);	// set Page(y) address
+		spi_master_write_addr(dev, _y, _y+h-1);
+		spi_master_write_command(dev, 0x2C);	// Memory Write
+		spi_master_write_color(dev, color, w*h);
+	}
+}
 
-  if (x0 > x1) {
-    swap(int32_t, x0, x1);
-    swap(int32_t, y0, y1);
-  }
+static void lcdShadeStream(TFT_t *dev, int32_t x, int32_t y, int32_t w, const lcd_shader_t *sh);
+static void lcdTriSpans(TFT_t *dev, int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint16_t color, const lcd_shader_t *sh);
 
-  int16_t dx, dy;
-  dx = x1 - x0;
-  dy = abs(y1 - y0);
+// Shade a horizontal span, clipped to the screen. In frame buffer mode the
+// shader writes straight into the frame buffer.
+static void lcdShadeHLine(TFT_t *dev, int32_t x, int32_t y, int32_t w, const lcd_shader_t *sh)
+{
+	if (x+w <= 0 || x >= dev->_width) return; // off screen
+	if (y < 0 || y >= dev->_height) return;
+	if (x < 0) {w += x; x = 0;} // clip
+	if (x+w > dev->_width) w = dev->_width-x;
+	if (w <= 0) return;
 
-  int16_t err = dx / 2;
-  int16_t ystep;
+	if (dev->_use_frame_buffer) {
+		sh->span(sh, x, y, w, dev->_frame_buffer + y*dev->_width + x);
+		lcdMark(dev, x, y, x+w-1, y);
+	} else {
+		spi_master_write_window(dev, x, y, x+w-1, y);
+		lcdShadeStream(dev, x, y, w, sh);
+		spi_stream_flush(dev);
+	}
+}
 
-  if (y0 < y1) {
-    ystep = 1;
-  } else {
-    ystep = -1;
-  }
+// Shade w pixels from (x, y) into the stream, in pieces of BUF_LEN
+static void lcdShadeStream(TFT_t *dev, int32_t x, int32_t y, int32_t w, const lcd_shader_t *sh)
+{
+	static uint16_t shade_buf[BUF_LEN];
+	while (w) {
+		int32_t n = (w < BUF_LEN) ? w : BUF_LEN;
+		sh->span(sh, x, y, n, shade_buf);
+		spi_stream_colors(dev, shade_buf, n);
+		x += n;
+		w -= n;
+	}
+}
 
-  for (; x0 <= x1; x0++) {
-    if (steep) {
-      lcdDrawPixel(dev, y0, x0, color);
-    } else {
-      lcdDrawPixel(dev, x0, y0, color);
-    }
-    err -= dy;
-    if (err < 0) {
-      y0 += ystep;
-      err += dx;
-    }
-  }
+// Fill a horizontal span with a color, or with a shader if not NULL
+static inline void lcdSpan(TFT_t *dev, int32_t x, int32_t y, int32_t w, uint16_t color, const lcd_shader_t *sh)
+{
+	if (sh) lcdShadeHLine(dev, x, y, w, sh);
+	else lcdDrawHLine(dev, x, y, w, color);
 }
-#endif
 
-/***************************************************************************************
-** Function name:           lcdDrawLine
-** Description:             draw a line between 2 arbitrary points
-***************************************************************************************/
-// Bresenham's algorithm - thx Wikipedia - speed enhanced by Bodmer to use
-// efficient H/V Line draw routines for line segments of 2 pixels or more.
+// Draw line
+// x0:Start X coordinate
+// y0:Start Y coordinate
+// x1:End X coordinate
+// y1:End Y coordinate
+// color:color
+// The line is clipped to the screen first (Cohen-Sutherland), then walked
+// with integer Bresenham. Pixels are emitted as horizontal runs for shallow
+// lines and vertical runs for steep lines, one window write per run.
 void lcdDrawLine(TFT_t *dev, int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint16_t color)
 {
-  bool steep = abs(y1 - y0) > abs(x1 - x0);
-  if (steep) {
-    swap(int32_t, x0, y0);
-    swap(int32_t, x1, y1);
-  }
-
-  if (x0 > x1) {
-    swap(int32_t, x0, x1);
-    swap(int32_t, y0, y1);
-  }
+	if (!lcdClipLine(dev, &x0, &y0, &x1, &y1)) return; // off screen
 
-  int32_t dx = x1 - x0, dy = abs(y1 - y0);;
+	int32_t dx = abs(x1 - x0), dy = abs(y1 - y0);
+	bool steep = dy > dx;
 
-  int32_t err = dx >> 1, ystep = -1, xs = x0, dlen = 0;
-
-  if (y0 < y1) ystep = 1;
+	// Walk along the major axis in the positive direction
+	if (steep ? (y0 > y1) : (x0 > x1)) {
+		swap(int32_t, x0, x1);
+		swap(int32_t, y0, y1);
+	}
 
-  // Split into steep and not steep for FastH/V separation
-  if (steep) {
-    for (; x0 <= x1; x0++) {
-      dlen++;
-      err -= dy;
-      if (err < 0) {
-        if (dlen == 1) lcdDrawPixel(dev, y0, xs, color);
-        else lcdDrawVLine(dev, y0, xs, dlen, color);
-        dlen = 0;
-        y0 += ystep; xs = x0 + 1;
-        err += dx;
-      }
-    }
-    if (dlen) lcdDrawVLine(dev, y0, xs, dlen, color);
-  }
-  else
-  {
-    for (; x0 <= x1; x0++) {
-      dlen++;
-      err -= dy;
-      if (err < 0) {
-        if (dlen == 1) lcdDrawPixel(dev, xs, y0, color);
-        else lcdDrawHLine(dev, xs, y0, dlen, color);
-        dlen = 0;
-        y0 += ystep; xs = x0 + 1;
-        err += dx;
-      }
-    }
-    if (dlen) lcdDrawHLine(dev, xs, y0, dlen, color);
-  }
+	if (steep) {
+		int32_t xstep = (x0 < x1) ? 1 : -1;
+		int32_t err = dy >> 1, ys = y0;
+		for (int32_t y = y0; y <= y1; y++) {
+			err -= dx;
+			if (err < 0) {
+				lcdDrawRun(dev, x0, ys, 1, y-ys+1, color);
+				x0 += xstep; ys = y + 1;
+				err += dy;
+			}
+		}
+		if (ys <= y1) lcdDrawRun(dev, x0, ys, 1, y1-ys+1, color);
+	} else {
+		int32_t ystep = (y0 < y1) ? 1 : -1;
+		int32_t err = dx >> 1, xs = x0;
+		for (int32_t x = x0; x <= x1; x++) {
+			err -= dy;
+			if (err < 0) {
+				lcdDrawRun(dev, xs, y0, x-xs+1, 1, color);
+				y0 += ystep; xs = x + 1;
+				err += dx;
+			}
+		}
+		if (xs <= x1) lcdDrawRun(dev, xs, y0, x1-xs+1, 1, color);
+	}
 }
 
 // Draw rectangle - assume x1 <= x2 && y1 <= y2
@@ -758,6 +1183,7 @@ void lcdFillRect(TFT_t *dev, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uin
 				dev->_frame_buffer[j*dev->_width+i] = color;
 			}
 		}
+		lcdMark(dev, x1, y1, x2, y2);
 	} else {
 		int32_t _x1 = x1 + dev->_offsetx;
 		int32_t _x2 = x2 + dev->_offsetx;
@@ -792,6 +1218,12 @@ void lcdDrawTri(TFT_t *dev, int32_t x0, int32_t y0, int32_t x1, int32_t y1, int3
 ***************************************************************************************/
 // Fill a triangle - original Adafruit function works well and code footprint is small
 void lcdFillTri(TFT_t *dev, int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint16_t color)
+{
+  lcdTriSpans(dev, x0, y0, x1, y1, x2, y2, color, NULL);
+}
+
+// Walk the horizontal spans of a triangle, filled with a color or a shader
+static void lcdTriSpans(TFT_t *dev, int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint16_t color, const lcd_shader_t *sh)
 {
   int32_t a, b, y, last;
 
@@ -812,7 +1244,7 @@ void lcdFillTri(TFT_t *dev, int32_t x0, int32_t y0, int32_t x1, int32_t y1, int3
     else if (x1 > b) b = x1;
     if (x2 < a)      a = x2;
     else if (x2 > b) b = x2;
-	lcdDrawHLine(dev, a, y0, b - a + 1, color);
+	lcdSpan(dev, a, y0, b - a + 1, color, sh);
     return;
   }
 
@@ -842,7 +1274,7 @@ void lcdFillTri(TFT_t *dev, int32_t x0, int32_t y0, int32_t x1, int32_t y1, int3
     sb += dx02;
 
     if (a > b) swap(int32_t, a, b);
-	lcdDrawHLine(dev, a, y, b - a + 1, color);
+	lcdSpan(dev, a, y, b - a + 1, color, sh);
   }
 
   // For lower part of triangle, find scanline crossings for segments
@@ -856,7 +1288,7 @@ void lcdFillTri(TFT_t *dev, int32_t x0, int32_t y0, int32_t x1, int32_t y1, int3
     sb += dx02;
 
     if (a > b) swap(int32_t, a, b);
-	lcdDrawHLine(dev, a, y, b - a + 1, color);
+	lcdSpan(dev, a, y, b - a + 1, color, sh);
   }
 }
 
@@ -1148,6 +1580,248 @@ void lcdDrawRegularPolygon(TFT_t *dev, int32_t xc, int32_t yc, int32_t n, int32_
 	}
 }
 
+/* * * * * * * * * * Shaders * * * * * * * * * */
+
+#define SHADE_ONE (1 << 16) // 1.0 in Q16
+
+// Linear gradient span: t is stepped in Q16 along the span. While t is
+// inside the gradient, each channel is stepped with its own Q16 increment.
+static void lcdGradientSpan(const lcd_shader_t *sh, int32_t x, int32_t y, int32_t w, uint16_t *colors)
+{
+	const uint16_t c0 = sh->color0, c1 = sh->color1;
+	int32_t r0 = c0 >> 11, g0 = (c0 >> 5) & 0x3F, b0 = c0 & 0x1F;
+	int32_t dr = (c1 >> 11) - r0, dg = ((c1 >> 5) & 0x3F) - g0, db = (c1 & 0x1F) - b0;
+	int32_t t = (x - sh->x0) * sh->dtx + (y - sh->y0) * sh->dty;
+	int32_t dt = sh->dtx;
+	int32_t r = 0, g = 0, b = 0;
+	bool inside = false;
+
+	while (w--) {
+		if (t <= 0) {
+			*colors++ = c0;
+		} else if (t >= SHADE_ONE) {
+			*colors++ = c1;
+		} else {
+			if (!inside) { // t is monotonic, so this happens once
+				r = (r0 << 16) + dr * t;
+				g = (g0 << 16) + dg * t;
+				b = (b0 << 16) + db * t;
+				inside = true;
+			}
+			*colors++ = ((r >> 16) << 11) | ((g >> 16) << 5) | (b >> 16);
+			r += dr * dt;
+			g += dg * dt;
+			b += db * dt;
+		}
+		t += dt;
+	}
+}
+
+// Integer division rounding toward negative infinity
+static inline int32_t lcdFloorDiv(int32_t a, int32_t b)
+{
+	return (a >= 0) ? a / b : -((b - 1 - a) / b);
+}
+
+// Checkerboard span with square cells of size pixels
+static void lcdCheckerSpan(const lcd_shader_t *sh, int32_t x, int32_t y, int32_t w, uint16_t *colors)
+{
+	int32_t size = sh->size;
+	int32_t qx = lcdFloorDiv(x - sh->x0, size);
+	int32_t qy = lcdFloorDiv(y - sh->y0, size);
+	int32_t n = (qx+1)*size - (x - sh->x0); // pixels left in first cell
+	bool odd = (qx + qy) & 1;
+
+	while (w) {
+		if (n > w) n = w;
+		uint16_t color = odd ? sh->color1 : sh->color0;
+		w -= n;
+		while (n--) *colors++ = color;
+		odd = !odd;
+		n = size;
+	}
+}
+
+// Ordered dither span mixing two colors with a 4x4 Bayer matrix
+static void lcdDitherSpan(const lcd_shader_t *sh, int32_t x, int32_t y, int32_t w, uint16_t *colors)
+{
+	static const uint8_t bayer[4][4] = {
+		{ 0,  8,  2, 10},
+		{12,  4, 14,  6},
+		{ 3, 11,  1,  9},
+		{15,  7, 13,  5},
+	};
+	const uint8_t *row = bayer[y & 3];
+	int32_t level = sh->size;
+
+	while (w--) {
+		*colors++ = (row[x & 3] < level) ? sh->color1 : sh->color0;
+		x++;
+	}
+}
+
+// Set up a linear gradient from color0 at (x0,y0) to color1 at (x1,y1).
+// Pixels before the start or past the end get the end colors.
+void lcdShaderGradient(lcd_shader_t *sh, int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint16_t color0, uint16_t color1)
+{
+	int64_t dx = x1 - x0, dy = y1 - y0;
+	int64_t len2 = dx*dx + dy*dy;
+	if (len2 == 0) len2 = 1;
+	sh->span = lcdGradientSpan;
+	sh->color0 = color0;
+	sh->color1 = color1;
+	sh->x0 = x0;
+	sh->y0 = y0;
+	sh->dtx = (dx << 16) / len2;
+	sh->dty = (dy << 16) / len2;
+	sh->user = NULL;
+}
+
+// Set up a checkerboard of size x size cells anchored at the origin
+void lcdShaderChecker(lcd_shader_t *sh, int32_t size, uint16_t color0, uint16_t color1)
+{
+	sh->span = lcdCheckerSpan;
+	sh->color0 = color0;
+	sh->color1 = color1;
+	sh->x0 = 0;
+	sh->y0 = 0;
+	sh->size = (size > 0) ? size : 1;
+	sh->user = NULL;
+}
+
+// Set up an ordered dither of two colors.
+// level:0 (all color0) to 16 (all color1)
+void lcdShaderDither(lcd_shader_t *sh, int32_t level, uint16_t color0, uint16_t color1)
+{
+	sh->span = lcdDitherSpan;
+	sh->color0 = color0;
+	sh->color1 = color1;
+	sh->size = level;
+	sh->user = NULL;
+}
+
+// Shade a rectangle - assume x1 <= x2 && y1 <= y2
+// x1:Start X coordinate
+// y1:Start Y coordinate
+// x2:End X coordinate
+// y2:End Y coordinate
+// sh:shader
+void lcdShadeRect(TFT_t *dev, int32_t x1, int32_t y1, int32_t x2, int32_t y2, const lcd_shader_t *sh) {
+	if (x2 < 0 || x1 >= dev->_width) return; // off screen
+	if (y2 < 0 || y1 >= dev->_height) return;
+	if (x1 < 0) x1 = 0; // clip
+	if (x2 >= dev->_width) x2=dev->_width-1;
+	if (y1 < 0) y1 = 0;
+	if (y2 >= dev->_height) y2=dev->_height-1;
+
+	int32_t w = x2-x1+1;
+	if (dev->_use_frame_buffer) {
+		uint16_t *ptr = dev->_frame_buffer + y1*dev->_width + x1;
+		for (int32_t j = y1; j <= y2; j++) {
+			sh->span(sh, x1, j, w, ptr);
+			ptr += dev->_width;
+		}
+		lcdMark(dev, x1, y1, x2, y2);
+	} else {
+		spi_master_write_window(dev, x1, y1, x2, y2);
+		for (int32_t j = y1; j <= y2; j++) lcdShadeStream(dev, x1, j, w, sh);
+		spi_stream_flush(dev);
+	}
+}
+
+// Shade a triangle
+void lcdShadeTri(TFT_t *dev, int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, const lcd_shader_t *sh)
+{
+	lcdTriSpans(dev, x0, y0, x1, y1, x2, y2, 0, sh);
+}
+
+// Shade a circle
+// x0:Central X coordinate
+// y0:Central Y coordinate
+// r:radius
+// sh:shader
+void lcdShadeCircle(TFT_t *dev, int32_t x0, int32_t y0, int32_t r, const lcd_shader_t *sh) {
+	int32_t x;
+	int32_t y;
+	int32_t err;
+	int32_t old_err;
+	int32_t ChangeX;
+	int32_t px = -1, py = 0; // last column and its half height
+
+	// Same walk as lcdFillCircle, but each column's half height closes the
+	// rows above it, which are then emitted as horizontal spans.
+	x=0;
+	y=-r;
+	err=2-2*r;
+	ChangeX=1;
+	do{
+		if(ChangeX) {
+			for (; px >= 0 && py > -y; py--) {
+				lcdShadeHLine(dev, x0-px, y0-py, 2*px+1, sh);
+				lcdShadeHLine(dev, x0-px, y0+py, 2*px+1, sh);
+			}
+			px = x;
+			py = -y;
+		} // endif
+		ChangeX=(old_err=err)<=x;
+		if (ChangeX)			err+=++x*2+1;
+		if (old_err>y || err>x) err+=++y*2+1;
+	} while(y<=0);
+	for (; py > 0; py--) {
+		lcdShadeHLine(dev, x0-px, y0-py, 2*px+1, sh);
+		lcdShadeHLine(dev, x0-px, y0+py, 2*px+1, sh);
+	}
+	lcdShadeHLine(dev, x0-px, y0, 2*px+1, sh);
+}
+
+#define POLY_MAX 64 // most sides shaded, more look the same
+
+// Shade a regular polygon
+// xc:Center X coordinate
+// yc:Center Y coordinate
+// n:Number of slides
+// r:radius
+// angle:Angle of regular polygon
+// sh:shader
+void lcdShadeRegularPolygon(TFT_t *dev, int32_t xc, int32_t yc, int32_t n, int32_t r, int32_t angle, const lcd_shader_t *sh)
+{
+	float rd = -angle * M_PIf / 180.0f;
+	float c = cosf(rd), s = sinf(rd);
+	int32_t vx[POLY_MAX+1], vy[POLY_MAX+1];
+	int32_t ymin = INT32_MAX, ymax = INT32_MIN;
+
+	if (n < 3) return;
+	if (n > POLY_MAX) n = POLY_MAX;
+	for (int32_t i = 0; i < n; i++) {
+		float xd = r * cosf(2 * M_PIf * i / n);
+		float yd = r * sinf(2 * M_PIf * i / n);
+		vx[i] = (int32_t)(xd * c - yd * s + xc);
+		vy[i] = (int32_t)(xd * s + yd * c + yc);
+		if (vy[i] < ymin) ymin = vy[i];
+		if (vy[i] > ymax) ymax = vy[i];
+	}
+	vx[n] = vx[0]; // close
+	vy[n] = vy[0];
+	if (ymin < 0) ymin = 0; // clip
+	if (ymax >= dev->_height) ymax = dev->_height-1;
+
+	// The polygon is convex, so each row is one span between the leftmost
+	// and rightmost edge crossings, and each pixel is shaded once
+	for (int32_t y = ymin; y <= ymax; y++) {
+		int32_t xl = INT32_MAX, xr = INT32_MIN;
+		for (int32_t i = 0; i < n; i++) {
+			int32_t xa = vx[i], ya = vy[i], xb = vx[i+1], yb = vy[i+1];
+			if (y < ya && y < yb) continue;
+			if (y > ya && y > yb) continue;
+			if (ya != yb) xa = xb = xa + (y - ya) * (xb - xa) / (yb - ya);
+			else if (xa > xb) swap(int32_t, xa, xb); // a flat edge spans both ends
+			if (xa < xl) xl = xa;
+			if (xb > xr) xr = xb;
+		}
+		if (xl <= xr) lcdShadeHLine(dev, xl, y, xr-xl+1, sh);
+	}
+}
+
 // Draw ASCII character
 // x:X coordinate
 // y:Y coordinate
@@ -1276,6 +1950,24 @@ void lcdInversionOn(TFT_t *dev) {
 	spi_master_write_command(dev, 0x21); // Display Inversion On
 }
 
+// Define the vertical scroll area, in display rows. The sum of the three
+// areas must equal the number of rows in the display memory.
+// top:Number of fixed rows at the top
+// height:Number of rows that scroll
+// bottom:Number of fixed rows at the bottom
+void lcdScrollArea(TFT_t *dev, int32_t top, int32_t height, int32_t bottom) {
+	spi_master_write_command(dev, 0x33);	// Vertical Scrolling Definition
+	spi_master_write_addr(dev, top, height);
+	spi_master_write_data_word(dev, bottom);
+}
+
+// Set the memory row shown at the top of the scroll area
+// line:top <= line < top+height, as given to lcdScrollArea
+void lcdScrollStart(TFT_t *dev, int32_t line) {
+	spi_master_write_command(dev, 0x37);	// Vertical Scrolling Start Address
+	spi_master_write_data_word(dev, line);
+}
+
 // Enable use of frame buffer
 void lcdFrameEnable(TFT_t *dev) {
 	dev->_frame_buffer = heap_caps_malloc(sizeof(uint16_t)*dev->_width*dev->_height, MALLOC_CAP_DMA);
@@ -1287,10 +1979,140 @@ void lcdFrameEnable(TFT_t *dev) {
 	}
 }
 
+// Enable use of a half resolution frame buffer. Drawing uses the reduced
+// width and height, and lcdWriteFrame doubles each pixel horizontally and
+// vertically, so raster work and memory drop by 4x.
+void lcdFrameEnableHalf(TFT_t *dev) {
+	if (dev->_use_frame_buffer) {
+		ESP_LOGE(TAG, "frame buffer already enabled");
+		return;
+	}
+	int32_t _width = dev->_width / 2;
+	int32_t _height = dev->_height / 2;
+	dev->_frame_buffer = heap_caps_malloc(sizeof(uint16_t)*_width*_height, MALLOC_CAP_DMA);
+	if (dev->_frame_buffer == NULL) {
+		ESP_LOGE(TAG, "heap_caps_malloc fail");
+	} else {
+		ESP_LOGI(TAG, "heap_caps_malloc success");
+		dev->_width = _width;
+		dev->_height = _height;
+		dev->_frame_scale = 2;
+		dev->_use_frame_buffer = true;
+	}
+}
+
 // Disable use of frame buffer
 void lcdFrameDisable(TFT_t *dev) {
+	lcdLayerDisable(dev);
 	if (dev->_frame_buffer != NULL) heap_caps_free(dev->_frame_buffer);
+	dev->_frame_buffer = NULL;
 	dev->_use_frame_buffer = false;
+	if (dev->_frame_scale > 1) {
+		dev->_width *= dev->_frame_scale;
+		dev->_height *= dev->_frame_scale;
+		dev->_frame_scale = 1;
+	}
+}
+
+// Enable layers. The current frame buffer contents become the static
+// background layer, cached in run-length encoded form. Dynamic layers drawn
+// afterward are cleared with lcdLayerClear and only changed blocks are
+// written by lcdWriteFrame. May be called again to capture a new background.
+void lcdLayerEnable(TFT_t *dev) {
+	if (dev->_use_frame_buffer == false) {
+		ESP_LOGE(TAG, "layers need a frame buffer");
+		return;
+	}
+	if (dev->_frame_scale > 1) {
+		ESP_LOGE(TAG, "layers need a full resolution frame buffer");
+		return;
+	}
+	struct lcd_layers_s *ls = dev->_layers;
+	if (ls == NULL) {
+		ls = heap_caps_calloc(1, sizeof(struct lcd_layers_s), MALLOC_CAP_8BIT);
+		if (ls == NULL) {
+			ESP_LOGE(TAG, "heap_caps_calloc fail");
+			return;
+		}
+	} else if (ls->runs != NULL) {
+		heap_caps_free(ls->runs);
+	}
+
+	// Count the runs, then encode them
+	uint32_t nruns = 0;
+	for (int32_t y = 0; y < dev->_height; y++) {
+		uint16_t *ptr = dev->_frame_buffer + y*dev->_width;
+		nruns++;
+		for (int32_t x = 1; x < dev->_width; x++) nruns += (ptr[x] != ptr[x-1]);
+	}
+	ls->runs = heap_caps_malloc(nruns*sizeof(lcd_run_t), MALLOC_CAP_8BIT);
+	if (ls->runs == NULL) {
+		ESP_LOGE(TAG, "heap_caps_malloc fail");
+		heap_caps_free(ls);
+		dev->_layers = NULL;
+		return;
+	}
+	lcd_run_t *run = ls->runs;
+	for (int32_t y = 0; y < dev->_height; y++) {
+		uint16_t *ptr = dev->_frame_buffer + y*dev->_width;
+		ls->row[y] = run - ls->runs;
+		run->color = ptr[0];
+		run->len = 1;
+		for (int32_t x = 1; x < dev->_width; x++) {
+			if (ptr[x] == run->color) {
+				run->len++;
+			} else {
+				run++;
+				run->color = ptr[x];
+				run->len = 1;
+			}
+		}
+		run++;
+	}
+	ESP_LOGI(TAG, "background runs:%"PRIu32" bytes:%u", nruns, (unsigned)(nruns*sizeof(lcd_run_t)));
+
+	ls->sel = 0;
+	memset(ls->dirty, 0, sizeof(ls->dirty));
+	memset(ls->send, 0xFF, sizeof(ls->send)); // whole screen on next write
+	dev->_layers = ls;
+}
+
+// Disable layers and free the cached background
+void lcdLayerDisable(TFT_t *dev) {
+	struct lcd_layers_s *ls = dev->_layers;
+	if (ls == NULL) return;
+	if (ls->runs != NULL) heap_caps_free(ls->runs);
+	heap_caps_free(ls);
+	dev->_layers = NULL;
+}
+
+// Select the dynamic layer that following draw calls belong to
+// layer:0 to LCD_LAYERS-1
+void lcdLayerSelect(TFT_t *dev, int32_t layer) {
+	if (dev->_layers == NULL || layer < 0 || layer >= LCD_LAYERS) return;
+	dev->_layers->sel = layer;
+}
+
+// Clear a dynamic layer by restoring the background where it was drawn.
+// Other layers drawn in the same blocks are erased too and must be redrawn.
+// layer:0 to LCD_LAYERS-1
+void lcdLayerClear(TFT_t *dev, int32_t layer) {
+	struct lcd_layers_s *ls = dev->_layers;
+	if (ls == NULL || layer < 0 || layer >= LCD_LAYERS) return;
+
+	for (int32_t r = 0; r < LAYER_ROWS; r++) {
+		uint32_t bits = ls->dirty[layer][r];
+		if (bits == 0) continue;
+		int32_t y1 = r*LAYER_BLK;
+		int32_t y2 = (y1+LAYER_BLK < dev->_height) ? y1+LAYER_BLK-1 : dev->_height-1;
+		for (int32_t c1 = 0, c2; lcdNextSpan(bits, &c1, &c2); c1 = c2+1) {
+			int32_t x1 = c1*LAYER_BLK;
+			int32_t x2 = ((c2+1)*LAYER_BLK < dev->_width) ? (c2+1)*LAYER_BLK-1 : dev->_width-1;
+			lcdRestore(dev, x1, y1, x2, y2);
+		}
+		ls->send[r] |= bits;
+		ls->dirty[layer][r] = 0;
+	}
 }
 
 // Scroll image in frame buffer
@@ -1345,6 +2167,7 @@ void lcdWrapArround(TFT_t *dev, scroll_t scroll, int32_t start, int32_t end) {
 			dev->_frame_buffer[i] = wk;
 		}
 	}
+	lcdMark(dev, 0, 0, _width-1, _height-1);
 }
 
 // Write frame buffer to display
@@ -1352,6 +2175,40 @@ void lcdWriteFrame(TFT_t *dev)
 {
 	if (dev->_use_frame_buffer == false) return;
 
+	// With layers, only write the blocks changed since the last write
+	struct lcd_layers_s *ls = dev->_layers;
+	if (ls != NULL) {
+		for (int32_t r = 0; r < LAYER_ROWS; r++) {
+			uint32_t bits = ls->send[r] & ((1ULL << LAYER_COLS) - 1);
+			if (bits == 0) continue;
+			int32_t y1 = r*LAYER_BLK;
+			int32_t y2 = (y1+LAYER_BLK < dev->_height) ? y1+LAYER_BLK-1 : dev->_height-1;
+			for (int32_t c1 = 0, c2; lcdNextSpan(bits, &c1, &c2); c1 = c2+1) {
+				int32_t x1 = c1*LAYER_BLK;
+				int32_t x2 = ((c2+1)*LAYER_BLK < dev->_width) ? (c2+1)*LAYER_BLK-1 : dev->_width-1;
+				spi_master_write_window(dev, x1, y1, x2, y2);
+				for (int32_t y = y1; y <= y2; y++) {
+					spi_stream_colors(dev, dev->_frame_buffer + y*dev->_width + x1, x2-x1+1);
+				}
+				spi_stream_flush(dev);
+			}
+			ls->send[r] = 0;
+		}
+		return;
+	}
+
+	// Half resolution: send every row twice, each pixel doubled
+	if (dev->_frame_scale == 2) {
+		spi_master_write_window(dev, 0, 0, dev->_width*2-1, dev->_height*2-1);
+		for (int32_t y = 0; y < dev->_height; y++) {
+			uint16_t *row = dev->_frame_buffer + y*dev->_width;
+			spi_stream_colors2(dev, row, dev->_width);
+			spi_stream_colors2(dev, row, dev->_width);
+		}
+		spi_stream_flush(dev);
+		return;
+	}
+
 	spi_master_write_command(dev, 0x2A); // set column(x) address
 	spi_master_write_addr(dev, dev->_offsetx, dev->_offsetx+dev->_width-1);
 	spi_master_write_command(dev, 0x2B); // set Page(y) address
@@ -1372,3 +2229,44 @@ void lcdWriteFrame(TFT_t *dev)
 #endif
 	return;
 }
+
+// Write the frame buffers of several panels on the bus. Chunks are queued
+// to the panels in turn, so all panels update together and the bus stays
+// busy while the next chunk is prepared. Panels with layers or a half
+// resolution frame buffer are written with lcdWriteFrame afterward.
+// devs:Array of panels
+// n:Number of panels
+void lcdWriteFrames(TFT_t *devs[], int32_t n)
+{
+	if (n <= 0) return;
+	size_t left[n];
+	bool busy = false;
+
+	for (int32_t i = 0; i < n; i++) {
+		TFT_t *dev = devs[i];
+		left[i] = 0;
+		if (!dev->_use_frame_buffer || dev->_layers || dev->_frame_scale > 1) continue;
+		spi_master_write_window(dev, 0, 0, dev->_width-1, dev->_height-1);
+		left[i] = dev->_width*dev->_height;
+		busy = true;
+	}
+	while (busy) {
+		busy = false;
+		for (int32_t i = 0; i < n; i++) {
+			if (left[i] == 0) continue;
+			TFT_t *dev = devs[i];
+			size_t sent = dev->_width*dev->_height - left[i];
+			size_t size = (left[i] < BUF_LEN) ? left[i] : BUF_LEN;
+			spi_stream_colors(dev, dev->_frame_buffer + sent, size);
+			spi_stream_queue(dev); // buffer belongs to this panel
+			left[i] -= size;
+			busy |= (left[i] != 0);
+		}
+	}
+	spi_stream_flush(devs[0]);
+
+	for (int32_t i = 0; i < n; i++) {
+		TFT_t *dev = devs[i];
+		if (dev->_use_frame_buffer && (dev->_layers || dev->_frame_scale > 1)) lcdWriteFrame(dev);
+	}
+}
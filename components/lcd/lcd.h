@@ -34,6 +34,9 @@
 #define LCD_H 240
 #endif
 
+// Number of dynamic layers, see lcdLayerEnable()
+#define LCD_LAYERS 2
+
 typedef enum {DIRECTION0, DIRECTION90, DIRECTION180, DIRECTION270} direction_t;
 
 typedef enum {
@@ -52,14 +55,26 @@ typedef struct {
 	uint8_t     _font_size;
 	bool        _font_back_en;
 	uint16_t    _font_back_color;
+	int8_t      _cs;
 	int8_t      _dc;
 	int8_t      _bl;
 	spi_device_handle_t _SPIHandle;
 	bool        _use_frame_buffer;
 	uint16_t   *_frame_buffer;
+	uint8_t     _frame_scale;
+	bool        _win_active;
+	int32_t     _win_x1;
+	int32_t     _win_y1;
+	int32_t     _win_x2;
+	int32_t     _win_y2;
+	int32_t     _win_x;
+	int32_t     _win_y;
+	struct lcd_layers_s *_layers;
 } TFT_t;
 
 void lcdInit(TFT_t *dev);
+void lcdInitPanel(TFT_t *dev, int16_t cs, int16_t dc, int16_t reset, int16_t bl);
+void lcdCanvasInit(TFT_t *dev, uint16_t *buf, int32_t width, int32_t height);
 
 // Draw (outline) and fill primitives
 void lcdFillScreen(TFT_t *dev, uint16_t color);
@@ -83,6 +98,38 @@ void lcdDrawRectangle(TFT_t *dev, int32_t xc, int32_t yc, int32_t w, int32_t h,
 void lcdDrawTriangle(TFT_t *dev, int32_t xc, int32_t yc, int32_t w, int32_t h, int32_t angle, uint16_t color);
 void lcdDrawRegularPolygon(TFT_t *dev, int32_t xc, int32_t yc, int32_t n, int32_t r, int32_t angle, uint16_t color);
 
+// Stream pixels into a window: set the window once, then push any number of
+// pixels in row-major order.
+void lcdBeginWindow(TFT_t *dev, int32_t x1, int32_t y1, int32_t x2, int32_t y2);
+void lcdPushPixels(TFT_t *dev, const uint16_t *colors, size_t size);
+void lcdEndWindow(TFT_t *dev);
+
+// Read back pixels, from the frame buffer or from the panel
+void lcdReadPixels(TFT_t *dev, int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *colors);
+
+// Span shaders: a shader produces the colors of one horizontal span and
+// feeds the shaded fills below. Set one up with a lcdShader function, or
+// fill in span (and user) for a custom shader.
+typedef struct lcd_shader_s lcd_shader_t;
+typedef void (*lcd_span_t)(const lcd_shader_t *sh, int32_t x, int32_t y, int32_t w, uint16_t *colors);
+struct lcd_shader_s {
+	lcd_span_t span; // write w colors for pixels (x,y) to (x+w-1,y)
+	uint16_t color0;
+	uint16_t color1;
+	int32_t x0, y0; // origin
+	int32_t dtx, dty; // gradient steps per pixel, Q16
+	int32_t size; // checker cell size, dither level
+	void *user; // for custom shaders
+};
+
+void lcdShaderGradient(lcd_shader_t *sh, int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint16_t color0, uint16_t color1);
+void lcdShaderChecker(lcd_shader_t *sh, int32_t size, uint16_t color0, uint16_t color1);
+void lcdShaderDither(lcd_shader_t *sh, int32_t level, uint16_t color0, uint16_t color1);
+void lcdShadeRect(TFT_t *dev, int32_t x1, int32_t y1, int32_t x2, int32_t y2, const lcd_shader_t *sh);
+void lcdShadeTri(TFT_t *dev, int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, const lcd_shader_t *sh);
+void lcdShadeCircle(TFT_t *dev, int32_t x0, int32_t y0, int32_t r, const lcd_shader_t *sh);
+void lcdShadeRegularPolygon(TFT_t *dev, int32_t xc, int32_t yc, int32_t n, int32_t r, int32_t angle, const lcd_shader_t *sh);
+
 // Characters and strings
 int32_t lcdDrawChar(TFT_t *dev, int32_t x, int32_t y, char ascii, uint16_t color);
 int32_t lcdDrawString(TFT_t *dev, int32_t x, int32_t y, char *ascii, uint16_t color);
@@ -101,9 +148,20 @@ void lcdBacklightOff(TFT_t *dev);
 void lcdBacklightOn(TFT_t *dev);
 void lcdInversionOff(TFT_t *dev);
 void lcdInversionOn(TFT_t *dev);
+void lcdScrollArea(TFT_t *dev, int32_t top, int32_t height, int32_t bottom);
+void lcdScrollStart(TFT_t *dev, int32_t line);
 void lcdFrameEnable(TFT_t *dev);
+void lcdFrameEnableHalf(TFT_t *dev);
 void lcdFrameDisable(TFT_t *dev);
 void lcdWrapArround(TFT_t *dev, scroll_t scroll, int32_t start, int32_t end);
 void lcdWriteFrame(TFT_t *dev);
+void lcdWriteFrames(TFT_t *devs[], int32_t n);
+
+// Layers: a static background cached once, plus dynamic layers that are
+// cleared by restoring the background only where they were drawn.
+void lcdLayerEnable(TFT_t *dev);
+void lcdLayerDisable(TFT_t *dev);
+void lcdLayerSelect(TFT_t *dev, int32_t layer);
+void lcdLayerClear(TFT_t *dev, int32_t layer);
 
 #endif // LCD_H_
@@ -136,6 +136,27 @@ TickType_t ColorBandTest(TFT_t *dev, int32_t width, int32_t height) {
 	return diffTick;
 }
 
+TickType_t ShaderTest(TFT_t *dev, int32_t width, int32_t height) {
+	TickType_t startTick, endTick, diffTick;
+	startTick = xTaskGetTickCount();
+
+	lcd_shader_t shader;
+	lcdShaderGradient(&shader, 0, 0, 0, height-1, RED, BLUE);
+	lcdShadeRect(dev, 0, 0, width-1, height-1, &shader);
+	lcdShaderChecker(&shader, 8, BLACK, WHITE);
+	lcdShadeCircle(dev, width/4, height/2, height/5, &shader);
+	lcdShaderDither(&shader, 6, YELLOW, PURPLE);
+	lcdShadeRegularPolygon(dev, width/2, height/2, 6, height/5, 0, &shader);
+	lcdShaderGradient(&shader, width*5/8, 0, width-1, 0, GREEN, CYAN);
+	lcdShadeTri(dev, width*5/8, height*3/4, width-1, height*3/4, width*13/16, height/4, &shader);
+	lcdWriteFrame(dev);
+
+	endTick = xTaskGetTickCount();
+	diffTick = endTick - startTick;
+	ESP_LOGI(__FUNCTION__, "elapsed time[ms]:%"PRIu32,diffTick*portTICK_PERIOD_MS);
+	return diffTick;
+}
+
 TickType_t FillRectTest(TFT_t *dev, int32_t width, int32_t height) {
 	TickType_t startTick, endTick, diffTick;
 	startTick = xTaskGetTickCount();
@@ -500,6 +521,60 @@ TickType_t TextTest(TFT_t *dev, int32_t width, int32_t height) {
 	return diffTick;
 }
 
+TickType_t StreamTest(TFT_t *dev, int32_t width, int32_t height) {
+	TickType_t startTick, endTick, diffTick;
+	startTick = xTaskGetTickCount();
+
+	uint16_t line[width];
+	lcdBeginWindow(dev, 0, 0, width-1, height-1);
+	for(int32_t ypos=0;ypos<height;ypos++) {
+		for(int32_t xpos=0;xpos<width;xpos++) {
+			line[xpos] = rgb565(xpos*255/width, ypos*255/height, (xpos^ypos)&0xFF);
+		}
+		lcdPushPixels(dev, line, width);
+	}
+	lcdEndWindow(dev);
+	lcdWriteFrame(dev);
+
+	endTick = xTaskGetTickCount();
+	diffTick = endTick - startTick;
+	ESP_LOGI(__FUNCTION__, "elapsed time[ms]:%"PRIu32,diffTick*portTICK_PERIOD_MS);
+	return diffTick;
+}
+
+TickType_t ReadbackTest(TFT_t *dev, int32_t width, int32_t height) {
+	TickType_t startTick, endTick, diffTick;
+	startTick = xTaskGetTickCount();
+
+	// Save under a box, draw over it, then restore and verify
+	int32_t w = width/4, h = height/4;
+	int32_t x = (width-w)/2, y = (height-h)/2;
+	uint16_t *save = malloc(w*h*sizeof(uint16_t));
+	uint16_t *check = malloc(w*h*sizeof(uint16_t));
+	if (save == NULL || check == NULL) {
+		ESP_LOGE(__FUNCTION__, "malloc fail");
+		free(save);
+		free(check);
+		return 0;
+	}
+	StreamTest(dev, width, height);
+	lcdReadPixels(dev, x, y, w, h, save);
+	lcdFillRect(dev, x, y, x+w-1, y+h-1, RED);
+	for (int32_t j = 0; j < h; j++) lcdDrawMultiPixels(dev, x, y+j, w, save+j*w);
+	lcdWriteFrame(dev);
+	lcdReadPixels(dev, x, y, w, h, check);
+	int32_t errors = 0;
+	for (int32_t i = 0; i < w*h; i++) errors += (save[i] != check[i]);
+	ESP_LOGI(__FUNCTION__, "readback errors:%"PRId32, errors);
+	free(save);
+	free(check);
+
+	endTick = xTaskGetTickCount();
+	diffTick = endTick - startTick;
+	ESP_LOGI(__FUNCTION__, "elapsed time[ms]:%"PRIu32,diffTick*portTICK_PERIOD_MS);
+	return diffTick;
+}
+
 void LCD(void *pvParameters)
 {
 	TFT_t dev;
@@ -517,6 +592,9 @@ void LCD(void *pvParameters)
 		ColorBandTest(&dev, LCD_W, LCD_H);
 		WAIT;
 
+		ShaderTest(&dev, LCD_W, LCD_H);
+		WAIT;
+
 		ArrowTest(&dev, LCD_W, LCD_H);
 		WAIT;
 
@@ -558,5 +636,11 @@ void LCD(void *pvParameters)
 		TextTest(&dev, LCD_W, LCD_H);
 		WAIT;
 
+		StreamTest(&dev, LCD_W, LCD_H);
+		WAIT;
+
+		ReadbackTest(&dev, LCD_W, LCD_H);
+		WAIT;
+
 	} // end while
 }
@@ -15,6 +15,8 @@ TickType_t ColorBarTest(TFT_t *dev, int32_t width, int32_t height);
 
 TickType_t ColorBandTest(TFT_t *dev, int32_t width, int32_t height);
 
+TickType_t ShaderTest(TFT_t *dev, int32_t width, int32_t height);
+
 TickType_t FillRectTest(TFT_t *dev, int32_t width, int32_t height);
 
 TickType_t FillTriTest(TFT_t *dev, int32_t width, int32_t height);
@@ -35,6 +37,10 @@ TickType_t TextDirTest(TFT_t *dev, int32_t width, int32_t height);
 
 TickType_t TextParamTest(TFT_t *dev, int32_t width, int32_t height);
 
+TickType_t StreamTest(TFT_t *dev, int32_t width, int32_t height);
+
+TickType_t ReadbackTest(TFT_t *dev, int32_t width, int32_t height);
+
 // Calls all the tests in a forever loop
 void LCD(void *pvParameters);
 
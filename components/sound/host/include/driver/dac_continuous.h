@@ -0,0 +1,54 @@
+// Host build: the continuous DAC API, played by a virtual DMA clock
+// (see sim_dac.c).
+#ifndef DAC_CONTINUOUS_H_
+#define DAC_CONTINUOUS_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+typedef struct dac_continuous_s *dac_continuous_handle_t;
+
+typedef enum {DAC_CHANNEL_MASK_CH0 = 1, DAC_CHANNEL_MASK_CH1 = 2} dac_channel_mask_t;
+typedef enum {DAC_CHANNEL_MODE_SIMUL, DAC_CHANNEL_MODE_ALTER} dac_continuous_channel_mode_t;
+typedef enum {DAC_DIGI_CLK_SRC_DEFAULT, DAC_DIGI_CLK_SRC_APLL} dac_continuous_digi_clk_src_t;
+
+typedef struct {
+	dac_channel_mask_t chan_mask;
+	uint32_t desc_num;
+	size_t buf_size;
+	uint32_t freq_hz;
+	int8_t offset;
+	dac_continuous_digi_clk_src_t clk_src;
+	dac_continuous_channel_mode_t chan_mode;
+} dac_continuous_config_t;
+
+typedef struct {
+	void *buf;
+	size_t buf_size;
+	size_t write_bytes;
+} dac_event_data_t;
+
+typedef bool (*dac_isr_callback_t)(dac_continuous_handle_t handle,
+	const dac_event_data_t *event, void *user_data);
+
+typedef struct {
+	dac_isr_callback_t on_convert_done;
+	dac_isr_callback_t on_stop;
+} dac_event_callbacks_t;
+
+esp_err_t dac_continuous_new_channels(const dac_continuous_config_t *cfg,
+	dac_continuous_handle_t *handle);
+esp_err_t dac_continuous_del_channels(dac_continuous_handle_t handle);
+esp_err_t dac_continuous_enable(dac_continuous_handle_t handle);
+esp_err_t dac_continuous_disable(dac_continuous_handle_t handle);
+esp_err_t dac_continuous_register_event_callback(dac_continuous_handle_t handle,
+	const dac_event_callbacks_t *callbacks, void *user_data);
+esp_err_t dac_continuous_start_async_writing(dac_continuous_handle_t handle);
+esp_err_t dac_continuous_stop_async_writing(dac_continuous_handle_t handle);
+esp_err_t dac_continuous_write_asynchronously(dac_continuous_handle_t handle,
+	uint8_t *dma_buf, size_t dma_buf_len, const uint8_t *data,
+	size_t data_len, size_t *bytes_loaded);
+
+#endif /* DAC_CONTINUOUS_H_ */
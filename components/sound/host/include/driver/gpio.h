@@ -0,0 +1,22 @@
+// Host build: pins are ignored.
+#ifndef GPIO_H_
+#define GPIO_H_
+
+#include <stdint.h>
+#include "esp_err.h"
+
+typedef enum {GPIO_INTR_DISABLE} gpio_int_type_t;
+typedef enum {GPIO_MODE_INPUT, GPIO_MODE_OUTPUT} gpio_mode_t;
+
+typedef struct {
+	uint64_t pin_bit_mask;
+	gpio_mode_t mode;
+	uint32_t pull_up_en;
+	uint32_t pull_down_en;
+	gpio_int_type_t intr_type;
+} gpio_config_t;
+
+static inline esp_err_t gpio_config(const gpio_config_t *cfg) {return ESP_OK;}
+static inline esp_err_t gpio_set_level(uint32_t pin, uint32_t level) {return ESP_OK;}
+
+#endif /* GPIO_H_ */
@@ -0,0 +1,17 @@
+// Host build: errors are fatal, as with the default abort on target.
+#ifndef ESP_CHECK_H_
+#define ESP_CHECK_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "esp_err.h"
+
+#define ESP_ERROR_CHECK(x) do { \
+		esp_err_t err_ = (x); \
+		if (err_ != ESP_OK) { \
+			fprintf(stderr, "%s:%d: %s failed (%d)\n", __FILE__, __LINE__, #x, err_); \
+			abort(); \
+		} \
+	} while (0)
+
+#endif /* ESP_CHECK_H_ */
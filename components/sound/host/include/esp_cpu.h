@@ -0,0 +1,11 @@
+// Host build: "cycles" are nanoseconds of the monotonic clock.
+#ifndef ESP_CPU_H_
+#define ESP_CPU_H_
+
+#include <stdint.h>
+
+typedef uint32_t esp_cpu_cycle_count_t;
+
+esp_cpu_cycle_count_t esp_cpu_get_cycle_count(void);
+
+#endif /* ESP_CPU_H_ */
@@ -0,0 +1,16 @@
+// Host build: capabilities are ignored.
+#ifndef ESP_HEAP_CAPS_H_
+#define ESP_HEAP_CAPS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#define MALLOC_CAP_8BIT (1<<2)
+#define MALLOC_CAP_DMA (1<<3)
+#define MALLOC_CAP_INTERNAL (1<<11)
+
+static inline void *heap_caps_malloc(size_t size, uint32_t caps) {return malloc(size);}
+static inline void heap_caps_free(void *ptr) {free(ptr);}
+
+#endif /* ESP_HEAP_CAPS_H_ */
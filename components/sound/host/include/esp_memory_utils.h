@@ -0,0 +1,9 @@
+// Host build: all data is taken to be in flash, so clips can be cached.
+#ifndef ESP_MEMORY_UTILS_H_
+#define ESP_MEMORY_UTILS_H_
+
+#include <stdbool.h>
+
+static inline bool esp_ptr_in_drom(const void *p) {return true;}
+
+#endif /* ESP_MEMORY_UTILS_H_ */
@@ -0,0 +1,24 @@
+// Host build: the subset of FreeRTOS used by the sound component.
+#ifndef FREERTOS_H_
+#define FREERTOS_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned UBaseType_t;
+
+#define configTICK_RATE_HZ 100
+#define portTICK_PERIOD_MS (1000 / configTICK_RATE_HZ)
+#define portMAX_DELAY 0xFFFFFFFFU
+#define pdMS_TO_TICKS(ms) ((TickType_t)((ms) * configTICK_RATE_HZ / 1000))
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS pdTRUE
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+
+#endif /* FREERTOS_H_ */
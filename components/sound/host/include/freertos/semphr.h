@@ -0,0 +1,13 @@
+// Host build: mutexes only.
+#ifndef SEMPHR_H_
+#define SEMPHR_H_
+
+#include "freertos/FreeRTOS.h"
+
+typedef void *SemaphoreHandle_t;
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void);
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem);
+
+#endif /* SEMPHR_H_ */
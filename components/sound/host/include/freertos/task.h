@@ -0,0 +1,18 @@
+// Host build: tasks run as threads (see sim_rtos.c).
+#ifndef TASK_H_
+#define TASK_H_
+
+#include "freertos/FreeRTOS.h"
+
+typedef void *TaskHandle_t;
+typedef void (*TaskFunction_t)(void *);
+
+BaseType_t xTaskCreate(TaskFunction_t func, const char *name, uint32_t stack,
+	void *arg, UBaseType_t prio, TaskHandle_t *handle);
+void vTaskDelete(TaskHandle_t handle);
+void vTaskDelay(TickType_t ticks);
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks);
+void vTaskNotifyGiveFromISR(TaskHandle_t handle, BaseType_t *woken);
+
+#endif /* TASK_H_ */
@@ -0,0 +1,981 @@
+// Host simulator for the sound component. Runs sound.c against a virtual
+// DAC (sim_dac.c) to render audio to a WAV file, check the mixer, codecs
+// and sound effects (tone/sfx.c) against known output, and measure refill
+// throughput.
+//
+// Usage:
+//   sound_sim render [-o out.wav] [stream.wav]
+//   sound_sim test
+//   sound_sim bench [resample]
+
+#define _GNU_SOURCE // memmem
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "sound.h"
+#include "sfx.h"
+#include "sim.h"
+#include "bcFire48k.h"
+#include "gunEmpty48k.h"
+#include "powerUp48k.h"
+#include "powerUp48kIma.h"
+
+#define RATE 48000U
+#define SILENCE 0x80U
+#define TEST_SZ 256
+#define BENCH_MS 20000 // audio time per benchmark case
+
+static uint32_t lead; // samples from a play call to its first sample out
+static uint32_t failed;
+
+static void check(bool ok, const char *name, const char *fmt, double val)
+{
+	printf("%-28s %s  ", name, ok ? "pass" : "FAIL");
+	printf(fmt, val);
+	printf("\n");
+	if (!ok) failed++;
+}
+
+// Run until all voices end, then a little longer to drain the DMA.
+static void run_idle(void)
+{
+	while (sound_busy()) sim_run_ms(10);
+	sim_run_ms(50);
+}
+
+// Signal to noise ratio in dB of n output samples against a reference,
+// both centered on SILENCE.
+static double snr_db(const uint8_t *out, const double *ref, size_t n)
+{
+	double sig = 0, err = 0;
+
+	for (size_t i = 0; i < n; i++) {
+		double r = ref[i] - SILENCE, d = out[i] - ref[i];
+		sig += r * r;
+		err += d * d;
+	}
+	return err ? 10 * log10(sig / err) : 99;
+}
+
+// Return the play latency in samples from a ramp played at full volume,
+// or 0 if the ramp is not found.
+static uint32_t find_lead(void)
+{
+	uint8_t ramp[TEST_SZ];
+
+	for (uint32_t i = 0; i < TEST_SZ; i++) ramp[i] = i;
+	sound_set_volume(MAX_VOL);
+	sim_record(true);
+	sound_play(ramp, TEST_SZ, 0, MAX_VOL, SOUND_PRIO_DEFAULT, false);
+	run_idle();
+	sim_record(false);
+	uint8_t *p = memmem(sim_out, sim_nout, ramp, TEST_SZ);
+	return p ? p - sim_out : 0;
+}
+
+// Find the play latency.
+static void test_lead(void)
+{
+	lead = find_lead();
+	check(lead != 0, "play latency", "%.0f samples", lead);
+}
+
+// Each latency profile plays after its queued buffers, and a profile with
+// buffers too short for the rate falls back to the next. The play latency
+// in the stats is the lead found in the output, within a us per buffer.
+static void test_latency(void)
+{
+	static const char *names[] = {"low", "balanced", "low cpu"};
+	static const uint32_t desc[] = {4, 8, 8}, samples[] = {32, 64, 256};
+	sound_stats_t st;
+	char name[32];
+
+	for (uint32_t p = 0; p < SOUND_LATENCY_LAST; p++) {
+		sound_init(RATE, p);
+		sound_get_stats(&st, true);
+		uint32_t n = find_lead();
+		sound_get_stats(&st, true);
+		uint32_t refill = samples[p] * 1000000ULL / RATE;
+		snprintf(name, sizeof(name), "latency %s", names[p]);
+		check(n == desc[p]*samples[p] && st.profile == p && st.refill_us == refill &&
+			st.lead_us == (desc[p]-1)*refill, name, "%.0f samples", n);
+		uint32_t us = n * 1000000ULL / RATE;
+		snprintf(name, sizeof(name), "latency stat %s", names[p]);
+		check(st.plays == 1 && st.latency_max_us + desc[p] >= us &&
+			st.latency_max_us <= us + desc[p], name, "%.0f us", st.latency_max_us);
+	}
+	sound_init(RATE*5, SOUND_LATENCY_LOW); // 32 samples in 133 us
+	sound_get_stats(&st, true);
+	check(st.profile == SOUND_LATENCY_BALANCED, "latency fallback", "%.0f us refills",
+		st.refill_us);
+	// With no refills the channel is deleted again
+	sim_hold(true);
+	int32_t ret = sound_init(RATE, SOUND_LATENCY_BALANCED);
+	sim_hold(false);
+	uint64_t t = sim_samples();
+	sim_run_ms(10);
+	check(ret != 0 && sim_samples() == t, "init fails without refills", "%.0f", ret);
+	sound_init(RATE, SOUND_LATENCY_BALANCED);
+}
+
+// The cycle counts are of the time spent in refills. A refill held off
+// past the end of the next buffer misses that buffer, which plays its old
+// samples again, and each one missed counts as late once the ring comes
+// round to it.
+static void test_stats(void)
+{
+	static const uint32_t stalls[] = {1, 2, 20}; // buffers of 64 samples
+	uint8_t a[300];
+	sound_stats_t st;
+	char name[32];
+
+	memset(a, 0x40, sizeof(a));
+	int32_t v = sound_play(a, sizeof(a), 0, MAX_VOL, SOUND_PRIO_DEFAULT, true);
+	sim_run_ms(10);
+	sound_get_stats(&st, true);
+	sim_cb_reset();
+	sim_run_ms(100);
+	sound_get_stats(&st, false);
+	check(st.refills && st.cycles_avg && st.cycles_max >= st.cycles_avg &&
+		(uint64_t)st.cycles_avg * st.refills <= sim_cb_ns(), "refill cycles",
+		"%.0f avg", st.cycles_avg);
+	check(st.late == 0, "no late refills", "%.0f", st.late);
+
+	for (uint32_t i = 0; i < sizeof(stalls)/sizeof(stalls[0]); i++) {
+		sound_get_stats(&st, true);
+		uint64_t m = sim_missed();
+		sim_hold(true);
+		sim_run(stalls[i]*64);
+		sim_hold(false);
+		sim_run_ms(50); // a few passes of the ring
+		sound_get_stats(&st, false);
+		m = sim_missed() - m;
+		snprintf(name, sizeof(name), "late after %u buffer stall", (unsigned)stalls[i]);
+		check(st.late == m && m == stalls[i]-1, name, "%.0f late", st.late);
+	}
+	sound_voice_stop(v);
+	run_idle();
+}
+
+// Each master volume gives the same output as the legacy per sample
+// formula: sample*gain/100% + bias.
+static void test_volume(void)
+{
+	uint8_t ramp[TEST_SZ];
+	uint32_t bad = 0;
+
+	for (uint32_t i = 0; i < TEST_SZ; i++) ramp[i] = i;
+	for (uint32_t m = 0; m <= MAX_VOL; m++) {
+		sound_set_volume(m);
+		sim_record(true);
+		sound_start(ramp, TEST_SZ, false);
+		run_idle();
+		sim_record(false);
+		uint32_t gain = MAX_VOL * m, den = MAX_VOL * MAX_VOL;
+		for (uint32_t i = 0; i < TEST_SZ; i++) {
+			uint32_t want = i*gain/den + SILENCE - SILENCE*gain/den;
+			if (sim_out[lead+i] != want) bad++;
+		}
+	}
+	sound_set_volume(MAX_VOL);
+	check(!bad, "volume (legacy exact)", "%.0f bad samples", bad);
+}
+
+// A volume change lands between two buffers, never part way through one.
+static void test_volume_change(void)
+{
+	uint8_t level[1000];
+	sound_stats_t st;
+	uint32_t bad = 0, at = 0;
+
+	memset(level, 0xC0, sizeof(level));
+	sound_get_stats(&st, false);
+	uint32_t len = (st.refill_us * (uint64_t)RATE + 500000) / 1000000; // samples
+	int32_t v = sound_play(level, sizeof(level), 0, MAX_VOL, SOUND_PRIO_DEFAULT, true);
+	sim_run_ms(50);
+	sim_record(true);
+	sim_run_ms(10);
+	sound_voice_volume(v, 50); // 0xC0 at half volume is 0xA0
+	sim_run_ms(50);
+	sound_set_volume(50); // and at a quarter 0x90
+	sim_run_ms(50);
+	sim_record(false);
+	sound_voice_stop(v);
+	run_idle();
+	sound_set_volume(MAX_VOL);
+	uint8_t want = 0xC0;
+	for (uint32_t i = 0; i < sim_nout; i++) {
+		if (sim_out[i] == want) continue;
+		bad += i % len != 0; // changed part way through a buffer
+		want = (want == 0xC0) ? 0xA0 : 0x90;
+		bad += sim_out[i] != want;
+		at++;
+	}
+	check(!bad && at == 2, "volume change per buffer", "%.0f bad changes", bad);
+}
+
+// Two voices sum about SILENCE and clip at the rails.
+static void test_mix(void)
+{
+	uint8_t ramp[TEST_SZ];
+	uint32_t bad = 0;
+
+	for (uint32_t i = 0; i < TEST_SZ; i++) ramp[i] = i;
+	sim_record(true);
+	sound_play(ramp, TEST_SZ, 0, MAX_VOL, SOUND_PRIO_DEFAULT, false);
+	sound_play(ramp, TEST_SZ, 0, MAX_VOL, SOUND_PRIO_DEFAULT, false);
+	run_idle();
+	sim_record(false);
+	for (int32_t i = 0; i < TEST_SZ; i++) {
+		int32_t want = 2*(i - (int32_t)SILENCE) + SILENCE;
+		want = want < 0 ? 0 : want > 0xFF ? 0xFF : want;
+		if (sim_out[lead+i] != want) bad++;
+	}
+	check(!bad, "mix two voices", "%.0f bad samples", bad);
+}
+
+// IMA-ADPCM decodes close to the PCM it was made from.
+static void test_adpcm(void)
+{
+	double *ref = malloc(POWERUP48K_SAMPLES * sizeof(double));
+
+	for (uint32_t i = 0; i < POWERUP48K_SAMPLES; i++) ref[i] = powerUp48k[i];
+	sim_record(true);
+	sound_play_adpcm(powerUp48kIma, POWERUP48KIMA_SAMPLES, 0, MAX_VOL,
+		SOUND_PRIO_DEFAULT, false);
+	run_idle();
+	sim_record(false);
+	double snr = snr_db(sim_out + lead, ref, POWERUP48K_SAMPLES);
+	check(snr > 25, "adpcm vs pcm", "%.1f dB SNR", snr);
+	free(ref);
+}
+
+// A 1kHz sine at 24kHz plays twice as long at the DAC rate, close to the
+// ideal sine.
+static void test_resample(void)
+{
+	const uint32_t n = 24000, hz = 1000, amp = 100;
+	uint8_t *src = malloc(n);
+	double *ref = malloc(2 * n * sizeof(double));
+
+	for (uint32_t i = 0; i < n; i++) src[i] = SILENCE + lround(amp*sin(2*M_PI*hz*i/n));
+	for (uint32_t i = 0; i < 2*n; i++) ref[i] = SILENCE + amp*sin(2*M_PI*hz*i/(2.0*n));
+	sim_record(true);
+	sound_play(src, n, n, MAX_VOL, SOUND_PRIO_DEFAULT, false);
+	run_idle();
+	sim_record(false);
+	size_t end = sim_nout; // last sample not at silence
+	while (end > lead && sim_out[end-1] == SILENCE) end--;
+	double len = (double)(end - lead);
+	check(fabs(len - 2*n) <= 4, "resample 24k length", "%.0f samples", len);
+	double snr = snr_db(sim_out + lead, ref, 2*n - 4);
+	check(snr > 30, "resample 24k sine", "%.1f dB SNR", snr);
+	free(src);
+	free(ref);
+}
+
+// An ADPCM voice resampled for a while, then set back to the DAC rate,
+// decodes from where the output is: the loop point plays as it does
+// without the rate change.
+static void test_resample_back(void)
+{
+	const uint32_t n = POWERUP48KIMA_SAMPLES, k = 64;
+	uint8_t wrap[2*k];
+
+	sim_record(true);
+	int32_t v = sound_play_adpcm(powerUp48kIma, n, 0, MAX_VOL, SOUND_PRIO_DEFAULT, true);
+	sim_run(lead + n + k);
+	sound_voice_stop(v);
+	run_idle();
+	sim_record(false);
+	memcpy(wrap, sim_out + lead + n - k, sizeof(wrap));
+
+	v = sound_play_adpcm(powerUp48kIma, n, 0, MAX_VOL, SOUND_PRIO_DEFAULT, true);
+	sim_run_ms(100);
+	sound_voice_rate(v, 36000);
+	sim_run_ms(100);
+	sound_voice_rate(v, 0);
+	sim_run_ms(20);
+	sim_record(true);
+	sim_run(n + 2*k);
+	sound_voice_stop(v);
+	run_idle();
+	sim_record(false);
+	bool ok = memmem(sim_out, sim_nout, wrap, sizeof(wrap)) != NULL;
+	check(ok, "resample back to adpcm", "%.0f", 0);
+}
+
+// A streamed 16-bit stereo file plays as its 8-bit mono mix.
+static void test_stream(void)
+{
+	const uint32_t n = 20000;
+	char path[] = "/tmp/sound_simXXXXXX";
+	int fd = mkstemp(path);
+	FILE *f = fdopen(fd, "wb");
+	uint8_t hdr[44] = "RIFF\0\0\0\0WAVEfmt \x10\0\0\0\x01\0\x02\0"
+		"\x80\xbb\0\0\0\xee\x02\0\x04\0\x10\0data";
+	uint32_t len = n * 4, bad = 0;
+	uint8_t *want = malloc(n);
+
+	memcpy(hdr + 40, &len, 4);
+	len += 36;
+	memcpy(hdr + 4, &len, 4);
+	fwrite(hdr, 1, sizeof(hdr), f);
+	for (uint32_t i = 0; i < n; i++) {
+		int16_t l = lround(20000*sin(2*M_PI*440*i/RATE));
+		int16_t r = lround(8000*sin(2*M_PI*660*i/RATE));
+		fwrite(&l, 2, 1, f);
+		fwrite(&r, 2, 1, f);
+		want[i] = (((l + r) >> 1) >> 8) + SILENCE;
+	}
+	fclose(f);
+
+	sound_get_stats(&(sound_stats_t){0}, true);
+	sim_pace(4); // let the stream task keep up
+	sim_record(true);
+	if (sound_stream_file(path, false) == 0) {
+		while (sound_stream_busy()) sim_run_ms(10);
+	}
+	run_idle();
+	sim_record(false);
+	sim_pace(0);
+	uint8_t *p = memmem(sim_out, sim_nout, want, 64);
+	if (p == NULL || p + n > sim_out + sim_nout) bad = n;
+	else for (uint32_t i = 0; i < n; i++) bad += p[i] != want[i];
+	check(!bad, "stream s16 stereo", "%.0f bad samples", bad);
+	check(!sound_stream_underruns(), "stream underruns", "%.0f", sound_stream_underruns());
+
+	// A file at another rate is refused rather than played off pitch
+	f = fopen(path, "r+b");
+	fseek(f, 24, SEEK_SET);
+	fwrite(&(uint32_t){RATE/2}, 4, 1, f);
+	fclose(f);
+	int32_t ret = sound_stream_file(path, false);
+	check(ret != 0 && !sound_stream_busy(), "stream refuses other rate", "%.0f", ret);
+	unlink(path);
+	free(want);
+}
+
+// Record a clip played whole, then the same clip split in three and
+// queued on the voice. The output must match sample for sample.
+static uint32_t queue_diff(const uint8_t *audio, uint32_t size, uint32_t rate, bool adpcm)
+{
+	// ADPCM splits on block boundaries
+	uint32_t unit = adpcm ? SOUND_ADPCM_BLOCK_SAMPLES : 1;
+	uint32_t cut1 = size / 3 / unit * unit, cut2 = 2 * cut1;
+	uint32_t off1 = adpcm ? cut1 / unit * SOUND_ADPCM_BLOCK : cut1;
+	uint32_t off2 = 2 * off1;
+	uint32_t bad = 0;
+
+	sim_record(true);
+	if (adpcm) sound_play_adpcm(audio, size, rate, MAX_VOL, SOUND_PRIO_DEFAULT, false);
+	else sound_play(audio, size, rate, MAX_VOL, SOUND_PRIO_DEFAULT, false);
+	run_idle();
+	sim_record(false);
+	size_t n = sim_nout;
+	uint8_t *whole = malloc(n);
+	memcpy(whole, sim_out, n);
+
+	sim_record(true);
+	int32_t v;
+	if (adpcm) {
+		v = sound_play_adpcm(audio, cut1, rate, MAX_VOL, SOUND_PRIO_DEFAULT, false);
+		sound_queue_adpcm(v, audio + off1, cut2 - cut1, false);
+		sound_queue_adpcm(v, audio + off2, size - cut2, false);
+	} else {
+		v = sound_play(audio, cut1, rate, MAX_VOL, SOUND_PRIO_DEFAULT, false);
+		sound_queue(v, audio + off1, cut2 - cut1, false);
+		sound_queue(v, audio + off2, size - cut2, false);
+	}
+	run_idle();
+	sim_record(false);
+	if (sim_nout != n) bad = n;
+	else for (size_t i = 0; i < n; i++) bad += sim_out[i] != whole[i];
+	free(whole);
+	return bad;
+}
+
+// Queued clips play on without a gap, including while resampling, and
+// notify as each ends.
+static void test_queue(void)
+{
+	uint32_t bad = queue_diff(powerUp48k, POWERUP48K_SAMPLES, 0, false);
+	check(!bad, "queue pcm gapless", "%.0f bad samples", bad);
+	bad = queue_diff(powerUp48k, POWERUP48K_SAMPLES, 30000, false);
+	check(!bad, "queue pcm 30kHz gapless", "%.0f bad samples", bad);
+	bad = queue_diff(powerUp48kIma, POWERUP48KIMA_SAMPLES, 0, true);
+	check(!bad, "queue adpcm gapless", "%.0f bad samples", bad);
+
+	// An intro, a loop that runs until the ending is queued, and the ending
+	uint8_t a[300], b[100], c[200];
+	memset(a, 0x40, sizeof(a));
+	memset(b, 0xC0, sizeof(b));
+	memset(c, 0x60, sizeof(c));
+	sim_record(true);
+	int32_t v = sound_play(a, sizeof(a), 0, MAX_VOL, SOUND_PRIO_DEFAULT, false);
+	sound_voice_notify(v, xTaskGetCurrentTaskHandle());
+	sound_queue(v, b, sizeof(b), true);
+	uint32_t notes = ulTaskNotifyTake(pdTRUE, portMAX_DELAY); // intro ended
+	sim_run_ms(10);
+	sound_queue(v, c, sizeof(c), false);
+	while (sound_busy()) notes += ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+	run_idle();
+	sim_record(false);
+	// Intro, at least 3 passes of the loop, then the ending
+	uint8_t *p = sim_out + lead;
+	uint32_t nb = 0;
+	bad = 0;
+	for (uint32_t i = 0; i < sizeof(a); i++) bad += *p++ != 0x40;
+	while (*p == 0xC0) p++, nb++;
+	for (uint32_t i = 0; i < sizeof(c); i++) bad += *p++ != 0x60;
+	bad += *p != SILENCE || nb % sizeof(b) || nb < 3*sizeof(b);
+	check(!bad, "queue intro, loop, ending", "%.0f loop passes", nb / (double)sizeof(b));
+	// Ends of the intro, the loop and the ending
+	check(notes == 3, "queue notifications", "%.0f", notes);
+
+	// sound_start() waits on a notification
+	uint64_t t = sim_samples();
+	sound_start(a, sizeof(a), true);
+	t = sim_samples() - t;
+	check(!sound_busy() && t >= sizeof(a), "start and wait", "%.0f samples", t);
+}
+
+// With refills held off the command ring fills. A command that cannot be
+// posted leaves the voice as it was: a dropped play fails, sound_start()
+// does not wait on it and a dropped stop leaves the voice playing.
+static void test_cmd_full(void)
+{
+	uint8_t a[300];
+
+	memset(a, 0x40, sizeof(a));
+	int32_t v = sound_play(a, sizeof(a), 0, MAX_VOL, SOUND_PRIO_DEFAULT, true);
+	sim_run_ms(10);
+	sim_hold(true);
+	for (uint32_t i = 0; i < 40; i++) sound_set_volume(MAX_VOL); // more than the ring
+	int32_t w = sound_play(a, sizeof(a), 0, MAX_VOL, SOUND_PRIO_DEFAULT, false);
+	int32_t q = sound_queue(v, a, sizeof(a), false);
+	sound_voice_stop(v);
+	sound_start(a, sizeof(a), true);
+	check(w < 0 && q != 0 && sound_voice_busy(v), "full ring drops commands", "%.0f", w);
+	sim_hold(false);
+	sim_run_ms(10);
+	sound_stop();
+	run_idle();
+	check(!sound_busy(), "full ring recovers", "%.0f", sound_busy());
+}
+
+// Record a clip played at full volume.
+static uint8_t *record_clip(const uint8_t *audio, uint32_t size, size_t *n)
+{
+	sim_record(true);
+	sound_play(audio, size, 0, MAX_VOL, SOUND_PRIO_DEFAULT, false);
+	run_idle();
+	sim_record(false);
+	uint8_t *out = malloc(sim_nout);
+	memcpy(out, sim_out, *n = sim_nout);
+	return out;
+}
+
+// Cached clips play the same as from flash, the least recently used is
+// evicted first, and a clip still playing is not evicted.
+static void test_cache(void)
+{
+	sound_stats_t st;
+	size_t n, nc;
+
+	run_idle();
+	uint8_t *whole = record_clip(powerUp48k, POWERUP48K_SAMPLES, &n);
+
+	sound_cache_budget(POWERUP48K_SAMPLES + BCFIRE48K_SAMPLES);
+	sound_get_stats(&st, true);
+	free(record_clip(powerUp48k, POWERUP48K_SAMPLES, &nc)); // miss, copied
+	uint8_t *cached = record_clip(powerUp48k, POWERUP48K_SAMPLES, &nc); // hit
+	sound_get_stats(&st, true);
+	check(nc == n && !memcmp(cached, whole, n), "cache same output", "%.0f bytes",
+		st.cache_used);
+	check(st.cache_hits == 1 && st.cache_misses == 1, "cache hit", "%.0f hits",
+		st.cache_hits);
+	free(cached);
+	free(whole);
+
+	// bcFire fills the budget, powerUp is used again, so gunEmpty evicts
+	// bcFire, and bcFire evicts gunEmpty (powerUp is more recent)
+	sound_play(bcFire48k, BCFIRE48K_SAMPLES, 0, 0, SOUND_PRIO_DEFAULT, false);
+	sound_play(powerUp48k, POWERUP48K_SAMPLES, 0, 0, SOUND_PRIO_DEFAULT, false);
+	run_idle();
+	sound_play(gunEmpty48k, GUNEMPTY48K_SAMPLES, 0, 0, SOUND_PRIO_DEFAULT, false);
+	run_idle();
+	sound_play(powerUp48k, POWERUP48K_SAMPLES, 0, 0, SOUND_PRIO_DEFAULT, false);
+	run_idle();
+	sound_get_stats(&st, true);
+	check(st.cache_hits == 2 && st.cache_misses == 2 &&
+		st.cache_used == POWERUP48K_SAMPLES + GUNEMPTY48K_SAMPLES,
+		"cache lru eviction", "%.0f bytes", st.cache_used);
+
+	// Only room for one clip, and it is playing
+	sound_cache_budget(POWERUP48K_SAMPLES);
+	int32_t v = sound_play(powerUp48k, POWERUP48K_SAMPLES, 0, 0, SOUND_PRIO_DEFAULT, true);
+	sound_play(bcFire48k, BCFIRE48K_SAMPLES, 0, 0, SOUND_PRIO_DEFAULT, false);
+	sound_get_stats(&st, true);
+	bool ok = st.cache_used == POWERUP48K_SAMPLES;
+	sound_voice_stop(v);
+	run_idle();
+	sound_play(bcFire48k, BCFIRE48K_SAMPLES, 0, 0, SOUND_PRIO_DEFAULT, false);
+	run_idle();
+	sound_get_stats(&st, true);
+	check(ok && st.cache_used == BCFIRE48K_SAMPLES, "cache keeps playing clip",
+		"%.0f bytes", st.cache_used);
+	sound_cache_budget(0);
+	sound_get_stats(&st, true);
+	check(st.cache_used == 0, "cache disabled", "%.0f bytes", st.cache_used);
+}
+
+// Heap allocations, counted to tell a rendered effect from a cached one
+static uint32_t mallocs;
+static bool realloc_fail; // fail reallocs, e.g. an effect shrinking
+
+void *__real_malloc(size_t size);
+void *__wrap_malloc(size_t size)
+{
+	mallocs++;
+	return __real_malloc(size);
+}
+
+void *__real_realloc(void *p, size_t size);
+void *__wrap_realloc(void *p, size_t size)
+{
+	return realloc_fail ? NULL : __real_realloc(p, size);
+}
+
+// Crossings of SILENCE per 1000 samples from start to end, twice the
+// frequency in Hz at 500 samples per second
+static double crossings(const uint8_t *buf, uint32_t start, uint32_t end)
+{
+	uint32_t n = 0;
+	for (uint32_t i = start+1; i < end; i++) n += (buf[i] >= SILENCE) != (buf[i-1] >= SILENCE);
+	return n * 1000.0 / (end - start);
+}
+
+// A preset is the same effect for the same seed and renders the same
+// audio, within sfx_samples(), and slides go the way the kind does.
+static void test_sfx_preset(void)
+{
+	static const char *names[] = {"coin", "laser", "explosion", "powerup", "hit", "jump", "blip"};
+	uint32_t size = 2*RATE;
+	uint8_t *buf = malloc(size), *again = malloc(size);
+	char name[32];
+
+	for (uint32_t k = 0; k < SFX_PRESET_LAST; k++) {
+		uint32_t bad = 0, quiet = 0, wrong = 0;
+		for (uint32_t seed = 0; seed < 50; seed++) {
+			sfx_t a, b;
+			sfx_preset(&a, k, seed);
+			sfx_preset(&b, k, seed);
+			uint32_t n = sfx_render(&a, buf, size, RATE);
+			bad += memcmp(&a, &b, sizeof(sfx_t)) || n == 0 || n > sfx_samples(&a, RATE) ||
+				sfx_render(&b, again, size, RATE) != n || memcmp(buf, again, n);
+			double e = 0;
+			for (uint32_t i = 0; i < n; i++) e += (buf[i] - 128.0) * (buf[i] - 128.0);
+			quiet += n == 0 || sqrt(e / n) < 4;
+			// The slide of a laser falls and that of a jump rises
+			double early = crossings(buf, n/10, 3*n/10), late = crossings(buf, 6*n/10, 8*n/10);
+			if (k == SFX_LASER) wrong += a.slide >= 0 || late >= early;
+			if (k == SFX_JUMP) wrong += a.slide <= 0 || late <= early;
+		}
+		snprintf(name, sizeof(name), "sfx %s repeatable", names[k]);
+		check(bad == 0 && quiet == 0, name, "%.0f seeds differ", bad);
+		if (k == SFX_LASER || k == SFX_JUMP) {
+			snprintf(name, sizeof(name), "sfx %s slide", names[k]);
+			check(wrong == 0, name, "%.0f seeds wrong way", wrong);
+		}
+	}
+	free(buf);
+	free(again);
+}
+
+// Play an effect, and return the heap allocations of the call: one or
+// more if it was rendered, none if it was cached or refused.
+static uint32_t sfx_allocs(const sfx_t *sfx, int32_t *voice)
+{
+	uint32_t m = mallocs;
+	*voice = sfx_play(sfx, MAX_VOL, SOUND_PRIO_DEFAULT);
+	return mallocs - m;
+}
+
+// Effects are rendered once, the least recently played is evicted first,
+// one still playing is not evicted, and one over the budget is refused.
+static void test_sfx_cache(void)
+{
+	sfx_t a = {.wave = SFX_SQUARE, .freq = 440, .sustain = 100, .decay = 100};
+	sfx_t b = a, c = a, big = a;
+	uint32_t n = sfx_samples(&a, RATE);
+	int32_t v;
+
+	b.freq = 660;
+	c.freq = 880;
+	big.sustain = 1000;
+	run_idle();
+	sfx_init(RATE, 2*n);
+	uint32_t first = sfx_allocs(&a, &v);
+	run_idle();
+	sim_record(true);
+	uint32_t hit = sfx_allocs(&a, &v);
+	run_idle();
+	sim_record(false);
+	uint8_t *ref = malloc(n);
+	sfx_render(&a, ref, n, RATE);
+	bool ok = v >= 0 && first > 0 && hit == 0 && memmem(sim_out, sim_nout, ref, n) != NULL;
+	check(ok, "sfx cached", "%.0f allocations", hit);
+	free(ref);
+
+	// a is played again, so c evicts b, and b evicts c
+	sfx_allocs(&b, &v);
+	run_idle();
+	sfx_allocs(&a, &v);
+	run_idle();
+	ok = sfx_allocs(&c, &v) > 0;
+	run_idle();
+	ok = ok && sfx_allocs(&a, &v) == 0;
+	run_idle();
+	ok = ok && sfx_allocs(&b, &v) > 0;
+	run_idle();
+	ok = ok && sfx_allocs(&a, &v) == 0 && v >= 0;
+	run_idle();
+	check(ok, "sfx lru eviction", "%.0f", ok);
+
+	// Only room for one effect, and it is playing
+	sfx_init(RATE, n);
+	sfx_allocs(&a, &v);
+	sfx_allocs(&b, &v);
+	ok = v < 0;
+	run_idle();
+	sfx_allocs(&b, &v);
+	check(ok && v >= 0, "sfx keeps playing effect", "%.0f", v);
+	run_idle();
+
+	uint32_t m = sfx_allocs(&big, &v);
+	check(v < 0 && m == 0, "sfx refuses over budget", "%.0f samples", sfx_samples(&big, RATE));
+
+	// A slide ends d at a quarter of its samples, but it keeps its whole
+	// buffer if shrinking fails, so a does not fit alongside
+	sfx_t d = {.wave = SFX_SQUARE, .freq = 880, .freq_min = 440, .slide = -120, .sustain = 400};
+	uint32_t nd = sfx_samples(&d, RATE);
+	sfx_init(RATE, nd + n - 1);
+	realloc_fail = true;
+	sfx_allocs(&d, &v);
+	realloc_fail = false;
+	run_idle();
+	sfx_allocs(&a, &v);
+	run_idle();
+	m = sfx_allocs(&d, &v);
+	run_idle();
+	check(m > 0, "sfx counts unshrunk buffer", "%.0f allocations", m);
+	sfx_deinit();
+}
+
+static int cmd_test(void)
+{
+	test_lead();
+	test_latency();
+	test_stats();
+	test_volume();
+	test_volume_change();
+	test_mix();
+	test_adpcm();
+	test_resample();
+	test_resample_back();
+	test_stream();
+	test_queue();
+	test_cmd_full();
+	test_cache();
+	test_sfx_preset();
+	test_sfx_cache();
+	printf("%s\n", failed ? "FAILED" : "PASSED");
+	return failed != 0;
+}
+
+// Refill throughput of one case, as samples out per second of CPU in the
+// callback and as a multiple of the DAC rate.
+static void bench_case(const char *name, uint32_t voices, bool adpcm, uint32_t rate)
+{
+	for (uint32_t v = 0; v < voices; v++) {
+		if (adpcm) sound_play_adpcm(powerUp48kIma, POWERUP48KIMA_SAMPLES, rate,
+			80, SOUND_PRIO_DEFAULT, true);
+		else sound_play(powerUp48k, POWERUP48K_SAMPLES, rate,
+			80, SOUND_PRIO_DEFAULT, true);
+	}
+	sim_run_ms(100);
+	sim_cb_reset();
+	uint64_t s0 = sim_samples();
+	sim_run_ms(BENCH_MS);
+	double sec = sim_cb_ns() / 1e9;
+	double sps = (sim_samples() - s0) / sec;
+	printf("%-24s %8.1f Msample/s %8.0fx real time %6.0f ns/refill\n", name,
+		sps / 1e6, sps / RATE, sim_cb_ns() / (double)sim_cb_calls());
+	sound_stop();
+	sim_run_ms(100);
+}
+
+// Time of one refill of a DMA buffer with voices playing powerUp48k as
+// PCM or ADPCM, the quickest and the average of BENCH_REFILLS.
+#define BENCH_REFILLS 20000
+
+static void bench_refill(const char *name, uint32_t voices, bool adpcm)
+{
+	sound_stats_t st;
+
+	for (uint32_t v = 0; v < voices; v++) {
+		if (adpcm) sound_play_adpcm(powerUp48kIma, POWERUP48KIMA_SAMPLES, 0,
+			80, SOUND_PRIO_DEFAULT, true);
+		else sound_play(powerUp48k, POWERUP48K_SAMPLES, 0,
+			80, SOUND_PRIO_DEFAULT, true);
+	}
+	sim_run_ms(100);
+	sound_get_stats(&st, false);
+	uint32_t len = st.refill_us * RATE / 1000000;
+	sim_cb_reset();
+	sim_run((uint64_t)BENCH_REFILLS * len);
+	printf("%-16s ns/refill min:%-6.0f avg:%-6.0f ns/sample min:%.1f\n", name,
+		(double)sim_cb_min(), sim_cb_ns() / (double)sim_cb_calls(),
+		sim_cb_min() / (double)len);
+	sound_stop();
+	sim_run_ms(100);
+}
+
+// Error of the IMA-ADPCM powerUp48k against the 8-bit original.
+static void bench_adpcm_error(void)
+{
+	double *ref = malloc(POWERUP48K_SAMPLES * sizeof(double));
+	uint32_t err = 0;
+
+	lead = find_lead();
+	for (uint32_t i = 0; i < POWERUP48K_SAMPLES; i++) ref[i] = powerUp48k[i];
+	sim_record(true);
+	sound_play_adpcm(powerUp48kIma, POWERUP48KIMA_SAMPLES, 0, MAX_VOL,
+		SOUND_PRIO_DEFAULT, false);
+	run_idle();
+	sim_record(false);
+	for (uint32_t i = 0; i < POWERUP48K_SAMPLES; i++) {
+		uint32_t e = abs(sim_out[lead+i] - powerUp48k[i]);
+		if (e > err) err = e;
+	}
+	printf("adpcm vs pcm     SNR:%.1fdB max error:%u LSB, %u bytes as PCM, %u as ADPCM\n",
+		snr_db(sim_out + lead, ref, POWERUP48K_SAMPLES), (unsigned)err,
+		(unsigned)POWERUP48K_SAMPLES, (unsigned)((POWERUP48KIMA_SAMPLES +
+		SOUND_ADPCM_BLOCK_SAMPLES-1) / SOUND_ADPCM_BLOCK_SAMPLES * SOUND_ADPCM_BLOCK));
+	free(ref);
+}
+
+// Time of a refill and SNR of one looping voice playing a sine of hz at
+// a sample rate, resampled to the DAC rate (rate 0 for none). The SNR is
+// of the first second out against the ideal sine at the source position
+// of each sample, so it is the interpolation error only: the Q16 phase
+// step is off the exact rate ratio by less than 2e-5, which over a second
+// would dominate the error while being inaudible (0.03 cent).
+static void bench_resample(uint32_t rate, uint32_t hz)
+{
+	const uint32_t amp = 100;
+	uint32_t n = rate ? rate : RATE; // a second, a whole number of periods
+	uint8_t *src = malloc(n);
+	double *ref = malloc(RATE * sizeof(double));
+	sound_stats_t st;
+
+	for (uint32_t i = 0; i < n; i++) src[i] = SILENCE + lround(amp*sin(2*M_PI*hz*i/n));
+	double step = rate ? (((uint64_t)rate << 16) + RATE/2) / RATE / 65536.0 : 1;
+	for (uint32_t i = 0; i < RATE; i++) ref[i] = SILENCE + amp*sin(2*M_PI*hz*i*step/n);
+	sim_record(true);
+	sound_play(src, n, rate, MAX_VOL, SOUND_PRIO_DEFAULT, true);
+	sim_run(lead + RATE);
+	sim_record(false);
+	double snr = snr_db(sim_out + lead, ref, RATE);
+	sound_get_stats(&st, false);
+	uint32_t len = st.refill_us * RATE / 1000000;
+	sim_cb_reset();
+	sim_run((uint64_t)BENCH_REFILLS * len);
+	printf("%-7s rate:%-5u ns/refill min:%-5.0f SNR:%.1fdB  # %uHz\n",
+		rate == 0 ? "native" : SOUND_RESAMPLE_4TAP ? "4tap" : "linear",
+		(unsigned)(rate ? rate : RATE), (double)sim_cb_min(), snr, (unsigned)hz);
+	sound_stop();
+	sim_run_ms(100);
+	free(src);
+	free(ref);
+}
+
+// Resampler cost and quality at common clip rates.
+static void bench_resamples(void)
+{
+	lead = find_lead();
+	bench_resample(11025, 440);
+	bench_resample(22050, 1000);
+	bench_resample(24000, 1000);
+	bench_resample(11025, 3000); // f/fs 0.27
+	bench_resample(0, 1000);
+}
+
+// The refill inner loop before and after the volume lookup table, on a
+// 1001 byte cyclic sound, 64 samples per refill. The legacy loop is kept
+// here only to be measured.
+#define LOOP_SZ 1001
+#define LOOP_REFILLS 4000000
+
+static uint64_t now_ns(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+// buf[i] = abase[(idx+i)%asize]*volume/PERCENT + bias, per sample
+static __attribute__((noinline)) uint32_t loop_legacy(uint8_t *buf, const uint8_t *abase,
+	uint32_t asize, uint32_t idx, uint32_t volume)
+{
+	uint32_t bias = SILENCE - SILENCE*volume/100;
+	for (uint32_t i = 0; i < 64; i++) buf[i] = abase[(idx+i)%asize]*volume/100 + bias;
+	return (idx + 64) % asize;
+}
+
+// Split at the wrap point, buf[i] = SILENCE + vlut[src[k]]
+static __attribute__((noinline)) uint32_t loop_lut(uint8_t *buf, const uint8_t *abase,
+	uint32_t asize, uint32_t idx, const int16_t *vlut)
+{
+	uint32_t i = 0;
+	while (i < 64) {
+		uint32_t n = asize - idx;
+		if (n > 64 - i) n = 64 - i;
+		const uint8_t *src = abase + idx;
+		for (uint32_t k = 0; k < n; k++) buf[i+k] = SILENCE + vlut[src[k]];
+		i += n;
+		idx += n;
+		if (idx == asize) idx = 0;
+	}
+	return idx;
+}
+
+static void bench_loop(void)
+{
+	static uint8_t audio[LOOP_SZ], buf[64];
+	static int16_t vlut[256];
+	volatile uint32_t vol = 80; // not known to the compiler
+	uint32_t volume = vol, idx, sum;
+
+	for (uint32_t i = 0; i < LOOP_SZ; i++) audio[i] = powerUp48k[i];
+	for (uint32_t i = 0; i < 256; i++) vlut[i] = i*volume/100 + SILENCE - SILENCE*volume/100 - SILENCE;
+
+	uint64_t t0 = now_ns();
+	for (uint32_t r = idx = sum = 0; r < LOOP_REFILLS; r++) {
+		idx = loop_legacy(buf, audio, LOOP_SZ, idx, volume);
+		sum += buf[r & 63];
+	}
+	uint64_t t1 = now_ns();
+	for (uint32_t r = idx = 0; r < LOOP_REFILLS; r++) {
+		idx = loop_lut(buf, audio, LOOP_SZ, idx, vlut);
+		sum -= buf[r & 63];
+	}
+	uint64_t t2 = now_ns();
+	printf("%-24s %8.2f ns/sample\n", "loop legacy", (t1 - t0) / (LOOP_REFILLS * 64.0));
+	printf("%-24s %8.2f ns/sample%s\n", "loop runs+lut", (t2 - t1) / (LOOP_REFILLS * 64.0),
+		sum ? "  (outputs differ)" : "");
+}
+
+static int cmd_bench(void)
+{
+	bench_loop();
+	sound_set_volume(MAX_VOL);
+	bench_case("idle", 0, false, 0);
+	bench_case("pcm 1 voice", 1, false, 0);
+	bench_case("pcm 8 voices", SOUND_VOICES, false, 0);
+	bench_case("adpcm 1 voice", 1, true, 0);
+	bench_case("adpcm 8 voices", SOUND_VOICES, true, 0);
+	bench_case("pcm 8 voices 22050Hz", SOUND_VOICES, false, 22050);
+	bench_case("adpcm 8 voices 22050Hz", SOUND_VOICES, true, 22050);
+	sound_init(RATE, SOUND_LATENCY_LOW);
+	bench_case("pcm 8 voices, low", SOUND_VOICES, false, 0);
+	sound_init(RATE, SOUND_LATENCY_LOW_CPU);
+	bench_case("pcm 8 voices, low cpu", SOUND_VOICES, false, 0);
+	sound_init(RATE, SOUND_LATENCY_BALANCED);
+	printf("\n");
+	bench_refill("pcm 1 voice", 1, false);
+	bench_refill("adpcm 1 voice", 1, true);
+	bench_refill("pcm 8 voices", SOUND_VOICES, false);
+	bench_refill("adpcm 8 voices", SOUND_VOICES, true);
+	bench_adpcm_error();
+	printf("\n");
+	bench_resamples();
+	return 0;
+}
+
+// Render a short scene: overlapping effects, a pitch bend, an ADPCM clip
+// and an optional streamed file.
+static int cmd_render(const char *path, const char *stream)
+{
+	sound_stats_t st;
+
+	sound_set_volume(MAX_VOL);
+	sim_record(true);
+	sound_start(powerUp48k, POWERUP48K_SAMPLES, false);
+	sim_run_ms(300);
+	sound_play(bcFire48k, BCFIRE48K_SAMPLES, 0, 70, SOUND_PRIO_DEFAULT, false);
+	sim_run_ms(400);
+	int32_t v = sound_play(gunEmpty48k, GUNEMPTY48K_SAMPLES, 0, 90, SOUND_PRIO_DEFAULT, true);
+	for (uint32_t r = RATE; r > RATE/2; r -= RATE/64) {
+		sound_voice_rate(v, r);
+		sim_run_ms(20);
+	}
+	sound_voice_stop(v);
+	sound_play_adpcm(powerUp48kIma, POWERUP48KIMA_SAMPLES, 36000, MAX_VOL,
+		SOUND_PRIO_DEFAULT, false);
+	run_idle();
+	if (stream) {
+		sim_pace(4);
+		if (sound_stream_file(stream, false) == 0) {
+			while (sound_stream_busy()) sim_run_ms(10);
+		}
+		run_idle();
+		sim_pace(0);
+	}
+	sim_record(false);
+	sound_get_stats(&st, false);
+	printf("%s: %zu samples (%.2f s)\n", path, sim_nout, sim_nout / (double)RATE);
+	printf("refills %u, ns max %u avg %u, late %u, latency max %u us avg %u us\n",
+		st.refills, st.cycles_max, st.cycles_avg, st.late,
+		st.latency_max_us, st.latency_avg_us);
+	if (sim_wav_write(path, sim_out, sim_nout, RATE)) {
+		perror(path);
+		return 1;
+	}
+	return 0;
+}
+
+int main(int argc, char *argv[])
+{
+	const char *cmd = argc > 1 ? argv[1] : "";
+	int ret;
+
+	sound_init(RATE, SOUND_LATENCY_BALANCED);
+	if (!strcmp(cmd, "test")) {
+		ret = cmd_test();
+	} else if (!strcmp(cmd, "bench") && argc > 2 && !strcmp(argv[2], "resample")) {
+		bench_resamples();
+		ret = 0;
+	} else if (!strcmp(cmd, "bench")) {
+		ret = cmd_bench();
+	} else if (!strcmp(cmd, "render")) {
+		const char *out = "sound_sim.wav", *stream = NULL;
+		for (int i = 2; i < argc; i++) {
+			if (!strcmp(argv[i], "-o") && i+1 < argc) out = argv[++i];
+			else stream = argv[i];
+		}
+		ret = cmd_render(out, stream);
+	} else {
+		fprintf(stderr, "usage: %s render [-o out.wav] [stream.wav] | test | bench [resample]\n", argv[0]);
+		return 2;
+	}
+	sound_deinit();
+	return ret;
+}
@@ -0,0 +1,57 @@
+#ifndef SIM_H_
+#define SIM_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Host simulator of the DAC DMA. Descriptors play in a ring at the sample
+// rate of a virtual clock. When one finishes, its samples go to the
+// output and the refill callback is called for it, as on the target, so
+// a refill plays after the other descriptors in the ring.
+
+extern int sim_verbose; // show info logs
+
+// Output of the DAC, 8-bit unsigned samples, recorded while enabled.
+extern uint8_t *sim_out;
+extern size_t sim_nout;
+
+// Run the DMA for a number of samples, rounded up to whole descriptors.
+// Does nothing if the DAC is not started.
+void sim_run(uint64_t samples);
+
+// Run the DMA for a number of milliseconds.
+void sim_run_ms(uint32_t ms);
+
+// Hold off the refill callback, as if interrupts were masked. The DMA
+// plays on, replaying the descriptors as they were last filled. Releasing
+// calls back once for the last descriptor to finish, as the driver only
+// reports the latest one.
+void sim_hold(bool enable);
+
+// Return the refill callbacks not made while held, each a descriptor that
+// played its old samples again.
+uint64_t sim_missed(void);
+
+// Start or stop recording the output. Starting clears the output.
+void sim_record(bool enable);
+
+// Slow the virtual clock to real time divided by div, so threads such as
+// the stream task keep up. 0 runs as fast as possible.
+void sim_pace(uint32_t div);
+
+// Return the samples played since the DAC was started.
+uint64_t sim_samples(void);
+
+// Return the host time spent in the refill callback, in ns, the number of
+// calls, and the time of the quickest call since the last sim_cb_reset().
+uint64_t sim_cb_ns(void);
+uint64_t sim_cb_calls(void);
+uint64_t sim_cb_min(void);
+void sim_cb_reset(void);
+
+// Write samples as an 8-bit mono WAV file.
+// Return zero if successful, or non-zero otherwise.
+int32_t sim_wav_write(const char *path, const uint8_t *data, size_t n, uint32_t rate);
+
+#endif /* SIM_H_ */
@@ -0,0 +1,235 @@
+// Continuous DAC driver for the host simulator. Plays descriptors from a
+// virtual clock driven by sim_run(), calling the registered callback.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "driver/dac_continuous.h"
+#include "esp_cpu.h"
+#include "esp_timer.h"
+#include "sim.h"
+
+struct dac_continuous_s {
+	dac_continuous_config_t cfg;
+	dac_event_callbacks_t cbs;
+	void *user_data;
+	uint8_t *desc; // desc_num buffers of buf_size bytes
+	uint32_t cur; // next descriptor to finish
+	bool started;
+};
+
+int sim_verbose;
+uint8_t *sim_out;
+size_t sim_nout;
+
+static struct dac_continuous_s *dac;
+static size_t out_cap;
+static bool recording;
+static uint32_t pace;
+static uint64_t played; // samples
+static uint32_t rate = 1; // Hz, kept after the DAC is deleted
+static uint64_t cb_ns, cb_calls, cb_min = UINT64_MAX;
+static bool hold;
+static uint8_t *held; // last descriptor to finish while held
+static uint64_t missed; // callbacks not made while held
+
+static uint64_t now_ns(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+// Samples held by a DMA buffer. With auto 16-bit align, each 8-bit sample
+// takes the high byte of a 16-bit word.
+static size_t buf_samples(size_t bytes)
+{
+#if CONFIG_DAC_DMA_AUTO_16BIT_ALIGN
+	return bytes / 2;
+#else
+	return bytes;
+#endif
+}
+
+static void out_put(const uint8_t *dma, size_t n)
+{
+	if (!recording) return;
+	if (sim_nout + n > out_cap) {
+		out_cap = (out_cap ? out_cap * 2 : 1 << 16) + n;
+		sim_out = realloc(sim_out, out_cap);
+		if (sim_out == NULL) {perror("sim_out"); exit(1);}
+	}
+	for (size_t i = 0; i < n; i++) {
+#if CONFIG_DAC_DMA_AUTO_16BIT_ALIGN
+		sim_out[sim_nout++] = dma[2*i+1];
+#else
+		sim_out[sim_nout++] = dma[i];
+#endif
+	}
+}
+
+// Call the refill callback for a finished descriptor, timed.
+static void cb_call(uint8_t *d)
+{
+	if (dac->cbs.on_convert_done == NULL) return;
+	size_t bsz = dac->cfg.buf_size;
+	dac_event_data_t ev = {.buf = d, .buf_size = bsz, .write_bytes = bsz};
+	uint64_t t0 = now_ns();
+	dac->cbs.on_convert_done(dac, &ev, dac->user_data);
+	uint64_t ns = now_ns() - t0;
+	cb_ns += ns;
+	if (ns < cb_min) cb_min = ns;
+	cb_calls++;
+}
+
+void sim_run(uint64_t samples)
+{
+	if (dac == NULL || !dac->started) return;
+	size_t bsz = dac->cfg.buf_size;
+	size_t n = buf_samples(bsz);
+	uint64_t end = played + samples;
+
+	while (played < end) {
+		uint8_t *d = dac->desc + dac->cur * bsz;
+		out_put(d, n);
+		played += n;
+		if (pace) usleep(n * 1000000ULL / rate / pace);
+		if (hold) {
+			if (held != NULL) missed++;
+			held = d;
+		}
+		else
+			cb_call(d);
+		dac->cur = (dac->cur + 1) % dac->cfg.desc_num;
+	}
+}
+
+void sim_run_ms(uint32_t ms)
+{
+	sim_run((uint64_t)ms * rate / 1000);
+}
+
+void sim_hold(bool enable)
+{
+	hold = enable;
+	if (!hold && held != NULL && dac != NULL && dac->started) cb_call(held);
+	held = NULL;
+}
+
+void sim_record(bool enable)
+{
+	if (enable && !recording) sim_nout = 0;
+	recording = enable;
+}
+
+void sim_pace(uint32_t div)
+{
+	pace = div;
+}
+
+uint64_t sim_samples(void)
+{
+	return played;
+}
+
+uint64_t sim_cb_ns(void) {return cb_ns;}
+uint64_t sim_cb_calls(void) {return cb_calls;}
+uint64_t sim_cb_min(void) {return cb_min;}
+uint64_t sim_missed(void) {return missed;}
+void sim_cb_reset(void) {cb_ns = cb_calls = 0; cb_min = UINT64_MAX;}
+
+int64_t esp_timer_get_time(void)
+{
+	return played * 1000000ULL / rate;
+}
+
+esp_cpu_cycle_count_t esp_cpu_get_cycle_count(void)
+{
+	return now_ns();
+}
+
+esp_err_t dac_continuous_new_channels(const dac_continuous_config_t *cfg,
+	dac_continuous_handle_t *handle)
+{
+	if (dac != NULL || cfg->desc_num < 2 || cfg->buf_size == 0 || cfg->freq_hz == 0)
+		return ESP_FAIL;
+	dac = calloc(1, sizeof(*dac));
+	dac->desc = calloc(cfg->desc_num, cfg->buf_size);
+	dac->cfg = *cfg;
+	rate = cfg->freq_hz;
+	played = 0;
+	*handle = dac;
+	return ESP_OK;
+}
+
+esp_err_t dac_continuous_del_channels(dac_continuous_handle_t handle)
+{
+	if (handle != dac || dac->started) return ESP_FAIL;
+	free(dac->desc);
+	free(dac);
+	dac = NULL;
+	return ESP_OK;
+}
+
+esp_err_t dac_continuous_enable(dac_continuous_handle_t handle) {return ESP_OK;}
+esp_err_t dac_continuous_disable(dac_continuous_handle_t handle) {return ESP_OK;}
+
+esp_err_t dac_continuous_register_event_callback(dac_continuous_handle_t handle,
+	const dac_event_callbacks_t *callbacks, void *user_data)
+{
+	handle->cbs = *callbacks;
+	handle->user_data = user_data;
+	return ESP_OK;
+}
+
+esp_err_t dac_continuous_start_async_writing(dac_continuous_handle_t handle)
+{
+	handle->started = true;
+	return ESP_OK;
+}
+
+esp_err_t dac_continuous_stop_async_writing(dac_continuous_handle_t handle)
+{
+	handle->started = false;
+	return ESP_OK;
+}
+
+esp_err_t dac_continuous_write_asynchronously(dac_continuous_handle_t handle,
+	uint8_t *dma_buf, size_t dma_buf_len, const uint8_t *data,
+	size_t data_len, size_t *bytes_loaded)
+{
+	size_t n = buf_samples(dma_buf_len);
+	if (data_len < n) n = data_len;
+	for (size_t i = 0; i < n; i++) {
+#if CONFIG_DAC_DMA_AUTO_16BIT_ALIGN
+		dma_buf[2*i] = 0;
+		dma_buf[2*i+1] = data[i];
+#else
+		dma_buf[i] = data[i];
+#endif
+	}
+	if (bytes_loaded) *bytes_loaded = n;
+	return ESP_OK;
+}
+
+int32_t sim_wav_write(const char *path, const uint8_t *data, size_t n, uint32_t hz)
+{
+	FILE *f = fopen(path, "wb");
+	if (f == NULL) return -1;
+	uint8_t h[44];
+	uint32_t len = n;
+#define LE32(p, v) do {(p)[0] = (v); (p)[1] = (v) >> 8; (p)[2] = (v) >> 16; (p)[3] = (v) >> 24;} while (0)
+	memcpy(h, "RIFF", 4); LE32(h+4, 36 + len);
+	memcpy(h+8, "WAVEfmt ", 8); LE32(h+16, 16);
+	h[20] = 1; h[21] = 0; h[22] = 1; h[23] = 0; // PCM, mono
+	LE32(h+24, hz); LE32(h+28, hz); // byte rate
+	h[32] = 1; h[33] = 0; h[34] = 8; h[35] = 0; // block align, bits
+	memcpy(h+36, "data", 4); LE32(h+40, len);
+#undef LE32
+	int32_t err = fwrite(h, 1, sizeof(h), f) != sizeof(h) || fwrite(data, 1, n, f) != n;
+	if (n & 1) fputc(0, f); // chunks are padded to even size
+	return fclose(f) || err;
+}
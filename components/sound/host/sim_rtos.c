@@ -0,0 +1,133 @@
+// FreeRTOS calls for the host simulator. Tasks are threads. The main
+// thread stands for the application task: its delays and waits run the
+// DMA clock, so sound calls see refills happen while they wait.
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "sim.h"
+
+typedef struct {
+	TaskFunction_t func;
+	void *arg;
+	uint32_t notify; // notification count
+} task_t;
+
+static pthread_t main_thread;
+static bool main_set;
+static task_t main_task;
+static __thread task_t *cur_task;
+static pthread_mutex_t notify_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t notify_cond = PTHREAD_COND_INITIALIZER;
+
+__attribute__((constructor)) static void rtos_init(void)
+{
+	main_thread = pthread_self();
+	main_set = true;
+	cur_task = &main_task;
+}
+
+static bool on_main(void)
+{
+	return main_set && pthread_equal(pthread_self(), main_thread);
+}
+
+static void *task_entry(void *p)
+{
+	cur_task = p; // kept for notifications that come late
+	cur_task->func(cur_task->arg);
+	return NULL;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t func, const char *name, uint32_t stack,
+	void *arg, UBaseType_t prio, TaskHandle_t *handle)
+{
+	pthread_t th;
+	task_t *t = calloc(1, sizeof(*t));
+	if (t == NULL) return pdFALSE;
+	t->func = func;
+	t->arg = arg;
+	if (pthread_create(&th, NULL, task_entry, t)) {
+		free(t);
+		return pdFALSE;
+	}
+	pthread_detach(th);
+	if (handle) *handle = t;
+	return pdPASS;
+}
+
+void vTaskDelete(TaskHandle_t handle)
+{
+	if (handle == NULL) pthread_exit(NULL);
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+	if (on_main())
+		sim_run_ms(ticks * portTICK_PERIOD_MS);
+	else
+		usleep(ticks * portTICK_PERIOD_MS * 1000);
+	sched_yield();
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+	return cur_task;
+}
+
+// Take the notification count. On the main thread, the DMA clock runs a
+// descriptor at a time until notified (ticks is ignored).
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks)
+{
+	task_t *t = cur_task;
+	uint32_t n;
+
+	pthread_mutex_lock(&notify_mutex);
+	while (t->notify == 0 && ticks) {
+		if (on_main()) {
+			pthread_mutex_unlock(&notify_mutex);
+			sim_run(1);
+			pthread_mutex_lock(&notify_mutex);
+		} else {
+			pthread_cond_wait(&notify_cond, &notify_mutex);
+		}
+	}
+	n = t->notify;
+	if (n) t->notify = clear ? 0 : n - 1;
+	pthread_mutex_unlock(&notify_mutex);
+	return n;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t handle, BaseType_t *woken)
+{
+	task_t *t = handle;
+
+	pthread_mutex_lock(&notify_mutex);
+	t->notify++;
+	pthread_cond_broadcast(&notify_cond);
+	pthread_mutex_unlock(&notify_mutex);
+	if (woken) *woken = pdTRUE;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void)
+{
+	pthread_mutex_t *m = malloc(sizeof(*m));
+	if (m) pthread_mutex_init(m, NULL);
+	return m;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks)
+{
+	if (ticks == 0) return pthread_mutex_trylock(sem) == 0;
+	return pthread_mutex_lock(sem) == 0; // waits forever
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem)
+{
+	return pthread_mutex_unlock(sem) == 0;
+}
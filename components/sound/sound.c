@@ -1,11 +1,18 @@
 // https://docs.espressif.com/projects/esp-idf/en/stable/esp32/api-reference/peripherals/dac.html
 
+#include <stdio.h>
 #include <string.h> // memset
+#include <stdatomic.h>
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/semphr.h"
 #include "esp_log.h"
 #include "esp_check.h"
+#include "esp_cpu.h"
+#include "esp_heap_caps.h"
+#include "esp_memory_utils.h"
+#include "esp_timer.h"
 #include "driver/dac_continuous.h"
 #include "driver/gpio.h"
 
@@ -14,75 +21,756 @@
 #define SOUND_A  26 // Audio output
 #define SOUND_SD 25 // Sound disable, active low
 
-#define DAC_DESC_NUM 8 // Number of DAC descriptors
-#define DAC_BUF_SZ 128 // DAC buffer size in bytes
+#define DAC_BUF_MAX 512 // largest DAC buffer size of the profiles, in bytes
+#define DESC_MAX 8 // most DAC descriptors of the profiles
+#if CONFIG_DAC_DMA_AUTO_16BIT_ALIGN
+#define DAC_SAMPLE_SZ 2 // each sample is widened to 16 bits
+#else
+#define DAC_SAMPLE_SZ 1
+#endif
 // was able to play audio at 48kHz with buf size of  8 and 8 desc, async.
 // was able to play audio at 48kHz with buf size of 64 and 8 desc, sync w/ vol control.
+#define REFILL_MIN_US 200 // shorter buffers interrupt too often
+#define MEASURE_MS 20 // time to measure the refill time over at start
 
 #define SOUND_VOLUME_DEFAULT 50
 #define SILENCE 0x80U
 #define POLL_DELAY 10
 #define PERCENT 100U
+#define SAMPLE_MAX 0xFFU
+#define LUT_SZ 256 // one entry per 8-bit sample value
+#define STREAM_LUT SOUND_VOICES // lookup table index of the stream
+#define STEP_ONE (1U<<16) // Q16 phase step of a voice at the DAC rate
+#define STEP_MAX (8U<<16)
+#define CMD_RING_SZ 32 // power of 2
+#define CMD_WAIT 100 // ms to wait for room in the command ring
+
+// Streaming from a file. The ring holds converted 8-bit mono samples
+// (~340ms at 48kHz). Reads are in large blocks aligned to the block size in
+// the file, so the SD card is busy in short bursts between long idle gaps.
+#define STREAM_RING_SZ (16*1024) // power of 2
+#define STREAM_BLOCK 4096 // bytes per file read
+#define STREAM_STACK 4096
+#define STREAM_PRIO 5
+
+// Clip cache, copies of clips in flash kept in internal RAM, so the refill
+// ISR does not stall on flash cache misses when other tasks use the flash.
+#define CACHE_CLIPS 16 // most clips cached, at most 32
 
 static const char *TAG = "sound";
 
-// Critical section protected variables
-static portMUX_TYPE spinlock = portMUX_INITIALIZER_UNLOCKED;
-static const uint8_t *abase;
-static volatile uint32_t asize;
-static volatile uint32_t aidx;
-static volatile bool     cyclic;
-static volatile uint32_t dcnt;
+// Number of DAC descriptors and buffer size in bytes of each latency
+// profile. A play waits for the buffers already queued, about desc_num-1
+// buffer times, and each buffer time brings a refill interrupt.
+static const struct {
+	uint32_t desc_num;
+	uint32_t buf_sz;
+} profiles[SOUND_LATENCY_LAST] = {
+	[SOUND_LATENCY_LOW] = {4, 64},
+	[SOUND_LATENCY_BALANCED] = {8, 128},
+	[SOUND_LATENCY_LOW_CPU] = {8, DAC_BUF_MAX},
+};
+
+typedef enum {VOICE_PCM8, VOICE_ADPCM} voice_fmt_t;
+
+// Audio queued to play on a voice after the current clip
+typedef struct {
+	const uint8_t *audio;
+	uint32_t size; // in samples
+	uint8_t fmt; // voice_fmt_t
+	bool loop;
+} clip_t;
+
+// One playing sound. The output position (idx) is in the current clip,
+// of size samples. The clip being read (base, fmt, decoder state) is the
+// same, except that the resampler may read ahead into the next queued clip.
+typedef struct {
+	const uint8_t *base;
+	uint32_t size; // in samples
+	uint32_t idx; // next sample
+	bool loop;
+	uint8_t fmt; // voice_fmt_t
+	uint8_t vol; // 0-100%
+	// Resampling, Q16 phase step and the fraction between idx and idx+1
+	uint32_t step;
+	uint32_t frac;
+	// Resampler input, hist[1] is the sample at idx, read ahead to rpos
+	bool primed;
+	uint8_t hist[4];
+	uint32_t rpos;
+	// IMA-ADPCM decoder state at idx, or at rpos when resampling
+	uint8_t istep; // step table index
+	uint16_t bpos; // sample within block
+	int16_t pred; // last sample
+	const uint8_t *blk; // current block
+	uint32_t rsize; // size of the clip at rpos
+	bool rloop;
+	// Clips to play next, without a gap
+	clip_t q[SOUND_QUEUE_LEN];
+	uint8_t qh; // first queued clip
+	uint8_t qn; // clips queued
+	uint8_t qr; // queued clips the resampler has started reading
+	TaskHandle_t notify; // task to notify as clips end
+	uint32_t gen; // generation of the play command
+} voice_t;
+
+// Commands from tasks to the refill ISR
+typedef enum {
+	CMD_PLAY, // start audio on a voice
+	CMD_REPLACE, // swap the audio of a playing voice, for sound_cyclic()
+	CMD_STOP, // stop a voice
+	CMD_STOP_ALL,
+	CMD_RATE, // change the phase step of a voice
+	CMD_QUEUE, // queue audio after the current clip of a voice
+	CMD_NOTIFY, // set the task to notify as clips end
+	CMD_VOLUME, // set the volume of a voice
+	CMD_MASTER, // set the master volume
+} cmd_type_t;
+
+typedef struct {
+	uint8_t type; // cmd_type_t
+	uint8_t voice;
+	uint8_t fmt; // voice_fmt_t
+	bool loop;
+	uint8_t vol; // 0-100%, of the voice or the master
+	uint32_t gen; // of the voice, commands for an old generation are dropped
+	const void *audio;
+	uint32_t size;
+	uint32_t step;
+	TaskHandle_t task; // to notify
+	uint32_t posted; // us, low bits of esp_timer_get_time()
+} cmd_t;
+
+// Task side view of a voice, guarded by cmd_mutex
+typedef struct {
+	uint32_t gen; // generation of the last play command
+	uint32_t prio;
+	uint32_t serial; // start order, for stealing the oldest
+	uint32_t rate; // Hz, 0 for the DAC rate
+	uint32_t queued; // clips posted to the queue, less q_used is pending
+	uint32_t cached; // bit per cache entry read by the voice
+	bool stopped; // stop posted, free for reuse
+} alloc_t;
+
+// A clip copied to internal RAM, guarded by cmd_mutex
+typedef struct {
+	const void *src; // in flash, NULL if the entry is free
+	uint8_t *copy;
+	uint32_t size; // in bytes
+	uint32_t last; // use order, the least recent is evicted first
+} cache_t;
+
+// Owned by the refill ISR. Tasks never touch these, they post commands
+// into a single producer, single consumer ring that the ISR drains at the
+// start of each refill. Tasks take turns as the producer with a mutex, so
+// there are no critical sections on either side.
+static voice_t voices[SOUND_VOICES]; // idle when idx >= size
+static uint32_t dcnt; // silent buffers left to write
+static cmd_t cmds[CMD_RING_SZ];
+static atomic_uint cmd_head; // written by tasks
+static atomic_uint cmd_tail; // written by the ISR
+static atomic_uint done_gen[SOUND_VOICES]; // last generation that ended
+static atomic_uint q_used[SOUND_VOICES]; // queued clips started or dropped
+static uint32_t volume; // master volume, 0-100%
+// Per voice sample to output lookup, with voice & master volume and bias
+// applied, centered on SILENCE. Keeps multiply & divide out of the mixing
+// loop. Rebuilt as volume commands are drained, so a change lands between
+// buffers.
+static int16_t vlut[SOUND_VOICES+1][LUT_SZ];
+
+// Owned by tasks
+static SemaphoreHandle_t cmd_mutex;
+static alloc_t alloc[SOUND_VOICES];
+static uint32_t serial;
+static int32_t cyclic_voice = -1; // voice used by sound_cyclic()
+static cache_t cache[CACHE_CLIPS];
+static uint32_t cache_budget; // bytes, 0 if disabled
+static uint32_t cache_used; // bytes
+static uint32_t cache_serial;
+static uint32_t cache_hits;
+static uint32_t cache_misses;
+
+// Stream state. The ring is single producer (stream task), single consumer
+// (refill ISR) and lock-free: each side only writes its own index.
+typedef enum {STREAM_IDLE, STREAM_RUN, STREAM_EOF} stream_state_t;
+static uint8_t *ring; // allocated on first use, kept until sound_deinit()
+static atomic_uint ring_head; // written by the producer
+static atomic_uint ring_tail; // written by the consumer
+static atomic_int stream_state;
+static volatile bool stream_quit;
+static volatile bool stream_alive; // producer task running
+static volatile uint32_t stream_underruns;
 
 // Other global variables
 static dac_continuous_handle_t dac_handle;
 static volatile bool device_en;
-static volatile uint32_t volume;
-static volatile uint8_t bias; // to prevent popping at end when vol low.
+static uint32_t sample_rate;
+static sound_latency_t latency;
+static uint32_t desc_num; // of the latency profile
 
+// Refill statistics, written by the ISR. A reset is requested with a flag
+// so the ISR stays the only writer. The ISR makes st_seq odd while it
+// writes the counts, as the 64-bit totals can tear, and a reader on the
+// other core reads again if st_seq was odd or changed.
+static uint32_t refill_us; // time to play one DMA buffer, measured
+static volatile uint32_t st_calls; // refill callbacks, including idle ones
+static volatile bool stats_reset;
+static atomic_uint st_seq;
+static volatile uint32_t st_refills; // buffers written
+static volatile uint64_t st_cycles; // total cycles in refills
+static volatile uint32_t st_cycles_max;
+static volatile uint32_t st_late; // descriptors that were not refilled in time
+static volatile uint32_t st_plays; // play commands applied
+static volatile uint64_t st_latency_us; // total play latency
+static volatile uint32_t st_latency_max_us;
+static uint32_t st_prev; // us, entry time of the last refill
+// Entry time of the last refill of each descriptor, by its buffer
+static struct {
+	void *buf;
+	uint32_t t; // us
+} st_desc[DESC_MAX];
 
-static bool IRAM_ATTR dac_convert_callback(dac_continuous_handle_t handle,
-	const dac_event_data_t *event, void *user_data)
+
+// IMA-ADPCM tables
+static DRAM_ATTR const int8_t ima_index[8] = {-1, -1, -1, -1, 2, 4, 6, 8};
+static DRAM_ATTR const int16_t ima_step[89] = {
+	7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+	50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+	253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+	1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+	3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+	11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+	32767
+};
+
+// Decode the next n samples of an IMA-ADPCM voice to 8-bit unsigned.
+// Blocks are SOUND_ADPCM_BLOCK bytes: predictor, step index and a pad byte,
+// then two samples per byte, low nibble first.
+static void IRAM_ATTR adpcm_decode(voice_t *vp, uint8_t *dst, uint32_t n)
 {
-#if CONFIG_DAC_DMA_AUTO_16BIT_ALIGN
-	uint8_t buf[event->buf_size/2];
+	const uint8_t *blk = vp->blk;
+	uint32_t bpos = vp->bpos;
+	int32_t pred = vp->pred;
+	int32_t step = vp->istep;
+
+	for (uint32_t i = 0; i < n; i++) {
+		if (bpos == 0) { // block header holds the first sample
+			pred = (int16_t)(blk[0] | blk[1] << 8);
+			step = blk[2];
+			if (step > 88) step = 88;
+		} else {
+			uint32_t k = bpos - 1;
+			uint32_t code = blk[4 + (k >> 1)] >> ((k & 1) << 2);
+			int32_t st = ima_step[step];
+			int32_t diff = st >> 3;
+			if (code & 4) diff += st;
+			if (code & 2) diff += st >> 1;
+			if (code & 1) diff += st >> 2;
+			pred += (code & 8) ? -diff : diff;
+			if (pred > INT16_MAX) pred = INT16_MAX;
+			else if (pred < INT16_MIN) pred = INT16_MIN;
+			step += ima_index[code & 7];
+			if (step < 0) step = 0;
+			else if (step > 88) step = 88;
+		}
+		dst[i] = (pred >> 8) + SILENCE;
+		if (++bpos == SOUND_ADPCM_BLOCK_SAMPLES) {
+			bpos = 0;
+			blk += SOUND_ADPCM_BLOCK;
+		}
+	}
+	vp->blk = blk;
+	vp->bpos = bpos;
+	vp->pred = pred;
+	vp->istep = step;
+}
+
+// Move the decoder of an IMA-ADPCM voice to sample idx of its clip, by
+// decoding from the start of the block.
+static void IRAM_ATTR adpcm_seek(voice_t *vp, uint32_t idx)
+{
+	uint8_t s;
+
+	vp->blk = vp->base + idx / SOUND_ADPCM_BLOCK_SAMPLES * SOUND_ADPCM_BLOCK;
+	vp->bpos = 0;
+	for (uint32_t k = idx % SOUND_ADPCM_BLOCK_SAMPLES; k; k--) adpcm_decode(vp, &s, 1);
+}
+
+// Wake the task waiting on a voice, if any, as a clip ends.
+static inline void IRAM_ATTR voice_notify(voice_t *vp)
+{
+	if (vp->notify) vTaskNotifyGiveFromISR(vp->notify, NULL);
+}
+
+// Drop the queued clips of a voice.
+static void IRAM_ATTR voice_flush(uint32_t v)
+{
+	voice_t *vp = &voices[v];
+
+	atomic_fetch_add_explicit(&q_used[v], vp->qn, memory_order_release);
+	vp->qh = vp->qn = vp->qr = 0;
+}
+
+// Stop a voice and tell the tasks.
+static void IRAM_ATTR voice_end(uint32_t v)
+{
+	voice_t *vp = &voices[v];
+
+	vp->idx = vp->size;
+	voice_flush(v);
+	atomic_store_explicit(&done_gen[v], vp->gen, memory_order_release);
+	voice_notify(vp);
+}
+
+// Start reading a clip on a voice from its first sample.
+static void IRAM_ATTR clip_read(voice_t *vp, const clip_t *c)
+{
+	vp->base = vp->blk = c->audio;
+	vp->bpos = 0;
+	vp->fmt = c->fmt;
+	vp->rpos = 0;
+	vp->rsize = c->size;
+	vp->rloop = c->loop;
+}
+
+// The output of a voice reached the end of its clip. Move on to the next
+// clip, which is already being read, or back to the start if looping.
+// Return true if the voice plays on from sample 0, or false if it ended.
+static bool IRAM_ATTR clip_end(voice_t *vp)
+{
+	uint32_t v = vp - voices;
+
+	if (vp->qr) {
+		const clip_t *c = &vp->q[vp->qh];
+		vp->size = c->size;
+		vp->loop = c->loop;
+		vp->qh = (vp->qh + 1) % SOUND_QUEUE_LEN;
+		vp->qn--;
+		vp->qr--;
+		atomic_fetch_add_explicit(&q_used[v], 1, memory_order_release);
+		voice_notify(vp);
+		return true;
+	}
+	return vp->loop;
+}
+
+// Read the next input sample of a resampled voice, going on to the next
+// queued clip, or wrapping if it loops. Past the end, read silence.
+static uint8_t IRAM_ATTR voice_pull(voice_t *vp)
+{
+	uint8_t s = SILENCE;
+
+	if (vp->rpos >= vp->rsize) {
+		if (vp->qn > vp->qr) {
+			clip_read(vp, &vp->q[(vp->qh + vp->qr) % SOUND_QUEUE_LEN]);
+			vp->qr++;
+		} else if (!vp->rloop) {
+			return s;
+		} else {
+			vp->rpos = 0;
+			vp->blk = vp->base;
+			vp->bpos = 0;
+		}
+	}
+	if (vp->fmt == VOICE_ADPCM) adpcm_decode(vp, &s, 1);
+	else s = vp->base[vp->rpos];
+	vp->rpos++;
+	return s;
+}
+
+// Resample a voice at its phase step into up to n samples, stopping at the
+// end of a sound that does not loop, and advance the voice. Linear
+// interpolation between the two nearest samples, or 4-tap Catmull-Rom with
+// SOUND_RESAMPLE_4TAP. Return the number of samples.
+static uint32_t IRAM_ATTR resample(voice_t *vp, uint8_t *dst, uint32_t n)
+{
+	uint8_t *h = vp->hist;
+	uint32_t idx = vp->idx, frac = vp->frac, i;
+
+	if (!vp->primed) {
+		h[1] = voice_pull(vp);
+		h[2] = voice_pull(vp);
+		h[3] = voice_pull(vp);
+		h[0] = h[1];
+		vp->primed = true;
+	}
+	for (i = 0; i < n && idx < vp->size; i++) {
+#if SOUND_RESAMPLE_4TAP
+		int32_t t = frac >> 8; // Q8
+		int32_t a = 3*(h[1]-h[2]) + h[3] - h[0]; // coefficients times 2
+		int32_t b = 2*h[0] - 5*h[1] + 4*h[2] - h[3];
+		int32_t c = h[2] - h[0];
+		int32_t y = h[1] + ((((((a*t >> 8) + b)*t >> 8) + c)*t + 256) >> 9);
+		dst[i] = (y < 0) ? 0 : (y > SAMPLE_MAX) ? SAMPLE_MAX : y;
 #else
-	uint8_t buf[event->buf_size];
+		dst[i] = h[1] + (((h[2] - h[1]) * (int32_t)frac + (1 << 15)) >> 16);
 #endif
-    // size_t load_bytes = 0;
-	portENTER_CRITICAL_ISR(&spinlock);
-	if (aidx < asize) {
-		uint32_t idx = aidx;
-		uint32_t size = (!cyclic && asize < sizeof(buf)) ? asize : sizeof(buf);
-		aidx =  cyclic ? (aidx + size) % asize : aidx + size;
-		portEXIT_CRITICAL_ISR(&spinlock);
-		uint32_t i;
-		for (i = 0; i < size; i++) buf[i] = abase[(idx+i)%asize]*volume/PERCENT + bias;
-		while (i < sizeof(buf)) buf[i++] = SILENCE; // pad to block size with silence
-		dac_continuous_write_asynchronously(handle,
-			event->buf, event->buf_size,
-			buf, sizeof(buf), NULL /*&load_bytes*/);
-			// error if load_bytes != sizeof(buf)
+		for (frac += vp->step; frac >= STEP_ONE; frac -= STEP_ONE) {
+			h[0] = h[1]; h[1] = h[2]; h[2] = h[3];
+			h[3] = voice_pull(vp);
+			if (++idx >= vp->size && clip_end(vp)) idx = 0;
+		}
+	}
+	vp->idx = (idx < vp->size) ? idx : vp->size;
+	vp->frac = frac;
+	return i;
+}
+
+// Mix a run of samples through a lookup table. The first voice stores,
+// which saves clearing the mix buffer.
+static inline void IRAM_ATTR mix_run(int32_t *dst, const uint8_t *src, uint32_t n,
+	const int16_t *lut, bool first)
+{
+	if (first) {
+		for (uint32_t k = 0; k < n; k++) dst[k] = lut[src[k]];
+	} else {
+		for (uint32_t k = 0; k < n; k++) dst[k] += lut[src[k]];
+	}
+}
+
+// Phase step to play audio at rate_hz on the DAC, 0 for the DAC rate.
+static uint32_t voice_step(uint32_t rate_hz)
+{
+	if (rate_hz == 0 || sample_rate == 0) return STEP_ONE;
+	uint64_t step = (((uint64_t)rate_hz << 16) + sample_rate/2) / sample_rate;
+	return (step > STEP_MAX) ? STEP_MAX : (step == 0) ? 1 : step;
+}
+
+// Build the lookup table for a voice from its volume and the master volume.
+// Same result as sample*gain/PERCENT + bias as it was computed per sample,
+// with the quotient stepped incrementally so there is no divide per entry.
+static void IRAM_ATTR lut_build(uint32_t v)
+{
+	const uint32_t den = PERCENT*PERCENT;
+	uint32_t gain = (v == STREAM_LUT ? MAX_VOL : voices[v].vol) * volume;
+	int32_t bias = SILENCE - SILENCE*gain/den;
+	uint32_t q = 0, r = 0;
+	uint32_t dq = gain / den, dr = gain % den;
+
+	for (uint32_t i = 0; i < LUT_SZ; i++) {
+		vlut[v][i] = q + bias - SILENCE; // q = i*gain/den
+		q += dq;
+		r += dr;
+		if (r >= den) {q++; r -= den;}
+	}
+}
+
+// Apply the commands posted by tasks since the last refill.
+// now: time of this refill in us, for the play latency.
+// Start and end writing the refill statistics (see st_seq).
+static inline void IRAM_ATTR st_begin(void)
+{
+	uint32_t seq = atomic_load_explicit(&st_seq, memory_order_relaxed);
+	atomic_store_explicit(&st_seq, seq + 1, memory_order_relaxed);
+	atomic_thread_fence(memory_order_release);
+}
+
+static inline void IRAM_ATTR st_end(void)
+{
+	uint32_t seq = atomic_load_explicit(&st_seq, memory_order_relaxed);
+	atomic_store_explicit(&st_seq, seq + 1, memory_order_release);
+}
+
+// Count the refills a descriptor missed. The driver reports only the
+// latest descriptor to finish, so one that finished while the ISR was
+// held off gets no refill and plays its old samples again. It is counted
+// at its next refill, by the whole passes of the ring since its last.
+static void IRAM_ATTR late_count(void *buf, uint32_t now)
+{
+	uint32_t lap = desc_num*refill_us;
+	uint32_t i = 0;
+
+	while (i < desc_num && st_desc[i].buf != NULL && st_desc[i].buf != buf) i++;
+	if (i == desc_num) return; // not one of the channel's descriptors
+	if (st_desc[i].buf != NULL && lap)
+		st_late += (now - st_desc[i].t + lap/2)/lap - 1;
+	st_desc[i].buf = buf;
+	st_desc[i].t = now;
+}
+
+static void IRAM_ATTR cmd_drain(uint32_t now)
+{
+	uint32_t tail = atomic_load_explicit(&cmd_tail, memory_order_relaxed);
+	uint32_t head = atomic_load_explicit(&cmd_head, memory_order_acquire);
+
+	for (; tail != head; tail++) {
+		const cmd_t *c = &cmds[tail & (CMD_RING_SZ-1)];
+		voice_t *vp = &voices[c->voice];
+		if (c->type == CMD_PLAY) {
+			if (vp->idx < vp->size) voice_notify(vp); // stolen
+			voice_flush(c->voice);
+			clip_t clip = {c->audio, c->size, c->fmt, c->loop};
+			clip_read(vp, &clip);
+			vp->size = c->size;
+			vp->idx = 0;
+			vp->loop = c->loop;
+			vp->step = c->step;
+			vp->frac = 0;
+			vp->primed = false;
+			vp->notify = c->task;
+			vp->gen = c->gen;
+			vp->vol = c->vol;
+			lut_build(c->voice);
+			// The first sample plays after the buffers already queued
+			uint32_t lat = now - c->posted + (desc_num-1)*refill_us;
+			st_begin();
+			st_plays++;
+			st_latency_us += lat;
+			if (lat > st_latency_max_us) st_latency_max_us = lat;
+			st_end();
+		} else if (c->type == CMD_STOP_ALL) {
+			for (uint32_t v = 0; v < SOUND_VOICES; v++)
+				if (voices[v].idx < voices[v].size) voice_end(v);
+		} else if (c->type == CMD_MASTER) {
+			volume = c->vol;
+			for (uint32_t v = 0; v <= STREAM_LUT; v++) lut_build(v);
+		} else if (vp->gen != c->gen) { // voice has moved on
+			if (c->type == CMD_QUEUE)
+				atomic_fetch_add_explicit(&q_used[c->voice], 1, memory_order_release);
+			else if (c->type == CMD_NOTIFY && c->task)
+				vTaskNotifyGiveFromISR(c->task, NULL);
+		} else if (c->type == CMD_QUEUE) {
+			clip_t clip = {c->audio, c->size, c->fmt, c->loop};
+			if (vp->idx < vp->size) {
+				vp->q[(vp->qh + vp->qn++) % SOUND_QUEUE_LEN] = clip;
+				continue;
+			}
+			// Ended before the clip came, play it now (with a gap)
+			clip_read(vp, &clip);
+			vp->size = c->size;
+			vp->idx = 0;
+			vp->loop = c->loop;
+			vp->frac = 0;
+			vp->primed = false;
+			atomic_fetch_add_explicit(&q_used[c->voice], 1, memory_order_release);
+			atomic_store_explicit(&done_gen[c->voice], vp->gen - 1, memory_order_release);
+		} else if (c->type == CMD_NOTIFY) {
+			vp->notify = c->task;
+			if (vp->idx >= vp->size) voice_notify(vp); // already ended
+		} else if (c->type == CMD_VOLUME) {
+			vp->vol = c->vol; // also for a clip queued after it ends
+			lut_build(c->voice);
+		} else if (vp->idx >= vp->size) {
+			continue; // ended
+		} else if (c->type == CMD_REPLACE) {
+			vp->base = vp->blk = c->audio;
+			vp->size = vp->rsize = c->size;
+			vp->idx = 0;
+			vp->frac = 0;
+			vp->bpos = 0;
+		} else if (c->type == CMD_STOP) {
+			voice_end(c->voice);
+		} else if (c->type == CMD_RATE) {
+			if (vp->step == STEP_ONE && c->step != STEP_ONE && !vp->qr) {
+				// Start reading ahead from the current position
+				vp->primed = false;
+				vp->rpos = vp->idx;
+			}
+			vp->step = c->step;
+		}
+	}
+	atomic_store_explicit(&cmd_tail, tail, memory_order_release);
+}
+
+// Mix the active voices and the stream into one DMA buffer.
+static bool IRAM_ATTR dac_convert_callback(dac_continuous_handle_t handle,
+	const dac_event_data_t *event, void *user_data)
+{
+	// One DMA channel, so the ISR is never reentered
+	static uint8_t buf[DAC_BUF_MAX/DAC_SAMPLE_SZ];
+	static int32_t mix[DAC_BUF_MAX/DAC_SAMPLE_SZ];
+	static uint8_t dec[DAC_BUF_MAX/DAC_SAMPLE_SZ]; // decoded or streamed samples
+	uint32_t len = event->buf_size/DAC_SAMPLE_SZ; // samples
+	uint32_t nmix = 0; // sounds mixed
+	uint32_t t0 = esp_cpu_get_cycle_count();
+	uint32_t now = esp_timer_get_time();
+
+	st_calls++;
+	st_begin();
+	if (stats_reset) {
+		st_refills = st_cycles = st_cycles_max = st_late = 0;
+		st_plays = st_latency_us = st_latency_max_us = 0;
+		stats_reset = false;
+	}
+	late_count(event->buf, now);
+	st_end();
+	st_prev = now;
+	cmd_drain(now);
+	for (uint32_t v = 0; v < SOUND_VOICES; v++) {
+		voice_t *vp = &voices[v];
+		if (vp->idx >= vp->size) continue;
+		const int16_t *lut = vlut[v];
+		bool first = (nmix++ == 0);
+		uint32_t idx = vp->idx, i = 0;
+		bool rs = vp->step != STEP_ONE || vp->qr; // or reading ahead
+		if (!rs && vp->primed) {
+			// Back from resampling, the reader is a few samples past idx
+			vp->primed = false;
+			vp->rpos = idx;
+			if (vp->fmt == VOICE_ADPCM) adpcm_seek(vp, idx);
+		}
+		if (rs) {
+			i = resample(vp, dec, len);
+			mix_run(mix, dec, i, lut, first);
+		}
+		else while (i < len) {
+			// Contiguous run up to the end of the sound or buffer
+			uint32_t n = vp->size - idx;
+			if (n > len - i) n = len - i;
+			const uint8_t *src = vp->base + idx;
+			if (vp->fmt == VOICE_ADPCM) {
+				adpcm_decode(vp, dec, n);
+				src = dec;
+			}
+			mix_run(mix + i, src, n, lut, first);
+			i += n;
+			idx += n;
+			if (idx < vp->size) break;
+			// A looping clip gives way to a queued clip at the end of a pass
+			if (vp->qn) {
+				clip_read(vp, &vp->q[vp->qh]);
+				vp->qr++;
+			} else if (vp->loop) {
+				vp->blk = vp->base;
+				vp->bpos = 0;
+			}
+			if (!clip_end(vp)) break; // rest of the buffer is silence
+			idx = 0;
+		}
+		if (first && i < len)
+			memset(mix + i, 0, (len - i)*sizeof(int32_t));
+		if (!rs) vp->idx = idx;
+		if (vp->idx >= vp->size) voice_end(v);
+	}
+	int32_t state = atomic_load_explicit(&stream_state, memory_order_acquire);
+	if (state != STREAM_IDLE && stream_quit) {
+		atomic_store_explicit(&stream_state, STREAM_IDLE, memory_order_release);
+	} else if (state != STREAM_IDLE) {
+		// Take what is in the ring, an underrun if not enough
+		uint32_t tail = atomic_load_explicit(&ring_tail, memory_order_relaxed);
+		uint32_t head = atomic_load_explicit(&ring_head, memory_order_acquire);
+		uint32_t n = head - tail;
+		if (n > len) n = len;
+		else if (n < len && state == STREAM_RUN) stream_underruns++;
+		if (n) {
+			uint32_t off = tail & (STREAM_RING_SZ-1);
+			uint32_t n1 = STREAM_RING_SZ - off;
+			if (n1 > n) n1 = n;
+			memcpy(dec, ring + off, n1);
+			memcpy(dec + n1, ring, n - n1);
+			atomic_store_explicit(&ring_tail, tail + n, memory_order_release);
+			bool first = (nmix++ == 0);
+			mix_run(mix, dec, n, vlut[STREAM_LUT], first);
+			if (first && n < len)
+				memset(mix + n, 0, (len - n)*sizeof(int32_t));
+		} else if (state == STREAM_EOF) {
+			atomic_store_explicit(&stream_state, STREAM_IDLE, memory_order_release);
+		}
+	}
+
+	if (nmix) {
+		dcnt = desc_num; // then silence in every descriptor
+		// Saturate to the DAC range
+		for (uint32_t i = 0; i < len; i++) {
+			int32_t s = SILENCE + mix[i];
+			buf[i] = (s < 0) ? 0 : (s > SAMPLE_MAX) ? SAMPLE_MAX : s;
+		}
 	} else if (dcnt) {
 		dcnt--;
-		portEXIT_CRITICAL_ISR(&spinlock);
-		memset(buf, SILENCE, sizeof(buf));
-		dac_continuous_write_asynchronously(handle,
-			event->buf, event->buf_size,
-			buf, sizeof(buf), NULL /*&load_bytes*/);
+		memset(buf, SILENCE, len);
 	} else {
-		portEXIT_CRITICAL_ISR(&spinlock);
+		return true;
 	}
+	dac_continuous_write_asynchronously(handle,
+		event->buf, event->buf_size,
+		buf, len, NULL /*&load_bytes*/);
+		// error if load_bytes != len
+
+	uint32_t cycles = esp_cpu_get_cycle_count() - t0;
+	st_begin();
+	st_refills++;
+	st_cycles += cycles;
+	if (cycles > st_cycles_max) st_cycles_max = cycles;
+	st_end();
 	return true;
 }
 
+// Post a command for the refill ISR. Only one task posts at a time.
+// Waits for room if the ring is full, which only happens if the DAC is
+// not running. Callers change their task side state only once posted.
+// Return zero if posted, or non-zero if the ring stayed full for CMD_WAIT
+// ms and the command was dropped.
+static int32_t cmd_post(const cmd_t *c)
+{
+	uint32_t head = atomic_load_explicit(&cmd_head, memory_order_relaxed);
+
+	for (uint32_t t = 0; head - atomic_load_explicit(&cmd_tail,
+		memory_order_acquire) >= CMD_RING_SZ; t += POLL_DELAY) {
+		if (t >= CMD_WAIT) {
+			ESP_LOGW(TAG, "Command ring full, dropped");
+			return -1;
+		}
+		vTaskDelay(pdMS_TO_TICKS(POLL_DELAY));
+	}
+	cmds[head & (CMD_RING_SZ-1)] = *c;
+	cmds[head & (CMD_RING_SZ-1)].posted = esp_timer_get_time();
+	atomic_store_explicit(&cmd_head, head + 1, memory_order_release);
+	return 0;
+}
+
+// Return true if the last play command on a voice has not ended yet.
+static bool voice_busy(uint32_t v)
+{
+	return !alloc[v].stopped &&
+		atomic_load_explicit(&done_gen[v], memory_order_acquire) != alloc[v].gen;
+}
+
+
+// Measure the time between refills of the running DMA, over at least
+// MEASURE_MS and a few buffer times.
+// Return the refill time in us, or 0 if there were no refills.
+static uint32_t refill_measure(void)
+{
+	TickType_t ticks = pdMS_TO_TICKS(MEASURE_MS + 4*refill_us/1000) + 1;
+
+	vTaskDelay(ticks); // for the DMA to get going
+	uint32_t c0 = st_calls, t0 = st_prev;
+	vTaskDelay(ticks);
+	uint32_t c1 = st_calls, t1 = st_prev;
+	if (t0 == 0 || c1 - c0 < 2) return 0;
+	return (t1 - t0) / (c1 - c0);
+}
 
 // Initialize the sound driver. Must be called before using sound.
-// May be called again to change sample rate.
+// May be called again to change sample rate or latency profile.
+// The buffer time is measured once the DMA runs. If it is below
+// REFILL_MIN_US, the next profile with fewer interrupts is used.
 // sample_hz: sample rate in Hz to playback audio.
+// profile: latency profile, trading play latency against refill
+// interrupts (CPU time).
 // Return zero if successful, or non-zero otherwise.
-int32_t sound_init(uint32_t sample_hz)
+int32_t sound_init(uint32_t sample_hz, sound_latency_t profile)
 {
+	if (profile >= SOUND_LATENCY_LAST) profile = SOUND_LATENCY_BALANCED;
+	uint32_t buf_us = sample_hz ? (uint64_t)profiles[profile].buf_sz/DAC_SAMPLE_SZ *
+		1000000 / sample_hz : 0;
+	if (buf_us < REFILL_MIN_US && profile+1 < SOUND_LATENCY_LAST) {
+		ESP_LOGW(TAG, "%u us buffers too short, using profile %d",
+			(unsigned)buf_us, profile+1);
+		return sound_init(sample_hz, profile+1);
+	}
+	if (cmd_mutex == NULL) cmd_mutex = xSemaphoreCreateMutex();
+	sample_rate = sample_hz;
+	latency = profile;
+	// Voices playing at their own rate need a new phase step
+	xSemaphoreTake(cmd_mutex, portMAX_DELAY);
+	for (uint32_t v = 0; v < SOUND_VOICES; v++) {
+		if (!alloc[v].rate || !voice_busy(v)) continue;
+		cmd_t c = {.type = CMD_RATE, .voice = v, .gen = alloc[v].gen,
+			.step = voice_step(alloc[v].rate)};
+		cmd_post(&c);
+	}
+	xSemaphoreGive(cmd_mutex);
 	sound_set_volume(SOUND_VOLUME_DEFAULT);
 	
 	/* * * * * * * * * * GPIO25 Pin Config * * * * * * * * * */
@@ -101,12 +789,16 @@ int32_t sound_init(uint32_t sample_hz)
 
 	// If sound_init called previously, disable & delete prior channel
 	if (dac_handle != NULL) sound_deinit();
+	// Reset the refill timing once the old channel's ISR has stopped
+	refill_us = buf_us;
+	st_prev = 0;
+	memset(st_desc, 0, sizeof(st_desc));
 
 	/* * * * * * * * * * GPIO26 Sound Config * * * * * * * * * */
 	dac_continuous_config_t cont_cfg = {
 		.chan_mask = DAC_CHANNEL_MASK_CH1, // GPIO26 only
-		.desc_num = DAC_DESC_NUM,
-		.buf_size = DAC_BUF_SZ,
+		.desc_num = profiles[profile].desc_num,
+		.buf_size = profiles[profile].buf_sz,
 		.freq_hz = sample_hz,
 		.offset = 0,
 		.clk_src = DAC_DIGI_CLK_SRC_DEFAULT,
@@ -132,8 +824,28 @@ int32_t sound_init(uint32_t sample_hz)
 	ESP_ERROR_CHECK(dac_continuous_register_event_callback(dac_handle, &cbs, NULL));
 	// Enable the continuous channels
 	ESP_ERROR_CHECK(dac_continuous_enable(dac_handle));
+	desc_num = profiles[profile].desc_num;
 	ESP_LOGI(TAG, "Start async audio DMA");
 	ESP_ERROR_CHECK(dac_continuous_start_async_writing(dac_handle));
+
+	// Check the buffer time against the DMA, as the DAC clock may not
+	// divide down to the sample rate exactly
+	uint32_t us = refill_measure();
+	if (us == 0) {
+		ESP_LOGE(TAG, "No DMA refills");
+		sound_deinit();
+		return -1;
+	}
+	if (us < REFILL_MIN_US && profile+1 < SOUND_LATENCY_LAST) {
+		ESP_LOGW(TAG, "%u us refills too short, using profile %d",
+			(unsigned)us, profile+1);
+		return sound_init(sample_hz, profile+1);
+	}
+	if (us > refill_us + refill_us/8 || us < refill_us - refill_us/8)
+		ESP_LOGW(TAG, "Refill time %u us, expected %u us", (unsigned)us, (unsigned)refill_us);
+	refill_us = us;
+	ESP_LOGI(TAG, "Profile %d, %u x %u byte buffers, %u us refills", profile,
+		(unsigned)desc_num, (unsigned)profiles[profile].buf_sz, (unsigned)us);
 	return 0;
 }
 
@@ -141,6 +853,7 @@ int32_t sound_init(uint32_t sample_hz)
 // Return zero if successful, or non-zero otherwise.
 int32_t sound_deinit(void)
 {
+	sound_stream_stop();
 	ESP_LOGI(TAG, "Stop async audio DMA");
 	ESP_ERROR_CHECK(dac_continuous_stop_async_writing(dac_handle));
 	ESP_ERROR_CHECK(dac_continuous_disable(dac_handle));
@@ -148,60 +861,604 @@ int32_t sound_deinit(void)
 	ESP_ERROR_CHECK(dac_continuous_register_event_callback(dac_handle, &cbs, NULL));
 	ESP_ERROR_CHECK(dac_continuous_del_channels(dac_handle));
 	dac_handle = NULL;
+	heap_caps_free(ring);
+	ring = NULL;
 	return 0;
 }
 
+// Return true if the refill ISR may be reading a cache entry: a voice
+// that read it has not ended. Call with cmd_mutex held.
+static bool cache_busy(uint32_t e)
+{
+	for (uint32_t v = 0; v < SOUND_VOICES; v++) {
+		if ((alloc[v].cached >> e & 1) &&
+			atomic_load_explicit(&done_gen[v], memory_order_acquire) != alloc[v].gen)
+			return true;
+	}
+	return false;
+}
+
+// Evict least recently used entries that are not busy, until size more
+// bytes fit the budget and, if entry is true, an entry is free.
+// Call with cmd_mutex held.
+// Return a free entry, or -1 if there is no room.
+static int32_t cache_evict(uint32_t size, bool entry)
+{
+	for (;;) {
+		int32_t lru = -1, free_e = -1;
+		for (uint32_t e = 0; e < CACHE_CLIPS; e++) {
+			if (cache[e].src == NULL) {
+				if (free_e < 0) free_e = e;
+			} else if (!cache_busy(e) &&
+				(lru < 0 || (int32_t)(cache[e].last - cache[lru].last) < 0)) {
+				lru = e;
+			}
+		}
+		if ((free_e >= 0 || !entry) && cache_used + size <= cache_budget) return free_e;
+		if (lru < 0) return -1;
+		heap_caps_free(cache[lru].copy);
+		cache_used -= cache[lru].size;
+		cache[lru].src = NULL;
+	}
+}
+
+// Return the audio to play for a clip: its copy in internal RAM if cached,
+// or if it can be cached now, otherwise the clip itself. Only clips in
+// flash are cached. Call with cmd_mutex held.
+// audio: the clip.
+// size: the size of the clip in bytes.
+// v: voice that will read it.
+static const void *cache_lookup(const void *audio, uint32_t size, uint32_t v)
+{
+	if (cache_used > cache_budget) cache_evict(0, false); // budget lowered
+	if (cache_budget == 0 || !esp_ptr_in_drom(audio)) return audio;
+	for (uint32_t e = 0; e < CACHE_CLIPS; e++) {
+		if (cache[e].src != audio || cache[e].size < size) continue;
+		cache_hits++;
+		cache[e].last = cache_serial++;
+		alloc[v].cached |= 1U << e;
+		return cache[e].copy;
+	}
+	cache_misses++;
+	if (size > cache_budget) return audio;
+	int32_t e = cache_evict(size, true);
+	if (e < 0) return audio;
+	uint8_t *copy = heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+	if (copy == NULL) return audio;
+	memcpy(copy, audio, size);
+	cache[e] = (cache_t){.src = audio, .copy = copy, .size = size, .last = cache_serial++};
+	cache_used += size;
+	alloc[v].cached |= 1U << e;
+	return copy;
+}
+
+// Bytes of audio of a format, from its size in samples.
+static uint32_t clip_bytes(uint32_t size, voice_fmt_t fmt)
+{
+	if (fmt != VOICE_ADPCM) return size;
+	return (size + SOUND_ADPCM_BLOCK_SAMPLES-1) / SOUND_ADPCM_BLOCK_SAMPLES *
+		SOUND_ADPCM_BLOCK;
+}
+
+// Start audio of either format on a free or stolen voice, notifying task
+// (if not NULL) as it ends. Call with cmd_mutex held.
+static int32_t voice_alloc(const void *audio, uint32_t size, uint32_t rate_hz,
+	uint32_t vol, uint32_t prio, bool loop, voice_fmt_t fmt, TaskHandle_t task)
+{
+	int32_t v = -1;
+
+	if (vol > MAX_VOL) vol = MAX_VOL;
+	for (uint32_t i = 0; i < SOUND_VOICES; i++) {
+		alloc_t *ap = &alloc[i];
+		if (!voice_busy(i)) {v = i; break;} // free voice
+		if (ap->prio > prio) continue;
+		if (v < 0 || ap->prio < alloc[v].prio ||
+			(ap->prio == alloc[v].prio && (int32_t)(ap->serial - alloc[v].serial) < 0))
+			v = i; // lower priority, or same priority and older
+	}
+	if (v >= 0) {
+		alloc_t *ap = &alloc[v];
+		// Keep the entries of a stolen voice until the ISR is done with them
+		if (atomic_load_explicit(&done_gen[v], memory_order_acquire) == ap->gen)
+			ap->cached = 0;
+		audio = cache_lookup(audio, clip_bytes(size, fmt), v);
+		cmd_t c = {.type = CMD_PLAY, .voice = v, .fmt = fmt, .loop = loop,
+			.vol = vol, .gen = ap->gen + 1, .audio = audio, .size = size,
+			.step = voice_step(rate_hz), .task = task};
+		if (cmd_post(&c)) return -1; // the voice plays on as it was
+		ap->gen++;
+		ap->prio = prio;
+		ap->serial = serial++;
+		ap->rate = rate_hz;
+		ap->stopped = false;
+		if (v == cyclic_voice) cyclic_voice = -1;
+	}
+	return v;
+}
+
+// Start audio of either format on a free or stolen voice.
+static int32_t voice_start(const void *audio, uint32_t size, uint32_t rate_hz,
+	uint32_t vol, uint32_t prio, bool loop, voice_fmt_t fmt)
+{
+	if (cmd_mutex == NULL || audio == NULL || size == 0) return -1;
+	xSemaphoreTake(cmd_mutex, portMAX_DELAY);
+	int32_t v = voice_alloc(audio, size, rate_hz, vol, prio, loop, fmt, NULL);
+	xSemaphoreGive(cmd_mutex);
+	return v;
+}
+
+// Queue audio of either format on a voice.
+static int32_t voice_queue(int32_t voice, const void *audio, uint32_t size,
+	bool loop, voice_fmt_t fmt)
+{
+	int32_t ret = -1;
+
+	if (cmd_mutex == NULL || voice < 0 || voice >= SOUND_VOICES ||
+		audio == NULL || size == 0) return -1;
+	xSemaphoreTake(cmd_mutex, portMAX_DELAY);
+	alloc_t *ap = &alloc[voice];
+	uint32_t pending = ap->queued -
+		atomic_load_explicit(&q_used[voice], memory_order_acquire);
+	if (voice_busy(voice) && pending < SOUND_QUEUE_LEN) {
+		audio = cache_lookup(audio, clip_bytes(size, fmt), voice);
+		cmd_t c = {.type = CMD_QUEUE, .voice = voice, .fmt = fmt, .loop = loop,
+			.gen = ap->gen, .audio = audio, .size = size};
+		if (cmd_post(&c) == 0) {
+			ap->queued++;
+			ret = 0;
+		}
+	}
+	xSemaphoreGive(cmd_mutex);
+	return ret;
+}
+
 // Start playing the sound immediately. Play the audio buffer once.
+// The sound is mixed with any others playing (see sound_play()).
 // audio: a pointer to an array of 8-bit, unsigned audio data.
 // size: the size of the array in bytes.
 // wait: if true, block until done playing, otherwise return straight away.
 void sound_start(const void *audio, uint32_t size, bool wait)
 {
-	portENTER_CRITICAL(&spinlock);
-	abase = audio;
-	asize = size;
-	aidx = 0;
-	cyclic = false;
-	dcnt = DAC_DESC_NUM;
-	portEXIT_CRITICAL(&spinlock);
-	while (wait && aidx < asize)
-		vTaskDelay(pdMS_TO_TICKS(POLL_DELAY));
+	TaskHandle_t task = wait ? xTaskGetCurrentTaskHandle() : NULL;
+
+	if (cmd_mutex == NULL || audio == NULL || size == 0) return;
+	xSemaphoreTake(cmd_mutex, portMAX_DELAY);
+	int32_t v = voice_alloc(audio, size, 0, MAX_VOL, SOUND_PRIO_DEFAULT,
+		false, VOICE_PCM8, task);
+	uint32_t gen = (v >= 0) ? alloc[v].gen : 0;
+	xSemaphoreGive(cmd_mutex);
+	// Woken by the refill ISR as the sound ends, is stopped or is stolen
+	while (task && v >= 0 && alloc[v].gen == gen && voice_busy(v))
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
 }
 
 // Cyclically play samples from audio buffer until sound_stop() is called.
+// Replaces the previous sound_cyclic() audio, so it can be called again
+// to change a tone without adding voices.
 // audio: a pointer to an array of 8-bit, unsigned audio data.
 // size: the size of the array in bytes.
 void sound_cyclic(const void *audio, uint32_t size)
 {
-	portENTER_CRITICAL(&spinlock);
-	abase = audio;
-	asize = size;
-	aidx = 0;
-	cyclic = true;
-	dcnt = DAC_DESC_NUM;
-	portEXIT_CRITICAL(&spinlock);
+	if (cmd_mutex == NULL || audio == NULL || size == 0) return;
+	xSemaphoreTake(cmd_mutex, portMAX_DELAY);
+	if (cyclic_voice >= 0 && voice_busy(cyclic_voice)) {
+		cmd_t c = {.type = CMD_REPLACE, .voice = cyclic_voice,
+			.gen = alloc[cyclic_voice].gen, .audio = audio, .size = size};
+		cmd_post(&c);
+	} else {
+		cyclic_voice = voice_alloc(audio, size, 0, MAX_VOL,
+			SOUND_PRIO_DEFAULT, true, VOICE_PCM8, NULL);
+	}
+	xSemaphoreGive(cmd_mutex);
+}
+
+// Start playing audio on a voice, mixed with the other voices.
+// If no voice is free, the active voice with the lowest priority is stolen
+// (the oldest if tied), as long as its priority is not above prio.
+// Audio at another sample rate is resampled to the DAC rate.
+// audio: a pointer to an array of 8-bit, unsigned audio data.
+// size: the size of the array in bytes.
+// rate_hz: sample rate of the audio, or 0 if the same as the DAC.
+// vol: voice volume, 0-100% as an integer value.
+// prio: priority, higher wins when stealing voices.
+// loop: if true, play cyclically until stopped.
+// Return the voice number, or -1 if no voice was available or the DAC
+// is not taking commands.
+int32_t sound_play(const void *audio, uint32_t size, uint32_t rate_hz, uint32_t vol, uint32_t prio, bool loop)
+{
+	return voice_start(audio, size, rate_hz, vol, prio, loop, VOICE_PCM8);
+}
+
+// Start playing IMA-ADPCM audio on a voice, as made by
+// components/audio/ima_adpcm.py. Otherwise the same as sound_play().
+// audio: a pointer to the array of IMA-ADPCM blocks.
+// samples: the number of samples (the _SAMPLES value of the asset).
+// rate_hz: sample rate of the audio, or 0 if the same as the DAC.
+// vol: voice volume, 0-100% as an integer value.
+// prio: priority, higher wins when stealing voices.
+// loop: if true, play cyclically until stopped.
+// Return the voice number, or -1 if no voice was available or the DAC
+// is not taking commands.
+int32_t sound_play_adpcm(const void *audio, uint32_t samples, uint32_t rate_hz, uint32_t vol, uint32_t prio, bool loop)
+{
+	return voice_start(audio, samples, rate_hz, vol, prio, loop, VOICE_ADPCM);
+}
+
+// Queue audio to play on a voice straight after its current clip and any
+// clips queued before it, with no gap. Plays at the rate and volume of
+// the voice. A looping clip plays on to a clip queued after it at the end
+// of a pass, so an intro can lead into a loop.
+// voice: voice number returned by sound_play().
+// audio: a pointer to an array of 8-bit, unsigned audio data.
+// size: the size of the array in bytes.
+// loop: if true, play cyclically until stopped or another clip is queued.
+// Return zero if queued, or non-zero if the voice is not playing or
+// SOUND_QUEUE_LEN clips are already waiting.
+int32_t sound_queue(int32_t voice, const void *audio, uint32_t size, bool loop)
+{
+	return voice_queue(voice, audio, size, loop, VOICE_PCM8);
+}
+
+// Queue IMA-ADPCM audio on a voice. Otherwise the same as sound_queue().
+// voice: voice number returned by sound_play() or sound_play_adpcm().
+// audio: a pointer to the array of IMA-ADPCM blocks.
+// samples: the number of samples (the _SAMPLES value of the asset).
+// loop: if true, play cyclically until stopped or another clip is queued.
+// Return zero if queued, or non-zero otherwise.
+int32_t sound_queue_adpcm(int32_t voice, const void *audio, uint32_t samples, bool loop)
+{
+	return voice_queue(voice, audio, samples, loop, VOICE_ADPCM);
+}
+
+// Notify a task each time a clip on a voice ends: as it moves on to a
+// queued clip, and when the voice stops, is stopped or is stolen. The
+// task waits with ulTaskNotifyTake(), e.g. to queue the next clip, in
+// place of polling. Applies until the voice is started again.
+// voice: voice number returned by sound_play().
+// task: task to notify, or NULL for none.
+void sound_voice_notify(int32_t voice, TaskHandle_t task)
+{
+	if (cmd_mutex == NULL || voice < 0 || voice >= SOUND_VOICES) return;
+	xSemaphoreTake(cmd_mutex, portMAX_DELAY);
+	cmd_t c = {.type = CMD_NOTIFY, .voice = voice, .gen = alloc[voice].gen,
+		.task = task};
+	cmd_post(&c);
+	xSemaphoreGive(cmd_mutex);
+}
+
+// Stop a voice.
+// voice: voice number returned by sound_play().
+void sound_voice_stop(int32_t voice)
+{
+	if (cmd_mutex == NULL || voice < 0 || voice >= SOUND_VOICES) return;
+	xSemaphoreTake(cmd_mutex, portMAX_DELAY);
+	cmd_t c = {.type = CMD_STOP, .voice = voice, .gen = alloc[voice].gen};
+	if (cmd_post(&c) == 0) alloc[voice].stopped = true;
+	xSemaphoreGive(cmd_mutex);
+}
+
+// Return true if the voice is playing, otherwise return false.
+// voice: voice number returned by sound_play().
+bool sound_voice_busy(int32_t voice)
+{
+	if (voice < 0 || voice >= SOUND_VOICES) return false;
+	return voice_busy(voice);
+}
+
+// Set the volume of a voice.
+// voice: voice number returned by sound_play().
+// vol: 0-100% as an integer value.
+void sound_voice_volume(int32_t voice, uint32_t vol)
+{
+	if (cmd_mutex == NULL || voice < 0 || voice >= SOUND_VOICES) return;
+	if (vol > MAX_VOL) vol = MAX_VOL;
+	xSemaphoreTake(cmd_mutex, portMAX_DELAY);
+	cmd_t c = {.type = CMD_VOLUME, .voice = voice, .vol = vol, .gen = alloc[voice].gen};
+	cmd_post(&c);
+	xSemaphoreGive(cmd_mutex);
+}
+
+// Change the sample rate a voice plays at, e.g. to bend its pitch.
+// voice: voice number returned by sound_play().
+// rate_hz: sample rate of the audio, or 0 if the same as the DAC.
+void sound_voice_rate(int32_t voice, uint32_t rate_hz)
+{
+	if (cmd_mutex == NULL || voice < 0 || voice >= SOUND_VOICES) return;
+	xSemaphoreTake(cmd_mutex, portMAX_DELAY);
+	cmd_t c = {.type = CMD_RATE, .voice = voice, .gen = alloc[voice].gen,
+		.step = voice_step(rate_hz)};
+	if (cmd_post(&c) == 0) alloc[voice].rate = rate_hz;
+	xSemaphoreGive(cmd_mutex);
 }
 
 // Return true if sound playing, otherwise return false.
 bool sound_busy(void)
 {
-	return aidx < asize;
+	if (sound_stream_busy()) return true;
+	for (uint32_t v = 0; v < SOUND_VOICES; v++)
+		if (voice_busy(v)) return true;
+	return false;
 }
 
-// Stop playing the sound.
+// Stop playing all sounds, including a stream.
 void sound_stop(void)
 {
-	portENTER_CRITICAL(&spinlock);
-	aidx = asize;
-	portEXIT_CRITICAL(&spinlock);
+	sound_stream_stop();
+	if (cmd_mutex == NULL) return;
+	xSemaphoreTake(cmd_mutex, portMAX_DELAY);
+	cmd_t c = {.type = CMD_STOP_ALL};
+	if (cmd_post(&c) == 0) {
+		for (uint32_t v = 0; v < SOUND_VOICES; v++) alloc[v].stopped = true;
+	}
+	xSemaphoreGive(cmd_mutex);
+}
+
+// WAV file of the stream
+typedef struct {
+	FILE *f;
+	long data; // file offset of the samples
+	uint32_t size; // bytes of sample data
+	uint16_t channels;
+	uint16_t bits;
+	bool loop;
+} wav_t;
+
+static wav_t stream_wav;
+
+// Read a little-endian value from a header.
+static uint32_t rd_le(const uint8_t *p, uint32_t n)
+{
+	uint32_t v = 0;
+	while (n--) v = (v << 8) | p[n];
+	return v;
+}
+
+// Parse the RIFF header, leaving the file at the first sample.
+// Return zero if a supported PCM format, or non-zero otherwise.
+static int32_t wav_open(wav_t *w)
+{
+	uint8_t hdr[16];
+	bool fmt = false;
+
+	if (fread(hdr, 1, 12, w->f) != 12 ||
+		memcmp(hdr, "RIFF", 4) || memcmp(hdr+8, "WAVE", 4)) {
+		ESP_LOGE(TAG, "Not a WAV file");
+		return -1;
+	}
+	while (fread(hdr, 1, 8, w->f) == 8) {
+		uint32_t len = rd_le(hdr+4, 4);
+		if (!memcmp(hdr, "fmt ", 4) && len >= 16) {
+			if (fread(hdr, 1, 16, w->f) != 16) break;
+			uint32_t rate = rd_le(hdr+4, 4);
+			w->channels = rd_le(hdr+2, 2);
+			w->bits = rd_le(hdr+14, 2);
+			if (rd_le(hdr, 2) != 1 || w->channels < 1 || w->channels > 2 ||
+				(w->bits != 8 && w->bits != 16)) {
+				ESP_LOGE(TAG, "Unsupported WAV format %u, %u ch, %u bit",
+					(unsigned)rd_le(hdr, 2), w->channels, w->bits);
+				return -1;
+			}
+			if (rate != sample_rate) { // would play off pitch
+				ESP_LOGE(TAG, "WAV rate %u Hz, DAC rate %u Hz",
+					(unsigned)rate, (unsigned)sample_rate);
+				return -1;
+			}
+			fmt = true;
+			len -= 16;
+		} else if (!memcmp(hdr, "data", 4) && fmt) {
+			w->data = ftell(w->f);
+			w->size = len;
+			return 0;
+		}
+		if (fseek(w->f, len + (len & 1), SEEK_CUR)) break; // chunks are word aligned
+	}
+	ESP_LOGE(TAG, "No WAV data");
+	return -1;
+}
+
+// Convert frames to 8-bit mono and store them in the ring. Only called
+// when there is space for them.
+static void stream_put(const uint8_t *src, uint32_t frames, const wav_t *w)
+{
+	uint32_t head = atomic_load_explicit(&ring_head, memory_order_relaxed);
+
+	for (uint32_t i = 0; i < frames; i++) {
+		int32_t s;
+		if (w->bits == 8) {
+			s = src[0];
+			if (w->channels == 2) s = (s + src[1]) >> 1;
+		} else {
+			s = (int16_t)rd_le(src, 2);
+			if (w->channels == 2) s = (s + (int16_t)rd_le(src+2, 2)) >> 1;
+			s = (s >> 8) + SILENCE;
+		}
+		src += w->channels * (w->bits >> 3);
+		ring[(head + i) & (STREAM_RING_SZ-1)] = s;
+	}
+	atomic_store_explicit(&ring_head, head + frames, memory_order_release);
+}
+
+// Producer task: read blocks from the file into the ring until the end of
+// the file (or forever if looping) or until stopped. Playback starts once
+// the ring is full, or at the end of a short file.
+static void stream_run(void *arg)
+{
+	wav_t *w = &stream_wav;
+	uint32_t fsz = w->channels * (w->bits >> 3); // bytes per frame
+	uint8_t *blk = heap_caps_malloc(STREAM_BLOCK, MALLOC_CAP_DMA);
+	uint32_t left = w->size;
+	// First read ends on a block boundary in the file
+	uint32_t len = STREAM_BLOCK - w->data % STREAM_BLOCK;
+
+	if (blk == NULL) ESP_LOGE(TAG, "No memory for stream block");
+	while (blk && !stream_quit) {
+		if (left < fsz) { // end of data
+			if (!w->loop) break;
+			fseek(w->f, w->data, SEEK_SET);
+			left = w->size;
+			len = STREAM_BLOCK - w->data % STREAM_BLOCK;
+		}
+		if (len > left) len = left;
+		len -= len % fsz;
+		uint32_t frames = len / fsz;
+		// Wait for space in the ring
+		while (!stream_quit && STREAM_RING_SZ - (
+			atomic_load_explicit(&ring_head, memory_order_relaxed) -
+			atomic_load_explicit(&ring_tail, memory_order_acquire)) < frames) {
+			if (atomic_load(&stream_state) == STREAM_IDLE)
+				atomic_store_explicit(&stream_state, STREAM_RUN, memory_order_release);
+			vTaskDelay(pdMS_TO_TICKS(POLL_DELAY));
+		}
+		if (stream_quit) break;
+		uint32_t got = fread(blk, 1, len, w->f);
+		stream_put(blk, got / fsz, w);
+		if (got != len) {
+			ESP_LOGE(TAG, "Stream read error");
+			break;
+		}
+		left -= len;
+		len = STREAM_BLOCK;
+	}
+	fclose(w->f);
+	heap_caps_free(blk);
+	if (!stream_quit) // play out what is left in the ring
+		atomic_store_explicit(&stream_state, STREAM_EOF, memory_order_release);
+	stream_alive = false;
+	vTaskDelete(NULL);
+}
+
+// Stream a WAV file, mixed with the voices. The file is read by a task
+// in large blocks, so other tasks can use the file system in between.
+// Plays 8-bit or 16-bit PCM, mono or stereo (mixed to mono), at the DAC
+// sample rate; files at another rate are refused. The file system (e.g.
+// the SD card at /sdcard) must be mounted by the caller.
+// Stops any stream already playing.
+// path: file name, e.g. "/sdcard/music.wav".
+// loop: if true, play cyclically until stopped.
+// Return zero if successful, or non-zero otherwise.
+int32_t sound_stream_file(const char *path, bool loop)
+{
+	sound_stream_stop();
+	if (ring == NULL)
+		ring = heap_caps_malloc(STREAM_RING_SZ, MALLOC_CAP_INTERNAL|MALLOC_CAP_8BIT);
+	if (ring == NULL) {
+		ESP_LOGE(TAG, "No memory for stream ring");
+		return -1;
+	}
+	wav_t *w = &stream_wav;
+	w->f = fopen(path, "rb");
+	if (w->f == NULL) {
+		ESP_LOGE(TAG, "Can't open %s", path);
+		return -1;
+	}
+	setvbuf(w->f, NULL, _IONBF, 0); // blocks go straight to our buffer
+	w->loop = loop;
+	if (wav_open(w) || w->size < w->channels * (w->bits >> 3)) {
+		fclose(w->f);
+		return -1;
+	}
+	// Stream is idle, so the consumer is not using the ring
+	atomic_store(&ring_head, atomic_load(&ring_tail));
+	stream_quit = false;
+	stream_underruns = 0;
+	stream_alive = true;
+	if (xTaskCreate(stream_run, "sound_stream", STREAM_STACK, NULL,
+		STREAM_PRIO, NULL) != pdPASS) {
+		ESP_LOGE(TAG, "Can't create stream task");
+		stream_alive = false;
+		fclose(w->f);
+		return -1;
+	}
+	return 0;
+}
+
+// Stop the stream, if playing. Blocks until the file is closed and the
+// refill ISR has let go of the ring.
+void sound_stream_stop(void)
+{
+	stream_quit = true;
+	while (stream_alive) vTaskDelay(pdMS_TO_TICKS(POLL_DELAY));
+	if (dac_handle == NULL) atomic_store(&stream_state, STREAM_IDLE);
+	while (atomic_load(&stream_state) != STREAM_IDLE)
+		vTaskDelay(pdMS_TO_TICKS(POLL_DELAY));
+}
+
+// Return true if a stream is playing, otherwise return false.
+bool sound_stream_busy(void)
+{
+	return stream_alive || atomic_load(&stream_state) != STREAM_IDLE;
+}
+
+// Return the number of DMA buffer refills that found the stream ring
+// short of samples (the file could not be read fast enough).
+uint32_t sound_stream_underruns(void)
+{
+	return stream_underruns;
 }
 
-// Set the volume.
+// Set the master volume.
 // volume: 0-100% as an integer value.
 void sound_set_volume(uint32_t vol)
 {
-	volume = vol;
-	bias = SILENCE - (SILENCE * vol / PERCENT);
+	if (cmd_mutex == NULL) return;
+	if (vol > MAX_VOL) vol = MAX_VOL;
+	xSemaphoreTake(cmd_mutex, portMAX_DELAY);
+	cmd_t c = {.type = CMD_MASTER, .vol = vol};
+	cmd_post(&c);
+	xSemaphoreGive(cmd_mutex);
+}
+
+// Get the DMA buffer refill statistics.
+// stats: filled with the counts since the last reset.
+// reset: if true, start counting again from zero at the next refill.
+void sound_get_stats(sound_stats_t *stats, bool reset)
+{
+	uint32_t seq, refills, plays;
+	uint64_t cycles_sum, latency_sum;
+
+	do {
+		seq = atomic_load_explicit(&st_seq, memory_order_acquire);
+		refills = st_refills;
+		cycles_sum = st_cycles;
+		stats->cycles_max = st_cycles_max;
+		stats->late = st_late;
+		plays = st_plays;
+		latency_sum = st_latency_us;
+		stats->latency_max_us = st_latency_max_us;
+		atomic_thread_fence(memory_order_acquire);
+	} while ((seq & 1) || atomic_load_explicit(&st_seq, memory_order_relaxed) != seq);
+	stats->refills = refills;
+	stats->cycles_avg = refills ? cycles_sum / refills : 0;
+	stats->plays = plays;
+	stats->latency_avg_us = plays ? latency_sum / plays : 0;
+	stats->refill_us = refill_us;
+	stats->lead_us = (desc_num-1)*refill_us;
+	stats->profile = latency;
+	stats->stream_underruns = stream_underruns;
+	stats->cache_hits = stats->cache_misses = stats->cache_used = 0;
+	if (reset) stats_reset = true;
+	if (cmd_mutex == NULL) return;
+	xSemaphoreTake(cmd_mutex, portMAX_DELAY);
+	stats->cache_hits = cache_hits;
+	stats->cache_misses = cache_misses;
+	stats->cache_used = cache_used;
+	if (reset) cache_hits = cache_misses = 0;
+	xSemaphoreGive(cmd_mutex);
+}
+
+// Set the internal RAM budget of the clip cache. Clips in flash (including
+// mapped partitions) are copied into the cache as they are played, so
+// later plays read RAM, and the least recently used are evicted to make
+// room. Copying a clip holds up other sound calls for the time it takes.
+// bytes: budget, or 0 (the default) to disable the cache. Clips still
+// playing stay cached until they end and room is needed.
+void sound_cache_budget(uint32_t bytes)
+{
+	if (cmd_mutex == NULL) return;
+	xSemaphoreTake(cmd_mutex, portMAX_DELAY);
+	cache_budget = bytes;
+	cache_evict(0, false);
+	xSemaphoreGive(cmd_mutex);
 }
 
 // Enable or disable the sound output device.
@@ -4,25 +4,91 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
 #define MAX_VOL 100U
 
+// Sounds are mixed from up to SOUND_VOICES voices. Each voice has its own
+// position, loop flag, volume and priority. When all voices are busy, a new
+// sound steals the lowest priority voice.
+// Calls from tasks are posted as commands that the audio ISR applies at its
+// next DMA buffer refill (~1.3ms at 48kHz). Not for use from an ISR.
+#define SOUND_VOICES 8
+#define SOUND_PRIO_DEFAULT 1
+
+// Clips that can wait in the queue of a voice, see sound_queue().
+#define SOUND_QUEUE_LEN 4
+
+// IMA-ADPCM assets are a sequence of blocks, each with a 4-byte header
+// (predictor, step index, pad) and 4-bit samples, low nibble first.
+#define SOUND_ADPCM_BLOCK 256
+#define SOUND_ADPCM_BLOCK_SAMPLES (1 + (SOUND_ADPCM_BLOCK-4)*2)
+
+// Voices at another rate than the DAC are resampled with a Q16 phase step,
+// by linear interpolation, or by 4-tap (Catmull-Rom) interpolation if
+// SOUND_RESAMPLE_4TAP is defined non-zero (costs more cycles per sample).
+#ifndef SOUND_RESAMPLE_4TAP
+#define SOUND_RESAMPLE_4TAP 0
+#endif
+
+// Latency profiles for sound_init(). Lower latency takes more refill
+// interrupts (and CPU time) per second.
+//   SOUND_LATENCY_LOW: 4 buffers of 32 samples, ~3 ms play latency at 48kHz
+//   SOUND_LATENCY_BALANCED: 8 buffers of 64 samples, ~11 ms
+//   SOUND_LATENCY_LOW_CPU: 8 buffers of 256 samples, ~43 ms
+// (Samples with CONFIG_DAC_DMA_AUTO_16BIT_ALIGN, otherwise twice as many.)
+typedef enum {
+	SOUND_LATENCY_LOW,
+	SOUND_LATENCY_BALANCED,
+	SOUND_LATENCY_LOW_CPU,
+	SOUND_LATENCY_LAST
+} sound_latency_t;
+
+// DMA buffer refill statistics, see sound_get_stats(). The refill counts
+// are read as one set, between two refills.
+typedef struct {
+	uint32_t refills; // DMA buffers written
+	uint32_t cycles_max; // most CPU cycles in one refill
+	uint32_t cycles_avg;
+	uint32_t late; // refills missed, so a buffer played its old samples again
+	uint32_t plays; // sounds started
+	uint32_t latency_max_us; // from a play call to its first sample out
+	uint32_t latency_avg_us;
+	uint32_t refill_us; // time to play one DMA buffer, as measured
+	uint32_t lead_us; // time to play the other buffers queued ahead of a play
+	uint32_t profile; // sound_latency_t in use
+	uint32_t stream_underruns; // see sound_stream_underruns()
+	uint32_t cache_hits; // plays of clips found in the cache
+	uint32_t cache_misses; // plays of clips in flash not found
+	uint32_t cache_used; // bytes of internal RAM used by the cache
+} sound_stats_t;
+
 // Initialize the sound driver. Must be called before using sound.
-// May be called again to change sample rate.
+// May be called again to change sample rate or latency profile.
+// The buffer time is measured once the DMA runs. If it is too short, the
+// next profile with fewer interrupts is used (see sound_get_stats()).
 // sample_hz: sample rate in Hz to playback audio.
+// profile: latency profile, trading play latency against refill
+// interrupts (CPU time).
 // Return zero if successful, or non-zero otherwise.
-int32_t sound_init(uint32_t sample_hz);
+int32_t sound_init(uint32_t sample_hz, sound_latency_t profile);
 
 // Free resources used for sound (DAC, DMA hardware, buffers, etc.).
 // Return zero if successful, or non-zero otherwise.
 int32_t sound_deinit(void);
 
 // Start playing the sound immediately. Play the audio buffer once.
+// The sound is mixed with any others playing (see sound_play()).
 // audio: a pointer to an array of 8-bit, unsigned audio data.
 // size: the size of the array in bytes.
 // wait: if true, block until done playing, otherwise return straight away.
+// Waits on a task notification, so it takes the notification count.
 void sound_start(const void *audio, uint32_t size, bool wait);
 
 // Cyclically play samples from audio buffer until sound_stop() is called.
+// Replaces the previous sound_cyclic() audio, so it can be called again
+// to change a tone without adding voices.
 // audio: a pointer to an array of 8-bit, unsigned audio data.
 // size: the size of the array in bytes.
 void sound_cyclic(const void *audio, uint32_t size);
@@ -30,13 +96,119 @@ void sound_cyclic(const void *audio, uint32_t size);
 // Return true if sound playing, otherwise return false.
 bool sound_busy(void);
 
-// Stop playing the sound.
+// Stop playing all sounds, including a stream.
 void sound_stop(void);
 
-// Set the volume.
+// Set the master volume.
 // volume: 0-100% as an integer value.
 void sound_set_volume(uint32_t vol);
 
+// Start playing audio on a voice, mixed with the other voices.
+// If no voice is free, the active voice with the lowest priority is stolen
+// (the oldest if tied), as long as its priority is not above prio.
+// Audio at another sample rate is resampled to the DAC rate.
+// audio: a pointer to an array of 8-bit, unsigned audio data.
+// size: the size of the array in bytes.
+// rate_hz: sample rate of the audio, or 0 if the same as the DAC.
+// vol: voice volume, 0-100% as an integer value.
+// prio: priority, higher wins when stealing voices.
+// loop: if true, play cyclically until stopped.
+// Return the voice number, or -1 if no voice was available or the DAC
+// is not taking commands.
+int32_t sound_play(const void *audio, uint32_t size, uint32_t rate_hz, uint32_t vol, uint32_t prio, bool loop);
+
+// Start playing IMA-ADPCM audio on a voice, as made by
+// components/audio/ima_adpcm.py. Otherwise the same as sound_play().
+// audio: a pointer to the array of IMA-ADPCM blocks.
+// samples: the number of samples (the _SAMPLES value of the asset).
+// rate_hz: sample rate of the audio, or 0 if the same as the DAC.
+// vol: voice volume, 0-100% as an integer value.
+// prio: priority, higher wins when stealing voices.
+// loop: if true, play cyclically until stopped.
+// Return the voice number, or -1 if no voice was available or the DAC
+// is not taking commands.
+int32_t sound_play_adpcm(const void *audio, uint32_t samples, uint32_t rate_hz, uint32_t vol, uint32_t prio, bool loop);
+
+// Queue audio to play on a voice straight after its current clip and any
+// clips queued before it, with no gap. Plays at the rate and volume of
+// the voice. A looping clip plays on to a clip queued after it at the end
+// of a pass, so an intro can lead into a loop.
+// voice: voice number returned by sound_play().
+// audio: a pointer to an array of 8-bit, unsigned audio data.
+// size: the size of the array in bytes.
+// loop: if true, play cyclically until stopped or another clip is queued.
+// Return zero if queued, or non-zero if the voice is not playing or
+// SOUND_QUEUE_LEN clips are already waiting.
+int32_t sound_queue(int32_t voice, const void *audio, uint32_t size, bool loop);
+
+// Queue IMA-ADPCM audio on a voice. Otherwise the same as sound_queue().
+// voice: voice number returned by sound_play() or sound_play_adpcm().
+// audio: a pointer to the array of IMA-ADPCM blocks.
+// samples: the number of samples (the _SAMPLES value of the asset).
+// loop: if true, play cyclically until stopped or another clip is queued.
+// Return zero if queued, or non-zero otherwise.
+int32_t sound_queue_adpcm(int32_t voice, const void *audio, uint32_t samples, bool loop);
+
+// Notify a task each time a clip on a voice ends: as it moves on to a
+// queued clip, and when the voice stops, is stopped or is stolen. The
+// task waits with ulTaskNotifyTake(), e.g. to queue the next clip, in
+// place of polling. Applies until the voice is started again.
+// voice: voice number returned by sound_play().
+// task: task to notify, or NULL for none.
+void sound_voice_notify(int32_t voice, TaskHandle_t task);
+
+// Stop a voice.
+// voice: voice number returned by sound_play().
+void sound_voice_stop(int32_t voice);
+
+// Return true if the voice is playing, otherwise return false.
+// voice: voice number returned by sound_play().
+bool sound_voice_busy(int32_t voice);
+
+// Set the volume of a voice.
+// voice: voice number returned by sound_play().
+// vol: 0-100% as an integer value.
+void sound_voice_volume(int32_t voice, uint32_t vol);
+
+// Stream a WAV file, mixed with the voices. The file is read by a task
+// in large blocks, so other tasks can use the file system in between.
+// Plays 8-bit or 16-bit PCM, mono or stereo (mixed to mono), at the DAC
+// sample rate; files at another rate are refused. The file system (e.g.
+// the SD card at /sdcard) must be mounted by the caller.
+// Stops any stream already playing.
+// path: file name, e.g. "/sdcard/music.wav".
+// loop: if true, play cyclically until stopped.
+// Return zero if successful, or non-zero otherwise.
+int32_t sound_stream_file(const char *path, bool loop);
+
+// Stop the stream, if playing. Blocks until the file is closed.
+void sound_stream_stop(void);
+
+// Return true if a stream is playing, otherwise return false.
+bool sound_stream_busy(void);
+
+// Return the number of DMA buffer refills that found the stream ring
+// short of samples (the file could not be read fast enough).
+uint32_t sound_stream_underruns(void);
+
+// Change the sample rate a voice plays at, e.g. to bend its pitch.
+// voice: voice number returned by sound_play().
+// rate_hz: sample rate of the audio, or 0 if the same as the DAC.
+void sound_voice_rate(int32_t voice, uint32_t rate_hz);
+
+// Get the DMA buffer refill statistics. Late refills mean too few or too
+// small DMA buffers for the load; the play latency grows with both.
+// stats: filled with the counts since the last reset.
+// reset: if true, start counting again from zero at the next refill.
+void sound_get_stats(sound_stats_t *stats, bool reset);
+
+// Set the internal RAM budget of the clip cache. Clips in flash (including
+// mapped partitions) are copied into the cache as they are played, so
+// later plays read RAM, and the least recently used are evicted to make
+// room. Copying a clip holds up other sound calls for the time it takes.
+// bytes: budget, or 0 (the default) to disable the cache.
+void sound_cache_budget(uint32_t bytes);
+
 // Enable or disable the sound output device.
 // enable: if true, enable sound, otherwise disable.
 void sound_device(bool enable);
@@ -0,0 +1,159 @@
+#include <string.h> // memcpy
+
+#include "tile.h"
+
+#define LINES 8 // Scanlines per band of sprite culling
+
+static uint16_t line_buf[LCD_W]; // lcdPushPixels copies it out
+
+static const uint16_t *tset;
+static uint32_t tcount;
+static const uint8_t *tmap;
+static int32_t map_w, map_h; // in tiles
+static int32_t scroll_x, scroll_y; // in pixels
+static tile_sprite_t *sprites;
+static uint32_t num_sprites;
+
+// Positive modulo
+static inline int32_t wrap(int32_t a, int32_t n)
+{
+	a %= n;
+	return (a < 0) ? a + n : a;
+}
+
+// Compose the background for one scanline.
+// buf: output for width pixels.
+// y: screen Y coordinate.
+static void compose_map(uint16_t *buf, int32_t width, int32_t y)
+{
+	int32_t wy = wrap(scroll_y + y, map_h * TILE_H);
+	int32_t wx = wrap(scroll_x, map_w * TILE_W);
+	const uint8_t *mrow = tmap + (wy / TILE_H) * map_w;
+	int32_t trow = (wy % TILE_H) * TILE_W; // offset of pixel row in tile
+	int32_t tx = wx / TILE_W;
+	int32_t px = wx % TILE_W; // first pixel in first tile
+
+	while (width > 0) {
+		uint32_t idx = mrow[tx];
+		int32_t n = TILE_W - px;
+		if (n > width) n = width;
+		if (idx < tcount) {
+			memcpy(buf, tset + idx*TILE_W*TILE_H + trow + px, n*sizeof(uint16_t));
+		} else {
+			memset(buf, 0, n*sizeof(uint16_t));
+		}
+		buf += n;
+		width -= n;
+		px = 0;
+		if (++tx == map_w) tx = 0;
+	}
+}
+
+// Draw one row of each active sprite covering the scanline.
+// buf: width pixels already holding the background.
+// y: screen Y coordinate.
+static void compose_sprites(uint16_t *buf, int32_t width, int32_t y,
+	tile_sprite_t **active, uint32_t num_active)
+{
+	uint32_t drawn = 0;
+	for (uint32_t i = 0; i < num_active && drawn < TILE_SPRITES_PER_LINE; i++) {
+		tile_sprite_t *s = active[i];
+		if (y < s->y || y >= s->y + s->h) continue;
+		const uint16_t *src = s->pixels + (y - s->y) * s->w;
+		int32_t x1 = s->x, x2 = s->x + s->w;
+		if (x1 < 0) {src -= x1; x1 = 0;} // clip
+		if (x2 > width) x2 = width;
+		for (int32_t x = x1; x < x2; x++, src++) {
+			if (*src != TILE_TRANSPARENT) buf[x] = *src;
+		}
+		drawn++;
+	}
+}
+
+// Initialize the tile engine. Must be called before use.
+// Return zero if successful, or non-zero otherwise.
+int32_t tile_init(void)
+{
+	tset = NULL;
+	tcount = 0;
+	tmap = NULL;
+	map_w = map_h = 0;
+	scroll_x = scroll_y = 0;
+	sprites = NULL;
+	num_sprites = 0;
+	return 0;
+}
+
+// Set the tile set used by the map.
+// tiles: count tiles of TILE_W*TILE_H RGB565 pixels each, in row-major order.
+// count: number of tiles in the set.
+void tile_set_tiles(const uint16_t *tiles, uint32_t count)
+{
+	tset = tiles;
+	tcount = count;
+}
+
+// Set the tile map. The map is referenced, not copied, so it may be
+// changed between calls to tile_draw().
+// map: w*h tile indices in row-major order.
+// w: map width in tiles.
+// h: map height in tiles.
+void tile_set_map(const uint8_t *map, int32_t w, int32_t h)
+{
+	tmap = map;
+	map_w = w;
+	map_h = h;
+}
+
+// Set the scroll position of the map. The map wraps in both directions.
+// x: map X coordinate in pixels shown at the left of the screen.
+// y: map Y coordinate in pixels shown at the top of the screen.
+void tile_set_scroll(int32_t x, int32_t y)
+{
+	scroll_x = x;
+	scroll_y = y;
+}
+
+// Set the sprite list. Later sprites in the list are drawn on top of
+// earlier ones. The list is referenced, not copied, so sprites may be
+// moved between calls to tile_draw().
+// list: array of sprites.
+// num: number of sprites in the array, at most TILE_SPRITES_MAX are used.
+void tile_set_sprites(tile_sprite_t *list, uint32_t num)
+{
+	sprites = list;
+	num_sprites = (num < TILE_SPRITES_MAX) ? num : TILE_SPRITES_MAX;
+}
+
+// Compose the map and sprites and send them to the display.
+// dev: display device.
+void tile_draw(TFT_t *dev)
+{
+	int32_t width = (dev->_width < LCD_W) ? dev->_width : LCD_W;
+	int32_t height = dev->_height;
+	static tile_sprite_t *active[TILE_SPRITES_MAX];
+
+	lcdBeginWindow(dev, 0, 0, width-1, height-1);
+	for (int32_t y0 = 0; y0 < height; y0 += LINES) {
+		int32_t lines = (height - y0 < LINES) ? height - y0 : LINES;
+
+		// Find the sprites that overlap this band
+		uint32_t num_active = 0;
+		for (uint32_t i = 0; i < num_sprites; i++) {
+			tile_sprite_t *s = sprites + i;
+			if (!s->visible || s->pixels == NULL) continue;
+			if (s->y + s->h <= y0 || s->y >= y0 + lines) continue;
+			if (s->x + s->w <= 0 || s->x >= width) continue;
+			active[num_active++] = s;
+		}
+
+		for (int32_t j = 0; j < lines; j++) {
+			uint16_t *buf = line_buf;
+			if (tmap && map_w > 0 && map_h > 0) compose_map(buf, width, y0+j);
+			else memset(buf, 0, width*sizeof(uint16_t));
+			if (num_active) compose_sprites(buf, width, y0+j, active, num_active);
+			lcdPushPixels(dev, buf, width);
+		}
+	}
+	lcdEndWindow(dev);
+}
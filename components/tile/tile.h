@@ -0,0 +1,70 @@
+#ifndef TILE_H_
+#define TILE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "lcd.h"
+
+// This component is a tile-map background engine layered on the lcd
+// component. The background is a scrollable map of 8x8 tiles taken from a
+// tile set. Sprites are drawn over the background. The screen is composed a
+// scanline at a time into a line buffer, which is streamed to the
+// display with lcdPushPixels. A full screen can be redrawn every frame
+// without a frame buffer.
+
+#define TILE_W 8 // Tile width in pixels
+#define TILE_H 8 // Tile height in pixels
+
+// Sprite pixels of this color are not drawn (magenta)
+#define TILE_TRANSPARENT rgb565(255, 0, 255)
+
+// Maximum number of sprites drawn on a single scanline. Further sprites
+// on the same line are skipped.
+#define TILE_SPRITES_PER_LINE 16
+
+// Maximum number of sprites in the sprite list. Further sprites are not
+// drawn.
+#define TILE_SPRITES_MAX 64
+
+// A sprite is a rectangle of RGB565 pixels in row-major order.
+typedef struct {
+	const uint16_t *pixels; // w*h pixels, TILE_TRANSPARENT is not drawn
+	int32_t x, y; // screen position of the upper left corner
+	int32_t w, h; // size in pixels
+	bool visible;
+} tile_sprite_t;
+
+// Initialize the tile engine. Must be called before use.
+// Return zero if successful, or non-zero otherwise.
+int32_t tile_init(void);
+
+// Set the tile set used by the map.
+// tiles: count tiles of TILE_W*TILE_H RGB565 pixels each, in row-major order.
+// count: number of tiles in the set.
+void tile_set_tiles(const uint16_t *tiles, uint32_t count);
+
+// Set the tile map. The map is referenced, not copied, so it may be
+// changed between calls to tile_draw().
+// map: w*h tile indices in row-major order.
+// w: map width in tiles.
+// h: map height in tiles.
+void tile_set_map(const uint8_t *map, int32_t w, int32_t h);
+
+// Set the scroll position of the map. The map wraps in both directions.
+// x: map X coordinate in pixels shown at the left of the screen.
+// y: map Y coordinate in pixels shown at the top of the screen.
+void tile_set_scroll(int32_t x, int32_t y);
+
+// Set the sprite list. Later sprites in the list are drawn on top of
+// earlier ones. The list is referenced, not copied, so sprites may be
+// moved between calls to tile_draw().
+// list: array of sprites.
+// num: number of sprites in the array, at most TILE_SPRITES_MAX are used.
+void tile_set_sprites(tile_sprite_t *list, uint32_t num);
+
+// Compose the map and sprites and send them to the display.
+// dev: display device.
+void tile_draw(TFT_t *dev);
+
+#endif /* TILE_H_ */
@@ -0,0 +1,388 @@
+#include "sfx.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+
+#define BIAS 0x80
+#define AMPLITUDE 0x7F
+
+#define SFX_CACHE 8 // most effects cached
+#define NOISE_STEPS 32 // noise values per period, as in sfxr
+
+#define ERR_SAMPLE_RATE_ZERO 1
+#define ERR_MUTEX_FAILURE 2
+
+// A rendered effect, guarded by mutex
+typedef struct {
+    sfx_t sfx;
+    uint8_t *audio; // NULL if the entry is free
+    uint32_t size; // samples rendered
+    uint32_t bytes; // allocated, counted in cache_used
+    uint32_t last; // play order, the least recent is evicted first
+    int32_t voice; // voice of the last play
+    int64_t end_us; // time the last play ends, plus a refill or two
+} entry_t;
+
+static SemaphoreHandle_t mutex;
+static entry_t cache[SFX_CACHE];
+static uint32_t cache_bytes;
+static uint32_t cache_used;
+static uint32_t serial;
+static uint32_t sample_rate;
+
+// Next value of a xorshift generator. The state must not be zero.
+static uint32_t rnd_next(uint32_t *state) {
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *state = x;
+}
+
+// Random integer from lo to hi inclusive.
+static int32_t rnd(uint32_t *state, int32_t lo, int32_t hi) {
+    return lo + (int32_t)(rnd_next(state) % (uint32_t)(hi - lo + 1));
+}
+
+// Convert a time in ms to samples.
+static uint32_t ms_samples(uint32_t ms, uint32_t sample_hz) {
+    return (uint64_t)ms * sample_hz / 1000;
+}
+
+// Return the number of samples an effect renders to at most (the
+// envelope length; a slide below freq_min ends it sooner).
+// sfx: effect parameters.
+// sample_hz: sample rate in Hz.
+uint32_t sfx_samples(const sfx_t *sfx, uint32_t sample_hz) {
+    if (sfx == NULL) return 0;
+    return ms_samples(sfx->attack + sfx->sustain + sfx->decay, sample_hz);
+}
+
+// Render an effect to 8-bit, unsigned audio.
+// sfx: effect parameters.
+// buf: audio buffer.
+// size: size of the buffer in bytes, the audio is cut short to fit.
+// sample_hz: sample rate in Hz.
+// Return the number of samples written.
+uint32_t sfx_render(const sfx_t *sfx, uint8_t *buf, uint32_t size, uint32_t sample_hz) {
+    if (sfx == NULL || buf == NULL || sample_hz == 0 || sfx->wave >= SFX_LAST) return 0;
+    uint32_t n = sfx_samples(sfx, sample_hz);
+    if (n > size) n = size;
+
+    float rate = sample_hz;
+    uint32_t attack = ms_samples(sfx->attack, sample_hz);
+    uint32_t sustain = ms_samples(sfx->sustain, sample_hz);
+    uint32_t decay = ms_samples(sfx->decay, sample_hz);
+    uint32_t arp_at = sfx->arp ? ms_samples(sfx->arp_ms, sample_hz) : UINT32_MAX;
+    uint32_t repeat = sfx->repeat_ms ? ms_samples(sfx->repeat_ms, sample_hz) : UINT32_MAX;
+    // Slides are per sample multipliers of the frequency, the slide
+    // itself is multiplied by the acceleration
+    float slide_start = exp2f(sfx->slide / (12.0f * rate));
+    float accel = exp2f(sfx->accel / (12.0f * rate * rate));
+    float arp = exp2f(sfx->arp / 12.0f);
+    float duty = (sfx->duty ? sfx->duty : 50) / 100.0f;
+    float duty_step = sfx->duty_slide / (100.0f * rate);
+    float vib_depth = sfx->vib_depth / 100.0f;
+    float vib_step = 2 * (float)M_PI * sfx->vib_rate / rate;
+    // One-pole filter coefficients
+    float lp_a = sfx->lpf ? 1.0f - expf(-2 * (float)M_PI * sfx->lpf / rate) : 1.0f;
+    float hp_a = sfx->hpf ? 1.0f - expf(-2 * (float)M_PI * sfx->hpf / rate) : 0.0f;
+    float gain = AMPLITUDE / (1.0f + sfx->punch / 100.0f);
+
+    float freq = 0, slide = 0, phase = 0, vib = 0, noise = 0, lp = 0, hp = 0;
+    uint32_t noise_step = 0, state = 0x2545F491U ^ sfx->freq; // repeatable noise
+    uint32_t t = repeat; // restart on the first sample
+    uint32_t i;
+    for (i = 0; i < n; i++, t++) {
+        if (t >= repeat) {
+            freq = sfx->freq;
+            slide = slide_start;
+            t = 0;
+        }
+        if (t == arp_at) freq *= arp;
+        freq *= slide;
+        slide *= accel;
+        if (freq < sfx->freq_min) break;
+
+        float f = freq;
+        if (vib_depth > 0) {
+            f *= 1.0f + vib_depth * sinf(vib);
+            vib += vib_step;
+        }
+        if (f > rate / 2) f = rate / 2;
+        phase += f / rate;
+        if (phase >= 1.0f) phase -= floorf(phase);
+
+        float x;
+        switch (sfx->wave) {
+            case SFX_SQUARE:
+                x = (phase < duty) ? 1.0f : -1.0f;
+                duty += duty_step;
+                duty = fminf(fmaxf(duty, 0.01f), 0.99f);
+                break;
+            case SFX_SAW:
+                x = 1.0f - 2.0f * phase;
+                break;
+            case SFX_SINE:
+                x = sinf(2 * (float)M_PI * phase);
+                break;
+            case SFX_TRIANGLE:
+                x = (phase < 0.5f) ? 4.0f * phase - 1.0f : 3.0f - 4.0f * phase;
+                break;
+            default: // SFX_NOISE, a new random value each step of the period
+                if ((uint32_t)(phase * NOISE_STEPS) != noise_step) {
+                    noise_step = phase * NOISE_STEPS;
+                    noise = (int32_t)(rnd_next(&state) >> 16) / 32768.0f - 1.0f;
+                }
+                x = noise;
+                break;
+        }
+
+        lp += lp_a * (x - lp);
+        hp += hp_a * (lp - hp);
+        x = lp - hp;
+
+        float env;
+        if (i < attack) env = (float)i / attack;
+        else if (i < attack + sustain) env = 1.0f + sfx->punch / 100.0f * (1.0f - (float)(i - attack) / sustain);
+        else env = 1.0f - (float)(i - attack - sustain) / decay;
+        x = fminf(fmaxf(x * env * gain, -AMPLITUDE), AMPLITUDE);
+        buf[i] = BIAS + (int32_t)lrintf(x);
+    }
+    return i;
+}
+
+// Return true if the audio of an entry may still be playing.
+static bool entry_busy(const entry_t *e) {
+    return e->audio != NULL && (esp_timer_get_time() < e->end_us || sound_voice_busy(e->voice));
+}
+
+// Free an entry. Call with mutex held, once it is not busy.
+static void entry_free(entry_t *e) {
+    free(e->audio);
+    e->audio = NULL;
+    cache_used -= e->bytes;
+}
+
+// Stop the effects that may be playing and free the cache. Call with
+// mutex held.
+static void cache_clear(void) {
+    bool stopped = false;
+    int64_t now = esp_timer_get_time();
+    for (uint32_t i = 0; i < SFX_CACHE; i++) {
+        entry_t *e = &cache[i];
+        // A steal may have given the voice to another sound, so only stop
+        // it while this effect should still be playing
+        if (e->audio != NULL && now < e->end_us) {
+            sound_voice_stop(e->voice);
+            stopped = true;
+        }
+    }
+    // Stopped voices read their audio until the next refill
+    if (stopped) {
+        sound_stats_t stats;
+        sound_get_stats(&stats, false);
+        vTaskDelay(pdMS_TO_TICKS(2 * stats.refill_us / 1000) + 1);
+    }
+    for (uint32_t i = 0; i < SFX_CACHE; i++) {
+        if (cache[i].audio != NULL) entry_free(&cache[i]);
+    }
+}
+
+// Initialize the effect cache. sound_init() must be called separately.
+// May be called again to change the sample rate, which empties the cache.
+// sample_hz: rate to render effects at, e.g. the DAC rate.
+// bytes: RAM budget for rendered effects.
+// Return zero if successful, or non-zero otherwise.
+int32_t sfx_init(uint32_t sample_hz, uint32_t bytes) {
+    if (sample_hz == 0) return ERR_SAMPLE_RATE_ZERO;
+    if (mutex == NULL) mutex = xSemaphoreCreateMutex();
+    if (mutex == NULL) return ERR_MUTEX_FAILURE;
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    cache_clear();
+    sample_rate = sample_hz;
+    cache_bytes = bytes;
+    xSemaphoreGive(mutex);
+    return 0;
+}
+
+// Stop the effects playing and free the cache.
+void sfx_deinit(void) {
+    if (mutex == NULL) return;
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    cache_clear();
+    cache_bytes = 0;
+    xSemaphoreGive(mutex);
+}
+
+// Find or render an effect. Call with mutex held.
+// Return the cache entry, or NULL if there is no room.
+static entry_t *cache_get(const sfx_t *sfx) {
+    for (uint32_t i = 0; i < SFX_CACHE; i++) {
+        if (cache[i].audio != NULL && !memcmp(&cache[i].sfx, sfx, sizeof(sfx_t))) return &cache[i];
+    }
+    uint32_t n = sfx_samples(sfx, sample_rate);
+    if (n == 0 || n > cache_bytes) return NULL;
+    // Evict the least recently played until it fits and an entry is free
+    for (;;) {
+        entry_t *lru = NULL, *free_e = NULL;
+        for (uint32_t i = 0; i < SFX_CACHE; i++) {
+            entry_t *e = &cache[i];
+            if (e->audio == NULL) {
+                if (free_e == NULL) free_e = e;
+            } else if (!entry_busy(e) && (lru == NULL || (int32_t)(e->last - lru->last) < 0)) {
+                lru = e;
+            }
+        }
+        if (free_e != NULL && cache_used + n <= cache_bytes) {
+            uint8_t *audio = malloc(n);
+            if (audio == NULL) return NULL;
+            *free_e = (entry_t){.sfx = *sfx, .audio = audio, .voice = -1};
+            free_e->size = sfx_render(sfx, audio, n, sample_rate);
+            if (free_e->size == 0) {
+                free(audio);
+                free_e->audio = NULL;
+                return NULL;
+            }
+            // A slide may end it early. Shrinking in place can still fail,
+            // then the whole buffer is kept.
+            uint8_t *fit = realloc(audio, free_e->size);
+            if (fit != NULL) free_e->audio = fit;
+            free_e->bytes = fit != NULL ? free_e->size : n;
+            cache_used += free_e->bytes;
+            return free_e;
+        }
+        if (lru == NULL) return NULL;
+        entry_free(lru);
+    }
+}
+
+// Play an effect on a voice, rendering it first if it is not cached.
+// Effects are matched on their parameters, not their address. The least
+// recently played are evicted to make room, once they have ended.
+// sfx: effect parameters.
+// vol: voice volume, 0-100% as an integer value.
+// prio: priority, higher wins when stealing voices.
+// Return the voice number, or -1 if no voice or memory was available.
+int32_t sfx_play(const sfx_t *sfx, uint32_t vol, uint32_t prio) {
+    int32_t v = -1;
+
+    if (mutex == NULL || sfx == NULL) return -1;
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    entry_t *e = cache_get(sfx);
+    if (e != NULL) {
+        e->last = serial++;
+        v = sound_play(e->audio, e->size, sample_rate, vol, prio, false);
+        if (v >= 0) {
+            sound_stats_t stats;
+            sound_get_stats(&stats, false);
+            e->voice = v;
+            e->end_us = esp_timer_get_time() + (uint64_t)e->size * 1000000 / sample_rate +
+                2 * stats.refill_us;
+        }
+    }
+    xSemaphoreGive(mutex);
+    return v;
+}
+
+// Fill in the parameters of a random effect of a kind. The same seed
+// always gives the same effect, so a game can keep just the seed.
+// sfx: filled with the effect parameters.
+// kind: one of the enumerated preset kinds.
+// seed: any value.
+void sfx_preset(sfx_t *sfx, sfx_preset_t kind, uint32_t seed) {
+    uint32_t s = seed ^ 0x9E3779B9U;
+    if (s == 0) s = 1;
+    memset(sfx, 0, sizeof(sfx_t));
+    switch (kind) {
+        case SFX_COIN:
+            sfx->wave = SFX_SQUARE;
+            sfx->freq = rnd(&s, 800, 2000);
+            sfx->sustain = rnd(&s, 20, 80);
+            sfx->decay = rnd(&s, 100, 300);
+            sfx->punch = rnd(&s, 30, 60);
+            if (rnd(&s, 0, 1)) {
+                sfx->arp = rnd(&s, 4, 12);
+                sfx->arp_ms = rnd(&s, 30, 80);
+            }
+            break;
+        case SFX_LASER:
+            sfx->wave = rnd(&s, SFX_SQUARE, SFX_SINE);
+            sfx->duty = rnd(&s, 20, 50);
+            sfx->duty_slide = rnd(&s, -40, 40);
+            sfx->freq = rnd(&s, 600, 2500);
+            sfx->slide = -rnd(&s, 60, 200);
+            sfx->freq_min = rnd(&s, 100, 300);
+            sfx->sustain = rnd(&s, 50, 150);
+            sfx->decay = rnd(&s, 50, 250);
+            if (rnd(&s, 0, 1)) sfx->hpf = rnd(&s, 100, 500);
+            break;
+        case SFX_EXPLOSION:
+            sfx->wave = SFX_NOISE;
+            sfx->freq = rnd(&s, 100, 800);
+            sfx->slide = -rnd(&s, 10, 40);
+            sfx->sustain = rnd(&s, 100, 300);
+            sfx->decay = rnd(&s, 300, 800);
+            sfx->punch = rnd(&s, 20, 60);
+            if (rnd(&s, 0, 1)) {
+                sfx->vib_depth = rnd(&s, 5, 20);
+                sfx->vib_rate = rnd(&s, 5, 20);
+            }
+            if (rnd(&s, 0, 1)) sfx->lpf = rnd(&s, 1000, 4000);
+            break;
+        case SFX_POWERUP:
+            sfx->wave = rnd(&s, 0, 1) ? SFX_SAW : SFX_SQUARE;
+            sfx->duty = rnd(&s, 20, 50);
+            sfx->freq = rnd(&s, 300, 800);
+            if (rnd(&s, 0, 1)) {
+                sfx->slide = rnd(&s, 40, 100);
+                sfx->repeat_ms = rnd(&s, 80, 150);
+            } else {
+                sfx->slide = rnd(&s, 20, 60);
+            }
+            if (rnd(&s, 0, 1)) {
+                sfx->vib_depth = rnd(&s, 2, 10);
+                sfx->vib_rate = rnd(&s, 5, 15);
+            }
+            sfx->sustain = rnd(&s, 100, 300);
+            sfx->decay = rnd(&s, 100, 400);
+            break;
+        case SFX_HIT:
+            sfx->wave = rnd(&s, 0, 2) == 0 ? SFX_NOISE : rnd(&s, SFX_SQUARE, SFX_SAW);
+            sfx->duty = rnd(&s, 20, 50);
+            sfx->freq = rnd(&s, 300, 1200);
+            sfx->slide = -rnd(&s, 100, 300);
+            sfx->sustain = rnd(&s, 10, 50);
+            sfx->decay = rnd(&s, 50, 200);
+            if (rnd(&s, 0, 1)) sfx->hpf = rnd(&s, 200, 800);
+            break;
+        case SFX_JUMP:
+            sfx->wave = SFX_SQUARE;
+            sfx->duty = rnd(&s, 20, 50);
+            sfx->freq = rnd(&s, 300, 700);
+            sfx->slide = rnd(&s, 20, 60);
+            sfx->sustain = rnd(&s, 50, 150);
+            sfx->decay = rnd(&s, 50, 200);
+            if (rnd(&s, 0, 1)) sfx->lpf = rnd(&s, 2000, 6000);
+            if (rnd(&s, 0, 1)) sfx->hpf = rnd(&s, 100, 400);
+            break;
+        case SFX_BLIP:
+            sfx->wave = rnd(&s, SFX_SQUARE, SFX_SAW);
+            sfx->duty = rnd(&s, 20, 50);
+            sfx->freq = rnd(&s, 400, 1500);
+            sfx->sustain = rnd(&s, 30, 60);
+            sfx->decay = rnd(&s, 20, 100);
+            sfx->hpf = 100;
+            break;
+        default:
+            sfx->freq = 440;
+            sfx->sustain = 100;
+            break;
+    }
+}
@@ -0,0 +1,87 @@
+#ifndef SFX_H_
+#define SFX_H_
+
+#include <stdint.h>
+#include "sound.h"
+
+// Procedural sound effects in the style of sfxr. An effect is a small
+// parameter struct (an oscillator with a frequency slide, vibrato and an
+// arpeggio jump, shaped by an envelope and low/high-pass filters) that
+// is rendered to 8-bit audio when first played, in place of a sampled
+// asset of tens of KB. Rendered effects are kept in a small RAM cache,
+// so playing one again costs the same as sound_play().
+
+// Effect waveforms
+typedef enum {SFX_SQUARE, SFX_SAW, SFX_SINE, SFX_TRIANGLE, SFX_NOISE, SFX_LAST} sfx_wave_t;
+
+// Effect kinds for sfx_preset(), after the sfxr generator buttons
+typedef enum {
+    SFX_COIN, SFX_LASER, SFX_EXPLOSION, SFX_POWERUP, SFX_HIT, SFX_JUMP, SFX_BLIP,
+    SFX_PRESET_LAST
+} sfx_preset_t;
+
+// Effect parameters. Zero is "off" for all but freq, so a designated
+// initializer only names what it uses.
+typedef struct {
+    uint8_t wave;       // sfx_wave_t
+    uint8_t duty;       // square duty cycle, 1-99%, or 0 for 50%
+    int8_t duty_slide;  // duty cycle change, % per second
+    uint8_t punch;      // extra volume at the start of the sustain, %
+    uint16_t freq;      // start frequency, Hz
+    uint16_t freq_min;  // the effect ends if the slide falls below, Hz
+    int16_t slide;      // frequency slide, semitones per second
+    int16_t accel;      // slide change, semitones per second per second
+    uint8_t vib_depth;  // vibrato depth, % of the frequency
+    uint8_t vib_rate;   // vibrato rate, Hz
+    int8_t arp;         // frequency jump after arp_ms, semitones
+    uint8_t pad;
+    uint16_t arp_ms;
+    uint16_t repeat_ms; // restart the slide and arpeggio every, or 0
+    uint16_t attack;    // envelope, ms
+    uint16_t sustain;
+    uint16_t decay;
+    uint16_t lpf;       // low-pass cutoff, Hz, or 0 for none
+    uint16_t hpf;       // high-pass cutoff, Hz, or 0 for none
+} sfx_t;
+
+// Initialize the effect cache. sound_init() must be called separately.
+// May be called again to change the sample rate, which empties the cache.
+// sample_hz: rate to render effects at, e.g. the DAC rate.
+// bytes: RAM budget for rendered effects.
+// Return zero if successful, or non-zero otherwise.
+int32_t sfx_init(uint32_t sample_hz, uint32_t bytes);
+
+// Stop the effects playing and free the cache.
+void sfx_deinit(void);
+
+// Return the number of samples an effect renders to at most (the
+// envelope length; a slide below freq_min ends it sooner).
+// sfx: effect parameters.
+// sample_hz: sample rate in Hz.
+uint32_t sfx_samples(const sfx_t *sfx, uint32_t sample_hz);
+
+// Render an effect to 8-bit, unsigned audio.
+// sfx: effect parameters.
+// buf: audio buffer.
+// size: size of the buffer in bytes, the audio is cut short to fit.
+// sample_hz: sample rate in Hz.
+// Return the number of samples written.
+uint32_t sfx_render(const sfx_t *sfx, uint8_t *buf, uint32_t size, uint32_t sample_hz);
+
+// Play an effect on a voice, rendering it first if it is not cached.
+// Effects are matched on their parameters, not their address. The least
+// recently played are evicted to make room, once they have ended.
+// sfx: effect parameters.
+// vol: voice volume, 0-100% as an integer value.
+// prio: priority, higher wins when stealing voices.
+// Return the voice number, or -1 if no voice or memory was available.
+int32_t sfx_play(const sfx_t *sfx, uint32_t vol, uint32_t prio);
+
+// Fill in the parameters of a random effect of a kind. The same seed
+// always gives the same effect, so a game can keep just the seed.
+// sfx: filled with the effect parameters.
+// kind: one of the enumerated preset kinds.
+// seed: any value.
+void sfx_preset(sfx_t *sfx, sfx_preset_t kind, uint32_t seed);
+
+#endif /* SFX_H_ */
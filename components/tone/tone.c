@@ -21,7 +21,7 @@ int32_t tone_init(uint32_t sample_hz) {
     if (sample_hz < 2 * LOWEST_FREQ) {
         return ERR_SAMPLE_RATE_TOO_LOW;
     }
-    sound_init(sample_hz);
+    sound_init(sample_hz, SOUND_LATENCY_BALANCED);
     sample_rate = sample_hz;
     tone_buffer = malloc(sample_hz / LOWEST_FREQ);
     if (tone_buffer == NULL) {
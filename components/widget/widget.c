@@ -0,0 +1,220 @@
+#include <stdio.h> // vsnprintf, snprintf
+#include <stdarg.h>
+#include <string.h> // strncpy, strlen
+
+#include "widget.h"
+
+#define GLYPH_W (LCD_CHAR_W*WIDGET_FONT_MAX)
+#define GLYPH_H (LCD_CHAR_H*WIDGET_FONT_MAX)
+
+// Each glyph is rendered with its background into this canvas and written
+// as one window, instead of one write per pixel in direct mode.
+static TFT_t glyph;
+static uint16_t glyph_buf[GLYPH_W*GLYPH_H];
+
+// Draw one character cell with background.
+static void widget_glyph(TFT_t *dev, int32_t x, int32_t y, uint8_t size, char c, uint16_t fg, uint16_t bg)
+{
+	int32_t cw = LCD_CHAR_W*size, ch = LCD_CHAR_H*size;
+
+	lcdCanvasInit(&glyph, glyph_buf, cw, ch);
+	lcdSetFontSize(&glyph, size);
+	lcdFillScreen(&glyph, bg);
+	if (c != ' ') lcdDrawChar(&glyph, 0, 0, c, fg);
+	lcdBeginWindow(dev, x, y, x+cw-1, y+ch-1);
+	lcdPushPixels(dev, glyph_buf, cw*ch);
+	lcdEndWindow(dev);
+}
+
+/* * * * * * * * * * Label * * * * * * * * * */
+
+void widget_label_init(widget_label_t *w, int32_t x, int32_t y, uint8_t size, uint16_t fg, uint16_t bg)
+{
+	w->x = x;
+	w->y = y;
+	w->size = (size < 1) ? 1 : (size > WIDGET_FONT_MAX) ? WIDGET_FONT_MAX : size;
+	w->fg = fg;
+	w->bg = bg;
+	w->text[0] = '\0';
+	w->drawn[0] = '\0';
+	w->valid = false;
+}
+
+void widget_label_set(widget_label_t *w, const char *text)
+{
+	strncpy(w->text, text, WIDGET_TEXT_MAX);
+	w->text[WIDGET_TEXT_MAX] = '\0';
+}
+
+void widget_label_printf(widget_label_t *w, const char *fmt, ...)
+{
+	va_list args;
+
+	va_start(args, fmt);
+	vsnprintf(w->text, sizeof(w->text), fmt, args);
+	va_end(args);
+}
+
+void widget_label_invalidate(widget_label_t *w)
+{
+	w->valid = false;
+}
+
+void widget_label_draw(TFT_t *dev, widget_label_t *w)
+{
+	int32_t cw = LCD_CHAR_W*w->size, ch = LCD_CHAR_H*w->size;
+	int32_t n = strlen(w->text), m = strlen(w->drawn);
+
+	if (!w->valid) m = 0; // nothing on screen to keep
+	for (int32_t i = 0; i < n; i++) {
+		if (i < m && w->text[i] == w->drawn[i]) continue;
+		widget_glyph(dev, w->x+i*cw, w->y, w->size, w->text[i], w->fg, w->bg);
+	}
+	if (m > n) // erase the tail of a longer old text
+		lcdFillRect(dev, w->x+n*cw, w->y, w->x+m*cw-1, w->y+ch-1, w->bg);
+	memcpy(w->drawn, w->text, n+1);
+	w->valid = true;
+}
+
+/* * * * * * * * * * Value * * * * * * * * * */
+
+void widget_value_init(widget_value_t *w, int32_t x, int32_t y, uint8_t size, int32_t width, uint16_t fg, uint16_t bg)
+{
+	widget_label_init(&w->label, x, y, size, fg, bg);
+	w->width = (width > WIDGET_TEXT_MAX) ? WIDGET_TEXT_MAX : width;
+	widget_value_set(w, 0);
+}
+
+void widget_value_set(widget_value_t *w, int32_t value)
+{
+	w->value = value;
+	snprintf(w->label.text, sizeof(w->label.text), "%*ld", (int)w->width, (long)value);
+}
+
+void widget_value_invalidate(widget_value_t *w)
+{
+	widget_label_invalidate(&w->label);
+}
+
+void widget_value_draw(TFT_t *dev, widget_value_t *w)
+{
+	widget_label_draw(dev, &w->label);
+}
+
+/* * * * * * * * * * Bar * * * * * * * * * */
+
+void widget_bar_init(widget_bar_t *w, int32_t x, int32_t y, int32_t width, int32_t height, int32_t max, uint16_t fg, uint16_t bg)
+{
+	w->x = x;
+	w->y = y;
+	w->w = width;
+	w->h = height;
+	w->fg = fg;
+	w->bg = bg;
+	w->max = (max > 0) ? max : 1;
+	w->value = 0;
+	w->drawn = -1;
+}
+
+void widget_bar_set(widget_bar_t *w, int32_t value)
+{
+	w->value = (value < 0) ? 0 : (value > w->max) ? w->max : value;
+}
+
+void widget_bar_invalidate(widget_bar_t *w)
+{
+	w->drawn = -1;
+}
+
+void widget_bar_draw(TFT_t *dev, widget_bar_t *w)
+{
+	int32_t fill = (int64_t)w->value * w->w / w->max;
+	int32_t y2 = w->y+w->h-1;
+
+	if (w->drawn < 0) {
+		if (fill > 0) lcdFillRect(dev, w->x, w->y, w->x+fill-1, y2, w->fg);
+		if (fill < w->w) lcdFillRect(dev, w->x+fill, w->y, w->x+w->w-1, y2, w->bg);
+	} else if (fill > w->drawn) {
+		lcdFillRect(dev, w->x+w->drawn, w->y, w->x+fill-1, y2, w->fg);
+	} else if (fill < w->drawn) {
+		lcdFillRect(dev, w->x+fill, w->y, w->x+w->drawn-1, y2, w->bg);
+	}
+	w->drawn = fill;
+}
+
+/* * * * * * * * * * List * * * * * * * * * */
+
+void widget_list_init(widget_list_t *w, int32_t x, int32_t y, int32_t width, int32_t rows, uint8_t row_h, uint16_t fg, uint16_t bg, uint16_t sel_bg)
+{
+	w->x = x;
+	w->y = y;
+	w->w = width;
+	w->rows = (rows > 0) ? rows : 1;
+	w->row_h = (row_h < LCD_CHAR_H) ? LCD_CHAR_H : row_h;
+	w->fg = fg;
+	w->bg = bg;
+	w->sel_bg = sel_bg;
+	w->items = NULL;
+	w->count = 0;
+	w->sel = 0;
+	w->top = 0;
+	w->drawn_sel = w->drawn_top = -1;
+}
+
+void widget_list_set_items(widget_list_t *w, const char * const *items, int32_t count)
+{
+	w->items = items;
+	w->count = (items == NULL || count < 0) ? 0 : count;
+	w->sel = 0;
+	w->top = 0;
+	w->drawn_sel = w->drawn_top = -1;
+}
+
+// Select an item, scrolling so it is visible.
+void widget_list_select(widget_list_t *w, int32_t sel)
+{
+	if (w->count == 0) return;
+	if (sel < 0) sel = 0;
+	if (sel >= w->count) sel = w->count-1;
+	w->sel = sel;
+	if (sel < w->top) w->top = sel;
+	else if (sel >= w->top + w->rows) w->top = sel - w->rows + 1;
+}
+
+void widget_list_invalidate(widget_list_t *w)
+{
+	w->drawn_sel = w->drawn_top = -1;
+}
+
+// Draw one visible row: text glyphs, then the rest of the row.
+static void widget_list_row(TFT_t *dev, widget_list_t *w, int32_t row)
+{
+	int32_t i = w->top + row;
+	int32_t y = w->y + row*w->row_h;
+	int32_t ty = y + (w->row_h - LCD_CHAR_H)/2;
+	uint16_t bg = (i == w->sel) ? w->sel_bg : w->bg;
+	int32_t x = w->x;
+
+	if (ty > y) lcdFillRect(dev, w->x, y, w->x+w->w-1, ty-1, bg);
+	if (i < w->count) {
+		for (const char *s = w->items[i]; *s && x+LCD_CHAR_W <= w->x+w->w; s++) {
+			widget_glyph(dev, x, ty, 1, *s, w->fg, bg);
+			x += LCD_CHAR_W;
+		}
+	}
+	if (x < w->x+w->w) lcdFillRect(dev, x, ty, w->x+w->w-1, ty+LCD_CHAR_H-1, bg);
+	if (ty+LCD_CHAR_H < y+w->row_h)
+		lcdFillRect(dev, w->x, ty+LCD_CHAR_H, w->x+w->w-1, y+w->row_h-1, bg);
+}
+
+void widget_list_draw(TFT_t *dev, widget_list_t *w)
+{
+	if (w->drawn_top != w->top) { // scrolled or not drawn, repaint all rows
+		for (int32_t row = 0; row < w->rows; row++) widget_list_row(dev, w, row);
+	} else if (w->drawn_sel != w->sel) {
+		widget_list_row(dev, w, w->drawn_sel - w->top);
+		widget_list_row(dev, w, w->sel - w->top);
+	}
+	w->drawn_top = w->top;
+	w->drawn_sel = w->sel;
+}
@@ -0,0 +1,87 @@
+#ifndef WIDGET_H_
+#define WIDGET_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "lcd.h"
+
+// This component is a small retained widget layer on top of the lcd
+// component. Each widget keeps what it last drew. Setting a new value
+// only records it; the draw function compares against the drawn state and
+// redraws just the glyphs or regions that changed. Widget structures are
+// owned by the caller (usually static) and must be initialized before use.
+// Draw functions work in both frame buffer and direct mode. After drawing
+// over a widget by other means, call its invalidate function so the next
+// draw repaints it fully.
+
+#define WIDGET_TEXT_MAX 40 // Maximum characters in a label
+#define WIDGET_FONT_MAX 4 // Maximum font size
+
+// Text label. Only characters that differ from the drawn text are redrawn.
+typedef struct {
+	int32_t x, y;
+	uint8_t size; // font size, 1 to WIDGET_FONT_MAX
+	uint16_t fg, bg;
+	char text[WIDGET_TEXT_MAX+1];
+	char drawn[WIDGET_TEXT_MAX+1];
+	bool valid; // drawn matches the screen
+} widget_label_t;
+
+// Numeric value field, right aligned in a fixed number of characters
+typedef struct {
+	widget_label_t label;
+	int32_t width; // field width in characters
+	int32_t value;
+} widget_value_t;
+
+// Horizontal progress bar. Only the span between the drawn and new fill
+// positions is redrawn.
+typedef struct {
+	int32_t x, y, w, h;
+	uint16_t fg, bg;
+	int32_t max, value;
+	int32_t drawn; // filled width in pixels, -1 if not drawn
+} widget_bar_t;
+
+// Scrolling list of text items with one selected row. Moving the selection
+// redraws only the old and new rows, unless the list scrolls.
+typedef struct {
+	int32_t x, y, w;
+	int32_t rows; // visible rows
+	int32_t row_h; // row height in pixels
+	uint16_t fg, bg, sel_bg;
+	const char * const *items;
+	int32_t count;
+	int32_t sel, top;
+	int32_t drawn_sel, drawn_top; // -1 if not drawn
+} widget_list_t;
+
+// Label
+void widget_label_init(widget_label_t *w, int32_t x, int32_t y, uint8_t size, uint16_t fg, uint16_t bg);
+void widget_label_set(widget_label_t *w, const char *text);
+void widget_label_printf(widget_label_t *w, const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+void widget_label_invalidate(widget_label_t *w);
+void widget_label_draw(TFT_t *dev, widget_label_t *w);
+
+// Value field
+void widget_value_init(widget_value_t *w, int32_t x, int32_t y, uint8_t size, int32_t width, uint16_t fg, uint16_t bg);
+void widget_value_set(widget_value_t *w, int32_t value);
+void widget_value_invalidate(widget_value_t *w);
+void widget_value_draw(TFT_t *dev, widget_value_t *w);
+
+// Progress bar
+void widget_bar_init(widget_bar_t *w, int32_t x, int32_t y, int32_t width, int32_t height, int32_t max, uint16_t fg, uint16_t bg);
+void widget_bar_set(widget_bar_t *w, int32_t value);
+void widget_bar_invalidate(widget_bar_t *w);
+void widget_bar_draw(TFT_t *dev, widget_bar_t *w);
+
+// List
+// items: array of count strings, kept by the caller while the list is used.
+void widget_list_init(widget_list_t *w, int32_t x, int32_t y, int32_t width, int32_t rows, uint8_t row_h, uint16_t fg, uint16_t bg, uint16_t sel_bg);
+void widget_list_set_items(widget_list_t *w, const char * const *items, int32_t count);
+void widget_list_select(widget_list_t *w, int32_t sel);
+void widget_list_invalidate(widget_list_t *w);
+void widget_list_draw(TFT_t *dev, widget_list_t *w);
+
+#endif /* WIDGET_H_ */